@@ -8,6 +8,12 @@
 
 // use the cirque demo code library
 #include <CustomMeas.h>
+#include <MeasFrameQueue.h>
+#include <MeasStream.h>
+#include <MeasStatistics.h>
+#include <MeasFilter.h>
+#include <NoiseScan.h>
+#include <MeasEvents.h>
 #include <Cirque.h>  // if the library is installed from Library Manager you might not need this
 #include <Teensy4_HostBusLayer.h>
 
@@ -22,11 +28,28 @@ HidDescriptor hidDescriptor;
 SystemInfo systemInfo;
 HidReport hidReport;
 //CustomMeas::GlobalInfo_t globalInfo;
+MeasFrameQueue measFrames;  // reports are read into this on DR, and plotted when there is time
+
+// frames go out as text for the Serial Plotter, or as binary packets for MeasStreamReader (see MeasStream.h)
+enum OutputModes { OUTPUT_PLOTTER, OUTPUT_BINARY, OUTPUT_BINARY_COMPRESSED, OUTPUT_EVENTS };
+OutputModes outputMode = OUTPUT_PLOTTER;
+MeasStreamEncoder streamEncoder;
+uint8_t streamPacket[MEAS_STREAM_MAX_PACKET];
+MeasStatistics measStatistics;  // every frame is added, see 'a', 'A' and 'n'
+MeasFilterChain measFilter;  // no stages until 'L', the frames then pass through it first
+int16_t filteredMeas[MEAS_FILTER_CHANNELS];
+NoiseScan noiseScan;  // 'z', while it runs the frames go to the scan instead of the output
+CustomMeas::Config_t scanConfig;
+MeasEventDetector measEvents;  // touch/release per channel, in the 'v' output mode
 
 void processKeys(void);
 void showHelp(void);
 void waitForHidResetResponse(void);
 void identifyDevice(void);
+void beginMeasFrames(void);
+void showStatistics(void);
+void showNoiseScan(void);
+void printEvents(void);
 void plotMeasurements(int16_t * measurements, uint16_t count);
 
 void setup() {
@@ -45,31 +68,56 @@ void setup() {
   waitForHidResetResponse();
   identifyDevice();
 
+  beginMeasFrames();
+
+  // button like events, using the demo group's thresholds
+  measEvents.begin(micros);
+  measEvents.setThresholds(MeasEventDetector::thresholdsFromGroup(MeasConfig.groups[0]));
+
   Serial.println(F("h - help"));
 }
 
-int16_t measurements[MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT];
-
 void loop() {
   // put your main code here, to run repeatedly:
 
   // service DR
   if (HostBus.drAsserted())
   {
-    // DR is signalling a report is ready - read the report
-    uint16_t measCount;
-    if (customMeas.getMeasReport(measurements, measCount) == id_customMeas)
+    // DR is signalling a report is ready - read the report into the queue
+    // other report IDs generally don't happen, they are read and dropped
+    customMeas.queueMeasFrame(measFrames, micros());
+  }
+  else if ((measFrames.front() != 0) && noiseScan.Running)
+  {
+    // the scan changes ToggleFrequency as it goes, nothing is output until it's done
+    const MeasFrame_t * frame = measFrames.front();
+    customMeas.addNoiseScanFrame(noiseScan, scanConfig, frame->meas, frame->measCount);
+    if (!noiseScan.Running) showNoiseScan();
+    measFrames.pop();
+  }
+  else if (measFrames.front() != 0)
+  {
+    // printing is slow, only plot when DR doesn't need service
+    // once measurements are running, you can open the Serial Plotter window.
+    const MeasFrame_t * frame = measFrames.front();
+    uint16_t count = frame->measCount;
+    measFilter.process(frame->meas, filteredMeas, count);
+    measStatistics.add(filteredMeas, count);
+    if (outputMode == OUTPUT_EVENTS)
     {
-      // once measurements are running, you can open the Serial Plotter window.
-      plotMeasurements(measurements, measCount);
+      measEvents.process(filteredMeas, count, frame->sequence, frame->timestamp_us);
+      printEvents();
+    }
+    else if (outputMode == OUTPUT_PLOTTER)
+    {
+      plotMeasurements(filteredMeas, count);
     }
     else
     {
-      // report ID isn't measurements, get the report and display it
-      // generally this pathway doesn't happen
-      // customMeas.getReport(hidReport);
-      // printHidReport(hidReport);
+      uint16_t length = streamEncoder.encode(streamPacket, frame->sequence, frame->timestamp_us, filteredMeas, count);
+      Serial.write(streamPacket, length);
     }
+    measFrames.pop();
   }
 
   // Various characters sent to this app will trigger commands that change the operation of the device
@@ -90,16 +138,16 @@ void processKeys(void)
         Serial.println(F("Write Measurement Configuration\n  Measurements off"));
 
         customMeas.StopMeas();
-        for (int x = 0; x < GROUPINFO_LENGTH; x++)
-        {
-          customMeas.WriteGroupInfo(0, &GroupInfoArray[x]);
-        }
-        for (int x = 0; x < MEASINFO_LENGTH; x++)
         {
-          customMeas.WriteMeasInfo(0, &MeasInfoArray[x]);
+          // only the blocks that differ from the device are written
+          elapsedMicros writeTime = 0;
+          CustomMeas::commandErrors status = customMeas.applyConfig(MeasConfig);
+          uint32_t writeTime_us = writeTime;
+          Serial.printf("  Groups and Measurements written: %d blocks changed in %lu us, status %d\n", 
+            customMeas.ConfigBlocksWritten, writeTime_us, (int)status);
         }
-
-        Serial.println(F("  Groups and Measurements written"));
+        customMeas.beginMeasStream(MeasByteCount);  // the frame length is known from the configuration
+        beginMeasFrames();
         break;
       case 'm':
         Serial.println(F("Measurements Off"));
@@ -115,7 +163,13 @@ void processKeys(void)
         break;
       case 'C' :
         Serial.println(F("Calibrate All Groups"));
-        customMeas.CalibrateAll();
+        {
+          // the groups are read together (or come from the cache) and the writes go out back to back
+          elapsedMicros calibrateTime = 0;
+          customMeas.CalibrateAll();
+          uint32_t calibrateTime_us = calibrateTime;
+          Serial.printf("  %d groups written in %lu us\n", customMeas.ConfigBlocksWritten, calibrateTime_us);
+        }
         break;
       case 'e' :
         Serial.println(F("Enable Calibration Group 0"));
@@ -143,6 +197,76 @@ void processKeys(void)
         // this loads everything. The Enable bit is then set to be POR_Enable
         customMeas.Restore();
         break;
+      case 'f' :
+        Serial.printf("Frames queued: %lu  overruns: %lu  missed: %lu  waiting: %d\n",
+          measFrames.FramesQueued, measFrames.Overruns, measFrames.MissedFrames, measFrames.count());
+        break;
+      case 'p' :
+        Serial.println(F("Text output for the Serial Plotter"));
+        outputMode = OUTPUT_PLOTTER;
+        break;
+      case 'b' :
+        // the binary stream has no text in it from here on, until 'p'
+        Serial.println(F("Binary output"));
+        streamEncoder.begin(false);
+        outputMode = OUTPUT_BINARY;
+        break;
+      case 'B' :
+        Serial.println(F("Binary output, compressed"));
+        streamEncoder.begin(true);
+        outputMode = OUTPUT_BINARY_COMPRESSED;
+        break;
+      case 'a' :
+        Serial.println(F("Statistics cleared"));
+        measStatistics.reset();
+        break;
+      case 'A' :
+        showStatistics();
+        break;
+      case 'n' :
+        Serial.printf("No-touch reference saved from %lu frames, statistics cleared\n", measStatistics.Frames);
+        measStatistics.captureReference();
+        measStatistics.reset();
+        break;
+      case 'l' :
+        Serial.println(F("Filters off"));
+        measFilter.clear();
+        break;
+      case 'L' :
+        // the median removes single frame spikes before the low pass can smear them out
+        Serial.println(F("Filters on: median of 3 frames, then low pass 1/4"));
+        measFilter.clear();
+        measFilter.addMedian(3);
+        measFilter.addLowPass(2);
+        break;
+      case 'v' :
+        Serial.println(F("Touch and release events"));
+        measEvents.reset();  // new baselines from the next frame
+        outputMode = OUTPUT_EVENTS;
+        break;
+      case 'V' :
+        if (measEvents.Frames > 0)
+        {
+          Serial.printf("Frame read to events processed, over %lu frames: min %lu us  mean %lu us  max %lu us  dropped events: %lu\n",
+            measEvents.Frames, measEvents.LatencyMin_us, measEvents.latencyMean_us(), measEvents.LatencyMax_us, 
+            measEvents.EventsDropped);
+        }
+        measEvents.resetLatency();
+        break;
+      case 'z' :
+        // the demo measurements use 19, scan either side of it
+        Serial.println(F("Noise scan, ToggleFrequency 11 to 27. Don't touch the sensor..."));
+        scanConfig = MeasConfig;
+        noiseScan.begin(11, 27, 2, 64, 4);
+        noiseScan.setSpectrumChannel(0);
+        if (customMeas.beginNoiseScan(noiseScan, scanConfig) != CustomMeas::cmd_okay)
+        {
+          Serial.println(F("  Couldn't write the measurement configuration"));
+        }
+        break;
+      case 'Z' :
+        showNoiseScan();
+        break;
       default:
       break;
       // todo:
@@ -162,6 +286,12 @@ void showHelp(void)
   Serial.println(F("e - enable calibration group 0, E - enable calibration all groups"));
   Serial.println(F("d - disable calibration group 0, D - disable calibration all groups"));
   Serial.println(F("s - save configuration to flash, S - restore configuration from flash"));
+  Serial.println(F("p - text output for the Serial Plotter, b - binary output, B - binary output compressed"));
+  Serial.println(F("v - print touch/release events instead, V - show and clear the event latency"));
+  Serial.println(F("a - clear statistics, A - show statistics, n - save statistics as the no-touch reference (for SNR)"));
+  Serial.println(F("l - filters off, L - filters on (median of 3, then low pass)"));
+  Serial.println(F("z - noise scan, applies the quietest ToggleFrequency, Z - show the scan results"));
+  Serial.println(F("f - frame queue counters (overruns = plotting too slow, missed = DR serviced too late)"));
 }
 
 void waitForHidResetResponse(void)
@@ -206,6 +336,17 @@ void identifyDevice(void)
   // hidDescriptor.BCD
 }
 
+// the queue compares the time between frames with FrameMillis to spot missed frames. The demo
+// doesn't write FrameMillis, it's whatever the device has.
+void beginMeasFrames(void)
+{
+  CustomMeas::GlobalInfo_t globalInfo;
+  if (customMeas.ReadGlobalInfo(&globalInfo) == CustomMeas::cmd_okay)
+  {
+    measFrames.begin(globalInfo.FrameMillisLSB | (globalInfo.FrameMillisMSB << 8));
+  }
+}
+
 void plotMeasurements(int16_t * measurements, uint16_t count)
 {
   // write the measurements as a row of text. The Plotter feature of the IDE can be used to graph them.
@@ -217,3 +358,60 @@ void plotMeasurements(int16_t * measurements, uint16_t count)
   Serial.println();
 }
 
+void showStatistics(void)
+{
+  MeasChannelStats_t stats;
+  Serial.printf("Statistics over %lu frames\n", measStatistics.Frames);
+  for (uint8_t m = 0; m < measStatistics.Measurements; m++)
+  {
+    measStatistics.measurementSnapshot(m, stats);
+    Serial.printf("Measurement %d  mean: %.1f  sd: %.2f  p-p: %lu  SNR: %.1f\n", m, stats.mean, 
+      stats.standardDeviation, stats.peakToPeak, stats.snr);
+  }
+  for (uint16_t x = 0; x < measStatistics.Channels; x++)
+  {
+    measStatistics.channelSnapshot(x, stats);
+    Serial.printf("  %3d  mean: %.1f  sd: %.2f  min: %ld  max: %ld  p-p: %lu  SNR: %.1f\n", x, stats.mean, 
+      stats.standardDeviation, stats.min, stats.max, stats.peakToPeak, stats.snr);
+  }
+}
+
+void showNoiseScan(void)
+{
+  uint8_t best = noiseScan.recommended();
+  if (best == NOISE_SCAN_NONE)
+  {
+    Serial.println(F("No noise scan results"));
+    return;
+  }
+  for (uint8_t x = 0; x < noiseScan.Settings; x++)
+  {
+    const NoiseScanResult_t & result = noiseScan.result(x);
+    Serial.printf("ToggleFrequency %2d  noise power mean: %.2f  max: %.2f (channel %d)%s\n", result.toggleFrequency, 
+      result.meanPower, result.maxPower, result.worstChannel, (x == best) ? "  <-- quietest" : "");
+  }
+
+  // the channel 0 spectrum, from DC to half the frame rate
+  const uint32_t * power = noiseScan.spectrum(best);
+  if (power != 0)
+  {
+    Serial.print(F("Channel 0 spectrum at the quietest setting (1/256 counts^2):"));
+    for (uint16_t k = 0; k < NOISE_SCAN_SPECTRUM_BINS; k++)
+    {
+      Serial.print(F(" "));
+      Serial.print(power[k]);
+    }
+    Serial.println();
+  }
+}
+
+void printEvents(void)
+{
+  static const char * const names[] = { "touch", "release", "timeout", "negative" };
+  MeasEvent_t event;
+  while (measEvents.getEvent(event))
+  {
+    Serial.printf("%lu  channel %d  %s  signal %d  latency %d us\n", event.sequence, event.channel, 
+      names[event.type & 3], event.signal, event.latency_us);
+  }
+}
@@ -1,57 +1,34 @@
 // Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
 
 #include "Measurements.h"
+#include "CustomMeasConfig.h"
 
-CustomMeas::GroupInfo_t GroupInfoArray[GROUPINFO_LENGTH] =
-{
-	1, // .Mode = Self_V2V
-	0x81, // .Calibration = Background
-	0xEE, // .FrameBetweenCompsLSB --> 750
-	0x2, // .FrameBetweenCompsMSB
-	0xB5, // .NegativeThresholdLSB --> -75
-	0xFF, // .NegativeThresholdMSB
-	0x2C, // .SpeedThresholdLSB = 300
-	0x1,  // .SpeedThresholdMSB = 
-	0x58, // .ActivityThresholdLSB = 600
-	0x2, // .ActivityThresholdMSB = 
-	0x96, // .ActivityTimeoutLSB = 150
-	0x0, // .ActivityTimeoutMSB = 
-};
+typedef CustomMeasConfigBuilder Build;
 
-CustomMeas::MeasInfo_t MeasInfoArray[MEASINFO_LENGTH] =
+// one group, two measurements: electrodes 0..15, then electrodes 16..31
+constexpr CustomMeasConfig<1, 2> demoMeasurements =
 {
-	{ // Measurement 0
-		0x80, // .Control
-		{
-			0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-			0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-			0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-		}, // .ElectrodeStates
-		3, // .Gain
-		0x1F, // .GlobalOffset = 31
-		0, // .ChannelOffsetMultiplier
-		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, }, // .ChannelOffsets
-		19, // .ToggleFrequency
-		39, // .ApertureLength
-		0,  // .Waveform
-		0xFF, // .ADCChannelMaskLSB
-		0xFF, // .ADCChannelMaskMSB
+	Build::global(10, false), // not written, applyConfig only writes the groups and measurements
+	{
+		Build::group(Build::MODE_SELF_V2V, Build::CALIBRATION_BACKGROUND,
+			750, // frames between comps
+			-75, // negative threshold
+			300, // speed threshold
+			600, // activity threshold
+			150), // activity timeout
 	},
-	{ // Measurement 1
-		0x80, // .Control
-		{
-			0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-			0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-			0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-		}, // .ElectrodeStates
-		3, // .Gain
-		0x1F, // .GlobalOffset = 31
-		0, // .ChannelOffsetMultiplier
-		{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, }, // .ChannelOffsets
-		19, // .ToggleFrequency
-		39, // .ApertureLength
-		0,  // .Waveform
-		0xFF, // .ADCChannelMaskLSB
-		0xFF, // .ADCChannelMaskMSB
+	{
+		// electrodes, gain, global offset, toggle frequency, aperture length
+		Build::measurement(0x00000000FFFFULL, 3, 31, 19, 39),
+		Build::measurement(0x0000FFFF0000ULL, 3, 31, 19, 39),
 	},
-};
\ No newline at end of file
+};
+
+constexpr CustomMeas::Config_t MeasConfig = demoMeasurements.toConfig();
+constexpr uint16_t MeasByteCount = demoMeasurements.measByteCount();
+
+// these match the bytes TouchTools generated for this setup
+static_assert(MeasConfig.groups[0].FrameBetweenCompsLSB == 0xEE, "750 --> 0xEE, 0x02");
+static_assert(MeasConfig.groups[0].NegativeThresholdMSB == 0xFF, "-75 --> 0xB5, 0xFF");
+static_assert(MeasConfig.meas[1].ElectrodeStates[8] == 0x77, "measurement 1 senses electrodes 16..31");
+static_assert(MeasByteCount == 2 * 2 * MAX_READINGS_PER_MEASUREMENT, "two measurements of 16 readings");
@@ -5,11 +5,8 @@
 
 #include "CustomMeas.h"
 
-#define GROUPINFO_LENGTH (1)
-#define MEASINFO_LENGTH (2)
-
-// It'd be nice to have this be in some other file set. Measurements.h, Measurements.c
-extern CustomMeas::GroupInfo_t GroupInfoArray[GROUPINFO_LENGTH];
-extern CustomMeas::MeasInfo_t MeasInfoArray[MEASINFO_LENGTH];
+// built at compile time in Measurements.cpp, ready for CustomMeas::applyConfig()
+extern const CustomMeas::Config_t MeasConfig;
+extern const uint16_t MeasByteCount;  // readings in each report, in bytes
 
 #endif // MEASUREMENTS_H
@@ -11,6 +11,7 @@
 
 // use the cirque demo code library
 #include <CirqueHid.h>
+#include <WakeLatency.h>
 #include <DataUtils.h>
 #include <Cirque.h> // if the library is installed from Library Manager you might not need this
 #include <Teensy4_HostBusLayer.h>
@@ -25,17 +26,48 @@ CirqueHid cirqueHid(0x2C, 535); // Address 0x2C, make sure the buffer is at leas
 // Create a few helper objects that cirqueHid will need
 HidDescriptor hidDescriptor;
 HidReport hidReport;
+SystemInfo systemInfo;
+XYConfig xyConfig;
+PowerConfig powerConfig;
+FeedConfig feedConfig;
+QmvImageStore qmvImages;  // double buffered sensor images, when QMV streaming is on
+CompDrift compDrift;
+
+// compensation matrix snapshots, the baseline is captured with 'C' and compared with 'c'
+#define COMP_MAX_BYTES (2 * QMV_MAX_IMAGE_PIXELS)
+int16_t compBaseline[COMP_MAX_BYTES / 2];
+int16_t compCurrent[COMP_MAX_BYTES / 2];
+uint16_t compBaselineBytes = 0;
+#define COMP_OUTLIER_THRESHOLD 50
+
+// wake latency benchmark, touch-to-first-DR in each power state
+// The benchmark needs a touch stimulus (tapper, or a switch closed by the finger) wired to 
+// TOUCH_TRIGGER_PIN, active low. Timing from DR alone would leave out the wait for the next 
+// scan (up to TimeInIdle or TimeInSleep), which is the part the power states change.
+// Both edges are timestamped in interrupts.
+// #define TOUCH_TRIGGER_PIN 2
+WakeLatency wakeLatency;
+PowerSettings_t powerSettings;  // what the device is running, used to work out the power state
+bool benchmarkLatency = false;
+bool forcedSleep = false;
+elapsedMillis quietTimer;       // time since the last report
+volatile uint32_t touchTimestamp_us = 0;
+volatile bool touchTriggered = false;
+volatile uint32_t drTimestamp_us = 0;
 
 // PTP can send multiple fingers per report, and multiple reports per sensor image snapshot (frame)
 // This is the data needed to organize those reports into the status of each finger
 #define TOTAL_FINGERS 5
 PtpFingerData_t fingerData[TOTAL_FINGERS]; // holds the PTP report data, organized by Finger ID (0..4)
 bool fingerDataReady[TOTAL_FINGERS];  // a flag that helps track the data as it's being organized
-bool readingTwoReports = false;  // typically, all the finger data can span 2 PTP reports, this variable helps track that state
+uint8_t frameContacts = 0;     // total contacts in the frame, from the first PTP report of the frame
+uint8_t receivedContacts = 0;  // contacts received so far, the frame is complete when this reaches frameContacts
 
 // state data for the command loop (using key presses)
 bool enableContactReports = true;
 bool enableButtonReports = true;
+bool qmvStreaming = false;
+elapsedMillis qmvStatusTimer;
 
 void setup() {
   // put your setup code here, to run once:
@@ -65,22 +97,76 @@ void setup() {
     fingerData[x].tip = 0;
     fingerData[x].x = 0;
     fingerData[x].y = 0;
+    fingerData[x].pressure = 0;
 
     fingerDataReady[x] = false;
   }
 
+#ifdef TOUCH_TRIGGER_PIN
+  pinMode(TOUCH_TRIGGER_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(TOUCH_TRIGGER_PIN), touchTriggerIsr, FALLING);
+  attachInterrupt(digitalPinToInterrupt(DR_IO9), drIsr, FALLING);  // DR is active low
+#endif
+
   Serial.println(F("h - help"));
 }
 
 void loop() {
   // put your main code here, to run repeatedly:
 
+  // a touch from the trigger, the power state is worked out from the quiet time before it
+  if (touchTriggered)
+  {
+    touchTriggered = false;
+    if (benchmarkLatency)
+    {
+      wakeLatency.touch(touchTimestamp_us, WakeLatency::stateAfterQuiet(quietTimer, powerSettings, forcedSleep));
+    }
+  }
+
   // service DR
   if (HostBus.drAsserted())
   {
     // DR is signaling a report is ready - read the report
-    cirqueHid.getReport(hidReport);
-    printHidReport(hidReport);
+    if (benchmarkLatency)
+    {
+      // DR stays asserted until the report is read, so drTimestamp_us is this report's edge
+      if (wakeLatency.dataReady(drTimestamp_us))
+      {
+        showWakeLatency();
+      }
+      cirqueHid.getReport(hidReport);
+      forcedSleep = false;  // a touch wakes the device
+    }
+    else if (qmvStreaming)
+    {
+      // images are assembled into qmvImages, other reports still come out in hidReport
+      reportIds_t id = cirqueHid.getQMVReport(qmvImages, micros(), hidReport);
+      if ((id != QMV_REPORT_ID) && (id != id_unknown))
+      {
+        printHidReport(hidReport);
+      }
+    }
+    else
+    {
+      cirqueHid.getReport(hidReport);
+      printHidReport(hidReport);
+    }
+    quietTimer = 0;
+  }
+
+  if (qmvStreaming && (qmvStatusTimer > 1000))
+  {
+    // once a second show how the stream is doing, and the middle pixel of the newest image
+    qmvStatusTimer = 0;
+    if (qmvImages.imageAvailable())
+    {
+      qmvImages.image();
+    }
+    Serial.printf("QMV  frame: %d  fps: %d.%d  received: %d  dropped: %d  unread: %d  center: %d\n", 
+      qmvImages.FrameNumber, qmvImages.FrameRate_x10 / 10, qmvImages.FrameRate_x10 % 10,
+      qmvImages.FramesReceived, qmvImages.DroppedFrames, qmvImages.UnreadFrames,
+      qmvImages.pixel(qmvImages.SizeX / 2, qmvImages.SizeY / 2));
   }
 
   // Various "key presses" will trigger commands that change the operation of the device
@@ -169,17 +255,75 @@ void processKeys(void)
         readModifyWriteRegister(0x20080018, 4, 0);
         break;
       case 'i':
+        Serial.println(F("Cancel Force-Sleep"));
+        cirqueHid.forceSleep(false);
+        forcedSleep = false;
+        break;
+      case 'I':
+        Serial.println(F("Force-Sleep"));
+        cirqueHid.forceSleep(true);
+        forcedSleep = true;
+        break;
+      case '1':
+        setPowerProfile(CirqueHid::POWER_LOWEST_LATENCY, "lowest latency");
+        break;
+      case '2':
+        setPowerProfile(CirqueHid::POWER_BALANCED, "balanced");
+        break;
+      case '3':
+        setPowerProfile(CirqueHid::POWER_BATTERY, "battery");
+        break;
+      case 'l':
+        benchmarkLatency = false;
+        Serial.println(F("Stop wake latency benchmark"));
+        showWakeLatency();
+        break;
+      case 'L':
+#ifdef TOUCH_TRIGGER_PIN
+        Serial.println(F("Wake latency benchmark, tap the pad. Wait longer between taps to measure idle and sleep."));
+        wakeLatency.reset();
+        benchmarkLatency = true;
+#else
+        Serial.println(F("Wake latency benchmark needs a touch trigger, see TOUCH_TRIGGER_PIN"));
+#endif
+        break;
+      case 'q':
+        Serial.println(F("Stop QMV image stream"));
+        cirqueHid.setQMVStream(CirqueHid::QMV_POSTCOMP, CirqueHid::QMVCHANNEL_OFF);
+        qmvStreaming = false;
+        break;
+      case 'Q':
         {
-          uint8_t registerValue = 2;
-          Serial.println(F("Cancel Force-Sleep"));
-          cirqueHid.writeExtendedMemory(0x200a0408, &registerValue , 1);
+          uint8_t sizeX, sizeY;
+          cirqueHid.sensorSize(sizeX, sizeY);
+          Serial.printf("Start QMV image stream (post comp), sensor %d x %d\n", sizeX, sizeY);
+          if (qmvImages.begin(sizeX, sizeY, CirqueHid::QMV_POSTCOMP, cirqueHid.endianState() != 0))
+          {
+            qmvStreaming = cirqueHid.setQMVStream(CirqueHid::QMV_POSTCOMP, CirqueHid::QMVCHANNEL_I2C);
+            qmvStatusTimer = 0;
+          }
         }
         break;
-      case 'I':
+      case 'C':
+        compBaselineBytes = readCompSnapshot(compBaseline);
+        if (compBaselineBytes > 0)
         {
-          uint8_t registerValue = 1;
-          Serial.println(F("Force-Sleep"));
-          cirqueHid.writeExtendedMemory(0x200a0408, &registerValue , 1);
+          Serial.printf("Comp baseline saved, %d pixels\n", compBaselineBytes / 2);
+        }
+        break;
+      case 'c':
+        if (compBaselineBytes == 0)
+        {
+          Serial.println(F("No comp baseline, press 'C' first"));
+        }
+        else if (readCompSnapshot(compCurrent) == compBaselineBytes)
+        {
+          uint8_t sizeX, sizeY;
+          cirqueHid.sensorSize(sizeX, sizeY);
+          compDrift.analyze(compCurrent, compBaseline, compBaselineBytes / 2, COMP_OUTLIER_THRESHOLD);
+          Serial.printf("Comp drift  min: %d  max: %d  mean: %d  outliers: %d  worst: (%d, %d)\n",
+            compDrift.MinDrift, compDrift.MaxDrift, compDrift.MeanDrift, compDrift.Outliers,
+            (sizeX > 0) ? compDrift.WorstPixel % sizeX : 0, (sizeX > 0) ? compDrift.WorstPixel / sizeX : 0);
         }
         break;
       case '$' :
@@ -193,6 +337,55 @@ void processKeys(void)
   }
 }
 
+void setPowerProfile(CirqueHid::PowerProfiles profile, const char * name)
+{
+  bool okay = cirqueHid.setPowerProfile(profile);
+  powerSettings = CirqueHid::powerProfileSettings(profile);
+  Serial.printf("Power profile %s: %s\n", name, okay ? "okay" : "failed");
+}
+
+void showWakeLatency(void)
+{
+  const char * stateNames[WakeLatency::STATE_COUNT] = { "active", "idle", "sleep" };
+  for (uint8_t x = 0; x < WakeLatency::STATE_COUNT; x++)
+  {
+    WakeLatency::PowerStates state = (WakeLatency::PowerStates)x;
+    Serial.printf("%-6s  touches: %d  min: %lu us  max: %lu us  mean: %lu us\n", stateNames[x], 
+      wakeLatency.samples(state), wakeLatency.min_us(state), wakeLatency.max_us(state), wakeLatency.mean_us(state));
+  }
+}
+
+#ifdef TOUCH_TRIGGER_PIN
+void touchTriggerIsr(void)
+{
+  touchTimestamp_us = micros();
+  touchTriggered = true;
+}
+
+void drIsr(void)
+{
+  drTimestamp_us = micros();
+}
+#endif
+
+// returns the number of bytes read, 0 if the comp matrix couldn't be read
+uint16_t readCompSnapshot(int16_t * compMatrix)
+{
+  uint16_t compBytes = cirqueHid.compByteLength();
+  if ((compBytes == 0) || (compBytes > COMP_MAX_BYTES))
+  {
+    Serial.printf("Comp matrix length %d not supported\n", compBytes);
+    return 0;
+  }
+  I2cHidApi::commandErrors status = cirqueHid.readComp(compMatrix, compBytes);
+  if (status != I2cHidApi::cmd_okay)
+  {
+    Serial.printf("Comp read failed: %d\n", (int)status);
+    return 0;
+  }
+  return compBytes;
+}
+
 void showHelp(void)
 {
   Serial.println(F("Commands"));
@@ -204,8 +397,12 @@ void showHelp(void)
   Serial.println(F("  y - don't invert y-axis, Y - invert y-axis"));
   Serial.println(F("  s - unswap x-y, S - swap x-y"));
   Serial.println(F("  i - cancel 'force sleep', I - 'force sleep'"));
+  Serial.println(F("  1 - lowest latency power profile, 2 - balanced, 3 - battery"));
+  Serial.println(F("  l - stop wake latency benchmark, L - start wake latency benchmark"));
   Serial.println(F("  w - warm boot"));
   Serial.println(F("  g - get device capabilities"));
+  Serial.println(F("  q - stop QMV image stream, Q - stream QMV images (post comp)"));
+  Serial.println(F("  c - compare comp to the baseline, C - save the comp baseline"));
   Serial.println(F("  $ - physical power off, then on"));
 }
 
@@ -277,6 +474,17 @@ void identifyDevice(void)
     hidDescriptor.wCommandRegister, hidDescriptor.wDataRegister);
 
   // hidDescriptor.BCD
+
+  // the whole system info block is a single read
+  if (cirqueHid.readSystemInfo(systemInfo) == I2cHidApi::cmd_okay)
+  {
+    Serial.printf("HW ID : 0x%02x  FW ID : 0x%02x  FW Revision : 0x%08x\n", 
+      systemInfo.HardwareID, systemInfo.FirmwareID, systemInfo.FirmwareRevision);
+  }
+  else
+  {
+    Serial.println("System info read failed");
+  }
 }
 
 void printHidReport(HidReport & report)
@@ -284,17 +492,16 @@ void printHidReport(HidReport & report)
   switch (report.reportId)
   {
     case id_ptpReport :
-      if (report.report.ptp.numberFingers > MAX_PTP_FINGER_COUNT)
+      // The fingers of one frame can span several PTP reports (Pressure reports are always 
+      // one finger per report). The first report of a frame has the total contacts, the rest have 0.
+      if (report.report.ptp.contactCount != 0)
       {
-        // it will take reading two reports to get all the data
-        readingTwoReports = true;
-      }
-      else if (readingTwoReports)
-      {
-        readingTwoReports = false;
+        frameContacts = report.report.ptp.contactCount;
+        receivedContacts = 0;
       }
+      receivedContacts += report.report.ptp.numberFingers;
       // organize data
-      for (int x = 0; x < MAX_PTP_FINGER_COUNT; x++)
+      for (int x = 0; x < report.report.ptp.numberFingers; x++)
       {
         PtpFingerData_t * finger = &report.report.ptp.fingers[x];
         int index = finger->contactID;
@@ -304,19 +511,24 @@ void printHidReport(HidReport & report)
           fingerData[index].tip = finger->tip;
           fingerData[index].x = finger->x;
           fingerData[index].y = finger->y;
+          fingerData[index].pressure = finger->pressure;
 
           fingerDataReady[index] = true;
         }
       }
-      if (!readingTwoReports)
+      if (receivedContacts >= frameContacts)
       {
         // display data
-        Serial.printf("PTP  T: %d  C: %d  B: %d  ", report.report.ptp.timeStamp, report.report.ptp.contactCount, report.report.ptp.buttons);
+        Serial.printf("PTP  T: %d  C: %d  B: %d  ", report.report.ptp.timeStamp, frameContacts, report.report.ptp.buttons);
         for (int x = 0; x < TOTAL_FINGERS; x++)
         {
           Serial.printf("F%d  X:%4d  Y:%4d  Conf: %d  Tip: %d  ", 
             fingerData[x].contactID, fingerData[x].x, fingerData[x].y, 
             fingerData[x].confidence, fingerData[x].tip);
+          if (report.report.ptp.hasPressure)
+          {
+            Serial.printf("P:%4d  ", fingerData[x].pressure);
+          }
 
           fingerDataReady[x] = false;
         }
@@ -331,6 +543,31 @@ void printHidReport(HidReport & report)
     break;
     case id_keyReport : 
     break;
+    case id_crqAlpsReport :
+      if (report.length == HidReport::alpsAbsoluteLength)
+      {
+        Serial.printf("Alps  Flags: 0x%02x  B: %d  ", report.report.alpsAbs.contactFlags, report.report.alpsAbs.buttons);
+        for (int x = 0; x < MAX_CRQ_ALPS_FINGER_COUNT; x++)
+        {
+          Serial.printf("F%d  X:%4d  Y:%4d  Z:%3d  ", x, report.report.alpsAbs.fingers[x].x, 
+            report.report.alpsAbs.fingers[x].y, report.report.alpsAbs.fingers[x].z);
+        }
+      }
+      else
+      {
+        Serial.printf("CRQ  Flags: 0x%02x  B: %d  ", report.report.abs.contactFlags, report.report.abs.buttons);
+        for (int x = 0; x < MAX_CRQ_ALPS_FINGER_COUNT; x++)
+        {
+          Serial.printf("F%d  X:%4d  Y:%4d  ", x, report.report.abs.fingers[x].x, report.report.abs.fingers[x].y);
+        }
+      }
+      Serial.println();
+    break;
+    case id_alpsStickReport :
+      Serial.printf("Stick  X: %4d  Y: %4d  Z: %4d  Btn : %2d\n", 
+        report.report.stick.X, report.report.stick.Y, 
+        report.report.stick.Z, report.report.stick.buttons);
+    break;
     default :
     break;
   }
@@ -339,10 +576,29 @@ void printHidReport(HidReport & report)
 void readDefaults(void)
 {
   // read any registers that you want to peek at the default values...
+  // each config block (header and registers) is a single read
   uint8_t registerValue;
 
-  cirqueHid.readExtendedMemory(0x20080018, &registerValue, 1);
-  Serial.printf("XY Config (0x20080018): 0x%02x\n", registerValue);
+  if ((cirqueHid.readXYConfig(xyConfig) == I2cHidApi::cmd_okay) && xyConfig.IsImplemented)
+  {
+    Serial.printf("XY Config (0x20080018): 0x%02x\n", xyConfig.Flags);
+  }
+
+  if ((cirqueHid.readPowerConfig(powerConfig) == I2cHidApi::cmd_okay) && powerConfig.IsImplemented)
+  {
+    Serial.printf("Power Settings (0x200A0010): 0x%02x  Idle after %d x100ms, every %d x100us  Sleep after %d x100ms, every %d x100us\n", 
+      powerConfig.Settings, powerConfig.TimeBeforeIdle, powerConfig.TimeInIdle, 
+      powerConfig.TimeBeforeSleep, powerConfig.TimeInSleep);
+    // decoded in the device's byte order, the same as writePowerSettings encodes them
+    powerSettings = { powerConfig.TimeBeforeIdle, powerConfig.TimeInIdle, 
+      powerConfig.TimeBeforeSleep, powerConfig.TimeInSleep, powerConfig.Settings };
+  }
+
+  if ((cirqueHid.readFeedConfig(feedConfig) == I2cHidApi::cmd_okay) && feedConfig.IsImplemented)
+  {
+    Serial.printf("Feed Config (0x200E0008): 0x%02x 0x%02x 0x%02x 0x%02x\n", 
+      feedConfig.Config1, feedConfig.Config2, feedConfig.Config3, feedConfig.Config4);
+  }
 
   cirqueHid.readExtendedMemory(0x200a0408, &registerValue, 1);
   Serial.printf("Power Control (0x200A0408): 0x%02x\n", registerValue);
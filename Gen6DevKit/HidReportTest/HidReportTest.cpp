@@ -0,0 +1,259 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// PC side test for HidReport (libraries/Cirque/HidReport.h). Decodes byte-exact packets of each
+// fixed size report (PTP, PTP Pressure, Cirque and Alps Absolute, stick) and checks every field,
+// then checks that report ids 9 and 15 with other lengths are refused and leave nothing behind.
+//
+// Build (any C++11 compiler):
+//   g++ -O2 -I../../libraries/Cirque HidReportTest.cpp ../../libraries/Cirque/HidReport.cpp -o HidReportTest
+//
+// Usage:
+//   HidReportTest
+//     prints each check that fails, exits with 0 if none did
+
+#include <stdio.h>
+#include <string.h>
+#include "HidReport.h"
+
+static int checks = 0;
+static int failures = 0;
+
+static void check(const char * packet, const char * field, long actual, long expected)
+{
+	checks++;
+	if (actual != expected)
+	{
+		printf("FAILED %s: %s is %ld (0x%lX), expected %ld (0x%lX)\n", packet, field, actual, (unsigned long)actual,
+			expected, (unsigned long)expected);
+		failures++;
+	}
+}
+
+#define CHECK(packet, field, expected) check(packet, #field, (long)(field), (long)(expected))
+
+// every byte of the union is 0, as it is after a report that was refused
+static bool reportCleared(const HidReport & hidReport)
+{
+	const uint8_t * bytes = (const uint8_t *)&hidReport.report;
+	for (size_t i = 0; i < sizeof(hidReport.report); i++)
+	{
+		if (bytes[i] != 0) return false;
+	}
+	return true;
+}
+
+// PTP, two fingers (17 bytes)
+static const uint8_t ptpPacket[] =
+{
+	0x11, 0x00, 0x01,
+	0x0B, 0x34, 0x02, 0x56, 0x01,       // contact 2, tip, confidence, x 0x0234, y 0x0156
+	0x12, 0x78, 0x04, 0x9A, 0x03,       // contact 4, tip, no confidence, x 0x0478, y 0x039A
+	0xEF, 0xBE,                         // time stamp 0xBEEF
+	0x02, 0x01,                         // 2 contacts, left button
+};
+
+// PTP Pressure (14 bytes)
+static const uint8_t ptpPressurePacket[] =
+{
+	0x0E, 0x00, 0x01,
+	0x17, 0x34, 0x12, 0x78, 0x06,       // contact 5, tip, confidence, x 0x1234, y 0x0678
+	0x21, 0x03,                         // pressure area 0x0321
+	0x10, 0x27,                         // time stamp 10000
+	0x03, 0x00,                         // 3 contacts (first report of the frame), no buttons
+};
+
+// Cirque Absolute (30 bytes): y, x, palm per finger
+static const uint8_t crqAbsolutePacket[] =
+{
+	0x1E, 0x00, 0x09,
+	0x00, 0x01, 0x00, 0x02, 0x80,       // finger 0: y 0x0100, x 0x0200, palm 0x80
+	0x01, 0x01, 0x11, 0x02, 0x81,
+	0x02, 0x01, 0x22, 0x02, 0x82,
+	0x03, 0x01, 0x33, 0x02, 0x83,
+	0x04, 0x01, 0x44, 0x02, 0x84,       // finger 4: y 0x0104, x 0x0244, palm 0x84
+	0x1F, 0x02,                         // all five down, right button
+};
+
+// Alps Absolute (35 bytes): x, y, palm, z per finger
+static const uint8_t alpsAbsolutePacket[] =
+{
+	0x23, 0x00, 0x09,
+	0x10, 0x0A, 0x20, 0x05, 0x01, 0x30, // finger 0: x 0x0A10, y 0x0520, palm 0x01, z 0x30
+	0x11, 0x0A, 0x21, 0x05, 0x02, 0x31,
+	0x12, 0x0A, 0x22, 0x05, 0x03, 0x32,
+	0x13, 0x0A, 0x23, 0x05, 0x04, 0x33,
+	0x14, 0x0A, 0x24, 0x05, 0x05, 0x34, // finger 4: x 0x0A14, y 0x0524, palm 0x05, z 0x34
+	0x03, 0x04,                         // fingers 0 and 1 down, middle button
+};
+
+// stick (10 bytes)
+static const uint8_t stickPacket[] =
+{
+	0x0A, 0x00, 0x0F,
+	0x05,                               // left and middle buttons
+	0x34, 0x12, 0xDC, 0xFE, 0x42, 0x00, // X 0x1234, Y 0xFEDC, Z 0x0042
+};
+
+// report id 9 that's neither absolute report, and id 15 of another length (SpiderMeas)
+static const uint8_t badAbsolutePacket[] =
+{
+	0x20, 0x00, 0x09,
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+	0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+};
+static const uint8_t badStickPacket[] =
+{
+	0x0C, 0x00, 0x0F,
+	0x05, 0x34, 0x12, 0xDC, 0xFE, 0x42, 0x00, 0x01, 0x02,
+};
+
+static bool decode(HidReport & hidReport, const uint8_t * packet, uint16_t length)
+{
+	uint8_t buffer[64];
+	// the packet is read into a buffer that's longer than it, with stale bytes after it
+	memset(buffer, 0xA5, sizeof(buffer));
+	memcpy(buffer, packet, length);
+	return hidReport.decodeReport(buffer);
+}
+
+static void testPtp(void)
+{
+	const char * name = "PTP";
+	HidReport hidReport;
+	CHECK(name, decode(hidReport, ptpPacket, sizeof(ptpPacket)), true);
+	const PtpReport_t & ptp = hidReport.report.ptp;
+	CHECK(name, hidReport.length, 17);
+	CHECK(name, hidReport.reportId, id_ptpReport);
+	CHECK(name, ptp.numberFingers, 2);
+	CHECK(name, ptp.hasPressure, 0);
+	CHECK(name, ptp.fingers[0].contactID, 2);
+	CHECK(name, ptp.fingers[0].tip, 1);
+	CHECK(name, ptp.fingers[0].confidence, 1);
+	CHECK(name, ptp.fingers[0].x, 0x0234);
+	CHECK(name, ptp.fingers[0].y, 0x0156);
+	CHECK(name, ptp.fingers[0].pressure, 0);
+	CHECK(name, ptp.fingers[1].contactID, 4);
+	CHECK(name, ptp.fingers[1].tip, 1);
+	CHECK(name, ptp.fingers[1].confidence, 0);
+	CHECK(name, ptp.fingers[1].x, 0x0478);
+	CHECK(name, ptp.fingers[1].y, 0x039A);
+	CHECK(name, ptp.fingers[1].pressure, 0);
+	CHECK(name, ptp.fingers[2].x, 0);
+	CHECK(name, ptp.fingers[2].y, 0);
+	CHECK(name, ptp.timeStamp, 0xBEEF);
+	CHECK(name, ptp.contactCount, 2);
+	CHECK(name, ptp.buttons, 1);
+}
+
+static void testPtpPressure(void)
+{
+	const char * name = "PTP Pressure";
+	HidReport hidReport;
+	// a two finger report first, the pressure report mustn't keep its second finger
+	decode(hidReport, ptpPacket, sizeof(ptpPacket));
+	CHECK(name, decode(hidReport, ptpPressurePacket, sizeof(ptpPressurePacket)), true);
+	const PtpReport_t & ptp = hidReport.report.ptp;
+	CHECK(name, hidReport.length, HidReport::ptpPressureLength);
+	CHECK(name, hidReport.reportId, id_ptpReport);
+	CHECK(name, ptp.numberFingers, 1);
+	CHECK(name, ptp.hasPressure, 1);
+	CHECK(name, ptp.fingers[0].contactID, 5);
+	CHECK(name, ptp.fingers[0].tip, 1);
+	CHECK(name, ptp.fingers[0].confidence, 1);
+	CHECK(name, ptp.fingers[0].x, 0x1234);
+	CHECK(name, ptp.fingers[0].y, 0x0678);
+	CHECK(name, ptp.fingers[0].pressure, 0x0321);
+	for (int x = 1; x < MAX_PTP_FINGER_COUNT; x++)
+	{
+		CHECK(name, ptp.fingers[x].contactID, 0);
+		CHECK(name, ptp.fingers[x].tip, 0);
+		CHECK(name, ptp.fingers[x].x, 0);
+		CHECK(name, ptp.fingers[x].y, 0);
+		CHECK(name, ptp.fingers[x].pressure, 0);
+	}
+	CHECK(name, ptp.timeStamp, 10000);
+	CHECK(name, ptp.contactCount, 3);
+	CHECK(name, ptp.buttons, 0);
+}
+
+static void testCirqueAbsolute(void)
+{
+	const char * name = "Cirque Absolute";
+	HidReport hidReport;
+	CHECK(name, decode(hidReport, crqAbsolutePacket, sizeof(crqAbsolutePacket)), true);
+	const CRQabsoluteReport_t & abs = hidReport.report.abs;
+	CHECK(name, hidReport.length, HidReport::crqAbsoluteLength);
+	CHECK(name, hidReport.reportId, id_crqAlpsReport);
+	for (int x = 0; x < MAX_CRQ_ALPS_FINGER_COUNT; x++)
+	{
+		CHECK(name, abs.fingers[x].y, 0x0100 + x);
+		CHECK(name, abs.fingers[x].x, 0x0200 + (0x11 * x));
+		CHECK(name, abs.fingers[x].palm, 0x80 + x);
+	}
+	CHECK(name, abs.contactFlags, 0x1F);
+	CHECK(name, abs.buttons, 0x02);
+}
+
+static void testAlpsAbsolute(void)
+{
+	const char * name = "Alps Absolute";
+	HidReport hidReport;
+	CHECK(name, decode(hidReport, alpsAbsolutePacket, sizeof(alpsAbsolutePacket)), true);
+	const AlpsAbsoluteReport_t & abs = hidReport.report.alpsAbs;
+	CHECK(name, hidReport.length, HidReport::alpsAbsoluteLength);
+	CHECK(name, hidReport.reportId, id_crqAlpsReport);
+	for (int x = 0; x < MAX_CRQ_ALPS_FINGER_COUNT; x++)
+	{
+		CHECK(name, abs.fingers[x].x, 0x0A10 + x);
+		CHECK(name, abs.fingers[x].y, 0x0520 + x);
+		CHECK(name, abs.fingers[x].palm, 1 + x);
+		CHECK(name, abs.fingers[x].z, 0x30 + x);
+	}
+	CHECK(name, abs.contactFlags, 0x03);
+	CHECK(name, abs.buttons, 0x04);
+}
+
+static void testStick(void)
+{
+	const char * name = "stick";
+	HidReport hidReport;
+	CHECK(name, decode(hidReport, stickPacket, sizeof(stickPacket)), true);
+	const StickReport_t & stick = hidReport.report.stick;
+	CHECK(name, hidReport.length, HidReport::stickLength);
+	CHECK(name, hidReport.reportId, id_alpsStickReport);
+	CHECK(name, stick.buttons, 0x05);
+	CHECK(name, stick.X, 0x1234);
+	CHECK(name, stick.Y, 0xFEDC);
+	CHECK(name, stick.Z, 0x0042);
+}
+
+static void testWrongLengths(void)
+{
+	HidReport hidReport;
+	const char * name = "id 9, 32 bytes";
+	decode(hidReport, crqAbsolutePacket, sizeof(crqAbsolutePacket));
+	CHECK(name, decode(hidReport, badAbsolutePacket, sizeof(badAbsolutePacket)), false);
+	CHECK(name, hidReport.length, 32);
+	CHECK(name, hidReport.reportId, id_crqAlpsReport);
+	CHECK(name, reportCleared(hidReport), true);
+
+	name = "id 15, 12 bytes";
+	decode(hidReport, stickPacket, sizeof(stickPacket));
+	CHECK(name, decode(hidReport, badStickPacket, sizeof(badStickPacket)), false);
+	CHECK(name, hidReport.length, 12);
+	CHECK(name, hidReport.reportId, id_spiderMeas);
+	CHECK(name, reportCleared(hidReport), true);
+}
+
+int main(void)
+{
+	testPtp();
+	testPtpPressure();
+	testCirqueAbsolute();
+	testAlpsAbsolute();
+	testStick();
+	testWrongLengths();
+
+	printf("%d checks, %d failed\n", checks, failures);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// PC side benchmark for the MeasFilterChain stages (libraries/Cirque/MeasFilter.h).
+// Runs each stage on its own over synthetic frames (a slow drift, noise, and the odd spike),
+// then the chain the CustomMeas demo uses ('L'), and prints samples per second for each.
+// The numbers are for the PC, they show the relative cost of the stages, not the Teensy timing.
+// Only the portable path runs here, the DSP (SSUB16/SEL) medians are Teensy only.
+//
+// Build (any C++11 compiler):
+//   g++ -O2 -I../../libraries/Cirque MeasFilterBenchmark.cpp ../../libraries/Cirque/MeasFilter.cpp -o MeasFilterBenchmark
+//
+// Usage:
+//   MeasFilterBenchmark [channels] [frames]
+//     channels defaults to MEAS_FILTER_CHANNELS, frames to 20000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "MeasFilter.h"
+
+#define FRAME_SET (64)  // frames generated up front, so generating them isn't timed
+
+static int16_t frames[FRAME_SET][MEAS_FILTER_CHANNELS];
+static int16_t output[MEAS_FILTER_CHANNELS];
+static MeasFilterChain chain;
+
+static void makeFrames(uint16_t channels)
+{
+	srand(1);
+	for (uint16_t f = 0; f < FRAME_SET; f++)
+	{
+		for (uint16_t x = 0; x < channels; x++)
+		{
+			int16_t value = 1000 + x + f + (rand() % 21) - 10;
+			if ((rand() % 100) == 0) value += 500;
+			frames[f][x] = value;
+		}
+	}
+}
+
+// the checksum keeps the compiler from dropping the work
+static void run(const char * name, uint16_t channels, uint32_t frameCount)
+{
+	int32_t checksum = 0;
+	chain.reset();
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t f = 0; f < frameCount; f++)
+	{
+		chain.process(frames[f % FRAME_SET], output, channels);
+		checksum += output[f % channels];
+	}
+	std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+	double samples = (double)channels * frameCount;
+	printf("%-28s %12.0f samples/sec  %8.3f us/frame  (checksum %ld)\n", name, samples / seconds.count(),
+		1e6 * seconds.count() / frameCount, (long)checksum);
+}
+
+int main(int argc, char * argv[])
+{
+	uint16_t channels = MEAS_FILTER_CHANNELS;
+	uint32_t frameCount = 20000;
+	if (argc > 1) channels = (uint16_t)atoi(argv[1]);
+	if (argc > 2) frameCount = (uint32_t)atol(argv[2]);
+	if ((channels == 0) || (channels > MEAS_FILTER_CHANNELS) || (frameCount == 0))
+	{
+		fprintf(stderr, "Usage: MeasFilterBenchmark [channels 1..%d] [frames]\n", MEAS_FILTER_CHANNELS);
+		return 1;
+	}
+
+	makeFrames(channels);
+	printf("%u channels, %lu frames\n", channels, (unsigned long)frameCount);
+
+	chain.clear();
+	run("copy only (no stages)", channels, frameCount);
+
+	chain.clear();
+	chain.addLowPass(2);
+	run("low pass, shift 2", channels, frameCount);
+
+	chain.clear();
+	chain.addBaseline(6, 50);
+	run("baseline, shift 6", channels, frameCount);
+
+	chain.clear();
+	chain.addMedian(3);
+	run("median of 3", channels, frameCount);
+
+	chain.clear();
+	chain.addMedian(5);
+	run("median of 5", channels, frameCount);
+
+	chain.clear();
+	chain.addMedian(3);
+	chain.addLowPass(2);
+	run("median of 3, low pass", channels, frameCount);
+
+	return 0;
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// PC side reader for the CirqueCustomMeasDemo binary stream ('b' or 'B').
+// Decodes the MeasStream packets and writes them as CSV, or as columns (one raw file per
+// column) that can be memory mapped by analysis tools.
+//
+// Build (any C++11 compiler):
+//   g++ -O2 -I../../libraries/Cirque MeasStreamReader.cpp ../../libraries/Cirque/MeasStream.cpp -o MeasStreamReader
+//
+// Usage:
+//   MeasStreamReader <input> csv <file.csv>
+//   MeasStreamReader <input> columns <prefix>
+//     <prefix>.sequence.u32, <prefix>.timestamp_us.u32, <prefix>.s000.i16, <prefix>.s001.i16 ...
+//     (little endian, one value per packet)
+// <input> is a capture file, the serial port (after "stty -F /dev/ttyACM0 raw" on Linux), or - for stdin
+
+#include <stdio.h>
+#include <string.h>
+#include "MeasStream.h"
+
+static bool writeCsv(FILE * out, const MeasStreamDecoder & decoder, bool first)
+{
+	if (first)
+	{
+		fprintf(out, "sequence,timestamp_us");
+		for (uint16_t x = 0; x < decoder.SampleCount; x++) fprintf(out, ",s%u", x);
+		fprintf(out, "\n");
+	}
+	fprintf(out, "%lu,%lu", (unsigned long)decoder.Sequence, (unsigned long)decoder.Timestamp_us);
+	for (uint16_t x = 0; x < decoder.SampleCount; x++) fprintf(out, ",%d", decoder.Samples[x]);
+	fprintf(out, "\n");
+	return !ferror(out);
+}
+
+static void putLittleEndian(FILE * file, uint32_t value, uint8_t bytes)
+{
+	for (uint8_t x = 0; x < bytes; x++) fputc((value >> (8 * x)) & 0xFF, file);
+}
+
+int main(int argc, char * argv[])
+{
+	if ((argc != 4) || ((strcmp(argv[2], "csv") != 0) && (strcmp(argv[2], "columns") != 0)))
+	{
+		fprintf(stderr, "usage: %s <input> csv <file.csv>\n       %s <input> columns <prefix>\n", argv[0], argv[0]);
+		return 2;
+	}
+
+	FILE * in = (strcmp(argv[1], "-") == 0) ? stdin : fopen(argv[1], "rb");
+	if (in == NULL)
+	{
+		fprintf(stderr, "can't open %s\n", argv[1]);
+		return 1;
+	}
+
+	bool csv = (strcmp(argv[2], "csv") == 0);
+	FILE * csvFile = NULL;
+	FILE * columns[2 + MEAS_STREAM_MAX_SAMPLES] = { NULL };
+	uint16_t columnSamples = 0;  // the column layout is set by the first packet
+
+	if (csv)
+	{
+		csvFile = fopen(argv[3], "w");
+		if (csvFile == NULL)
+		{
+			fprintf(stderr, "can't create %s\n", argv[3]);
+			return 1;
+		}
+	}
+
+	MeasStreamDecoder decoder;
+	uint32_t packets = 0;
+	uint32_t skipped = 0;  // packets whose sample count doesn't match the columns
+	uint8_t buffer[4096];
+	size_t length;
+
+	while ((length = fread(buffer, 1, sizeof(buffer), in)) > 0)
+	{
+		for (size_t i = 0; i < length; i++)
+		{
+			if (!decoder.push(buffer[i])) continue;
+
+			if (csv)
+			{
+				if (!writeCsv(csvFile, decoder, packets == 0)) return 1;
+			}
+			else
+			{
+				if (packets == 0)
+				{
+					columnSamples = decoder.SampleCount;
+					char name[512];
+					for (uint16_t x = 0; x < 2 + columnSamples; x++)
+					{
+						if (x == 0) snprintf(name, sizeof(name), "%s.sequence.u32", argv[3]);
+						else if (x == 1) snprintf(name, sizeof(name), "%s.timestamp_us.u32", argv[3]);
+						else snprintf(name, sizeof(name), "%s.s%03u.i16", argv[3], x - 2);
+						columns[x] = fopen(name, "wb");
+						if (columns[x] == NULL)
+						{
+							fprintf(stderr, "can't create %s\n", name);
+							return 1;
+						}
+					}
+				}
+				if (decoder.SampleCount != columnSamples)
+				{
+					skipped++;
+					continue;
+				}
+				putLittleEndian(columns[0], decoder.Sequence, 4);
+				putLittleEndian(columns[1], decoder.Timestamp_us, 4);
+				for (uint16_t x = 0; x < columnSamples; x++)
+				{
+					putLittleEndian(columns[2 + x], (uint16_t)decoder.Samples[x], 2);
+				}
+			}
+			packets++;
+		}
+	}
+
+	if (csvFile != NULL) fclose(csvFile);
+	for (uint16_t x = 0; x < 2 + columnSamples; x++)
+	{
+		if (columns[x] != NULL) fclose(columns[x]);
+	}
+	if (in != stdin) fclose(in);
+
+	fprintf(stderr, "packets: %lu  lost: %lu  CRC errors: %lu  undecodable: %lu  skipped: %lu  frames the device missed: %lu\n",
+		(unsigned long)packets, (unsigned long)decoder.LostPackets, (unsigned long)decoder.CrcErrors,
+		(unsigned long)decoder.UndecodablePackets, (unsigned long)skipped, (unsigned long)decoder.SkippedFrames);
+	return 0;
+}
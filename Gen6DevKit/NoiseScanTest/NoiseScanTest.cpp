@@ -0,0 +1,320 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// PC side test for NoiseScan (libraries/Cirque/NoiseScan.h). A simulated CustomMeas device has
+// a known amount of noise at each ToggleFrequency: a tone on the spectrum channel and square
+// waves on the rest, with a glitch in the frames right after each change. The scan is driven
+// the way CustomMeas::addNoiseScanFrame drives it, then the noise power of every channel, the
+// peak bin of each spectrum and the recommended setting are checked. The Q15 FFT is also
+// checked on its own with single tones, and the noise power with a channel that swings across
+// most of the int16_t range.
+//
+// Build (any C++11 compiler):
+//   g++ -O2 -I../../libraries/Cirque NoiseScanTest.cpp ../../libraries/Cirque/NoiseScan.cpp -o NoiseScanTest
+//
+// Usage:
+//   NoiseScanTest
+//     prints each check that fails, exits with 0 if none did
+
+#include <stdio.h>
+#include <math.h>
+#include "NoiseScan.h"
+
+static int checks = 0;
+static int failures = 0;
+
+static void check(const char * test, const char * value, double actual, double expected, double tolerance)
+{
+	checks++;
+	if (fabs(actual - expected) > tolerance)
+	{
+		printf("FAILED %s: %s is %g, expected %g (+/- %g)\n", test, value, actual, expected, tolerance);
+		failures++;
+	}
+}
+
+#define CHECK(test, value, expected) check(test, #value, (double)(value), (double)(expected), 0)
+#define CHECK_NEAR(test, value, expected, tolerance) check(test, #value, (double)(value), (double)(expected), (tolerance))
+
+static const double pi = 3.14159265358979323846;
+
+// the largest bin of a spectrum, DC left out
+static uint16_t peakBin(const uint32_t * power)
+{
+	uint16_t peak = 1;
+	for (uint16_t k = 2; k < NOISE_SCAN_SPECTRUM_BINS; k++)
+	{
+		if (power[k] > power[peak]) peak = k;
+	}
+	return peak;
+}
+
+// *** the FFT on its own ***
+
+static void testFft(void)
+{
+	const char * test = "FFT";
+	const uint16_t n = NOISE_SCAN_FFT_LENGTH;
+	int16_t re[NOISE_SCAN_FFT_LENGTH];
+	int16_t im[NOISE_SCAN_FFT_LENGTH];
+
+	// a cosine of amplitude A at bin k gives A / 2 at k and n - k, as the result is the DFT / n
+	const uint16_t bins[] = { 1, 5, 16, 31 };
+	for (uint16_t b = 0; b < sizeof(bins) / sizeof(bins[0]); b++)
+	{
+		uint16_t k = bins[b];
+		for (uint16_t x = 0; x < n; x++)
+		{
+			re[x] = (int16_t)lround(8192 * cos(2 * pi * k * x / n));
+			im[x] = 0;
+		}
+		noiseScanFft(re, im);
+		CHECK_NEAR(test, re[k], 4096, 16);
+		CHECK_NEAR(test, im[k], 0, 16);
+		CHECK_NEAR(test, re[n - k], 4096, 16);
+		for (uint16_t x = 0; x < n; x++)
+		{
+			if ((x == k) || (x == n - k)) continue;
+			CHECK_NEAR(test, re[x], 0, 16);
+			CHECK_NEAR(test, im[x], 0, 16);
+		}
+	}
+
+	// a sine lands on the imaginary part, -A / 2 at k
+	for (uint16_t x = 0; x < n; x++)
+	{
+		re[x] = (int16_t)lround(8192 * sin(2 * pi * 7 * x / n));
+		im[x] = 0;
+	}
+	noiseScanFft(re, im);
+	CHECK_NEAR(test, re[7], 0, 16);
+	CHECK_NEAR(test, im[7], -4096, 16);
+	CHECK_NEAR(test, im[n - 7], 4096, 16);
+
+	// DC and the Nyquist bin, each of the 6 passes can round them down by one
+	for (uint16_t x = 0; x < n; x++)
+	{
+		re[x] = (int16_t)(1000 + ((x & 1) ? -2000 : 2000));
+		im[x] = 0;
+	}
+	noiseScanFft(re, im);
+	CHECK_NEAR(test, re[0], 1000, 6);
+	CHECK_NEAR(test, re[n / 2], 2000, 6);
+	CHECK_NEAR(test, re[1], 0, 6);
+}
+
+// *** a scan of a simulated device ***
+
+#define CHANNELS 12
+#define SPECTRUM_CHANNEL 0
+#define FRAMES_PER_SETTING 256
+#define SETTLE_FRAMES 2
+
+// ToggleFrequency 10, 20, 30 and 40. 30 is the quiet one.
+static const uint8_t frequencies[] = { 10, 20, 30, 40 };
+static const int16_t amplitudes[] = { 200, 100, 6, 50 };
+static const uint16_t toneBins[] = { 3, 6, 9, 12 };  // of the tone on the spectrum channel
+#define SETTINGS (sizeof(frequencies) / sizeof(frequencies[0]))
+
+typedef struct
+{
+	uint8_t toggleFrequency;
+	uint16_t frame;      // frames since the last change
+	uint8_t applyCount;  // changes of ToggleFrequency
+} SimDevice;
+
+static uint8_t settingOf(uint8_t toggleFrequency)
+{
+	for (uint8_t s = 0; s < SETTINGS; s++)
+	{
+		if (frequencies[s] == toggleFrequency) return s;
+	}
+	return 0;
+}
+
+// channel x is 1000 + 10 x plus its noise. The spectrum channel has a tone of amplitude A at
+// toneBins[s] (of a 64 point FFT). The others have a square wave of +/-(A + x), period 4 frames,
+// so their noise power is (A + x)^2 * n / (n - 1) exactly. The first frames after a change are
+// way off, the scan has to drop them.
+static int16_t sample(const SimDevice & device, uint16_t frame, uint16_t x)
+{
+	uint8_t s = settingOf(device.toggleFrequency);
+	int16_t level = (int16_t)(1000 + (10 * x));
+	if (device.frame < SETTLE_FRAMES) return (int16_t)(level + 3000);
+
+	uint16_t n = frame - SETTLE_FRAMES;  // frames since settling
+	if (x == SPECTRUM_CHANNEL)
+	{
+		return (int16_t)(level + lround(amplitudes[s] * sin(2 * pi * toneBins[s] * n / NOISE_SCAN_FFT_LENGTH)));
+	}
+	int16_t amplitude = (int16_t)(amplitudes[s] + x);
+	return (int16_t)(level + (((n & 3) < 2) ? amplitude : -amplitude));
+}
+
+static void applyToggleFrequency(SimDevice & device, uint8_t toggleFrequency)
+{
+	device.toggleFrequency = toggleFrequency;
+	device.frame = 0;
+	device.applyCount++;
+}
+
+// the same steps as CustomMeas::addNoiseScanFrame
+static void addFrame(NoiseScan & scan, SimDevice & device, const int16_t * frame, uint16_t count)
+{
+	if (!scan.add(frame, count)) return;
+	if (scan.Running)
+	{
+		applyToggleFrequency(device, scan.ToggleFrequency);
+	}
+	else if (scan.ApplyRecommended && (scan.recommended() != NOISE_SCAN_NONE))
+	{
+		applyToggleFrequency(device, scan.result(scan.recommended()).toggleFrequency);
+	}
+}
+
+// sample variance of a channel over the frames the scan keeps, worked out directly
+static double expectedPower(uint8_t setting, uint16_t x)
+{
+	SimDevice device = { frequencies[setting], SETTLE_FRAMES, 0 };
+	double sum = 0;
+	double sumSquares = 0;
+	for (uint16_t n = 0; n < FRAMES_PER_SETTING; n++)
+	{
+		double value = sample(device, n + SETTLE_FRAMES, x);
+		sum += value;
+		sumSquares += value * value;
+	}
+	double mean = sum / FRAMES_PER_SETTING;
+	return (sumSquares - (FRAMES_PER_SETTING * mean * mean)) / (FRAMES_PER_SETTING - 1);
+}
+
+static void testScan(void)
+{
+	const char * test = "scan";
+	NoiseScan scan;
+	SimDevice device = { 0, 0, 0 };
+	int16_t frame[CHANNELS];
+
+	CHECK(test, scan.recommended(), NOISE_SCAN_NONE);
+	CHECK(test, scan.begin(10, 40, 0, FRAMES_PER_SETTING), false);       // no step
+	CHECK(test, scan.begin(40, 10, 10, FRAMES_PER_SETTING), false);      // backwards
+	CHECK(test, scan.begin(10, 40, 10, 1), false);                       // too few frames
+	CHECK(test, scan.begin(0, 255, 1, FRAMES_PER_SETTING), false);       // too many settings
+
+	scan.setSpectrumChannel(SPECTRUM_CHANNEL);
+	CHECK(test, scan.begin(frequencies[0], frequencies[SETTINGS - 1], 10, FRAMES_PER_SETTING, SETTLE_FRAMES), true);
+	applyToggleFrequency(device, scan.ToggleFrequency);  // CustomMeas::beginNoiseScan
+
+	uint32_t frames = 0;
+	while (scan.Running && (frames < 10000))
+	{
+		for (uint16_t x = 0; x < CHANNELS; x++) frame[x] = sample(device, device.frame, x);
+		device.frame++;
+		frames++;
+		addFrame(scan, device, frame, CHANNELS);
+	}
+	CHECK(test, scan.Running, false);
+	CHECK(test, frames, SETTINGS * (SETTLE_FRAMES + FRAMES_PER_SETTING));
+	CHECK(test, scan.Settings, SETTINGS);
+
+	for (uint8_t s = 0; s < SETTINGS; s++)
+	{
+		const NoiseScanResult_t & result = scan.result(s);
+		CHECK(test, result.toggleFrequency, frequencies[s]);
+		CHECK(test, result.frames, FRAMES_PER_SETTING);
+
+		// the square wave channels, exactly
+		double n = FRAMES_PER_SETTING;
+		double total = expectedPower(s, SPECTRUM_CHANNEL);
+		for (uint16_t x = 1; x < CHANNELS; x++)
+		{
+			double amplitude = amplitudes[s] + x;
+			double power = amplitude * amplitude * n / (n - 1);
+			CHECK_NEAR(test, expectedPower(s, x), power, power * 1e-9);
+			total += power;
+		}
+		CHECK(test, result.worstChannel, CHANNELS - 1);
+		double worst = (amplitudes[s] + CHANNELS - 1) * (amplitudes[s] + CHANNELS - 1) * n / (n - 1);
+		CHECK_NEAR(test, result.maxPower, worst, worst * 1e-6);
+		CHECK_NEAR(test, result.meanPower, total / CHANNELS, total / CHANNELS * 1e-6);
+
+		// the tone: about A^2 / 2 as noise power, A^2 / 4 in its bin (1/256 counts^2)
+		double tone = (double)amplitudes[s] * amplitudes[s];
+		CHECK_NEAR(test, expectedPower(s, SPECTRUM_CHANNEL), tone / 2, (tone / 2) * 0.05 + 1);
+		const uint32_t * power = scan.spectrum(s);
+		CHECK(test, power != 0, true);
+		if (power == 0) continue;
+		CHECK(test, peakBin(power), toneBins[s]);
+		CHECK_NEAR(test, power[toneBins[s]], tone / 4 * 256, (tone / 4 * 256) * 0.05 + 256);
+		CHECK_NEAR(test, power[0], 0, 256);  // the mean is removed
+	}
+
+	CHECK(test, scan.recommended(), 2);
+	CHECK(test, device.toggleFrequency, 30);  // applied at the end
+	CHECK(test, device.applyCount, SETTINGS + 1);
+	CHECK(test, scan.spectrum(SETTINGS) == 0, true);
+}
+
+// the scan leaves the device alone at the end when asked to, and restarts a setting whose
+// frame size changes
+static void testNoApply(void)
+{
+	const char * test = "no apply";
+	NoiseScan scan;
+	SimDevice device = { 0, 0, 0 };
+	int16_t frame[CHANNELS];
+
+	CHECK(test, scan.begin(10, 20, 10, FRAMES_PER_SETTING, SETTLE_FRAMES, false), true);
+	applyToggleFrequency(device, scan.ToggleFrequency);
+	uint32_t frames = 0;
+	while (scan.Running && (frames < 10000))
+	{
+		for (uint16_t x = 0; x < CHANNELS; x++) frame[x] = sample(device, device.frame, x);
+		device.frame++;
+		frames++;
+		// a frame with one channel less part way through the first setting
+		uint16_t count = (frames == SETTLE_FRAMES + 10) ? CHANNELS - 1 : CHANNELS;
+		addFrame(scan, device, frame, count);
+	}
+	CHECK(test, scan.Settings, 2);
+	CHECK(test, scan.recommended(), 1);
+	CHECK(test, device.toggleFrequency, 20);  // the last setting, not the recommended one
+	CHECK(test, scan.spectrum(0) == 0, true);  // no spectrum channel was set
+	// the short frame starts the first setting again, then so does the next full one
+	CHECK(test, frames, (2 * SETTLE_FRAMES) + 10 + (2 * FRAMES_PER_SETTING));
+}
+
+// a channel that swings across most of the int16_t range, its differences from the first frame
+// are too big to square in 32 bits
+static void testLargeSwings(void)
+{
+	const char * test = "large swings";
+	NoiseScan scan;
+	int16_t frame[CHANNELS];
+
+	CHECK(test, scan.begin(10, 10, 10, FRAMES_PER_SETTING, SETTLE_FRAMES, false), true);
+	uint32_t frames = 0;
+	while (scan.Running && (frames < 10000))
+	{
+		for (uint16_t x = 0; x < CHANNELS; x++) frame[x] = (int16_t)(1000 + (10 * x));
+		frame[CHANNELS - 1] = (frames & 1) ? 30000 : -30000;
+		frames++;
+		scan.add(frame, CHANNELS);
+	}
+	double n = FRAMES_PER_SETTING;
+	double power = 30000.0 * 30000.0 * n / (n - 1);
+	CHECK(test, scan.Settings, 1);
+	CHECK(test, scan.result(0).worstChannel, CHANNELS - 1);
+	CHECK_NEAR(test, scan.result(0).maxPower, power, power * 1e-6);
+	CHECK_NEAR(test, scan.result(0).meanPower, power / CHANNELS, (power / CHANNELS) * 1e-6);
+}
+
+int main(void)
+{
+	testFft();
+	testScan();
+	testNoApply();
+	testLargeSwings();
+
+	printf("%d checks, %d failed\n", checks, failures);
+	return (failures == 0) ? 0 : 1;
+}
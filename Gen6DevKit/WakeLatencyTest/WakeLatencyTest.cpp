@@ -0,0 +1,170 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// PC side test for WakeLatency (libraries/Cirque/WakeLatency.h). A simulated device scans at the
+// active, idle or sleep rate, a touch is seen at the first scan after it and DR falls a fixed
+// processing time later. Taps are fed in at known points of the scan period, the way the Gen6
+// demo feeds the touch trigger and DR edges, and the min/max/mean of each power state are
+// checked against the values worked out from the scan period.
+//
+// Build (any C++11 compiler):
+//   g++ -O2 -I../../libraries/Cirque WakeLatencyTest.cpp ../../libraries/Cirque/WakeLatency.cpp -o WakeLatencyTest
+//
+// Usage:
+//   WakeLatencyTest
+//     prints each check that fails, exits with 0 if none did
+
+#include <stdio.h>
+#include "WakeLatency.h"
+
+static int checks = 0;
+static int failures = 0;
+
+static void check(const char * test, const char * value, long actual, long expected)
+{
+	checks++;
+	if (actual != expected)
+	{
+		printf("FAILED %s: %s is %ld, expected %ld\n", test, value, actual, expected);
+		failures++;
+	}
+}
+
+#define CHECK(test, value, expected) check(test, #value, (long)(value), (long)(expected))
+
+// the balanced and lowest latency profiles of CirqueHid::powerProfileSettings
+static const PowerSettings_t balanced = { 50, 100, 600, 1000, 0 };
+static const PowerSettings_t lowestLatency = { 50, 100, 600, 1000,
+	POWER_SETTING_DISABLE_IDLE_SLEEP | POWER_SETTING_DISABLE_DEEP_SLEEP };
+
+#define ACTIVE_SCAN_US 4000  // the active scan period isn't in the power settings
+#define PROCESS_US 1200      // from the scan that sees the touch to the DR edge
+#define READ_US 800          // the host's I2C read of the report
+#define TAPS 8               // taps per series, spread evenly over the scan period
+
+static uint32_t scanPeriod_us(WakeLatency::PowerStates state, const PowerSettings_t & powerSettings)
+{
+	if (state == WakeLatency::STATE_IDLE) return (uint32_t)powerSettings.timeInIdle_100us * 100;
+	if (state == WakeLatency::STATE_SLEEP) return (uint32_t)powerSettings.timeInSleep_100us * 100;
+	return ACTIVE_SCAN_US;
+}
+
+// The host side of the demo with a simulated device. The device is in deviceState for every tap,
+// the test picks quiet_ms (and forceSleep) so that it is.
+typedef struct
+{
+	WakeLatency latency;
+	PowerSettings_t powerSettings;
+	bool forcedSleep;
+	uint32_t lastReport_us;  // when the host finished reading the last report
+} SimHost;
+
+static void tapSeries(const char * test, SimHost & host, WakeLatency::PowerStates deviceState, uint32_t quiet_ms,
+	bool forceSleep = false)
+{
+	uint32_t period_us = scanPeriod_us(deviceState, host.powerSettings);
+	for (uint32_t tap = 0; tap < TAPS; tap++)
+	{
+		host.forcedSleep = forceSleep;  // 'I' before each tap
+		// touch at tap/TAPS of the way through a scan period, it is seen at the next scan
+		uint32_t touch_us = host.lastReport_us + (quiet_ms * 1000);
+		uint32_t drEdge_us = touch_us + (period_us - ((tap * period_us) / TAPS)) + PROCESS_US;
+		host.latency.touch(touch_us, WakeLatency::stateAfterQuiet(quiet_ms, host.powerSettings, host.forcedSleep));
+		host.latency.touch(touch_us + 300, WakeLatency::STATE_ACTIVE);  // trigger bounce, ignored
+		CHECK(test, host.latency.dataReady(touch_us - 500), false);     // pending before the touch
+		CHECK(test, host.latency.dataReady(drEdge_us), true);
+		CHECK(test, host.latency.dataReady(drEdge_us + ACTIVE_SCAN_US), false);  // the touch's next report
+
+		host.lastReport_us = drEdge_us + READ_US;
+		host.forcedSleep = false;  // a touch wakes the device
+	}
+}
+
+// what tapSeries has to give for a state whose scan period is period_us
+static void checkState(const char * test, const WakeLatency & latency, WakeLatency::PowerStates state,
+	uint32_t period_us)
+{
+	CHECK(test, latency.samples(state), TAPS);
+	CHECK(test, latency.min_us(state), PROCESS_US + (period_us / TAPS));
+	CHECK(test, latency.max_us(state), PROCESS_US + period_us);
+	// the waits are period_us * (TAPS, TAPS - 1 .. 1) / TAPS
+	CHECK(test, latency.mean_us(state), PROCESS_US + ((period_us * (TAPS + 1)) / (2 * TAPS)));
+}
+
+static void testStateAfterQuiet(void)
+{
+	const char * test = "stateAfterQuiet";
+	PowerSettings_t noDeepSleep = balanced;
+	noDeepSleep.settings = POWER_SETTING_DISABLE_DEEP_SLEEP;
+	PowerSettings_t noIdle = balanced;
+	noIdle.settings = POWER_SETTING_DISABLE_IDLE_SLEEP;
+
+	CHECK(test, WakeLatency::stateAfterQuiet(0, balanced, false), WakeLatency::STATE_ACTIVE);
+	CHECK(test, WakeLatency::stateAfterQuiet(4999, balanced, false), WakeLatency::STATE_ACTIVE);
+	CHECK(test, WakeLatency::stateAfterQuiet(5000, balanced, false), WakeLatency::STATE_IDLE);
+	CHECK(test, WakeLatency::stateAfterQuiet(59999, balanced, false), WakeLatency::STATE_IDLE);
+	CHECK(test, WakeLatency::stateAfterQuiet(60000, balanced, false), WakeLatency::STATE_SLEEP);
+	CHECK(test, WakeLatency::stateAfterQuiet(0, balanced, true), WakeLatency::STATE_SLEEP);
+	CHECK(test, WakeLatency::stateAfterQuiet(60000, noDeepSleep, false), WakeLatency::STATE_IDLE);
+	CHECK(test, WakeLatency::stateAfterQuiet(5000, noIdle, false), WakeLatency::STATE_ACTIVE);
+	CHECK(test, WakeLatency::stateAfterQuiet(60000, noIdle, false), WakeLatency::STATE_SLEEP);
+	CHECK(test, WakeLatency::stateAfterQuiet(100000, lowestLatency, false), WakeLatency::STATE_ACTIVE);
+}
+
+static void testPowerStates(void)
+{
+	const char * test = "balanced";
+	SimHost host = { WakeLatency(), balanced, false, 0xFFFF0000 };  // micros() wraps during the active taps
+
+	CHECK(test, host.latency.dataReady(1000), false);  // no touch yet
+	tapSeries(test, host, WakeLatency::STATE_ACTIVE, 200);
+	tapSeries(test, host, WakeLatency::STATE_IDLE, 6000);
+	tapSeries(test, host, WakeLatency::STATE_SLEEP, 61000);
+
+	checkState(test, host.latency, WakeLatency::STATE_ACTIVE, ACTIVE_SCAN_US);
+	checkState(test, host.latency, WakeLatency::STATE_IDLE, scanPeriod_us(WakeLatency::STATE_IDLE, balanced));
+	checkState(test, host.latency, WakeLatency::STATE_SLEEP, scanPeriod_us(WakeLatency::STATE_SLEEP, balanced));
+	// sleep has to cost more than idle, and idle more than active
+	CHECK(test, host.latency.mean_us(WakeLatency::STATE_SLEEP) > host.latency.mean_us(WakeLatency::STATE_IDLE), true);
+	CHECK(test, host.latency.mean_us(WakeLatency::STATE_IDLE) > host.latency.mean_us(WakeLatency::STATE_ACTIVE), true);
+
+	host.latency.reset();
+	for (uint8_t x = 0; x < WakeLatency::STATE_COUNT; x++)
+	{
+		CHECK(test, host.latency.samples((WakeLatency::PowerStates)x), 0);
+		CHECK(test, host.latency.mean_us((WakeLatency::PowerStates)x), 0);
+	}
+}
+
+static void testForcedSleep(void)
+{
+	const char * test = "forced sleep";
+	SimHost host = { WakeLatency(), balanced, false, 0 };
+
+	// forced to sleep before every tap, a short quiet time is still a sleep touch
+	tapSeries(test, host, WakeLatency::STATE_SLEEP, 200, true);
+	checkState(test, host.latency, WakeLatency::STATE_SLEEP, scanPeriod_us(WakeLatency::STATE_SLEEP, balanced));
+	CHECK(test, host.latency.samples(WakeLatency::STATE_ACTIVE), 0);
+}
+
+static void testLowestLatency(void)
+{
+	const char * test = "lowest latency";
+	SimHost host = { WakeLatency(), lowestLatency, false, 0 };
+
+	// idle and sleep are off, the device keeps scanning at the active rate however long it was quiet
+	tapSeries(test, host, WakeLatency::STATE_ACTIVE, 61000);
+	checkState(test, host.latency, WakeLatency::STATE_ACTIVE, ACTIVE_SCAN_US);
+	CHECK(test, host.latency.samples(WakeLatency::STATE_IDLE), 0);
+	CHECK(test, host.latency.samples(WakeLatency::STATE_SLEEP), 0);
+}
+
+int main(void)
+{
+	testStateAfterQuiet();
+	testPowerStates();
+	testForcedSleep();
+	testLowestLatency();
+
+	printf("%d checks, %d failed\n", checks, failures);
+	return (failures == 0) ? 0 : 1;
+}
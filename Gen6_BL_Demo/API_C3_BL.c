@@ -3,45 +3,97 @@
 #include <Arduino.h>  //for delay
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "Fletcher32.h"
+#include "CompressedImage.h"
+#include "ImageStream.h"
 #include "API_C3_BL.h"
-
-static uint8_t dataBuffer[BL_REPORT_LEN];
-static bl_read_packet g_packet;
-
+#include "I2C.h"
+
+// polling backs off from the shortest interval to the longest
+#define POLL_MIN_US (200)
+#define POLL_MAX_US (10000)
+#define GET_PACKET_RETRIES (50)
+// how long past the device's own (worst case) delay to keep polling before giving up
+#define READY_TIMEOUT_US (1000000)
+// a wait for the report (GetPacket) rather than for an operation
+#define WAIT_PACKET (BLOp_Count)
+// a streamed image: how often to look for the next chunk, and how long the PC can go quiet
+// while it's waited for
+#define STREAM_POLL_US (1000)
+#define STREAM_TIMEOUT_US (2000000)
+
+//The steps of an update, in order. Each sends a command and waits for the device to finish
+//it, then the next is chosen by how that went (NextStep).
+enum BLSteps
+{
+    BLStep_Done = 0,            // finished, or not started
+    BLStep_Status = 1,          // read the status: is it answering, without an error
+    BLStep_ResetFirst = 2,      // it wasn't, reset it before starting
+    BLStep_Hardware = 3,        // a container: read the part's HWID, is the container for it
+    BLStep_InvokeBootloader = 4,
+    BLStep_FormatImage = 5,
+    BLStep_FormatRegion = 6,    // each of a container's regions
+    BLStep_Resume = 7,          // instead of formatting, from a checkpoint: read back the end of what was written
+    BLStep_Unchanged = 8,       // differential: Validate before writing, it passes if nothing has changed
+    BLStep_ReadBack = 9,        // differential: read back the next chunk to compare it
+    BLStep_Write = 10,          // the next chunk, or what's changed in it
+    BLStep_Flush = 11,
+    BLStep_Validate = 12,
+    BLStep_EraseImage = 13,     // FormatImage again after an error, so a partial image doesn't run
+    BLStep_Reset = 14,
+};
+
+//the part the BL_program.. and BL_cmd.. functions talk to, its target is set by SetDefaultTarget
+static bl_device g_device;
+
+static void SetDefaultTarget(void);
+static void ParseStatus(bl_read_packet *packet, uint8_t *data);
 static void ParseReadPacket(bl_read_packet *packet, uint8_t *data);
-static bool GetPacket(bl_read_packet *packet, bool retries);
+static bool GetPacket(bl_device *device, uint16_t numBytes);
+static void SleepMicroseconds(uint32_t us);
+static uint32_t TimeUntil(uint32_t time_us);
+static void StartWait(bl_device *device, uint8_t operation, uint32_t units, uint32_t fixedDelay_us);
+static bool PollWait(bl_device *device);
+static bool Rebooted(bl_device *device);
+static void LearnTiming(bl_device *device, uint32_t elapsed_us, uint32_t sample_us);
 static bool IsBootloaderMode(uint16_t sentinel);
 static bool IsImageMode(uint16_t sentinel);
 static bool IsSentinelValid(uint16_t sentinel);
-static bool CheckStatusAndError(void);
-static bool InvokeBootloader(void);
-static bool FormatImage(const uint8_t *buf, bl_read_packet *packet);
-static bool FormatRegion(
-        const uint8_t *buf,
-        uint32_t address,
-        uint32_t numBytes,
-        bl_read_packet *packet);
-static bool WriteImage(
-        const uint8_t *buf,
-        uint32_t address,
-        uint32_t numBytes,
-        bl_read_packet *packet);
-static bool Flush(void);
-static bool Validate(void);
-static bool Reset(void);
+static uint8_t ActiveImage(bl_read_packet *packet);
+static const uint8_t *ReadImage(bl_device *device, uint32_t count);
+static bool SeekImage(bl_device *device, uint32_t offset);
+static bool ImagePending(bl_device *device);
+static bool HostSilent(istream *stream, uint32_t *frames, uint32_t *heard_us);
+static uint32_t WriteFixedDelay(bl_read_packet *packet, uint32_t payloadSize);
+static bool StartStep(bl_device *device);
+static bool ReadBackChanged(bl_device *device);
+static bool ReadBackErased(bl_device *device);
+static bool HardwareKnown(bl_device *device);
+static bool HardwareMatches(bl_device *device);
+static void SelectRegion(bl_device *device, uint8_t index);
+static uint8_t NextChunk(bl_device *device);
+static bool Resumable(bl_device *device);
+static void Checkpoint(bl_device *device, bool formatted);
+static void NextStep(bl_device *device, bool success);
+static void Failed(bl_device *device, uint16_t error, bool eraseImage);
 
 ///////////////////////////////////////////////////////////////////////////////
 //Private Functions
 ///////////////////////////////////////////////////////////////////////////////
 ///
-static void ParseReadPacket(bl_read_packet *packet, uint8_t *data)
+//set at run time, as BL_device_init does, the rest of g_device starts zeroed
+static void SetDefaultTarget(void)
 {
-    uint16_t i;
-    uint16_t checksumIndex;
-    uint16_t length;
+    g_device.target.bus = I2C_BUS_WIRE;
+    g_device.target.address = I2C_SLAVE_ADDR;
+}
 
+
+//the status, the first READ_STATUS_SIZE bytes of the report
+static void ParseStatus(bl_read_packet *packet, uint8_t *data)
+{
     // Length_LSB = data[0]
     // Length_MSB = data[1]
     // ReportID = data[2]
@@ -62,6 +114,15 @@ static void ParseReadPacket(bl_read_packet *packet, uint8_t *data)
             (data[14] << 24);
 
     packet->NumBytes = data[15] | (data[16] << 8);
+}
+
+static void ParseReadPacket(bl_read_packet *packet, uint8_t *data)
+{
+    uint16_t i;
+    uint16_t checksumIndex;
+    uint16_t length;
+
+    ParseStatus(packet, data);
 
     if (packet->NumBytes <= MAX_READ_DATA_SIZE)
     {
@@ -82,32 +143,213 @@ static void ParseReadPacket(bl_read_packet *packet, uint8_t *data)
     packet->Checksum = data[checksumIndex] | data[checksumIndex + 1] << 8;
 }
 
+
+//reads the report into device->packet, polling while the device is busy: the status, and
+//the data after it if it has any. numBytes is the data asked for (BL_request_read), 0 for none.
 //returns false if Sentinel is invalid
-static bool GetPacket(bl_read_packet *packet, bool retries)
+static bool GetPacket(bl_device *device, uint16_t numBytes)
+{
+    StartWait(device, WAIT_PACKET, numBytes, 0);
+    while (PollWait(device) == false)
+    {
+        SleepMicroseconds(TimeUntil(device->waitNext_us));
+    }
+    return device->waitSuccess;
+}
+
+
+static void SleepMicroseconds(uint32_t us)
+{
+    delay(us / 1000);
+    delayMicroseconds(us % 1000);
+}
+
+
+//0 once it's come
+static uint32_t TimeUntil(uint32_t time_us)
 {
+    int32_t remaining_us = (int32_t)(time_us - micros());
+
+    return (remaining_us > 0) ? (uint32_t)remaining_us : 0;
+}
+
+
+//Starts waiting for the device to finish an operation, PollWait does the waiting. Once the
+//operation has been timed it sleeps through most of its learned time first, then polls the
+//busy bit with short status reads at a growing interval. units scales the learned time
+//(bytes written, KB formatted). fixedDelay_us is the fixed delay the device asks for, it's
+//only used for the timeout, and as the longest InvokeBootloader or Reset can reboot unseen.
+//WAIT_PACKET waits for the report instead (GetPacket), GET_PACKET_RETRIES reads at most, and
+//units is the data asked for. The first read takes that with the status, as it's usually
+//ready straight away. After that it polls with short status reads too, and the data is only
+//read again once it's ready, if there's more of it than came the first time.
+static void StartWait(bl_device *device, uint8_t operation, uint32_t units, uint32_t fixedDelay_us)
+{
+    device->waiting = true;
+    device->waitSuccess = false;
+    device->waitOperation = operation;
+    device->waitUnits = units;
+    device->waitFixedDelay_us = fixedDelay_us;
+    device->waitExpected_us = (operation < BLOp_Count) ? device->timing[operation].learned_us * units : 0;
+    device->waitStart_us = micros();
+    device->waitNext_us = device->waitStart_us;
+    device->waitInterval_us = POLL_MIN_US;
+    device->waitPolls = 0;
+    device->waitSentinel = device->packet.Sentinel;
+    device->waitFlags = device->packet.Flags;
+    device->waitRebooted = false;
+
+    if (device->waitExpected_us > 0)
+    {
+        device->waitNext_us += device->waitExpected_us - (device->waitExpected_us / 8);
+    }
+}
+
+
+//Reads the status if it's time to. returns true when the wait is over: then waitSuccess is
+//true if the device is ready (device->packet holds its status), false on timeout.
+static bool PollWait(bl_device *device)
+{
+    uint8_t *data = device->dataBuffer;
+    uint32_t elapsed_us;
+    uint32_t late_us;
+    uint16_t length;
     uint16_t count;
-    bool success = false;
+    bool ready = false;
+    bool over;
 
-    for (count = 0; count < 50; count++)
+    if (TimeUntil(device->waitNext_us) > 0)
     {
-        BL_read(dataBuffer);
-        ParseReadPacket(packet, dataBuffer);
+        return false;
+    }
+    // past when it was due, while another device was being sent something
+    late_us = micros() - device->waitNext_us;
 
-        if ((packet->Flags & STATUS_BUSY_BIT) == 0)
+    // the device doesn't answer while it reboots, that reads as an invalid sentinel
+    data[3] = 0;
+    data[4] = 0;
+    if (device->waitOperation == WAIT_PACKET)
+    {
+        length = (device->waitPolls == 0) ? (uint16_t)device->waitUnits : 0;
+        if (length > MAX_READ_DATA_SIZE)
         {
-            if(IsSentinelValid(packet->Sentinel))
-            {
-                success = true;
-            }
-            break;
+            length = MAX_READ_DATA_SIZE;
         }
-        if (retries == false)
+        BL_read(&device->target, data, READ_STATUS_SIZE + ((length > 0) ? length + READ_CHECKSUM_SIZE : 0));
+        ParseStatus(&device->packet, data);
+        ready = ((device->packet.Flags & STATUS_BUSY_BIT) == 0);
+        count = (device->packet.NumBytes < MAX_READ_DATA_SIZE) ? device->packet.NumBytes : MAX_READ_DATA_SIZE;
+        if (ready && IsSentinelValid(device->packet.Sentinel) && (count > length))
         {
-            break;
+            // the report again, as far as the data's checksum
+            length = count;
+            data[3] = 0;
+            data[4] = 0;
+            BL_read(&device->target, data, READ_STATUS_SIZE + length + READ_CHECKSUM_SIZE);
         }
-        delay(10);
+        ParseReadPacket(&device->packet, data);
+        device->waitSuccess = ready && IsSentinelValid(device->packet.Sentinel);
+    }
+    else if (BL_read_status(&device->target, data) == READ_STATUS_SIZE)
+    {
+        ParseStatus(&device->packet, data);
+        ready = IsSentinelValid(device->packet.Sentinel) && ((device->packet.Flags & STATUS_BUSY_BIT) == 0);
+        if (device->waitOperation == BLOp_InvokeBootloader)
+        {
+            ready = Rebooted(device) && ready && IsBootloaderMode(device->packet.Sentinel);
+        }
+        else if (device->waitOperation == BLOp_Reset)
+        {
+            ready = Rebooted(device) && ready;
+        }
+        device->waitSuccess = ready;
+    }
+    else
+    {
+        device->waitRebooted = true;  // not answering
+    }
+    device->waitPolls++;
+
+    elapsed_us = micros() - device->waitStart_us;
+    if (device->waitOperation == WAIT_PACKET)
+    {
+        over = ready || (device->waitPolls >= GET_PACKET_RETRIES);
+    }
+    else
+    {
+        over = ready || (elapsed_us > device->waitFixedDelay_us + READY_TIMEOUT_US);
+    }
+
+    if (over == false)
+    {
+        device->waitNext_us = micros() + device->waitInterval_us;
+        if (device->waitInterval_us < POLL_MAX_US)
+        {
+            device->waitInterval_us *= 2;
+        }
+        return false;
+    }
+
+    device->waiting = false;
+    if (device->waitOperation < BLOp_Count)
+    {
+        LearnTiming(device, elapsed_us, elapsed_us - late_us);
+    }
+    return true;
+}
+
+
+//InvokeBootloader and Reset: the part finishes what it's doing before it reboots, and until
+//then it answers with the status it had. That's no use: it isn't in the bootloader yet, or it
+//still reports the image it ran before the reset. It has rebooted once it's stopped answering,
+//or answers with another sentinel or active image. One that did it between two status reads
+//is taken to have after the fixed delay.
+static bool Rebooted(bl_device *device)
+{
+    if ((device->packet.Sentinel != device->waitSentinel) ||
+        ((device->packet.Flags ^ device->waitFlags) & STATUS_ACTIVE_IMAGE))
+    {
+        device->waitRebooted = true;
+    }
+    return device->waitRebooted || ((uint32_t)(micros() - device->waitStart_us) >= device->waitFixedDelay_us);
+}
+
+
+//Counts the wait that's just finished, and learns from it how long the operation takes.
+//sample_us is the wait without the time the last status read was late by: the device could
+//have been ready when it was due, so that's the host's time, not the device's.
+static void LearnTiming(bl_device *device, uint32_t elapsed_us, uint32_t sample_us)
+{
+    bl_op_timing *timing = &device->timing[device->waitOperation];
+    uint32_t units = device->waitUnits;
+    int32_t error_us;
+
+    timing->count++;
+    timing->polls += device->waitPolls;
+    timing->last_us = elapsed_us;
+    timing->total_us += elapsed_us;
+    timing->fixedDelay_us += device->waitFixedDelay_us;
+
+    //A short write's fixed overhead makes it look slow per byte, so it counts for less, and
+    //for nothing until a full one has been timed.
+    if (device->waitSuccess && (units > 0) &&
+        ((device->waitOperation != BLOp_Write) || (units >= MAX_DATA_PAYLOAD_SIZE) || (timing->learned_us > 0)))
+    {
+        //Ready at the first read after the sleep means it took less than this (by how much
+        //isn't known), so it counts as a bit less, or the estimate could only ever grow.
+        if ((device->waitExpected_us > 0) && (device->waitPolls == 1))
+        {
+            sample_us -= sample_us / 4;
+        }
+
+        //move a quarter of the way to this one
+        error_us = ((int32_t)(sample_us / units) - (int32_t)timing->learned_us) / 4;
+        if ((device->waitOperation == BLOp_Write) && (units < MAX_DATA_PAYLOAD_SIZE))
+        {
+            error_us = error_us * (int32_t)units / MAX_DATA_PAYLOAD_SIZE;
+        }
+        timing->learned_us = (timing->learned_us == 0) ? (sample_us / units) : (timing->learned_us + error_us);
     }
-    return success;
 }
 
 
@@ -151,198 +393,789 @@ static bool IsSentinelValid(uint16_t sentinel)
 }
 
 
-//returns false if Sentinel is invalid or if status shows error
-static bool CheckStatusAndError(void)
+//the image a dual image part runs (or would)
+static uint8_t ActiveImage(bl_read_packet *packet)
+{
+    return (packet->Flags & STATUS_ACTIVE_IMAGE) >> STATUS_ACTIVE_IMAGE_SHIFT;
+}
+
+
+//returns the next count bytes of the image (count is MAX_DATA_PAYLOAD_SIZE at most), NULL if
+//a compressed image is corrupt or ends early, or a streamed one has been given up on
+static const uint8_t *ReadImage(bl_device *device, uint32_t count)
 {
-    if ((GetPacket(&g_packet, true) == false) || (g_packet.LastError != NO_ERROR))
+    const uint8_t *data;
+
+    if (device->buf)
     {
-        return false;
+        data = &device->buf[device->position];
+        device->position += count;
+        return data;
     }
-    return true;
+    if (device->stream)
+    {
+        // a chunk is a write, it's used where it arrived
+        data = IStream_chunk(device->stream, device->position);
+        device->position += count;
+        return data;
+    }
+    if (CImage_read(&device->reader, device->payloadBuffer, count) != count)
+    {
+        return NULL;
+    }
+    device->position += count;
+    return device->payloadBuffer;
 }
 
 
-static bool InvokeBootloader(void)
+//Moves on (or back) to offset in the image, so ReadImage reads from there. A compressed image
+//is opened again to go back, and decompressed up to it. A streamed one can't be moved in.
+//returns false if it couldn't be
+static bool SeekImage(bl_device *device, uint32_t offset)
 {
-    BL_cmd_invoke_bootloader();
-    delay(100);
+    uint32_t count;
 
-    return CheckStatusAndError();
+    if (device->stream)
+    {
+        return offset == device->position;
+    }
+    if (device->buf)
+    {
+        device->position = offset;
+        return true;
+    }
+    if (offset < device->position)
+    {
+        if (CImage_open(&device->reader, device->compressed, device->compressedSize) == false)
+        {
+            return false;
+        }
+        device->position = 0;
+    }
+    while (device->position < offset)
+    {
+        count = offset - device->position;
+        if (count > MAX_DATA_PAYLOAD_SIZE)
+        {
+            count = MAX_DATA_PAYLOAD_SIZE;
+        }
+        if (ReadImage(device, count) == NULL)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 
-static bool FormatImage(const uint8_t *buf, bl_read_packet *packet)
+//a streamed image's next chunk hasn't arrived yet (and the PC hasn't been given up on)
+static bool ImagePending(bl_device *device)
 {
-    uint32_t EntryPoint;
+    return (device->stream != NULL) && (device->waiting == false) && (device->step == BLStep_Write) &&
+           !device->stream->aborted && (IStream_chunk(device->stream, device->offset) == NULL);
+}
 
-    EntryPoint = buf[4] | ( buf[5] << 8 ) | ( buf[6] << 16 ) | ( buf[7] << 24 );
 
-    BL_cmd_format_image(0, 1, EntryPoint);
-    delay(packet->WriteDelay * 10);
+//returns true once nothing has come from the PC for STREAM_TIMEOUT_US
+static bool HostSilent(istream *stream, uint32_t *frames, uint32_t *heard_us)
+{
+    if (stream->frames != *frames)
+    {
+        *frames = stream->frames;
+        *heard_us = micros();
+    }
+    return (micros() - *heard_us) > STREAM_TIMEOUT_US;
+}
+
 
-    return CheckStatusAndError();
+//the delay the device asks for after a write, in ms per 100 bytes
+static uint32_t WriteFixedDelay(bl_read_packet *packet, uint32_t payloadSize)
+{
+    if (payloadSize * packet->WriteDelay > 100)
+    {
+        return (packet->WriteDelay * payloadSize / 100) * 1000;
+    }
+    return 1000;
 }
 
 
-static bool FormatRegion(
-        const uint8_t *buf,
-        uint32_t address,
-        uint32_t numBytes,
-        bl_read_packet *packet)
+//Sends the command for the device's step and starts waiting for it to finish.
+//returns false if it couldn't be sent, the image couldn't be read
+static bool StartStep(bl_device *device)
 {
-    BL_cmd_format_region(0, address, numBytes, Fletcher32(buf, numBytes));
-    delay( (packet->FormatDelay * ((numBytes / 1024) + 1)) );
+    bl_target *target = &device->target;
+    bl_read_packet *packet = &device->packet;
+    uint32_t kilobytes;
+    uint32_t unit;
 
-    return CheckStatusAndError();
+    switch (device->step)
+    {
+        case BLStep_Status:
+            StartWait(device, WAIT_PACKET, 0, 0);
+            break;
+
+        case BLStep_Hardware:
+            BL_request_read(target, BL_HWID_ADDRESS, BL_HWID_SIZE);
+            StartWait(device, WAIT_PACKET, BL_HWID_SIZE, 0);
+            break;
+
+        case BLStep_ResetFirst:
+        case BLStep_Reset:
+            BL_cmd_reset(target);
+            StartWait(device, BLOp_Reset, 1, 100000);
+            break;
+
+        case BLStep_InvokeBootloader:
+            BL_cmd_invoke_bootloader(target);
+            StartWait(device, BLOp_InvokeBootloader, 1, 100000);
+            break;
+
+        case BLStep_FormatImage:
+        case BLStep_EraseImage:
+            Checkpoint(device, false);
+            BL_cmd_format_image(target, device->imageType, device->regionCount, device->entryPoint);
+            StartWait(device, BLOp_FormatImage, 1, packet->WriteDelay * 10 * 1000UL);
+            break;
+
+        case BLStep_FormatRegion:
+            kilobytes = (device->numBytes / 1024) + 1;
+            BL_cmd_format_region(target, device->region, device->address, device->numBytes, device->checksum);
+            StartWait(device, BLOp_FormatRegion, kilobytes, packet->FormatDelay * kilobytes * 1000UL);
+            break;
+
+        case BLStep_Resume:
+            // up to the checkpoint, as much as a read holds in AtomicWriteSize units
+            unit = (packet->AtomicWriteSize > 0) ? packet->AtomicWriteSize : 1;
+            device->length = (MAX_READ_DATA_SIZE / unit) * unit;
+            if (device->length > device->checkpoint->verified - device->offset)
+            {
+                device->length = device->checkpoint->verified - device->offset;
+            }
+            device->data = NULL;
+            if (SeekImage(device, device->offset))
+            {
+                device->data = ReadImage(device, device->length);
+            }
+            if (device->data == NULL)
+            {
+                return false;
+            }
+            BL_request_read(target, device->address + device->offset, (uint16_t)device->length);
+            StartWait(device, WAIT_PACKET, device->length, 0);
+            break;
+
+        case BLStep_Unchanged:
+        case BLStep_Validate:
+            BL_cmd_validate(target, 1);
+            StartWait(device, BLOp_Validate, 1, 100000);
+            break;
+
+        case BLStep_ReadBack:
+            // as much as a read holds, in AtomicWriteSize units (the first may start part way
+            // into one), so what's changed can be written in whole units
+            unit = (packet->AtomicWriteSize > 0) ? packet->AtomicWriteSize : 1;
+            device->length = ((MAX_READ_DATA_SIZE / unit) * unit) - ((device->address + device->offset) % unit);
+            if (device->length > device->numBytes - device->offset)
+            {
+                device->length = device->numBytes - device->offset;
+            }
+            device->data = ReadImage(device, device->length);
+            if (device->data == NULL)
+            {
+                return false;
+            }
+            BL_request_read(target, device->address + device->offset, (uint16_t)device->length);
+            StartWait(device, WAIT_PACKET, device->length, 0);
+            break;
+
+        case BLStep_Write:
+            // a differential update's chunk, and what's changed in it, is set by the readback
+            if ((device->differential == false) || device->erased)
+            {
+                device->length = device->numBytes - device->offset;
+                if (device->length > MAX_DATA_PAYLOAD_SIZE)
+                {
+                    device->length = MAX_DATA_PAYLOAD_SIZE;
+                }
+                device->data = ReadImage(device, device->length);
+                if (device->data == NULL)
+                {
+                    return false;
+                }
+                device->first = 0;
+                device->last = device->length;
+            }
+            BL_cmd_write(target, device->address + device->offset + device->first, device->last - device->first,
+                         &device->data[device->first]);
+            if (device->stream)
+            {
+                // it's been sent, the PC can send the next one while the part writes this
+                IStream_release(device->stream, device->offset);
+            }
+            StartWait(device, BLOp_Write, device->last - device->first,
+                      WriteFixedDelay(packet, device->last - device->first));
+            break;
+
+        case BLStep_Flush:
+            BL_cmd_flush(target);
+            StartWait(device, BLOp_Flush, 1, 10000);
+            break;
+    }
+    return true;
 }
 
 
-//returns true success, false for error
-static bool WriteImage(
-        const uint8_t *buf,
-        uint32_t address,
-        uint32_t numBytes,
-        bl_read_packet *packet)
+//Compares the chunk read back with the image, and sets first..last to the span from the
+//first to the last changed AtomicWriteSize unit. If it couldn't be read back it's all changed.
+//returns true if anything has changed
+static bool ReadBackChanged(bl_device *device)
 {
-    uint32_t Length;
-    uint32_t PayloadSize;
-    bool success = true;
-
-    Length = numBytes;
-    while (Length > 0)
+    bl_read_packet *packet = &device->packet;
+    uint32_t start = device->address + device->offset;
+    uint32_t unit = (packet->AtomicWriteSize > 0) ? packet->AtomicWriteSize : 1;
+    uint32_t first = 0;
+    uint32_t last = device->length;
+    uint32_t i;
+
+    if (device->waitSuccess && (packet->LastError == NO_ERROR) && (packet->NumBytes >= device->length))
     {
-        if (Length > MAX_DATA_PAYLOAD_SIZE)
+        while ((first < last) && (packet->Data[first] == device->data[first]))
         {
-            PayloadSize = MAX_DATA_PAYLOAD_SIZE;
+            first++;
         }
-        else
+        while ((last > first) && (packet->Data[last - 1] == device->data[last - 1]))
         {
-            PayloadSize = Length;
+            last--;
         }
-
-        BL_cmd_write(
-                address + numBytes - Length,
-                PayloadSize,
-                &buf[numBytes - Length] );
-
-        if (PayloadSize * packet->WriteDelay > 100)
+        // out to the units they're in
+        if (first < last)
         {
-            delay(packet->WriteDelay * PayloadSize / 100);
-        }
-        else
-        {
-            delay(1);
+            first -= (start + first) % unit;
+            i = (start + last) % unit;
+            if (i > 0)
+            {
+                last += unit - i;
+            }
+            if (last > device->length)
+            {
+                last = device->length;
+            }
         }
+    }
+    device->first = first;
+    device->last = last;
+    return first < last;
+}
+
+
+//The chunk read back has changed, and it's all 0xFF: the bootloader erased the region on
+//FormatRegion, so nothing after it will match either.
+static bool ReadBackErased(bl_device *device)
+{
+    bl_read_packet *packet = &device->packet;
+    uint32_t i;
 
-        if(CheckStatusAndError() == false)
+    if (!device->waitSuccess || (packet->LastError != NO_ERROR) || (packet->NumBytes < device->length))
+    {
+        return false;
+    }
+    for (i = 0; i < device->length; i++)
+    {
+        if (packet->Data[i] != 0xFF)
         {
-            success = false;
-            break;
+            return false;
         }
-        Length -= PayloadSize;
     }
-    return success;
+    return true;
 }
 
 
-static bool Flush(void)
+//a container that names the hardware it's for
+static bool HardwareKnown(bl_device *device)
 {
-    BL_cmd_flush();
-    delay(10);
+    fwimage *container = &device->container;
 
-    return CheckStatusAndError();
+    return (container->data != NULL) &&
+           ((container->vendorId != 0) || (container->productId != 0) || (container->revision != 0));
 }
 
 
-static bool Validate(void)
+//the HWID has been read back, and each of the container's IDs that isn't 0 matches it
+static bool HardwareMatches(bl_device *device)
 {
-    BL_cmd_validate(1);
-    delay(100);
+    bl_read_packet *packet = &device->packet;
+    fwimage *container = &device->container;
+    uint16_t vendorId = packet->Data[0] | (packet->Data[1] << 8);
+    uint16_t productId = packet->Data[2] | (packet->Data[3] << 8);
+    uint16_t revision = packet->Data[4] | (packet->Data[5] << 8);
 
-    if ((CheckStatusAndError()) && (g_packet.Flags & STATUS_VALID_IMAGE))
+    if (!device->waitSuccess || (packet->LastError != NO_ERROR) || (packet->NumBytes < BL_HWID_SIZE))
     {
-        return true;
+        return false;
+    }
+    return ((container->vendorId == 0) || (container->vendorId == vendorId)) &&
+           ((container->productId == 0) || (container->productId == productId)) &&
+           ((container->revision == 0) || (container->revision == revision));
+}
+
+
+//makes the container's region index the one formatted or written (buf..checksum), from its start
+static void SelectRegion(bl_device *device, uint8_t index)
+{
+    fwimage_region region;
+
+    if (FWImage_region(&device->container, index, &region))
+    {
+        device->region = index;
+        device->buf = region.data;
+        device->numBytes = region.size;
+        device->address = region.address;
+        device->checksum = region.checksum;
+        device->position = 0;
+        device->offset = 0;
     }
-    return false;
 }
 
 
-static bool Reset(void)
+//the step after a chunk: the next one, the first of a container's next region, or the flush
+static uint8_t NextChunk(bl_device *device)
 {
-    BL_cmd_reset();
-    delay(100);
+    if ((device->offset >= device->numBytes) && (device->region + 1 < device->regionCount))
+    {
+        SelectRegion(device, device->region + 1);
+    }
+    if (device->offset < device->numBytes)
+    {
+        return (device->differential && !device->erased) ? BLStep_ReadBack : BLStep_Write;
+    }
+    return BLStep_Flush;
+}
+
+
+//the device's checkpoint is of this image, and the part still has its region's header
+static bool Resumable(bl_device *device)
+{
+    bl_checkpoint *checkpoint = device->checkpoint;
+
+    return (checkpoint != NULL) && checkpoint->formatted && !device->differential && (device->stream == NULL) &&
+           !device->background && (device->regionCount == 1) && (checkpoint->address == device->address) &&
+           (checkpoint->numBytes == device->numBytes) && (checkpoint->checksum == device->checksum);
+}
+
+
+//Keeps where the update has got to in the device's checkpoint, if it has one. formatted: the
+//part has the region's header, and everything before offset has been written. A differential
+//or streamed update, one in the background, or a container with more than one region starts
+//again instead.
+static void Checkpoint(bl_device *device, bool formatted)
+{
+    bl_checkpoint *checkpoint = device->checkpoint;
+
+    if (checkpoint == NULL)
+    {
+        return;
+    }
+    checkpoint->address = device->address;
+    checkpoint->numBytes = device->numBytes;
+    checkpoint->checksum = device->checksum;
+    checkpoint->formatted = formatted && !device->differential && (device->stream == NULL) && !device->background &&
+                            (device->regionCount == 1);
+    checkpoint->verified = checkpoint->formatted ? device->offset : 0;
+}
+
+
+//picks the step after the one that's just finished, success says whether the device finished it
+static void NextStep(bl_device *device, bool success)
+{
+    bl_read_packet *packet = &device->packet;
+    bool noError = success && (packet->LastError == NO_ERROR);
+    uint32_t unit = (packet->AtomicWriteSize > 0) ? packet->AtomicWriteSize : 1;
+    uint32_t verified;
+
+    switch (device->step)
+    {
+        case BLStep_Status:
+        case BLStep_ResetFirst:
+        case BLStep_Hardware:
+            if ((device->step == BLStep_Status) && !noError)
+            {
+                device->step = BLStep_ResetFirst;
+            }
+            else if ((device->step == BLStep_ResetFirst) && (packet->LastError != NO_ERROR))
+            {
+                Failed(device, packet->LastError, false);
+            }
+            else if ((device->step != BLStep_Hardware) && HardwareKnown(device))
+            {
+                device->step = BLStep_Hardware;
+            }
+            else if ((device->step == BLStep_Hardware) && !HardwareMatches(device))
+            {
+                //nothing has been done to it
+                device->error = BLProgErr_Hardware;
+                device->step = BLStep_Done;
+            }
+            else if ((packet->Flags & STATUS_DUAL_IMAGE) && IsImageMode(packet->Sentinel))
+            {
+                //A dual image part programs the other image while it keeps running this one,
+                //so it's only out of service for the reset at the end, which switches.
+                device->background = true;
+                device->imageType = ActiveImage(packet) ^ 1;
+                device->step = BLStep_FormatImage;
+            }
+            else if (IsBootloaderMode(packet->Sentinel) && Resumable(device))
+            {
+                //carry on from the checkpoint. The last chunk written is read back first, it
+                //could have been cut off part way through.
+                verified = device->checkpoint->verified;
+                device->offset = (verified > MAX_DATA_PAYLOAD_SIZE) ? (verified - MAX_DATA_PAYLOAD_SIZE) : 0;
+                device->offset -= (device->address + device->offset) % unit;
+                device->step = (device->offset < verified) ? BLStep_Resume : BLStep_Write;
+            }
+            else if (IsBootloaderMode(packet->Sentinel))
+            {
+                device->step = BLStep_FormatImage;
+            }
+            else
+            {
+                device->step = BLStep_InvokeBootloader;
+            }
+            if ((packet->Flags & STATUS_DUAL_IMAGE) && !device->background)
+            {
+                device->imageType = ActiveImage(packet) ^ 1;
+            }
+            break;
+
+        case BLStep_InvokeBootloader:
+            if (noError)
+            {
+                device->step = BLStep_FormatImage;
+            }
+            else
+            {
+                Failed(device, BLProgErr_InvokeBootloader, false);
+            }
+            break;
+
+        case BLStep_FormatImage:
+            if (noError)
+            {
+                device->step = BLStep_FormatRegion;
+            }
+            else
+            {
+                Failed(device, BLProgErr_FormatImage, false);
+            }
+            break;
+
+        case BLStep_FormatRegion:
+            if (noError && (device->region + 1 < device->regionCount))
+            {
+                SelectRegion(device, device->region + 1);
+            }
+            else if (noError)
+            {
+                //all of them, the writes start from the first
+                SelectRegion(device, 0);
+                Checkpoint(device, true);
+                device->step = device->differential ? BLStep_Unchanged : BLStep_Write;
+            }
+            else
+            {
+                Failed(device, BLProgErr_FormatRegion, false);
+            }
+            break;
+
+        case BLStep_Resume:
+            if (device->data == NULL)
+            {
+                Checkpoint(device, false);
+                Failed(device, BLProgErr_WriteImage, true);
+            }
+            else if (ReadBackChanged(device))
+            {
+                //where it was cut off, it's written again from here
+                if (SeekImage(device, device->offset))
+                {
+                    device->step = BLStep_Write;
+                }
+                else
+                {
+                    Checkpoint(device, false);
+                    Failed(device, BLProgErr_WriteImage, true);
+                }
+            }
+            else
+            {
+                device->offset += device->length;
+                if (device->offset < device->checkpoint->verified)
+                {
+                    device->step = BLStep_Resume;
+                }
+                else
+                {
+                    device->step = NextChunk(device);
+                }
+            }
+            break;
+
+        case BLStep_Unchanged:
+            if (noError && (packet->Flags & STATUS_VALID_IMAGE))
+            {
+                //the region checksum already matches the flash, nothing has changed
+                device->step = BLStep_Reset;
+            }
+            else
+            {
+                device->step = BLStep_ReadBack;
+            }
+            break;
+
+        case BLStep_ReadBack:
+            if (device->data == NULL)
+            {
+                Failed(device, BLProgErr_WriteImage, true);
+            }
+            else if (ReadBackChanged(device))
+            {
+                if (ReadBackErased(device) && SeekImage(device, device->offset))
+                {
+                    //reading the rest back would only cost time, it's written from this chunk
+                    //on as BL_program writes it
+                    device->erased = true;
+                }
+                device->step = BLStep_Write;
+            }
+            else
+            {
+                device->offset += device->length;
+                device->step = NextChunk(device);
+            }
+            break;
+
+        case BLStep_Write:
+            if (noError)
+            {
+                device->bytesWritten += device->last - device->first;
+                device->offset += device->length;
+                Checkpoint(device, true);
+                device->step = NextChunk(device);
+            }
+            else if (device->stream && device->stream->aborted)
+            {
+                Failed(device, BLProgErr_Stream, true);
+            }
+            else
+            {
+                //The part answering with an error means what it has can't be carried on
+                //from. If it stopped answering (it lost power) the checkpoint is kept.
+                if (success)
+                {
+                    Checkpoint(device, false);
+                }
+                Failed(device, BLProgErr_WriteImage, true);
+            }
+            break;
+
+        case BLStep_Flush:
+            if (noError)
+            {
+                device->step = BLStep_Validate;
+            }
+            else
+            {
+                if (success)
+                {
+                    Checkpoint(device, false);
+                }
+                Failed(device, BLProgErr_Flush, true);
+            }
+            break;
 
-    return CheckStatusAndError();
+        case BLStep_Validate:
+            if (success)
+            {
+                Checkpoint(device, false);
+            }
+            if (noError && (packet->Flags & STATUS_VALID_IMAGE))
+            {
+                device->step = BLStep_Reset;
+            }
+            else
+            {
+                Failed(device, BLProgErr_Validate, true);
+            }
+            break;
+
+        case BLStep_EraseImage:
+            device->step = device->background ? BLStep_Done : BLStep_Reset;
+            break;
+
+        case BLStep_Reset:
+            if (!noError)
+            {
+                device->error = BLProgErr_Reset;
+            }
+            else if ((device->error == BLProgErr_OK) && (packet->Flags & STATUS_DUAL_IMAGE) &&
+                     (ActiveImage(packet) != device->imageType))
+            {
+                device->error = BLProgErr_Switch;
+            }
+            device->step = BLStep_Done;
+            break;
+    }
+}
+
+
+//an error goes on to the reset, any error after writing began requires erasing the image first,
+//unless the checkpoint is to carry on from it (it hasn't been validated, so it won't run).
+//A dual image part updating in the background isn't reset: it's still running the image it had.
+static void Failed(bl_device *device, uint16_t error, bool eraseImage)
+{
+    device->error = error;
+    if (eraseImage && !Resumable(device))
+    {
+        device->step = BLStep_EraseImage;
+    }
+    else
+    {
+        device->step = device->background ? BLStep_Done : BLStep_Reset;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 //Public Functions
 ///////////////////////////////////////////////////////////////////////////////
 
+//A part that reports STATUS_DUAL_IMAGE while it's running an image keeps running it: the other
+//image is formatted (the FormatImage ImageType), written and validated, and the reset at the
+//end starts it, which is all the time the part is out of service. If the update fails before
+//then the part isn't reset, the image it's running is untouched.
 //returns either ErrorCodes or BLProgramErrors
 uint16_t BL_program(const uint8_t *buf, uint32_t numBytes, uint32_t address)
 {
-    uint16_t error = 0;
-    bool erase_image = false;
+    return BL_program_image(buf, numBytes, address, 0, false, NULL);
+}
+
+
+//Like BL_program, but only writes what differs from the image already in the device. After
+//the region is formatted with the new checksum it's validated: if that passes nothing has
+//changed and nothing is written. Otherwise each chunk is read back and compared first, which
+//is quicker when the device's write takes longer than the readback and little has changed.
+//It's meant for bootloaders that keep the flash through FormatRegion. On one that erases it
+//the first chunk that's changed reads back erased, and from there it's written as BL_program
+//writes it, so that costs the Validate and a readback more than BL_program.
+//bytesWritten (if not NULL) is set to the number of bytes written.
+//returns either ErrorCodes or BLProgramErrors
+uint16_t BL_program_differential(const uint8_t *buf, uint32_t numBytes, uint32_t address, uint32_t *bytesWritten)
+{
+    return BL_program_image(buf, numBytes, address, 0, true, bytesWritten);
+}
+
+
+//BL_program (or BL_program_differential) with the image's Fletcher32 worked out beforehand,
+//as the FW_*.h headers hold it (<name>_checksum, from ImageCompressor -c), so it isn't
+//computed over the whole image before anything is sent. A Fletcher32 is never 0, so a
+//checksum of 0 means it isn't known and is computed here.
+//returns either ErrorCodes or BLProgramErrors
+uint16_t BL_program_image(const uint8_t *buf, uint32_t numBytes, uint32_t address, uint32_t checksum,
+                          bool differential, uint32_t *bytesWritten)
+{
+    SetDefaultTarget();
+    BL_device_start(&g_device, buf, numBytes, address, checksum, differential);
+    BL_program_devices(&g_device, 1);
 
-    if (CheckStatusAndError() == false)
+    if (bytesWritten)
     {
-        if (Reset() == false)
-        {
-            error = g_packet.LastError;
-        }
+        *bytesWritten = g_device.bytesWritten;
     }
+    return g_device.error;
+}
+
 
-    if (!error)
+//Programs a compressed image (see CompressedImage.h), decompressing it a block at a time as
+//it's written. The image holds its address, entry point and checksum.
+//differential and bytesWritten are as BL_program_differential, bytesWritten may be NULL.
+//returns either ErrorCodes or BLProgramErrors
+uint16_t BL_program_compressed(const uint8_t *image, uint32_t size, bool differential, uint32_t *bytesWritten)
+{
+    SetDefaultTarget();
+    if (BL_device_start_compressed(&g_device, image, size, differential))
     {
-        if (!IsBootloaderMode(g_packet.Sentinel))
-        {
-            if(InvokeBootloader() == false)
-            {
-                error = BLProgErr_InvokeBootloader;
-            }
-        }
+        BL_program_devices(&g_device, 1);
     }
 
-    if (!error)
+    if (bytesWritten)
     {
-        if(FormatImage(buf, &g_packet) == false)
-        {
-            error = BLProgErr_FormatImage;
-        }
-        else if(FormatRegion(buf, address, numBytes, &g_packet) == false)
-        {
-            error = BLProgErr_FormatRegion;
-        }
-        else if(WriteImage(buf, address, numBytes, &g_packet) == false)
-        {
-            error = BLProgErr_WriteImage;
-            erase_image = true;
-        }
-        else if (Flush() == false)
-        {
-            error = BLProgErr_Flush;
-            erase_image = true;
-        }
-        else if (Validate() == false)
+        *bytesWritten = g_device.bytesWritten;
+    }
+    return g_device.error;
+}
+
+
+//Programs a container (see FirmwareImage.h): if it names the hardware it's for, the part's
+//HWID is checked first, then each region is formatted (FormatImage is told how many) and
+//written from where it is in the container. What isn't in a region isn't written.
+//differential and bytesWritten are as BL_program_differential, bytesWritten may be NULL.
+//returns either ErrorCodes or BLProgramErrors
+uint16_t BL_program_container(const uint8_t *image, uint32_t size, bool differential, uint32_t *bytesWritten)
+{
+    SetDefaultTarget();
+    if (BL_device_start_container(&g_device, image, size, differential))
+    {
+        BL_program_devices(&g_device, 1);
+    }
+
+    if (bytesWritten)
+    {
+        *bytesWritten = g_device.bytesWritten;
+    }
+    return g_device.error;
+}
+
+
+//Programs an image as the PC sends it (see ImageStream.h), once its ISTREAM_START has come.
+//receive feeds the stream what comes from the PC, and returns after wait_us: that's the time
+//the part is busy, so the next chunk arrives while it writes this one. The PC is sent the
+//result. If it goes quiet for STREAM_TIMEOUT_US while it's waited for, it's given up on.
+//returns either ErrorCodes or BLProgramErrors
+uint16_t BL_program_stream(istream *stream, void (*receive)(istream *stream, uint32_t wait_us))
+{
+    uint32_t frames = stream->frames;
+    uint32_t heard_us = micros();
+    uint32_t wait_us;
+
+    while ((stream->started == false) && (stream->aborted == false))
+    {
+        receive(stream, STREAM_POLL_US);
+        if (HostSilent(stream, &frames, &heard_us))
         {
-            error = BLProgErr_Validate;
-            erase_image = true;
+            IStream_abort(stream);
         }
     }
 
-    //any error after WriteImage requires erasing the image
-    if (erase_image)
+    if (stream->aborted)
     {
-        FormatImage(buf, &g_packet);
+        g_device.error = BLProgErr_Stream;
+        g_device.bytesWritten = 0;
     }
-
-    if (Reset() == false)
+    else
     {
-        error = BLProgErr_Reset;
+        SetDefaultTarget();
+        BL_device_start_stream(&g_device, stream);
+        while (BL_device_run(&g_device, &wait_us))
+        {
+            receive(stream, wait_us);
+            if (HostSilent(stream, &frames, &heard_us) && ImagePending(&g_device))
+            {
+                IStream_abort(stream);
+            }
+        }
+        g_device.stream = NULL;
     }
 
-    return error;
+    IStream_finish(stream, g_device.error, g_device.bytesWritten);
+    return g_device.error;
 }
 
 
@@ -352,21 +1185,22 @@ uint16_t BL_cmd_read_memory(uint32_t offset, uint16_t numBytes, uint8_t *data)
     uint16_t i;
     uint16_t count;
 
-    BL_request_read(offset, numBytes);
+    SetDefaultTarget();
+    BL_request_read(&g_device.target, offset, numBytes);
 
-    if (GetPacket(&g_packet, true) == false)
+    if (GetPacket(&g_device, numBytes) == false)
     {
         return 0;
     }
 
     count = numBytes;
-    if (numBytes > g_packet.NumBytes)
+    if (numBytes > g_device.packet.NumBytes)
     {
-        count = g_packet.NumBytes;
+        count = g_device.packet.NumBytes;
     }
     for (i = 0; i < count; i++)
     {
-        data[i] = g_packet.Data[i];
+        data[i] = g_device.packet.Data[i];
     }
 
     return count;
@@ -375,7 +1209,258 @@ uint16_t BL_cmd_read_memory(uint32_t offset, uint16_t numBytes, uint8_t *data)
 
 bool BL_get_status(bl_read_packet *packet)
 {
-    return GetPacket(packet, true);
+    bool success;
+
+    SetDefaultTarget();
+    success = GetPacket(&g_device, 0);
+
+    *packet = g_device.packet;
+    return success;
+}
+
+
+void BL_get_timing(uint8_t operation, bl_op_timing *timing)
+{
+    if (operation < BLOp_Count)
+    {
+        *timing = g_device.timing[operation];
+    }
+}
+
+
+//BL_program, BL_program_image and BL_program_compressed keep how far they get in checkpoint
+//from now on (NULL to stop), and carry on from it (see bl_checkpoint)
+void BL_set_checkpoint(bl_checkpoint *checkpoint)
+{
+    g_device.checkpoint = checkpoint;
+}
+
+
+void BL_reset_timing(bool forgetLearned)
+{
+    uint8_t i;
+    uint32_t learned_us;
+
+    for (i = 0; i < BLOp_Count; i++)
+    {
+        learned_us = g_device.timing[i].learned_us;
+        memset(&g_device.timing[i], 0, sizeof(bl_op_timing));
+        if (!forgetLearned)
+        {
+            g_device.timing[i].learned_us = learned_us;
+        }
+    }
+}
+
+
+//Sets up a device on bus (I2C_BUS_WIRE.., see I2C.h, each set up with I2C_bus_init) at
+//address, with nothing learned of its timing yet.
+void BL_device_init(bl_device *device, uint8_t bus, uint8_t address)
+{
+    memset(device, 0, sizeof(bl_device));
+    device->target.bus = bus;
+    device->target.address = address;
+}
+
+
+//Starts an update of the device, as BL_program_image's, for BL_device_run (or
+//BL_program_devices) to carry out. buf must be kept until it's finished.
+void BL_device_start(bl_device *device, const uint8_t *buf, uint32_t numBytes, uint32_t address, uint32_t checksum,
+                     bool differential)
+{
+    device->buf = buf;
+    device->stream = NULL;
+    memset(&device->container, 0, sizeof(fwimage));
+    device->regionCount = 1;
+    device->region = 0;
+    device->position = 0;
+    device->numBytes = numBytes;
+    device->address = address;
+    device->entryPoint = buf[4] | ( buf[5] << 8 ) | ( buf[6] << 16 ) | ( buf[7] << 24 );
+    device->checksum = (checksum != 0) ? checksum : Fletcher32(buf, numBytes);
+    device->differential = differential;
+    device->erased = false;
+    device->background = false;
+    device->imageType = 0;
+    device->step = BLStep_Status;
+    device->error = BLProgErr_OK;
+    device->bytesWritten = 0;
+    device->offset = 0;
+    device->waiting = false;
 }
 
 
+//Starts an update of the device from a compressed image, as BL_program_compressed's.
+//returns false, and the device's error is BLProgErr_BadImage, if it isn't one
+bool BL_device_start_compressed(bl_device *device, const uint8_t *image, uint32_t size, bool differential)
+{
+    cimage_header *header = &device->reader.header;
+
+    device->bytesWritten = 0;
+    device->waiting = false;
+    if (CImage_open(&device->reader, image, size) == false)
+    {
+        device->error = BLProgErr_BadImage;
+        device->step = BLStep_Done;
+        return false;
+    }
+    device->buf = NULL;
+    device->compressed = image;
+    device->compressedSize = size;
+    device->stream = NULL;
+    memset(&device->container, 0, sizeof(fwimage));
+    device->regionCount = 1;
+    device->region = 0;
+    device->position = 0;
+    device->numBytes = header->imageSize;
+    device->address = header->address;
+    device->entryPoint = header->entryPoint;
+    device->checksum = header->checksum;
+    device->differential = differential;
+    device->erased = false;
+    device->background = false;
+    device->imageType = 0;
+    device->step = BLStep_Status;
+    device->error = BLProgErr_OK;
+    device->offset = 0;
+    return true;
+}
+
+
+//Starts an update of the device from a container, as BL_program_container's.
+//returns false, and the device's error is BLProgErr_BadImage, if it isn't one
+bool BL_device_start_container(bl_device *device, const uint8_t *image, uint32_t size, bool differential)
+{
+    device->bytesWritten = 0;
+    device->waiting = false;
+    memset(&device->container, 0, sizeof(fwimage));
+    if (FWImage_open(&device->container, image, size) == false)
+    {
+        memset(&device->container, 0, sizeof(fwimage));
+        device->error = BLProgErr_BadImage;
+        device->step = BLStep_Done;
+        return false;
+    }
+    device->stream = NULL;
+    device->regionCount = device->container.regionCount;
+    SelectRegion(device, 0);
+    device->entryPoint = device->container.entryPoint;
+    device->differential = differential;
+    device->erased = false;
+    device->background = false;
+    device->imageType = 0;
+    device->step = BLStep_Status;
+    device->error = BLProgErr_OK;
+    return true;
+}
+
+
+//Starts an update of the device from an image the PC sends, once its ISTREAM_START has come
+//(stream->started). It's written as it arrives, so all of it is: a streamed update isn't
+//differential.
+void BL_device_start_stream(bl_device *device, istream *stream)
+{
+    device->buf = NULL;
+    device->stream = stream;
+    memset(&device->container, 0, sizeof(fwimage));
+    device->regionCount = 1;
+    device->region = 0;
+    device->position = 0;
+    device->numBytes = stream->numBytes;
+    device->address = stream->address;
+    device->entryPoint = stream->entryPoint;
+    device->checksum = stream->checksum;
+    device->differential = false;
+    device->erased = false;
+    device->background = false;
+    device->imageType = 0;
+    device->step = BLStep_Status;
+    device->error = BLProgErr_OK;
+    device->bytesWritten = 0;
+    device->offset = 0;
+    device->waiting = false;
+}
+
+
+//Carries the device's update on as far as it goes without waiting: each time the device has
+//finished a command it's sent the next, otherwise this returns straight away.
+//wait_us (if not NULL) is set to how long until there's more to do.
+//returns false once the update has finished (device->error says how it went)
+bool BL_device_run(bl_device *device, uint32_t *wait_us)
+{
+    while (device->step != BLStep_Done)
+    {
+        if (ImagePending(device))
+        {
+            if (wait_us)
+            {
+                *wait_us = STREAM_POLL_US;
+            }
+            return true;
+        }
+        if ((device->waiting == false) && (StartStep(device) == false))
+        {
+            NextStep(device, false);
+            continue;
+        }
+        if (PollWait(device) == false)
+        {
+            if (wait_us)
+            {
+                *wait_us = TimeUntil(device->waitNext_us);
+            }
+            return true;
+        }
+        NextStep(device, device->waitSuccess);
+    }
+    if (wait_us)
+    {
+        *wait_us = 0;
+    }
+    return false;
+}
+
+
+//Programs the devices (each started with BL_device_start..) together, and returns when all
+//have finished. While one is busy the others are sent their next commands, so as long as
+//they're on different buses it takes not much longer than programming one.
+//returns the number that failed, each device's error says how
+uint8_t BL_program_devices(bl_device *devices, uint8_t count)
+{
+    uint8_t i;
+    uint8_t failed;
+    uint32_t wait_us;
+    uint32_t sleep_us;
+    bool running;
+
+    do
+    {
+        running = false;
+        sleep_us = UINT32_MAX;
+        for (i = 0; i < count; i++)
+        {
+            if (BL_device_run(&devices[i], &wait_us))
+            {
+                running = true;
+                if (wait_us < sleep_us)
+                {
+                    sleep_us = wait_us;
+                }
+            }
+        }
+        if (running && (sleep_us > 0))
+        {
+            SleepMicroseconds(sleep_us);
+        }
+    } while (running);
+
+    failed = 0;
+    for (i = 0; i < count; i++)
+    {
+        if (devices[i].error != BLProgErr_OK)
+        {
+            failed++;
+        }
+    }
+    return failed;
+}
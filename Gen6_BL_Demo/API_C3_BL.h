@@ -8,6 +8,9 @@ extern "C" {
 #endif
 
 #include "API_C3_I2C_Commands.h"
+#include "CompressedImage.h"
+#include "FirmwareImage.h"
+#include "ImageStream.h"
 
 #define STATUS_DUAL_IMAGE 0x01
 #define STATUS_ACTIVE_IMAGE 0x06
@@ -23,6 +26,10 @@ extern "C" {
 #define STATUS_FORCE_SHIFT 5
 #define STATUS_RSVD_SHIFT 7
 
+// the part's hardware ID: vendor, product and revision (uint16 each)
+#define BL_HWID_ADDRESS (0x2000080A)
+#define BL_HWID_SIZE (6)
+
 enum ErrorCodes
 {
     NO_ERROR = 0,
@@ -50,8 +57,36 @@ enum BLProgramErrors
     BLProgErr_Flush = 105,
     BLProgErr_Validate = 106,
     BLProgErr_Reset = 107,
+    BLProgErr_BadImage = 108,   // not a compressed image BL_program_compressed can take
+    BLProgErr_Stream = 109,     // BL_program_stream: the PC stopped sending the image, or gave up
+    BLProgErr_Switch = 110,     // a dual image part didn't start the image it was given after the reset
+    BLProgErr_Hardware = 111,   // BL_program_container: the container is for other hardware (or the HWID couldn't be read)
+};
+
+// Operations BL_program waits on. The wait polls the busy bit and learns how long each one
+// takes, so it is set by the device rather than by the worst case delays it reports.
+enum BLOperations
+{
+    BLOp_InvokeBootloader = 0,
+    BLOp_FormatImage = 1,
+    BLOp_FormatRegion = 2,   // learned per KB
+    BLOp_Write = 3,          // learned per byte
+    BLOp_Flush = 4,
+    BLOp_Validate = 5,
+    BLOp_Reset = 6,
+    BLOp_Count = 7,
 };
 
+typedef struct
+{
+    uint32_t learned_us;     // per KB for FormatRegion, per byte for Write, 0 until the first one
+    uint32_t last_us;        // the last wait
+    uint32_t total_us;       // every wait since BL_reset_timing
+    uint32_t fixedDelay_us;  // what the device's fixed delays would have added up to
+    uint16_t count;
+    uint16_t polls;          // status reads
+} bl_op_timing;
+
 typedef struct
 {
     uint16_t Sentinel;
@@ -67,9 +102,99 @@ typedef struct
     uint16_t Checksum;
 } bl_read_packet;
 
+//How far an update has got, kept by the host so one that's cut off (the part loses power, the
+//fixture's cable comes out) carries on from there the next time the same image is programmed,
+//rather than starting again. The part keeps the region's header (FormatImage, FormatRegion)
+//in flash, so that isn't done again, and the end of what was written is read back to find
+//where to write from. Zero it to start with. Differential and streamed updates don't use it.
+typedef struct
+{
+    uint32_t address;                   // the image it's for
+    uint32_t numBytes;
+    uint32_t checksum;
+    bool formatted;                     // the part holds the region's header, and nothing has failed since
+    uint32_t verified;                  // bytes from the start written, and acknowledged without an error
+} bl_checkpoint;
+
+//One part, the bus and address it's on, and everything an update of it needs: its status,
+//what's been learned of its timing, and where the update has got to. An update doesn't wait
+//in a delay, it's run a step at a time (BL_device_run), so parts on different buses can be
+//programmed at once: while one is busy writing the others are sent their next commands.
+//Set it up with BL_device_init. The BL_program.. functions use their own, on Wire at
+//I2C_SLAVE_ADDR.
+typedef struct
+{
+    bl_target target;
+    bl_read_packet packet;              // the last status (or report) read
+    bl_op_timing timing[BLOp_Count];
+    uint8_t dataBuffer[BL_REPORT_LEN];
+    uint8_t payloadBuffer[MAX_DATA_PAYLOAD_SIZE];
+    cimage_reader reader;
+
+    // the update, set up by BL_device_start
+    const uint8_t *buf;                 // the image, NULL for a compressed one (reader) or a streamed one
+    const uint8_t *compressed;          // the compressed one, to open again if the reader has to go back
+    uint32_t compressedSize;
+    istream *stream;                    // the streamed one, NULL otherwise
+    fwimage container;                  // a container's header (container.data is NULL otherwise)
+    uint8_t regionCount;                // 1 unless it's a container
+    uint8_t region;                     // the one being formatted or written, buf..checksum are its
+    bl_checkpoint *checkpoint;          // kept through the update if not NULL (it isn't set by BL_device_start)
+    uint32_t position;                  // read so far
+    uint32_t numBytes;
+    uint32_t address;
+    uint32_t entryPoint;
+    uint32_t checksum;
+    bool differential;
+    bool erased;                        // differential: the part erased the image on FormatRegion, the rest isn't read back
+    bool background;                    // a dual image part: the one it's running is kept until the reset
+    uint8_t imageType;                  // the image programmed: 0, or on a dual image part the one not running
+    uint8_t step;
+    uint16_t error;                     // ErrorCodes or BLProgramErrors, once it's finished
+    uint32_t bytesWritten;
+    uint32_t offset;                    // into the image, of the chunk being written
+    uint32_t length;                    // of the chunk
+    uint32_t first;                     // the part of it that's written, first..last
+    uint32_t last;
+    const uint8_t *data;                // the chunk
+
+    // the wait for the step's command to finish
+    bool waiting;
+    bool waitSuccess;
+    uint8_t waitOperation;              // BLOperations, or BLOp_Count for the report (GetPacket)
+    uint32_t waitUnits;                 // for the report, the data asked for
+    uint32_t waitFixedDelay_us;
+    uint32_t waitExpected_us;
+    uint32_t waitStart_us;
+    uint32_t waitNext_us;               // the next status read
+    uint32_t waitInterval_us;
+    uint16_t waitPolls;
+    uint16_t waitSentinel;              // InvokeBootloader, Reset: the status from before the command,
+    uint8_t waitFlags;                  // the part can answer with it until it reboots
+    bool waitRebooted;                  // it's been seen to
+} bl_device;
+
 bool BL_get_status(bl_read_packet *status);
 uint16_t BL_program(const uint8_t * buf, uint32_t numBytes, uint32_t address);
+uint16_t BL_program_differential(const uint8_t * buf, uint32_t numBytes, uint32_t address, uint32_t *bytesWritten);
+uint16_t BL_program_image(const uint8_t * buf, uint32_t numBytes, uint32_t address, uint32_t checksum,
+                          bool differential, uint32_t *bytesWritten);
+uint16_t BL_program_compressed(const uint8_t * image, uint32_t size, bool differential, uint32_t *bytesWritten);
+uint16_t BL_program_container(const uint8_t * image, uint32_t size, bool differential, uint32_t *bytesWritten);
+uint16_t BL_program_stream(istream *stream, void (*receive)(istream *stream, uint32_t wait_us));
 uint16_t BL_cmd_read_memory(uint32_t offset, uint16_t numBytes, uint8_t *data);
+void BL_get_timing(uint8_t operation, bl_op_timing *timing);
+void BL_reset_timing(bool forgetLearned);
+void BL_set_checkpoint(bl_checkpoint *checkpoint);
+
+void BL_device_init(bl_device *device, uint8_t bus, uint8_t address);
+void BL_device_start(bl_device *device, const uint8_t *buf, uint32_t numBytes, uint32_t address, uint32_t checksum,
+                     bool differential);
+bool BL_device_start_compressed(bl_device *device, const uint8_t *image, uint32_t size, bool differential);
+bool BL_device_start_container(bl_device *device, const uint8_t *image, uint32_t size, bool differential);
+void BL_device_start_stream(bl_device *device, istream *stream);
+bool BL_device_run(bl_device *device, uint32_t *wait_us);
+uint8_t BL_program_devices(bl_device *devices, uint8_t count);
 
 #ifdef __cplusplus
 }
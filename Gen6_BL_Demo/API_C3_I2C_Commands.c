@@ -31,133 +31,134 @@
 #define DUMMY_BYTE  (0xDB)
 
 /**** Private Functions  ****/
-static void I2C_write_16(uint16_t data)
+static void I2C_write_16(uint8_t bus, uint16_t data)
 {
-    I2C_write((uint8_t)(data >> 0));
-    I2C_write((uint8_t)(data >> 8));
+    I2C_bus_write(bus, (uint8_t)(data >> 0));
+    I2C_bus_write(bus, (uint8_t)(data >> 8));
 }
 
-static void I2C_write_32(uint32_t data)
+static void I2C_write_32(uint8_t bus, uint32_t data)
 {
-    I2C_write((uint8_t)(data >> 0));
-    I2C_write((uint8_t)(data >> 8));
-    I2C_write((uint8_t)(data >> 16));
-    I2C_write((uint8_t)(data >> 24));
+    I2C_bus_write(bus, (uint8_t)(data >> 0));
+    I2C_bus_write(bus, (uint8_t)(data >> 8));
+    I2C_bus_write(bus, (uint8_t)(data >> 16));
+    I2C_bus_write(bus, (uint8_t)(data >> 24));
 }
 
-static void I2C_write_SetFeatureReport(uint8_t cmd)
+static void I2C_write_SetFeatureReport(uint8_t bus, uint8_t cmd)
 {
-    I2C_write_16(BL_REPORT_CMD_REG);
-    I2C_write_16(BL_REPORT_SET_FEAT);
-    I2C_write_16(BL_REPORT_DATA_REG);
-    I2C_write_16(BL_REPORT_LEN);
-    I2C_write(BL_REPORT_ID);
-    I2C_write(cmd);
+    I2C_write_16(bus, BL_REPORT_CMD_REG);
+    I2C_write_16(bus, BL_REPORT_SET_FEAT);
+    I2C_write_16(bus, BL_REPORT_DATA_REG);
+    I2C_write_16(bus, BL_REPORT_LEN);
+    I2C_bus_write(bus, BL_REPORT_ID);
+    I2C_bus_write(bus, cmd);
 }
 
-static void I2C_write_GetFeatureReport(void)
+static void I2C_write_GetFeatureReport(uint8_t bus)
 {
-    I2C_write_16(BL_REPORT_CMD_REG);
-    I2C_write_16(BL_REPORT_GET_FEAT);
-    I2C_write_16(BL_REPORT_DATA_REG);
+    I2C_write_16(bus, BL_REPORT_CMD_REG);
+    I2C_write_16(bus, BL_REPORT_GET_FEAT);
+    I2C_write_16(bus, BL_REPORT_DATA_REG);
 }
 
-static void I2C_write_DummyBytes(uint16_t count)
+static void I2C_write_DummyBytes(uint8_t bus, uint16_t count)
 {
     uint16_t i;
 
     for(i = 0; i < count; i++)
     {
-        I2C_write(DUMMY_BYTE);
+        I2C_bus_write(bus, DUMMY_BYTE);
     }
 }
 
 /**** Public Functions  ****/
 
-void BL_cmd_write(uint32_t offset, uint32_t numBytes, const uint8_t * dataPtr)
+void BL_cmd_write(const bl_target *target, uint32_t offset, uint32_t numBytes, const uint8_t * dataPtr)
 {
     uint32_t i;
 
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_WRITE);
-    I2C_write_32(offset);
-    I2C_write_32(numBytes);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_WRITE);
+    I2C_write_32(target->bus, offset);
+    I2C_write_32(target->bus, numBytes);
 
     for(i = 0; i < numBytes; i++)
     {
-        I2C_write(dataPtr[i]);
+        I2C_bus_write(target->bus, dataPtr[i]);
     }
 
-    I2C_write_DummyBytes(BL_REPORT_LEN - WRITE_CMD_HEADER_SIZE - numBytes);
-    I2C_endTransmission(true);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - WRITE_CMD_HEADER_SIZE - numBytes);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
-void BL_cmd_flush(void)
+void BL_cmd_flush(const bl_target *target)
 {
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_FLUSH);
-    I2C_write_DummyBytes(BL_REPORT_LEN - FLUSH_CMD_HEADER_SIZE);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_FLUSH);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - FLUSH_CMD_HEADER_SIZE);
 
-    I2C_endTransmission(true);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
-void BL_cmd_validate(uint8_t validationType)
+void BL_cmd_validate(const bl_target *target, uint8_t validationType)
 {
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_VALIDATE);
-    I2C_write(validationType);
-    I2C_write_DummyBytes(BL_REPORT_LEN - VALIDATE_CMD_HEADER_SIZE);
-    I2C_endTransmission(true);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_VALIDATE);
+    I2C_bus_write(target->bus, validationType);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - VALIDATE_CMD_HEADER_SIZE);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
-void BL_cmd_reset(void)
+void BL_cmd_reset(const bl_target *target)
 {
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_RESET);
-    I2C_write_DummyBytes(BL_REPORT_LEN - RESET_CMD_HEADER_SIZE);
-    I2C_endTransmission(true);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_RESET);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - RESET_CMD_HEADER_SIZE);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
 
 void BL_cmd_format_image(
+        const bl_target *target,
         uint8_t imageType,
         uint8_t numRegions,
         uint32_t entryPoint)
 {
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_FORMAT_IMG);
-    I2C_write(imageType);
-    I2C_write(numRegions);
-    I2C_write_32(entryPoint);
-    I2C_write_16(HID_DESC_ADDR);
-    I2C_write(I2C_SLAVE_ADDR);
-    I2C_write(BL_REPORT_ID);
-    I2C_write_DummyBytes(BL_REPORT_LEN - FORMAT_IMG_CMD_HEADER_SIZE);
-    I2C_endTransmission(true);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_FORMAT_IMG);
+    I2C_bus_write(target->bus, imageType);
+    I2C_bus_write(target->bus, numRegions);
+    I2C_write_32(target->bus, entryPoint);
+    I2C_write_16(target->bus, HID_DESC_ADDR);
+    I2C_bus_write(target->bus, target->address);
+    I2C_bus_write(target->bus, BL_REPORT_ID);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - FORMAT_IMG_CMD_HEADER_SIZE);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
-void BL_cmd_format_region(uint8_t regionNumber, uint32_t regionOffset, uint32_t regionSize, uint32_t regionChecksum)
+void BL_cmd_format_region(const bl_target *target, uint8_t regionNumber, uint32_t regionOffset, uint32_t regionSize, uint32_t regionChecksum)
 {
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_FORMAT_REG);
-    I2C_write(regionNumber);
-    I2C_write_32(regionOffset);
-    I2C_write_32(regionSize);
-    I2C_write_32(regionChecksum);
-    I2C_write_DummyBytes(BL_REPORT_LEN - FORMAT_REGION_CMD_HEADER_SIZE);
-
-    I2C_endTransmission(true);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_FORMAT_REG);
+    I2C_bus_write(target->bus, regionNumber);
+    I2C_write_32(target->bus, regionOffset);
+    I2C_write_32(target->bus, regionSize);
+    I2C_write_32(target->bus, regionChecksum);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - FORMAT_REGION_CMD_HEADER_SIZE);
+
+    I2C_bus_endTransmission(target->bus, true);
 }
 
-void BL_cmd_invoke_bootloader(void)
+void BL_cmd_invoke_bootloader(const bl_target *target)
 {
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_INVOKE_BL);
-    I2C_write_DummyBytes(BL_REPORT_LEN - INVOKE_BOOTLOADER_CMD_HEADER_SIZE);
-    I2C_endTransmission(true);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_INVOKE_BL);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - INVOKE_BOOTLOADER_CMD_HEADER_SIZE);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
-void BL_cmd_write_memory(uint32_t offset, uint16_t numBytes, uint8_t * dataPtr)
+void BL_cmd_write_memory(const bl_target *target, uint32_t offset, uint16_t numBytes, uint8_t * dataPtr)
 {
     uint32_t i;
     uint16_t checksum;
@@ -172,57 +173,74 @@ void BL_cmd_write_memory(uint32_t offset, uint16_t numBytes, uint8_t * dataPtr)
         (uint8_t)(numBytes >> 8)
     };
 
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_WRITE_MEM);
-    I2C_write_32(offset);
-    I2C_write_16(numBytes);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_WRITE_MEM);
+    I2C_write_32(target->bus, offset);
+    I2C_write_16(target->bus, numBytes);
 
     for(i = 0; i < numBytes; i++)
     {
-        I2C_write(dataPtr[i]);
+        I2C_bus_write(target->bus, dataPtr[i]);
     }
 
     checksum = Fletcher16(preamble, 7);
     checksum = Fletcher16_Continue(dataPtr, numBytes, checksum);
-    I2C_write_16(checksum);
-    I2C_write_DummyBytes(BL_REPORT_LEN - WRITE_MEMORY_CMD_HEADER_SIZE - numBytes);
+    I2C_write_16(target->bus, checksum);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - WRITE_MEMORY_CMD_HEADER_SIZE - numBytes);
 
-    I2C_endTransmission(true);
+    I2C_bus_endTransmission(target->bus, true);
 }
 
 
 //returns
 // '1': numBytes exceeds MAX_READ_DATA_SIZE
 // '0': success
-uint16_t BL_request_read(uint32_t offset, uint16_t numBytes)
+uint16_t BL_request_read(const bl_target *target, uint32_t offset, uint16_t numBytes)
 {
     if (numBytes > MAX_READ_DATA_SIZE)
     {
         return 1;
     }
 
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_SetFeatureReport(CMD_READ_MEM);
-    I2C_write_32(offset);
-    I2C_write_16(numBytes);
-    I2C_write_DummyBytes(BL_REPORT_LEN - READ_MEMORY_CMD_HEADER_SIZE);
-    I2C_endTransmission(true);
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_SetFeatureReport(target->bus, CMD_READ_MEM);
+    I2C_write_32(target->bus, offset);
+    I2C_write_16(target->bus, numBytes);
+    I2C_write_DummyBytes(target->bus, BL_REPORT_LEN - READ_MEMORY_CMD_HEADER_SIZE);
+    I2C_bus_endTransmission(target->bus, true);
 
     return 0;
 }
 
 
-void BL_read(uint8_t *data)
+//Reads the first length bytes of the report (BL_REPORT_LEN at most): the status, then as
+//much of the data and its checksum as is wanted. The rest isn't clocked out.
+//returns the number of bytes read, less than length if the device didn't answer
+uint16_t BL_read(const bl_target *target, uint8_t *data, uint16_t length)
 {
     uint16_t i;
-    I2C_beginTransmission(I2C_SLAVE_ADDR);
-    I2C_write_GetFeatureReport();
-    I2C_endTransmission(false);
-    I2C_request(I2C_SLAVE_ADDR, BL_REPORT_LEN, true);
+
+    if (length > BL_REPORT_LEN)
+    {
+        length = BL_REPORT_LEN;
+    }
+    I2C_bus_beginTransmission(target->bus, target->address);
+    I2C_write_GetFeatureReport(target->bus);
+    I2C_bus_endTransmission(target->bus, false);
+    I2C_bus_request(target->bus, target->address, length, true);
 
     i = 0;
-    while(I2C_available() && (i < BL_REPORT_LEN))
+    while(I2C_bus_available(target->bus) && (i < length))
     {
-        data[i++] = I2C_read();
+        data[i++] = I2C_bus_read(target->bus);
     }
+    return i;
+}
+
+//Reads only the status at the start of the report (READ_STATUS_SIZE bytes),
+//enough to poll the busy bit without the time of a full report.
+//returns the number of bytes read, less than READ_STATUS_SIZE if the device didn't answer
+uint16_t BL_read_status(const bl_target *target, uint8_t *data)
+{
+    return BL_read(target, data, READ_STATUS_SIZE);
 }
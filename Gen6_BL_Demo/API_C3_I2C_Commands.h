@@ -12,7 +12,7 @@
 extern "C" {
 #endif
 
-#define I2C_SLAVE_ADDR (0x2C)
+#define I2C_SLAVE_ADDR (0x2C)  // the address a part has unless it's been told otherwise
 #define BL_REPORT_ID  (0x07)
 #define HID_DESC_ADDR (0x0020)
 
@@ -78,25 +78,34 @@ extern "C" {
 #define READ_CHECKSUM_SIZE (2)
 #define MAX_READ_DATA_SIZE (BL_REPORT_LEN - READ_STATUS_SIZE - READ_CHECKSUM_SIZE)
 
+//The part a command goes to: the I2C bus it's on (I2C_BUS_WIRE.., see I2C.h) and its address
+typedef struct
+{
+    uint8_t bus;
+    uint8_t address;
+} bl_target;
 
 
-void BL_cmd_write(uint32_t offset, uint32_t numBytes, const uint8_t * dataPtr);
-void BL_cmd_flush(void);
-void BL_cmd_validate(uint8_t validationType);
-void BL_cmd_reset(void);
+void BL_cmd_write(const bl_target *target, uint32_t offset, uint32_t numBytes, const uint8_t * dataPtr);
+void BL_cmd_flush(const bl_target *target);
+void BL_cmd_validate(const bl_target *target, uint8_t validationType);
+void BL_cmd_reset(const bl_target *target);
 void BL_cmd_format_image(
+        const bl_target *target,
         uint8_t imageType,
         uint8_t numRegions,
         uint32_t entryPoint);
 void BL_cmd_format_region(
+        const bl_target *target,
         uint8_t regionNumber,
         uint32_t regionOffset,
         uint32_t regionSize,
         uint32_t regionChecksum);
-void BL_cmd_invoke_bootloader(void);
-void BL_cmd_write_memory(uint32_t offset, uint16_t numBytes, uint8_t * dataPtr);
-uint16_t BL_request_read(uint32_t offset, uint16_t numBytes);
-void BL_read(uint8_t *data);
+void BL_cmd_invoke_bootloader(const bl_target *target);
+void BL_cmd_write_memory(const bl_target *target, uint32_t offset, uint16_t numBytes, uint8_t * dataPtr);
+uint16_t BL_request_read(const bl_target *target, uint32_t offset, uint16_t numBytes);
+uint16_t BL_read(const bl_target *target, uint8_t *data, uint16_t length);
+uint16_t BL_read_status(const bl_target *target, uint8_t *data);
 
 #ifdef __cplusplus
 }
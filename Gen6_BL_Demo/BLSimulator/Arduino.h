@@ -0,0 +1,25 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// Host stand-in for the Arduino calls the bootloader code uses. Time is the simulator's
+// clock (see SimBootloader.cpp), so delays cost nothing to run but are counted.
+
+#ifndef BL_SIMULATOR_ARDUINO_H
+#define BL_SIMULATOR_ARDUINO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+uint32_t micros(void);
+uint32_t millis(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BL_SIMULATOR_ARDUINO_H
@@ -0,0 +1,466 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// Runs BL_program against the simulated bootloader and reports how long it took, where the
+// time went, and what the device's fixed delays would have added up to.
+//
+// usage: BLSimulator [writeDelay [formatDelay]]
+//   the delays the simulated part reports (ms per 100 bytes written, ms per KB formatted)
+//        BLSimulator -p
+//   programs the part with what ImageSender sends to the pty it prints, like the demo does
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include "SimBootloader.h"
+#include "Arduino.h"
+#include "../API_C3_BL.h"
+#include "../I2C.h"
+#include "../FW_CustomMeas.h"
+#include "../FW_CustomMeas_Z.h"
+
+static const char * operationNames[BLOp_Count] =
+{
+    "invoke bootloader",
+    "format image",
+    "format region",
+    "write",
+    "flush",
+    "validate",
+    "reset",
+};
+
+static const char * learnedUnits[BLOp_Count] = { "", "", "/KB", "/B", "", "", "" };
+
+static void printTiming(void)
+{
+    bl_op_timing timing;
+    uint32_t totalWait_us = 0;
+    uint32_t totalFixed_us = 0;
+
+    printf("  %-18s %6s %6s %11s %11s %12s\n", "operation", "count", "polls", "learned us", "waited ms", "fixed ms");
+    for (uint8_t i = 0; i < BLOp_Count; i++)
+    {
+        BL_get_timing(i, &timing);
+        if (timing.count == 0) continue;
+        printf("  %-18s %6u %6u %8lu%-3s %11.1f %12.1f\n", operationNames[i], timing.count, timing.polls,
+            (unsigned long)timing.learned_us, learnedUnits[i], timing.total_us / 1000.0, timing.fixedDelay_us / 1000.0);
+        totalWait_us += timing.total_us;
+        totalFixed_us += timing.fixedDelay_us;
+    }
+    printf("  %-18s %6s %6s %11s %11.1f %12.1f\n", "total", "", "", "", totalWait_us / 1000.0, totalFixed_us / 1000.0);
+}
+
+// a build that differs from the one in FW_CustomMeas.h in a few places
+static uint8_t changedImage[sizeof(Oly1p3_CustomMeas_BL)];
+static const uint32_t changes[] = { 0x0100, 0x3001, 0x5F10 };
+
+static bool imageIn(SimBootloader & sim, const uint8_t * image)
+{
+    return sim.imageValid() && (memcmp(sim.flash() + Oly1p3_CustomMeas_BL_start, image, sizeof(changedImage)) == 0);
+}
+
+static bool program(SimBootloader & sim, const char * title)
+{
+    uint32_t statusReads = sim.statusReads;
+    uint32_t fullReads = sim.fullReads;
+    uint32_t refused = sim.refusedCommands;
+    uint32_t busBytes = sim.busBytes;
+    uint64_t start_us = SimBootloader::now_us();
+
+    BL_reset_timing(false);
+    uint16_t error = BL_program(Oly1p3_CustomMeas_BL, sizeof(Oly1p3_CustomMeas_BL), Oly1p3_CustomMeas_BL_start);
+
+    printf("%s: %s, error %u, %.1f ms\n", title, (error == BLProgErr_OK) ? "programmed" : "FAILED", error,
+        (SimBootloader::now_us() - start_us) / 1000.0);
+    printTiming();
+    printf("  I2C: %lu bytes, %lu status reads, %lu full reads, %lu commands refused\n",
+        (unsigned long)(sim.busBytes - busBytes), (unsigned long)(sim.statusReads - statusReads),
+        (unsigned long)(sim.fullReads - fullReads), (unsigned long)(sim.refusedCommands - refused));
+    printf("  image %s, running %s\n\n", sim.imageValid() ? "valid" : "NOT valid",
+        sim.bootloaderMode() ? "the bootloader" : "the image");
+
+    return (error == BLProgErr_OK) && sim.imageValid() && (sim.refusedCommands == refused);
+}
+
+// one line per update: how long, how much was written, and the I2C traffic.
+// compressed (if not NULL) is image compressed, and what's programmed.
+static bool update(SimBootloader & sim, const char * title, const uint8_t * image, bool differential,
+    const uint8_t * compressed = 0, uint32_t compressedSize = 0)
+{
+    uint32_t statusReads = sim.statusReads;
+    uint32_t fullReads = sim.fullReads;
+    uint32_t refused = sim.refusedCommands;
+    uint64_t start_us = SimBootloader::now_us();
+    uint32_t bytesWritten = sizeof(changedImage);
+    uint16_t error;
+
+    if (compressed)
+    {
+        error = BL_program_compressed(compressed, compressedSize, differential, &bytesWritten);
+        if (!differential) bytesWritten = sizeof(changedImage);
+    }
+    else if (differential)
+    {
+        error = BL_program_differential(image, sizeof(changedImage), Oly1p3_CustomMeas_BL_start, &bytesWritten);
+    }
+    else
+    {
+        error = BL_program(image, sizeof(changedImage), Oly1p3_CustomMeas_BL_start);
+    }
+    bool success = (error == BLProgErr_OK) && imageIn(sim, image) && (sim.refusedCommands == refused);
+
+    printf("  %-32s %8.1f ms %7lu bytes %5lu %5lu %3lu  %s\n", title, (SimBootloader::now_us() - start_us) / 1000.0,
+        (unsigned long)bytesWritten, (unsigned long)(sim.statusReads - statusReads),
+        (unsigned long)(sim.fullReads - fullReads), (unsigned long)(sim.refusedCommands - refused),
+        success ? "ok" : "FAILED");
+    return success;
+}
+
+static bool compareUpdates(SimBootloader & sim, const char * model)
+{
+    bool success;
+
+    simDevices[I2C_BUS_WIRE] = &sim;
+    delay(100);  // power on
+    BL_reset_timing(true);
+    success = (BL_program(Oly1p3_CustomMeas_BL, sizeof(changedImage), Oly1p3_CustomMeas_BL_start) == BLProgErr_OK);
+
+    printf("%s\n", model);
+    printf("  %-32s %11s %13s %5s %5s %3s\n", "", "time", "written", "short", "full", "ref");
+    success = update(sim, "full, changed build", changedImage, false) && success;
+    success = update(sim, "compressed differential, changed", Oly1p3_CustomMeas_BL, true, Oly1p3_CustomMeas_BL_Z,
+        sizeof(Oly1p3_CustomMeas_BL_Z)) && success;
+    success = update(sim, "differential, same build", Oly1p3_CustomMeas_BL, true) && success;
+    success = update(sim, "differential, changed build", changedImage, true) && success;
+    success = update(sim, "compressed, changed build", Oly1p3_CustomMeas_BL, false, Oly1p3_CustomMeas_BL_Z,
+        sizeof(Oly1p3_CustomMeas_BL_Z)) && success;
+    printf("\n");
+    return success;
+}
+
+// programs count parts, one on each bus, together: BL_program_devices
+static bool programTogether(uint8_t count, bool compressed)
+{
+    static SimBootloader parts[I2C_BUS_COUNT];
+    static bl_device devices[I2C_BUS_COUNT];
+    uint32_t statusReads = 0;
+    uint32_t refused = 0;
+    uint8_t i;
+
+    for (i = 0; i < I2C_BUS_COUNT; i++)
+    {
+        simDevices[i] = (i < count) ? &parts[i] : 0;
+        if (i < count)
+        {
+            statusReads -= parts[i].statusReads;
+            refused -= parts[i].refusedCommands;
+        }
+    }
+    delay(100);  // power on
+
+    uint64_t start_us = SimBootloader::now_us();
+    for (i = 0; i < count; i++)
+    {
+        BL_device_init(&devices[i], i, I2C_SLAVE_ADDR);
+        if (compressed)
+        {
+            BL_device_start_compressed(&devices[i], Oly1p3_CustomMeas_BL_Z, sizeof(Oly1p3_CustomMeas_BL_Z), false);
+        }
+        else
+        {
+            BL_device_start(&devices[i], Oly1p3_CustomMeas_BL, sizeof(Oly1p3_CustomMeas_BL), Oly1p3_CustomMeas_BL_start,
+                Oly1p3_CustomMeas_BL_checksum, false);
+        }
+    }
+    uint8_t failed = BL_program_devices(devices, count);
+    double time_ms = (SimBootloader::now_us() - start_us) / 1000.0;
+
+    bool success = (failed == 0);
+    for (i = 0; i < count; i++)
+    {
+        success = success && imageIn(parts[i], Oly1p3_CustomMeas_BL);
+        statusReads += parts[i].statusReads;
+        refused += parts[i].refusedCommands;
+    }
+    printf("  %u part%s%-14s %8.1f ms  %6.1f ms each %6lu %3lu  %s\n", count, (count > 1) ? "s" : " ",
+        compressed ? ", compressed" : "", time_ms, time_ms / count, (unsigned long)statusReads,
+        (unsigned long)refused, success ? "ok" : "FAILED");
+
+    for (i = 0; i < I2C_BUS_COUNT; i++) simDevices[i] = 0;
+    return success && (refused == 0);
+}
+
+// one line per update: how long it took, and how much of that the part was out of service.
+// checksum 0 is the image's, anything else fails Validate, and then the update should fail
+// without the part losing the image it was running.
+static bool updateInService(SimBootloader & sim, const char * title, uint32_t checksum)
+{
+    uint32_t refused = sim.refusedCommands;
+    uint64_t start_us = SimBootloader::now_us();
+    uint64_t down_us = sim.downtime_us();
+
+    simDevices[I2C_BUS_WIRE] = &sim;
+    uint16_t error = BL_program_image(Oly1p3_CustomMeas_BL, sizeof(Oly1p3_CustomMeas_BL), Oly1p3_CustomMeas_BL_start,
+        checksum, false, NULL);
+    bool running = !sim.bootloaderMode() && imageIn(sim, Oly1p3_CustomMeas_BL);
+    bool success = (sim.refusedCommands == refused) && running &&
+        (error == ((checksum == 0) ? BLProgErr_OK : BLProgErr_Validate));
+
+    printf("  %-32s %8.1f ms %8.1f ms %6u  %3u  %s\n", title, (SimBootloader::now_us() - start_us) / 1000.0,
+        (sim.downtime_us() - down_us) / 1000.0, sim.activeImage(), error, success ? "ok" : "FAILED");
+    simDevices[I2C_BUS_WIRE] = 0;
+    return success;
+}
+
+// two lines: an update of a part that loses power part way through (powerFailWrite), then the
+// update again. With a checkpoint that carries on from where the first got to.
+static bool updateAfterPowerLoss(SimBootloader & sim, const char * title, bl_checkpoint * checkpoint)
+{
+    const char * attempts[2] = { "cut off", "again" };
+    uint32_t bytesWritten;
+    uint16_t error;
+    bool success = true;
+    char line[64];
+
+    simDevices[I2C_BUS_WIRE] = &sim;
+    delay(100);  // power on
+    BL_set_checkpoint(checkpoint);
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uint64_t start_us = SimBootloader::now_us();
+        error = BL_program_image(Oly1p3_CustomMeas_BL, sizeof(Oly1p3_CustomMeas_BL), Oly1p3_CustomMeas_BL_start,
+            Oly1p3_CustomMeas_BL_checksum, false, &bytesWritten);
+        bool ok = (i == 0) ? (error != BLProgErr_OK) : ((error == BLProgErr_OK) && imageIn(sim, Oly1p3_CustomMeas_BL));
+        snprintf(line, sizeof(line), "%s, %s", title, attempts[i]);
+        printf("  %-32s %8.1f ms %7lu bytes %4u  %s\n", line, (SimBootloader::now_us() - start_us) / 1000.0,
+            (unsigned long)bytesWritten, error, ok ? "ok" : "FAILED");
+        success = success && ok;
+    }
+    BL_set_checkpoint(NULL);
+    simDevices[I2C_BUS_WIRE] = 0;
+    return success;
+}
+
+// a sparse build: the image with a hole in it, made into a container with a region each side
+// of the hole, or padded with 0xFF and programmed as one
+static uint8_t sparseImage[sizeof(Oly1p3_CustomMeas_BL)];
+static uint8_t sparseContainer[FWIMAGE_HEADER_SIZE(2) + sizeof(Oly1p3_CustomMeas_BL)];
+static const uint32_t sparseHole[2] = { 0x2000, 0x4000 };
+
+static uint32_t makeContainer(uint16_t productId)
+{
+    fwimage header;
+    fwimage_region regions[2];
+
+    memset(&header, 0, sizeof(header));
+    header.regionCount = 2;
+    header.vendorId = 0x0488;
+    header.productId = productId;
+    header.revision = 0x0103;
+    header.entryPoint = sparseImage[4] | (sparseImage[5] << 8) | (sparseImage[6] << 16) | ((uint32_t)sparseImage[7] << 24);
+    regions[0].address = Oly1p3_CustomMeas_BL_start;
+    regions[0].size = sparseHole[0];
+    regions[0].data = sparseImage;
+    regions[1].address = Oly1p3_CustomMeas_BL_start + sparseHole[1];
+    regions[1].size = sizeof(sparseImage) - sparseHole[1];
+    regions[1].data = &sparseImage[sparseHole[1]];
+    return FWImage_build(sparseContainer, sizeof(sparseContainer), &header, regions);
+}
+
+// one line: programs sim with the container (or the padded image if size is 0), expected is
+// the error it should finish with. The image is in the part afterwards either way: one that's
+// for other hardware doesn't touch it.
+static bool programSparse(SimBootloader & sim, const char * title, uint32_t size, uint16_t expected)
+{
+    uint32_t refused = sim.refusedCommands;
+    uint64_t start_us = SimBootloader::now_us();
+    uint64_t down_us = sim.downtime_us();
+    uint32_t bytesWritten = 0;
+    uint16_t error;
+
+    simDevices[I2C_BUS_WIRE] = &sim;
+    if (size == 0)
+    {
+        error = BL_program_image(sparseImage, sizeof(sparseImage), Oly1p3_CustomMeas_BL_start, 0, false, &bytesWritten);
+    }
+    else
+    {
+        error = BL_program_container(sparseContainer, size, false, &bytesWritten);
+    }
+    bool success = (error == expected) && imageIn(sim, sparseImage) && !sim.bootloaderMode() &&
+        (sim.refusedCommands == refused);
+
+    printf("  %-32s %8.1f ms %7lu bytes %8.1f ms %4u  %s\n", title, (SimBootloader::now_us() - start_us) / 1000.0,
+        (unsigned long)bytesWritten, (sim.downtime_us() - down_us) / 1000.0, error, success ? "ok" : "FAILED");
+    simDevices[I2C_BUS_WIRE] = 0;
+    return success;
+}
+
+// ----------------------------------------
+// The demo's end of ImageSender, on a pty
+
+static int ptyFd = -1;
+
+static void sendToPty(const uint8_t * data, uint16_t count)
+{
+    if (write(ptyFd, data, count) != count) fprintf(stderr, "can't write to the pty\n");
+}
+
+// The PC's end is in real time, the part's in simulated time: the wait is slept through in
+// both, and what arrives meanwhile is received as the Teensy's USB would.
+static void receiveFromPty(istream * stream, uint32_t wait_us)
+{
+    struct pollfd wait = { ptyFd, POLLIN, 0 };
+    uint8_t buffer[1024];
+
+    if (poll(&wait, 1, (int)((wait_us + 999) / 1000)) > 0)
+    {
+        ssize_t count = read(ptyFd, buffer, sizeof(buffer));
+        if (count > 0) IStream_receive(stream, buffer, (uint32_t)count);
+    }
+    delayMicroseconds(wait_us);
+}
+
+static bool programFromPty(SimBootloader & sim)
+{
+    static istream stream;
+
+    ptyFd = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((ptyFd < 0) || (grantpt(ptyFd) != 0) || (unlockpt(ptyFd) != 0))
+    {
+        fprintf(stderr, "can't open a pty\n");
+        return false;
+    }
+    printf("waiting for: ImageSender %s <image>\n", ptsname(ptyFd));
+    fflush(stdout);
+
+    // the demo's loop, until the first byte of ISTREAM_START
+    struct pollfd wait = { ptyFd, POLLIN, 0 };
+    uint8_t first = 0;
+    while ((first != ISTREAM_SYNC) && (poll(&wait, 1, -1) > 0))
+    {
+        if (read(ptyFd, &first, 1) != 1) return false;
+    }
+    IStream_init(&stream, sendToPty);
+    IStream_receive(&stream, &first, 1);
+
+    uint32_t refused = sim.refusedCommands;
+    uint64_t start_us = SimBootloader::now_us();
+    uint16_t error = BL_program_stream(&stream, receiveFromPty);
+    bool success = (error == BLProgErr_OK) && sim.imageValid() && (sim.refusedCommands == refused);
+
+    printf("%lu bytes at 0x%08lX: %s, error %u, %.1f ms (simulated), %lu commands refused, image %s\n",
+        (unsigned long)stream.numBytes, (unsigned long)stream.address, (error == BLProgErr_OK) ? "programmed" : "FAILED",
+        error, (SimBootloader::now_us() - start_us) / 1000.0, (unsigned long)(sim.refusedCommands - refused),
+        sim.imageValid() ? "valid" : "NOT valid");
+    printTiming();
+
+    // let ImageSender read the result before its pty goes
+    usleep(200000);
+    close(ptyFd);
+    return success;
+}
+
+int main(int argc, char ** argv)
+{
+    static SimBootloader sim;
+    static SimBootloader eraseOnFormat;
+    static SimBootloader inPlace;
+    bool success;
+
+    if ((argc > 1) && (strcmp(argv[1], "-p") == 0))
+    {
+        simDevices[I2C_BUS_WIRE] = &sim;
+        delay(100);  // power on
+        return programFromPty(sim) ? 0 : 1;
+    }
+
+    if (argc > 1) sim.timing.writeDelay = (uint8_t)atoi(argv[1]);
+    if (argc > 2) sim.timing.formatDelay = (uint8_t)atoi(argv[2]);
+    simDevices[I2C_BUS_WIRE] = &sim;
+
+    printf("image %u bytes at 0x%08lX, the part reports WriteDelay %u, FormatDelay %u\n\n",
+        (unsigned)sizeof(Oly1p3_CustomMeas_BL), (unsigned long)Oly1p3_CustomMeas_BL_start,
+        sim.timing.writeDelay, sim.timing.formatDelay);
+
+    delay(100);  // power on
+    BL_reset_timing(true);
+    success = program(sim, "first update (nothing learned)");
+    success = program(sim, "second update (learned)") && success;
+
+    memcpy(changedImage, Oly1p3_CustomMeas_BL, sizeof(changedImage));
+    for (uint8_t i = 0; i < sizeof(changes) / sizeof(changes[0]); i++) changedImage[changes[i]] ^= 0x5A;
+    eraseOnFormat.timing = sim.timing;
+    inPlace.timing = sim.timing;
+    inPlace.eraseOnFormat = false;
+    success = compareUpdates(eraseOnFormat, "a part that erases the region on FormatRegion") && success;
+    success = compareUpdates(inPlace, "a part that erases as it writes") && success;
+
+    printf("parts on Wire, Wire1 and Wire2, programmed together (nothing learned)\n");
+    printf("  %-26s %11s %14s %6s %3s\n", "", "time", "", "short", "ref");
+    for (uint8_t count = 1; count <= I2C_BUS_COUNT; count++) success = programTogether(count, false) && success;
+    success = programTogether(I2C_BUS_COUNT, true) && success;
+
+    static SimBootloader single;
+    static SimBootloader dual;
+    single.timing = sim.timing;
+    dual.timing = sim.timing;
+    dual.dualImage = true;
+    delay(100);  // power on
+    printf("\na part with one image, and one with two (out of service is until it's running an image again)\n");
+    printf("  %-32s %11s %11s %6s %4s\n", "", "time", "out", "image", "err");
+    success = updateInService(single, "one image", 0) && success;
+    success = updateInService(dual, "two images", 0) && success;
+    success = updateInService(dual, "two images, again", 0) && success;
+    success = updateInService(dual, "two images, fails Validate", 0x12345678) && success;
+
+    // off for long enough that the write it was cut off in times out
+    static SimBootloader restarted;
+    static SimBootloader resumed;
+    static bl_checkpoint checkpoint;
+    restarted.timing = sim.timing;
+    resumed.timing = sim.timing;
+    restarted.powerFailWrite = resumed.powerFailWrite = 30;
+    restarted.powerOff_us = resumed.powerOff_us = 2000000;
+    printf("\na part that loses power for 2 s at write 30 of %u, then the same update again\n",
+        (unsigned)((sizeof(Oly1p3_CustomMeas_BL) + MAX_DATA_PAYLOAD_SIZE - 1) / MAX_DATA_PAYLOAD_SIZE));
+    printf("  %-32s %11s %13s %4s\n", "", "time", "written", "err");
+    success = updateAfterPowerLoss(restarted, "no checkpoint", NULL) && success;
+    success = updateAfterPowerLoss(resumed, "checkpoint", &checkpoint) && success;
+
+    // fresh parts, the hole reads 0xFF in both
+    static SimBootloader padded;
+    static SimBootloader sparse;
+    padded.timing = sim.timing;
+    sparse.timing = sim.timing;
+    memcpy(sparseImage, Oly1p3_CustomMeas_BL, sizeof(sparseImage));
+    memset(&sparseImage[sparseHole[0]], 0xFF, sparseHole[1] - sparseHole[0]);
+    delay(100);  // power on
+    printf("\nthe image without 0x%04lX..0x%04lX, padded with 0xFF, or a container with two regions\n",
+        (unsigned long)sparseHole[0], (unsigned long)sparseHole[1]);
+    printf("  %-32s %11s %13s %11s %4s\n", "", "time", "written", "out", "err");
+    success = programSparse(padded, "padded", 0, BLProgErr_OK) && success;
+    success = programSparse(sparse, "container", makeContainer(0x0100), BLProgErr_OK) && success;
+    success = programSparse(sparse, "container, other hardware", makeContainer(0x0200), BLProgErr_Hardware) &&
+        success;
+
+    // nothing learned, so the first status read is straight after the command
+    static SimBootloader slowSingle;
+    static SimBootloader slowDual;
+    slowSingle.timing = sim.timing;
+    slowDual.timing = sim.timing;
+    slowDual.dualImage = true;
+    slowSingle.rebootLag_us = slowDual.rebootLag_us = 5000;
+    delay(100);  // power on
+    printf("\nparts that answer with the old status for 5 ms after InvokeBootloader and the reset (nothing learned)\n");
+    printf("  %-32s %11s %11s %6s %4s\n", "", "time", "out", "image", "err");
+    BL_reset_timing(true);
+    success = updateInService(slowSingle, "one image", 0) && success;
+    BL_reset_timing(true);
+    success = updateInService(slowDual, "two images", 0) && success;
+
+    return success ? 0 : 1;
+}
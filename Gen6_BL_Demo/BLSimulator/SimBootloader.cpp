@@ -0,0 +1,521 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <string.h>
+#include "SimBootloader.h"
+#include "Arduino.h"
+#include "../I2C.h"
+#include "../API_C3_BL.h"
+#include "../Fletcher32.h"
+
+#define SENTINEL_BOOTLOADER (0x6C42)
+#define SENTINEL_IMAGE (0x6D49)
+#define BL_VERSION (10)
+#define ATOMIC_WRITE_SIZE (4)
+
+#define CMD_WRITE       (0x00)
+#define CMD_FLUSH       (0x01)
+#define CMD_VALIDATE    (0x02)
+#define CMD_RESET       (0x03)
+#define CMD_FORMAT_IMG  (0x04)
+#define CMD_FORMAT_REG  (0x05)
+#define CMD_INVOKE_BL   (0x06)
+#define CMD_READ_MEM    (0x08)
+
+static uint64_t simTime_ns = 0;
+
+static uint32_t get32(const uint8_t * data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void put16(uint8_t * data, uint16_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+}
+
+uint64_t SimBootloader::now_us(void)
+{
+    return simTime_ns / 1000;
+}
+
+void SimBootloader::advance_ns(uint64_t ns)
+{
+    simTime_ns += ns;
+}
+
+SimBootloader::SimBootloader()
+{
+    // a plausible part: the delays it reports are several times what it takes
+    timing.invoke_us = 40000;
+    timing.reset_us = 40000;
+    timing.formatImage_us = 12000;
+    timing.formatRegionPerKB_us = 20000;
+    timing.writeBase_us = 600;
+    timing.writePerByte_ns = 9000;
+    timing.flush_us = 3000;
+    timing.validate_us = 20000;
+    timing.writeDelay = 30;
+    timing.formatDelay = 100;
+    eraseOnFormat = true;
+    address = I2C_SLAVE_ADDR;
+    dualImage = false;
+    powerFailWrite = 0;
+    powerOff_us = 0;
+    rebootLag_us = 0;
+
+    // it comes with an image that runs
+    memset(m_flash, 0xFF, sizeof(m_flash));
+    m_valid[0] = true;
+    m_valid[1] = false;
+    m_active = 0;
+    m_target = 0;
+    m_down = false;
+    m_downSince_us = 0;
+    m_downtime_us = 0;
+    memset(m_regions, 0, sizeof(m_regions));
+    m_regionCount = 0;
+    m_formatted = false;
+    m_readAddress = 0;
+    busBytes = 0;
+    statusReads = 0;
+    fullReads = 0;
+    refusedCommands = 0;
+    powerOn();
+}
+
+void SimBootloader::powerOn(void)
+{
+    goDown();
+    m_bootloader = !m_valid[m_active];
+    m_lastError = NO_ERROR;
+    m_busyUntil_us = 0;
+    m_rebootFrom_us = now_us();
+    m_rebootUntil_us = m_rebootFrom_us + timing.reset_us;
+    m_pending = PENDING_NONE;
+    m_readCount = 0;
+    m_writes = 0;
+}
+
+bool SimBootloader::imageValid(void)
+{
+    update();
+    return m_valid[m_active];
+}
+
+bool SimBootloader::bootloaderMode(void)
+{
+    update();
+    return m_bootloader;
+}
+
+uint64_t SimBootloader::downtime_us(void)
+{
+    update();
+    return m_downtime_us + ((m_down && (now_us() > m_downSince_us)) ? now_us() - m_downSince_us : 0);
+}
+
+// out of service from now until it's running an image again
+void SimBootloader::goDown(void)
+{
+    if (!m_down)
+    {
+        m_down = true;
+        m_downSince_us = now_us();
+    }
+}
+
+// not answering
+bool SimBootloader::rebooting(void) const
+{
+    return (now_us() >= m_rebootFrom_us) && (now_us() < m_rebootUntil_us);
+}
+
+// InvokeBootloader or Reset: rebootLag_us from now it stops answering, for reboot_us
+void SimBootloader::reboot(Pending pending, uint32_t reboot_us)
+{
+    if (!m_down)
+    {
+        m_down = true;
+        m_downSince_us = now_us() + rebootLag_us;
+    }
+    m_rebootFrom_us = now_us() + rebootLag_us;
+    m_rebootUntil_us = m_rebootFrom_us + reboot_us;
+    m_pending = pending;
+}
+
+// the bootloader, or on a dual image part the image it isn't running
+bool SimBootloader::writable(void)
+{
+    return m_bootloader || (dualImage && (m_target != m_active));
+}
+
+void SimBootloader::busyFor(uint64_t us)
+{
+    m_busyUntil_us = now_us() + us;
+}
+
+// the formatted region offset..offset + count is in, NULL if it isn't all in one
+const SimBootloader::Region * SimBootloader::regionOf(uint32_t offset, uint32_t count) const
+{
+    for (uint8_t i = 0; i < m_regionCount; i++)
+    {
+        const Region &region = m_regions[i];
+        if (region.formatted && (offset >= region.offset) && (offset + count <= region.offset + region.size))
+        {
+            return &region;
+        }
+    }
+    return NULL;
+}
+
+// finishes whatever has completed by now
+void SimBootloader::update(void)
+{
+    uint64_t now = now_us();
+
+    if ((m_pending == PENDING_VALIDATE) && (now >= m_busyUntil_us))
+    {
+        m_valid[m_target] = m_formatted;
+        for (uint8_t i = 0; i < m_regionCount; i++)
+        {
+            const Region &region = m_regions[i];
+            if (Fletcher32(&m_flash[m_target][region.offset], region.size) != region.checksum) m_valid[m_target] = false;
+        }
+        m_lastError = m_valid[m_target] ? NO_ERROR : CHECKSUM_MISMATCH;
+        m_pending = PENDING_NONE;
+    }
+    if (((m_pending == PENDING_REBOOT_BOOTLOADER) || (m_pending == PENDING_REBOOT_IMAGE)) && (now >= m_rebootUntil_us))
+    {
+        // a dual image part starts the one it was given if it's valid
+        if ((m_pending == PENDING_REBOOT_IMAGE) && m_valid[m_target]) m_active = m_target;
+        m_target = m_active;
+        m_bootloader = (m_pending == PENDING_REBOOT_BOOTLOADER) || !m_valid[m_active];
+        m_pending = PENDING_NONE;
+        m_lastError = NO_ERROR;
+    }
+    if (m_down && !m_bootloader && (m_pending == PENDING_NONE) && (now >= m_rebootUntil_us))
+    {
+        m_downtime_us += m_rebootUntil_us - m_downSince_us;
+        m_down = false;
+    }
+}
+
+void SimBootloader::write(const uint8_t * data, uint16_t length)
+{
+    advance_ns((uint64_t)(length + 1) * SIM_I2C_BYTE_NS);
+    busBytes += length + 1;
+    update();
+
+    // set feature report: command register, 0x0337, data register, length, report ID, command
+    if ((length >= 10) && (data[2] == 0x37) && (data[3] == 0x03))
+    {
+        if (rebooting())
+        {
+            refusedCommands++;  // not answering, a NAK on real hardware
+            return;
+        }
+        command(&data[9], length - 9);
+    }
+}
+
+void SimBootloader::command(const uint8_t * report, uint16_t length)
+{
+    uint8_t cmd = report[0];
+    const uint8_t * params = &report[1];
+    const Region * region;
+    uint32_t offset;
+    uint32_t count;
+
+    if (now_us() < m_busyUntil_us)
+    {
+        refusedCommands++;
+        m_lastError = UNKNOWN_ERROR;
+        return;
+    }
+    m_lastError = NO_ERROR;
+    m_readCount = 0;
+
+    switch (cmd)
+    {
+        case CMD_WRITE:
+            offset = get32(&params[0]);
+            count = get32(&params[4]);
+            region = regionOf(offset, count);
+            if (!writable() || !m_formatted)
+            {
+                m_lastError = ACCESS_VIOLATION;
+            }
+            else if (!region || (count > MAX_DATA_PAYLOAD_SIZE) || (count + 9u > length))
+            {
+                m_lastError = OFFSET_OUT_OF_RANGE;
+            }
+            else if ((offset % ATOMIC_WRITE_SIZE) ||
+                ((count % ATOMIC_WRITE_SIZE) && (offset + count != region->offset + region->size)))
+            {
+                m_lastError = MISALIGNED_ADDRESS;  // whole units only, apart from the end of the region
+            }
+            else
+            {
+                uint64_t busy_us = timing.writeBase_us + (count * (uint64_t)timing.writePerByte_ns) / 1000;
+                if (!eraseOnFormat) busy_us += (count * (uint64_t)timing.formatRegionPerKB_us) / 1024;
+                if (++m_writes == powerFailWrite)
+                {
+                    memcpy(&m_flash[m_target][offset], &params[8], count / 2);
+                    powerFailWrite = 0;
+                    powerOn();
+                    m_rebootUntil_us += powerOff_us;
+                    break;
+                }
+                memcpy(&m_flash[m_target][offset], &params[8], count);
+                busyFor(busy_us);
+            }
+            break;
+        case CMD_FLUSH:
+            busyFor(timing.flush_us);
+            break;
+        case CMD_VALIDATE:
+            busyFor(timing.validate_us);
+            m_pending = PENDING_VALIDATE;
+            break;
+        case CMD_RESET:
+            reboot(PENDING_REBOOT_IMAGE, timing.reset_us);
+            break;
+        case CMD_FORMAT_IMG:
+            // ImageType, a part with one image only has 0
+            if (!m_bootloader && !(dualImage && ((params[0] & 1) != m_active)))
+            {
+                m_lastError = ACCESS_VIOLATION;
+                break;
+            }
+            m_target = dualImage ? (params[0] & 1) : 0;
+            if ((params[1] == 0) || (params[1] > SIM_MAX_REGIONS))
+            {
+                m_lastError = OFFSET_OUT_OF_RANGE;
+                break;
+            }
+            m_valid[m_target] = false;
+            m_formatted = false;
+            memset(m_regions, 0, sizeof(m_regions));
+            m_regionCount = params[1];
+            busyFor(timing.formatImage_us);
+            break;
+        case CMD_FORMAT_REG:
+            offset = get32(&params[1]);
+            count = get32(&params[5]);
+            if (!writable() || (offset + count > SIM_FLASH_SIZE) || (params[0] >= m_regionCount))
+            {
+                m_lastError = writable() ? OFFSET_OUT_OF_RANGE : ACCESS_VIOLATION;
+                break;
+            }
+            m_regions[params[0]].offset = offset;
+            m_regions[params[0]].size = count;
+            m_regions[params[0]].checksum = get32(&params[9]);
+            m_regions[params[0]].formatted = true;
+            m_formatted = true;
+            for (uint8_t i = 0; i < m_regionCount; i++)
+            {
+                if (!m_regions[i].formatted) m_formatted = false;
+            }
+            if (eraseOnFormat)
+            {
+                memset(&m_flash[m_target][offset], 0xFF, count);
+                busyFor((uint64_t)timing.formatRegionPerKB_us * ((count / 1024) + 1));
+            }
+            else
+            {
+                busyFor(timing.formatImage_us);
+            }
+            break;
+        case CMD_INVOKE_BL:
+            reboot(PENDING_REBOOT_BOOTLOADER, timing.invoke_us);
+            break;
+        case CMD_READ_MEM:
+            m_readAddress = get32(&params[0]);
+            m_readCount = params[4] | (params[5] << 8);
+            break;
+        default:
+            m_lastError = COMMAND_UNKNOWN;
+            break;
+    }
+}
+
+uint16_t SimBootloader::read(uint8_t * data, uint16_t length)
+{
+    uint8_t report[BL_REPORT_LEN];
+    uint16_t i;
+
+    update();
+    if (rebooting())
+    {
+        advance_ns(SIM_I2C_BYTE_NS);  // just the address, NAKed
+        busBytes++;
+        return 0;
+    }
+
+    memset(report, 0, sizeof(report));
+    put16(&report[0], BL_REPORT_LEN);
+    report[2] = BL_REPORT_ID;
+    put16(&report[3], m_bootloader ? SENTINEL_BOOTLOADER : SENTINEL_IMAGE);
+    report[5] = BL_VERSION;
+    report[6] = m_lastError;
+    report[7] = ((now_us() < m_busyUntil_us) ? STATUS_BUSY_BIT : 0) | (m_valid[m_target] ? STATUS_VALID_IMAGE : 0);
+    if (dualImage) report[7] |= STATUS_DUAL_IMAGE | (m_active << STATUS_ACTIVE_IMAGE_SHIFT);
+    report[8] = ATOMIC_WRITE_SIZE;
+    report[9] = timing.writeDelay;
+    report[10] = timing.formatDelay;
+    report[11] = (uint8_t)m_readAddress;
+    report[12] = (uint8_t)(m_readAddress >> 8);
+    report[13] = (uint8_t)(m_readAddress >> 16);
+    report[14] = (uint8_t)(m_readAddress >> 24);
+    put16(&report[15], m_readCount);
+    for (i = 0; (i < m_readCount) && (i < MAX_READ_DATA_SIZE); i++)
+    {
+        uint32_t address = m_readAddress + i;
+        static const uint8_t hwid[6] = { 0x88, 0x04, 0x00, 0x01, 0x03, 0x01 };
+        if (address < SIM_FLASH_SIZE)
+        {
+            report[READ_STATUS_SIZE + i] = m_flash[m_target][address];
+        }
+        else if ((address >= BL_HWID_ADDRESS) && (address < BL_HWID_ADDRESS + sizeof(hwid)))
+        {
+            report[READ_STATUS_SIZE + i] = hwid[address - BL_HWID_ADDRESS];
+        }
+    }
+
+    if (length > BL_REPORT_LEN) length = BL_REPORT_LEN;
+    memcpy(data, report, length);
+    advance_ns((uint64_t)(length + 1) * SIM_I2C_BYTE_NS);
+    busBytes += length + 1;
+    if (length <= READ_STATUS_SIZE)
+    {
+        statusReads++;
+    }
+    else
+    {
+        fullReads++;
+    }
+    return length;
+}
+
+// --------------------
+// I2C.h and Arduino.h on the simulator
+
+// a part on each bus, answering at its address
+SimBootloader * simDevices[I2C_BUS_COUNT] = { 0 };
+
+static uint8_t txBuffer[BL_REPORT_LEN + 16];
+static uint16_t txLength;
+static uint8_t txAddress;
+static uint8_t rxBuffer[BL_REPORT_LEN];
+static uint16_t rxLength;
+static uint16_t rxIndex;
+
+static SimBootloader * device(uint8_t bus, uint8_t address)
+{
+    SimBootloader * sim = (bus < I2C_BUS_COUNT) ? simDevices[bus] : 0;
+    return (sim && (sim->address == address)) ? sim : 0;
+}
+
+void I2C_init(uint32_t clockFrequency)
+{
+    I2C_bus_init(I2C_BUS_WIRE, clockFrequency);
+}
+
+void I2C_request(int16_t address, int16_t count, bool stop)
+{
+    I2C_bus_request(I2C_BUS_WIRE, address, count, stop);
+}
+
+uint16_t I2C_available(void)
+{
+    return I2C_bus_available(I2C_BUS_WIRE);
+}
+
+uint8_t I2C_read(void)
+{
+    return I2C_bus_read(I2C_BUS_WIRE);
+}
+
+void I2C_write(uint8_t data)
+{
+    I2C_bus_write(I2C_BUS_WIRE, data);
+}
+
+void I2C_beginTransmission(uint8_t address)
+{
+    I2C_bus_beginTransmission(I2C_BUS_WIRE, address);
+}
+
+void I2C_endTransmission(bool stop)
+{
+    I2C_bus_endTransmission(I2C_BUS_WIRE, stop);
+}
+
+// A transfer takes the CPU for as long as it's on the bus, as Wire's do, so one bus at a time
+// is enough here
+void I2C_bus_init(uint8_t bus, uint32_t clockFrequency)
+{
+    (void)bus;
+    (void)clockFrequency;
+}
+
+void I2C_bus_request(uint8_t bus, int16_t address, int16_t count, bool stop)
+{
+    SimBootloader * sim = device(bus, (uint8_t)address);
+    (void)stop;
+    rxIndex = 0;
+    rxLength = sim ? sim->read(rxBuffer, (uint16_t)count) : 0;
+}
+
+uint16_t I2C_bus_available(uint8_t bus)
+{
+    (void)bus;
+    return rxLength - rxIndex;
+}
+
+uint8_t I2C_bus_read(uint8_t bus)
+{
+    (void)bus;
+    return (rxIndex < rxLength) ? rxBuffer[rxIndex++] : 0;
+}
+
+void I2C_bus_write(uint8_t bus, uint8_t data)
+{
+    (void)bus;
+    if (txLength < sizeof(txBuffer)) txBuffer[txLength++] = data;
+}
+
+void I2C_bus_beginTransmission(uint8_t bus, uint8_t address)
+{
+    (void)bus;
+    txAddress = address;
+    txLength = 0;
+}
+
+void I2C_bus_endTransmission(uint8_t bus, bool stop)
+{
+    SimBootloader * sim = device(bus, txAddress);
+    (void)stop;
+    if (sim) sim->write(txBuffer, txLength);
+}
+
+void delay(uint32_t ms)
+{
+    SimBootloader::advance_ns((uint64_t)ms * 1000000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    SimBootloader::advance_ns((uint64_t)us * 1000);
+}
+
+uint32_t micros(void)
+{
+    return (uint32_t)SimBootloader::now_us();
+}
+
+uint32_t millis(void)
+{
+    return (uint32_t)(SimBootloader::now_us() / 1000);
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#ifndef SIM_BOOTLOADER_H
+#define SIM_BOOTLOADER_H
+
+#include <stdint.h>
+
+#define SIM_FLASH_SIZE (0x40000)
+#define SIM_MAX_REGIONS (8)
+#define SIM_I2C_BYTE_NS (22500)  // 9 clocks at 400 kHz
+
+// Host model of a Gen6 part's bootloader, on the far side of the I2C.h functions.
+// It answers the same reports (API_C3_I2C_Commands.c), stays busy for as long as each
+// operation takes, and doesn't answer at all while it reboots. Commands sent while it's
+// busy are refused, so a host that doesn't wait long enough sees errors, as it would with
+// a real part. The flash is kept, and Validate checks the region checksum against it. So is
+// the region's header (FormatImage, FormatRegion): after a reboot it can be written on with.
+// A dual image part (dualImage) has two, and programs the one it isn't running while it runs.
+//
+// Time is simulated: the I2C traffic, the delays and the polling all advance one clock.
+// There can be one on each bus (simDevices), all on the one clock.
+class SimBootloader
+{
+public:
+    typedef struct {
+        uint32_t invoke_us;            // reboot into the bootloader
+        uint32_t reset_us;             // reboot into the image
+        uint32_t formatImage_us;
+        uint32_t formatRegionPerKB_us; // erase
+        uint32_t writeBase_us;
+        uint32_t writePerByte_ns;
+        uint32_t flush_us;
+        uint32_t validate_us;
+        uint8_t writeDelay;            // what the status reports, ms per 100 bytes
+        uint8_t formatDelay;           // ms per KB
+    } Timing_t;
+
+    SimBootloader();
+
+    Timing_t timing;
+
+    // true: FormatRegion erases the region (formatRegionPerKB_us), and Write only programs.
+    // false: FormatRegion only records it (formatImage_us), and Write erases the bytes it
+    // writes as it goes (formatRegionPerKB_us as well), so what isn't written is kept.
+    bool eraseOnFormat;
+
+    uint8_t address;  // on its bus, I2C_SLAVE_ADDR
+
+    // Two images, each with its own flash. The one that isn't running can be formatted (the
+    // FormatImage ImageType), written and validated while the other runs, and the reset
+    // starts it if it's valid. The status reports STATUS_DUAL_IMAGE and the one running.
+    bool dualImage;
+
+    // It loses power part way through this write (counted from powerOn, 0 for never), as a
+    // fixture that drops it would, and is off for powerOff_us. What it was writing is half
+    // written. It happens once.
+    uint32_t powerFailWrite;
+    uint32_t powerOff_us;
+
+    // After InvokeBootloader or Reset it keeps answering as it was for this long before it
+    // reboots, finishing what it was doing, so the status it reports is still the old one.
+    uint32_t rebootLag_us;
+
+    void powerOn(void);
+
+    // the bus side, one I2C transaction each
+    void write(const uint8_t * data, uint16_t length);
+    uint16_t read(uint8_t * data, uint16_t length);  // 0 while not answering
+
+    bool imageValid(void);
+    bool bootloaderMode(void);
+    uint8_t activeImage(void) const { return m_active; }
+    const uint8_t * flash(void) const { return m_flash[m_active]; }
+    uint64_t downtime_us(void);  // not running an image: rebooting, or in the bootloader
+
+    // counters
+    uint32_t busBytes;
+    uint32_t statusReads;       // reads of READ_STATUS_SIZE bytes or fewer
+    uint32_t fullReads;
+    uint32_t refusedCommands;   // sent while busy or rebooting
+
+    static uint64_t now_us(void);
+    static void advance_ns(uint64_t ns);
+
+protected:
+    enum Pending { PENDING_NONE, PENDING_VALIDATE, PENDING_REBOOT_BOOTLOADER, PENDING_REBOOT_IMAGE };
+
+    bool m_bootloader;
+    bool m_valid[2];        // each image
+    uint8_t m_active;       // the image it runs
+    uint8_t m_target;       // the image commands go to
+    bool m_formatted;       // every region FormatImage said there'd be
+    uint8_t m_lastError;
+    uint64_t m_busyUntil_us;
+    uint64_t m_rebootFrom_us;
+    uint64_t m_rebootUntil_us;
+    Pending m_pending;
+
+    struct Region
+    {
+        uint32_t offset;
+        uint32_t size;
+        uint32_t checksum;
+        bool formatted;
+    };
+    Region m_regions[SIM_MAX_REGIONS];
+    uint8_t m_regionCount;
+
+    const Region * regionOf(uint32_t offset, uint32_t count) const;
+
+    uint32_t m_readAddress;
+    uint16_t m_readCount;
+    uint32_t m_writes;
+
+    bool m_down;
+    uint64_t m_downSince_us;
+    uint64_t m_downtime_us;
+
+    uint8_t m_flash[2][SIM_FLASH_SIZE];
+
+    void update(void);
+    bool writable(void);
+    void goDown(void);
+    bool rebooting(void) const;
+    void reboot(Pending pending, uint32_t reboot_us);
+    void command(const uint8_t * report, uint16_t length);
+    void busyFor(uint64_t us);
+};
+
+// the part on each bus (I2C.h), or NULL
+extern SimBootloader * simDevices[];
+
+#endif // SIM_BOOTLOADER_H
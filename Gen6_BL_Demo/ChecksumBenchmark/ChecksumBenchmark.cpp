@@ -0,0 +1,211 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// Checks Fletcher16.c and Fletcher32.c against test vectors and against the byte (and 16 bit
+// word) at a time versions they replaced, then times them both.
+//
+// usage: ChecksumBenchmark [megabytes]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+extern "C" {
+#include "../Fletcher16.h"
+}
+#include "../Fletcher32.h"
+
+// ----------------------------------------
+// What they replaced, reducing every 20 bytes and every 180 words
+
+static uint16_t referenceFletcher16(uint8_t const * data, uint32_t bytes, uint16_t previousChecksum)
+{
+    uint16_t sum1 = previousChecksum & 0xff, sum2 = (previousChecksum >> 8) & 0xff;
+
+    while (bytes)
+    {
+        uint32_t tlen = bytes > 20 ? 20 : bytes;
+        bytes -= tlen;
+        do
+        {
+            sum2 += sum1 += *data++;
+        } while (--tlen);
+        sum1 = (sum1 & 0xff) + (sum1 >> 8);
+        sum2 = (sum2 & 0xff) + (sum2 >> 8);
+    }
+    sum1 = (sum1 & 0xff) + (sum1 >> 8);
+    sum2 = (sum2 & 0xff) + (sum2 >> 8);
+    return sum2 << 8 | sum1;
+}
+
+// even lengths only, an odd one never ends
+static uint32_t referenceFletcher32(void const * ptr, uint32_t n_bytes, uint32_t previousChecksum)
+{
+    uint16_t * data = (uint16_t *)ptr;
+    uint32_t sum1 = previousChecksum & 0xFFFF, sum2 = (previousChecksum >> 16) & 0xFFFF;
+    uint16_t tlen;
+    uint16_t d;
+
+    while (n_bytes)
+    {
+        tlen = n_bytes > 360 ? 360 : (uint16_t)n_bytes;
+        n_bytes -= tlen;
+        do
+        {
+            d = *data++;
+            sum1 += d;
+            sum2 += sum1;
+            tlen -= sizeof(uint16_t);
+        } while (tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    return sum2 << 16 | sum1;
+}
+
+// ----------------------------------------
+// Test vectors. Starting the sums at all ones is the same as starting at 0 (the sums are
+// ones' complement), so these are the usual ones. Odd lengths end with a zero byte.
+
+typedef struct {
+    const char * text;
+    uint16_t fletcher16;
+    uint32_t fletcher32;
+} Vector_t;
+
+static const Vector_t vectors[] =
+{
+    { "abcde",    0xC8F0, 0xF04FC729 },
+    { "abcdef",   0x2057, 0x56502D2A },
+    { "abcdefgh", 0x0627, 0xEBE19591 },
+};
+
+static int failures = 0;
+
+static void expect(bool condition, const char * what, uint32_t length, uint32_t alignment)
+{
+    if (condition) return;
+    if (failures++ < 10) printf("  FAILED: %s, length %u, alignment %u\n", what, length, alignment);
+}
+
+static void checkVectors(void)
+{
+    for (const Vector_t & v : vectors)
+    {
+        uint32_t length = (uint32_t)strlen(v.text);
+        uint16_t f16 = Fletcher16((const uint8_t *)v.text, length);
+        uint32_t f32 = Fletcher32(v.text, length);
+        printf("  \"%s\": Fletcher16 0x%04X, Fletcher32 0x%08X\n", v.text, f16, f32);
+        expect(f16 == v.fletcher16, "Fletcher16 test vector", length, 0);
+        expect(f32 == v.fletcher32, "Fletcher32 test vector", length, 0);
+    }
+
+    // the all ones start never gives 0, so a sum that's a multiple of 65535 (or 255) is all ones
+    static const uint8_t ones[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    expect(Fletcher32(ones, 4) == 0xFFFFFFFF, "Fletcher32 of 0xFF bytes", 4, 0);
+    expect(Fletcher16(ones, 4) == 0xFFFF, "Fletcher16 of 0xFF bytes", 4, 0);
+}
+
+// random data, every alignment, lengths to past a few reductions, and split into pieces
+static void checkAgainstReference(void)
+{
+    std::vector<uint8_t> buffer(16 + 4 * 5802 + 16);
+    std::vector<uint8_t> copy(buffer.size() + 2);
+    srand(12345);
+
+    for (int pass = 0; pass < 4; pass++)
+    {
+        for (size_t i = 0; i < buffer.size(); i++)
+        {
+            // all 0xFF and all 0 as well as random, the extremes of the sums
+            buffer[i] = (pass == 0) ? 0xFF : (pass == 1) ? 0 : (uint8_t)rand();
+        }
+        for (uint32_t alignment = 0; alignment < 4; alignment++)
+        {
+            const uint8_t * data = &buffer[alignment];
+            for (uint32_t length = 0; length + 8 < buffer.size(); length += (length < 64) ? 1 : 1 + rand() % 97)
+            {
+                if (length > 0)
+                {
+                    expect(Fletcher16(data, length) == referenceFletcher16(data, length, 0xFFFF), "Fletcher16", length, alignment);
+                }
+
+                // the reference needs 16 bit alignment, and an even length
+                uint32_t even = (length + 1) & ~1u;
+                memcpy(copy.data(), data, length);
+                copy[length] = 0;
+                expect(Fletcher32(data, length) == referenceFletcher32(copy.data(), even, 0xFFFFFFFF), "Fletcher32", length, alignment);
+
+                // in two pieces, the first an even length for Fletcher32
+                if (length >= 4)
+                {
+                    uint32_t split = (rand() % length) & ~1u;
+                    uint16_t f16 = Fletcher16_Continue(data + split, length - split, Fletcher16(data, split));
+                    uint32_t f32 = Fletcher32_Continue(data + split, length - split, Fletcher32(data, split));
+                    expect(f16 == Fletcher16(data, length), "Fletcher16_Continue", length, alignment);
+                    expect(f32 == Fletcher32(data, length), "Fletcher32_Continue", length, alignment);
+                }
+            }
+        }
+    }
+}
+
+// ----------------------------------------
+// Timing
+
+// each checksum continues from the last, so none can be skipped or hoisted out of the loop
+template <typename F>
+static double megabytesPerSecond(F checksum, const uint8_t * data, uint32_t length, uint32_t repeats, uint32_t & result)
+{
+    uint32_t sum = 0xFFFFFFFF;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < repeats; i++) sum = checksum(data, length, sum);
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    result += sum;
+    return (double)length * repeats / seconds.count() / 1e6;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t megabytes = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200;
+    if (megabytes == 0) megabytes = 1;
+
+    printf("test vectors\n");
+    checkVectors();
+    printf("against the previous versions\n");
+    checkAgainstReference();
+    printf("  %s\n\n", failures ? "FAILED" : "all match");
+
+    // a firmware image's worth, and unaligned
+    const uint32_t length = 25288;
+    std::vector<uint8_t> image(length + 4);
+    for (size_t i = 0; i < image.size(); i++) image[i] = (uint8_t)(rand() >> 4);
+    uint32_t repeats = (uint32_t)((uint64_t)megabytes * 1000000 / length);
+    uint32_t result = 0;
+
+    printf("%u byte image, MB/s   %12s %12s %8s\n", length, "previous", "now", "speedup");
+    for (uint32_t alignment = 0; alignment < 3; alignment += 2)
+    {
+        const uint8_t * data = &image[alignment];
+        double before = megabytesPerSecond([](const uint8_t * d, uint32_t n, uint32_t s) { return referenceFletcher32(d, n, s); },
+            data, length, repeats, result);
+        double after = megabytesPerSecond([](const uint8_t * d, uint32_t n, uint32_t s) { return Fletcher32_Continue(d, n, s); },
+            data, length, repeats, result);
+        printf("  Fletcher32, offset %u  %12.0f %12.0f %7.1fx\n", alignment, before, after, after / before);
+    }
+    for (uint32_t alignment = 0; alignment < 2; alignment++)
+    {
+        const uint8_t * data = &image[alignment];
+        double before = megabytesPerSecond([](const uint8_t * d, uint32_t n, uint32_t s) { return (uint32_t)referenceFletcher16(d, n, (uint16_t)s); },
+            data, length, repeats, result);
+        double after = megabytesPerSecond([](const uint8_t * d, uint32_t n, uint32_t s) { return (uint32_t)Fletcher16_Continue(d, n, (uint16_t)s); },
+            data, length, repeats, result);
+        printf("  Fletcher16, offset %u  %12.0f %12.0f %7.1fx\n", alignment, before, after, after / before);
+    }
+    printf("(%08X)\n", result);  // so none of it is optimized away
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <string.h>
+
+#include "CompressedImage.h"
+
+#define WINDOW_SIZE (1 << CIMAGE_MAX_WINDOW_BITS)
+
+static uint16_t get16(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+//a literal count or match length, 15 in the token means more follows
+static bool ReadLength(const uint8_t **src, const uint8_t *end, uint32_t *length)
+{
+    uint8_t more;
+
+    if (*length != 15)
+    {
+        return true;
+    }
+    do
+    {
+        if (*src >= end)
+        {
+            return false;
+        }
+        more = *(*src)++;
+        *length += more;
+    } while (more == 255);
+    return true;
+}
+
+bool CImage_decompress_block(const uint8_t *src, uint16_t srcLength, uint8_t *dest, uint16_t destLength, uint16_t history)
+{
+    const uint8_t *end = src + srcLength;
+    uint8_t *out = dest;
+    uint8_t *outEnd = dest + destLength;
+    uint32_t literals;
+    uint32_t match;
+    uint16_t offset;
+    uint8_t token;
+
+    while (out < outEnd)
+    {
+        if (src >= end)
+        {
+            return false;
+        }
+        token = *src++;
+
+        literals = token >> 4;
+        if (!ReadLength(&src, end, &literals) ||
+            (literals > (uint32_t)(end - src)) ||
+            (literals > (uint32_t)(outEnd - out)))
+        {
+            return false;
+        }
+        memcpy(out, src, literals);
+        out += literals;
+        src += literals;
+        if (out == outEnd)
+        {
+            break;
+        }
+
+        if (end - src < 2)
+        {
+            return false;
+        }
+        offset = get16(src);
+        src += 2;
+        match = token & 0x0F;
+        if (!ReadLength(&src, end, &match))
+        {
+            return false;
+        }
+        match += CIMAGE_MIN_MATCH;
+        if ((offset == 0) || (offset > (out - dest) + history) || (match > (uint32_t)(outEnd - out)))
+        {
+            return false;
+        }
+
+        // byte by byte, a match can overlap what it's making
+        while (match--)
+        {
+            *out = *(out - offset);
+            out++;
+        }
+    }
+    return (src == end);
+}
+
+bool CImage_parse_header(cimage_header *header, const uint8_t *data, uint32_t size)
+{
+    if ((size < CIMAGE_HEADER_SIZE) || (get32(&data[0]) != CIMAGE_MAGIC))
+    {
+        return false;
+    }
+    header->version = data[4];
+    header->windowBits = data[5];
+    header->blockSize = get16(&data[6]);
+    header->imageSize = get32(&data[8]);
+    header->address = get32(&data[12]);
+    header->entryPoint = get32(&data[16]);
+    header->checksum = get32(&data[20]);
+    header->blockCount = get16(&data[24]);
+
+    return (header->version == CIMAGE_VERSION) &&
+           (header->windowBits <= CIMAGE_MAX_WINDOW_BITS) &&
+           (header->blockSize > 0) &&
+           (header->blockSize <= CIMAGE_MAX_BLOCK_SIZE) &&
+           (header->blockCount == (header->imageSize + header->blockSize - 1) / header->blockSize);
+}
+
+bool CImage_open(cimage_reader *reader, const uint8_t *data, uint32_t size)
+{
+    reader->next = data + CIMAGE_HEADER_SIZE;
+    reader->end = data + size;
+    reader->block = 0;
+    reader->history = 0;
+    reader->blockLength = 0;
+    reader->position = 0;
+    reader->error = !CImage_parse_header(&reader->header, data, size);
+    return !reader->error;
+}
+
+//decompresses the next block after the current one, keeping the window before it
+static bool NextBlock(cimage_reader *reader)
+{
+    uint16_t length;
+    uint16_t destLength;
+    uint16_t keep;
+    bool ok;
+
+    if ((reader->block >= reader->header.blockCount) || (reader->end - reader->next < 2))
+    {
+        return false;
+    }
+
+    // slide the window down
+    keep = reader->history + reader->blockLength;
+    if (keep > WINDOW_SIZE)
+    {
+        memmove(reader->buffer, &reader->buffer[keep - WINDOW_SIZE], WINDOW_SIZE);
+        keep = WINDOW_SIZE;
+    }
+    reader->history = keep;
+
+    destLength = reader->header.blockSize;
+    if (reader->block == reader->header.blockCount - 1)
+    {
+        destLength = reader->header.imageSize - (uint32_t)reader->block * reader->header.blockSize;
+    }
+
+    length = get16(reader->next);
+    reader->next += 2;
+    if ((length & ~CIMAGE_STORED) > reader->end - reader->next)
+    {
+        return false;
+    }
+    if (length & CIMAGE_STORED)
+    {
+        length &= ~CIMAGE_STORED;
+        ok = (length == destLength);
+        if (ok)
+        {
+            memcpy(&reader->buffer[reader->history], reader->next, length);
+        }
+    }
+    else
+    {
+        ok = CImage_decompress_block(reader->next, length, &reader->buffer[reader->history], destLength, reader->history);
+    }
+    reader->next += length;
+    reader->blockLength = destLength;
+    reader->position = 0;
+    reader->block++;
+    return ok;
+}
+
+uint32_t CImage_read(cimage_reader *reader, uint8_t *data, uint32_t count)
+{
+    uint32_t copied = 0;
+    uint32_t length;
+
+    while ((copied < count) && !reader->error)
+    {
+        if (reader->position == reader->blockLength)
+        {
+            if (reader->block >= reader->header.blockCount)
+            {
+                break;  // the end of the image
+            }
+            if (!NextBlock(reader))
+            {
+                reader->error = true;
+                break;
+            }
+        }
+        length = reader->blockLength - reader->position;
+        if (length > count - copied)
+        {
+            length = count - copied;
+        }
+        memcpy(&data[copied], &reader->buffer[reader->history + reader->position], length);
+        reader->position += length;
+        copied += length;
+    }
+    return copied;
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#ifndef COMPRESSED_IMAGE_H
+#define COMPRESSED_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* A firmware image compressed for storing in the host's flash (ImageCompressor makes them).
+ *
+ * Everything is little endian. The header:
+ *    0  magic, CIMAGE_MAGIC ("CQLZ")
+ *    4  version, CIMAGE_VERSION
+ *    5  windowBits, matches reach back 2^windowBits bytes at most
+ *    6  blockSize (uint16), bytes of image per block, the last block is the rest
+ *    8  imageSize (uint32)
+ *   12  address (uint32), where the image goes
+ *   16  entryPoint (uint32)
+ *   20  checksum (uint32), Fletcher32 of the image, as FormatRegion wants
+ *   24  blockCount (uint16)
+ *   26  reserved (uint16)
+ * then blockCount blocks, each a uint16 length (CIMAGE_STORED set: the block is stored as is)
+ * and that many bytes.
+ *
+ * A compressed block is LZ4 style sequences: a token (literal count in the high 4 bits, match
+ * length - CIMAGE_MIN_MATCH in the low 4, 15 means more follows in bytes of up to 255), the
+ * literals, then (unless the block is complete) a uint16 offset back to the match. Matches
+ * can reach back into earlier blocks, as far as the window, but not past the end of their own.
+ */
+
+#define CIMAGE_MAGIC (0x5A4C5143)  // "CQLZ"
+#define CIMAGE_VERSION (1)
+#define CIMAGE_HEADER_SIZE (28)
+#define CIMAGE_STORED (0x8000)
+#define CIMAGE_MIN_MATCH (4)
+
+// the largest window and block the reader has room for
+#ifndef CIMAGE_MAX_WINDOW_BITS
+#define CIMAGE_MAX_WINDOW_BITS (11)
+#endif
+#define CIMAGE_MAX_BLOCK_SIZE (520)  // MAX_DATA_PAYLOAD_SIZE, a block is a write
+
+typedef struct
+{
+    uint8_t version;
+    uint8_t windowBits;
+    uint16_t blockSize;
+    uint32_t imageSize;
+    uint32_t address;
+    uint32_t entryPoint;
+    uint32_t checksum;
+    uint16_t blockCount;
+} cimage_header;
+
+// Decompresses an image a block at a time. The buffer holds the window (the last of the image
+// so far) and the block being read, so it's the only RAM needed.
+typedef struct
+{
+    cimage_header header;
+    const uint8_t *next;    // the next block
+    const uint8_t *end;
+    uint16_t block;         // blocks decompressed
+    uint16_t history;       // bytes of window before the block in buffer
+    uint16_t blockLength;
+    uint16_t position;      // in the block, what's been read
+    bool error;
+    uint8_t buffer[(1 << CIMAGE_MAX_WINDOW_BITS) + CIMAGE_MAX_BLOCK_SIZE];
+} cimage_reader;
+
+// returns false if it's not a compressed image this reader can take
+bool CImage_parse_header(cimage_header *header, const uint8_t *data, uint32_t size);
+bool CImage_open(cimage_reader *reader, const uint8_t *data, uint32_t size);
+
+// Copies the next count bytes of the image to data.
+// returns the number copied, fewer than count at the end of the image or if it's corrupt (reader->error)
+uint32_t CImage_read(cimage_reader *reader, uint8_t *data, uint32_t count);
+
+// Decompresses one block. history bytes of the image before it come before dest, the block
+// goes at dest. The compressor uses it to check what it made.
+// returns false if the block is corrupt
+bool CImage_decompress_block(const uint8_t *src, uint16_t srcLength, uint8_t *dest, uint16_t destLength, uint16_t history);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COMPRESSED_IMAGE_H
@@ -2118,6 +2118,7 @@ const unsigned long Oly1p3_CustomMeas_BL_termination = 0x00000000;
 const unsigned long Oly1p3_CustomMeas_BL_start       = 0x00021820;
 const unsigned long Oly1p3_CustomMeas_BL_finish      = 0x00027AE8;
 const unsigned long Oly1p3_CustomMeas_BL_length      = 0x000062C8;
+const unsigned long Oly1p3_CustomMeas_BL_checksum    = 0x62D671FA;
 
 #define OLY1P3_CUSTOMMEAS_BL_TERMINATION 0x00000000
 #define OLY1P3_CUSTOMMEAS_BL_START       0x00021820
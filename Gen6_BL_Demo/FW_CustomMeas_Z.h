@@ -0,0 +1,1861 @@
+#ifndef FIRMWARE_Oly1p3_CustomMeas_BL_Z
+#define FIRMWARE_Oly1p3_CustomMeas_BL_Z
+
+// File: FW_CustomMeas.h, compressed by ImageCompressor. 22169 bytes from 25288, see CompressedImage.h
+
+const unsigned char Oly1p3_CustomMeas_BL_Z[] =
+{
+0x43, 0x51, 0x4C, 0x5A, 0x01, 0x0B, 0x08, 0x02, 0xC8, 0x62, 0x00, 0x00,
+0x20, 0x18, 0x02, 0x00, 0x28, 0x18, 0x02, 0x00, 0xFA, 0x71, 0xD6, 0x62,
+0x31, 0x00, 0x00, 0x00, 0xD5, 0x01, 0xF2, 0x93, 0x00, 0x00, 0x00, 0x00,
+0x28, 0x18, 0x02, 0x00, 0x60, 0xE0, 0x00, 0x3C, 0xF0, 0xE1, 0x02, 0xCC,
+0x60, 0xE0, 0x10, 0x3C, 0x00, 0xEA, 0x04, 0xC8, 0x7F, 0xE0, 0x7C, 0xC8,
+0x00, 0xEA, 0x82, 0xCB, 0xE2, 0xE0, 0x80, 0xCB, 0x00, 0xEA, 0x04, 0xCC,
+0x00, 0xE0, 0x78, 0xCC, 0x00, 0xEA, 0x82, 0xCC, 0xE6, 0xE0, 0x80, 0xCC,
+0x79, 0x3C, 0x08, 0x01, 0x00, 0xEA, 0x04, 0xCD, 0x10, 0xE0, 0x60, 0xCD,
+0x28, 0x3D, 0x02, 0xE0, 0x0D, 0xD9, 0x00, 0xEA, 0x02, 0xCC, 0xD1, 0xE0,
+0x64, 0xCC, 0x02, 0x3C, 0x2E, 0xEB, 0xE0, 0x7F, 0x00, 0xE8, 0x82, 0xC7,
+0x0F, 0xA7, 0x03, 0xE0, 0x74, 0xC7, 0x6E, 0x3C, 0x0F, 0xBF, 0x04, 0xE0,
+0xA8, 0x00, 0xB4, 0x08, 0x7C, 0xC0, 0x2E, 0xEB, 0x64, 0x79, 0x00, 0xE8,
+0x02, 0xC1, 0x02, 0xA4, 0x80, 0x17, 0x0F, 0x24, 0x2E, 0xEB, 0xE0, 0x79,
+0x00, 0xE8, 0x82, 0xC1, 0x83, 0xA7, 0x81, 0x7F, 0x21, 0xD7, 0x68, 0x3A,
+0x02, 0xA4, 0x60, 0xD7, 0x01, 0x67, 0x83, 0xA7, 0x7F, 0x3F, 0x04, 0x01,
+0x6F, 0x3C, 0x04, 0xC0, 0x61, 0x0A, 0x81, 0x67, 0x06, 0x24, 0x03, 0xE0,
+0xF4, 0xC7, 0x0E, 0x00, 0x22, 0x94, 0x3F, 0x08, 0x00, 0x06, 0x60, 0x00,
+0x92, 0x1E, 0x3C, 0x0F, 0xBC, 0x82, 0x38, 0x2E, 0xEB, 0xE4, 0x10, 0x00,
+0x58, 0xA4, 0x0D, 0xE0, 0xF6, 0x00, 0x0E, 0x00, 0xF5, 0x07, 0xE7, 0x00,
+0xB1, 0x08, 0x80, 0x15, 0x4E, 0xEB, 0xF0, 0x7C, 0x03, 0xE0, 0x74, 0x15,
+0x00, 0xE8, 0x80, 0xC4, 0x6B, 0x3C, 0x42, 0xD6, 0x22, 0x00, 0xF0, 0x04,
+0xBC, 0x02, 0x24, 0xE1, 0x08, 0x80, 0x00, 0xB3, 0x08, 0x3F, 0x0C, 0x2E,
+0xEB, 0xE8, 0x79, 0x00, 0xE0, 0x3A, 0x19, 0x90, 0x00, 0xF1, 0x2A, 0x03,
+0xA7, 0x83, 0x00, 0x12, 0xA4, 0x0B, 0x2F, 0xA2, 0xA7, 0x00, 0xE2, 0x88,
+0xC7, 0xFB, 0x27, 0x84, 0x17, 0x61, 0xE0, 0x91, 0x3F, 0xA8, 0x0F, 0xA1,
+0x09, 0x00, 0x38, 0x01, 0xE2, 0x7F, 0xC4, 0x01, 0x3F, 0xEF, 0x00, 0x00,
+0xE0, 0x57, 0x1F, 0x00, 0xE0, 0xAD, 0x1E, 0x8E, 0xA7, 0x8D, 0xA6, 0xCD,
+0x3F, 0x8E, 0xBF, 0x82, 0x38, 0x00, 0xE0, 0xD7, 0x12, 0x00, 0xFA, 0x28,
+0x0F, 0xA7, 0x0D, 0xA5, 0x2E, 0xEB, 0x6D, 0x7E, 0x4A, 0x3F, 0x0F, 0xBF,
+0x41, 0xE0, 0x0A, 0x3F, 0xBF, 0xA5, 0x2E, 0xEB, 0xEC, 0x7E, 0xCA, 0x3D,
+0xBF, 0xBD, 0x00, 0x15, 0xFF, 0xA5, 0x00, 0xE8, 0x02, 0xC6, 0xDE, 0x3D,
+0xFF, 0xBD, 0x00, 0xE8, 0x82, 0xC6, 0x01, 0xE0, 0x8F, 0xA5, 0x0C, 0xAD,
+0x5B, 0x3F, 0x0D, 0xAD, 0x01, 0xE0, 0x0F, 0x42, 0x00, 0xA1, 0xBC, 0x48,
+0x3F, 0x0F, 0xBF, 0x3F, 0xA7, 0x48, 0x3F, 0x3F, 0x18, 0x00, 0x01, 0x6C,
+0x00, 0x92, 0x1F, 0x8E, 0xA6, 0x8F, 0xA7, 0x0F, 0xE3, 0xDF, 0x3E, 0x6E,
+0x00, 0x20, 0x2D, 0x1F, 0x30, 0x00, 0xF1, 0x10, 0x0E, 0xA4, 0x8F, 0xA7,
+0xD8, 0x3F, 0x00, 0x14, 0x28, 0xE0, 0x88, 0x3F, 0x82, 0x38, 0xB2, 0x08,
+0x68, 0x39, 0xBD, 0xD4, 0x2E, 0xEB, 0x6C, 0x7F, 0x00, 0xE8, 0x02, 0xC7,
+0x2E, 0xEB, 0xED, 0xE8, 0x00, 0xF1, 0x02, 0x0E, 0xA9, 0x01, 0x17, 0x0F,
+0xAF, 0x21, 0x09, 0x09, 0xE0, 0xB2, 0x00, 0xB2, 0x08, 0x2E, 0xEB, 0x6D,
+0x84, 0x01, 0xB1, 0x82, 0x8F, 0x82, 0x2F, 0x61, 0x09, 0xA6, 0xD4, 0x2E,
+0xEB, 0xEC, 0x26, 0x00, 0x20, 0x8F, 0x8F, 0xE1, 0x01, 0x00, 0x68, 0x00,
+0x28, 0x8C, 0x2F, 0xD6, 0x00, 0x31, 0x80, 0x17, 0x82, 0x38, 0x00, 0x2A,
+0x96, 0x00, 0x80, 0x00, 0xF0, 0x67, 0xF4, 0x00, 0xB3, 0x08, 0x0A, 0xE0,
+0xC2, 0x34, 0x00, 0xE0, 0x53, 0x25, 0x22, 0x35, 0x00, 0xE0, 0xA4, 0x18,
+0x00, 0xE0, 0x19, 0x1F, 0x0C, 0xE0, 0x1A, 0x3C, 0x94, 0x15, 0x18, 0x89,
+0x88, 0x89, 0xA8, 0x8E, 0xB8, 0x8F, 0x28, 0x31, 0x43, 0x39, 0x0D, 0xE4,
+0xA0, 0x36, 0xC2, 0x3E, 0x0F, 0xE4, 0xA8, 0x37, 0xCD, 0x3F, 0x81, 0xBF,
+0x83, 0x3E, 0x8E, 0xBD, 0x8E, 0xA7, 0x00, 0xE2, 0x8F, 0xC7, 0xFD, 0x2F,
+0x84, 0x3E, 0x04, 0xC4, 0x7C, 0x3C, 0xEA, 0x01, 0xFA, 0x3C, 0x8C, 0x05,
+0x0A, 0xE0, 0xAA, 0x3C, 0x00, 0xE2, 0x02, 0xCD, 0x25, 0x01, 0x00, 0xE2,
+0x03, 0xCD, 0x17, 0x01, 0x00, 0xE2, 0x01, 0xCD, 0x02, 0x01, 0xE1, 0x09,
+0x8C, 0x8F, 0xFE, 0xE7, 0x00, 0x17, 0xCE, 0x3F, 0x00, 0xE0, 0x24, 0x1F,
+0x8E, 0xBF, 0x83, 0x3E, 0x64, 0x00, 0x46, 0x94, 0x17, 0x8E, 0xBF, 0x44,
+0x00, 0xF1, 0x3C, 0xE1, 0x09, 0xAC, 0x8F, 0x1C, 0x8F, 0x0F, 0xE4, 0xA0,
+0x37, 0x28, 0x37, 0x8C, 0x8E, 0xCE, 0x3F, 0xCD, 0x3F, 0xFE, 0xE9, 0x80,
+0xCF, 0xE8, 0x00, 0x9C, 0x8F, 0x0C, 0x8F, 0xA8, 0x37, 0xCE, 0x3F, 0xFF,
+0xE9, 0xFF, 0xCF, 0xE1, 0x00, 0x68, 0x3E, 0xCD, 0x00, 0x00, 0xE4, 0x00,
+0x17, 0x18, 0x3F, 0xFF, 0xE3, 0xFF, 0x16, 0x7D, 0x3F, 0xB4, 0x02, 0xE8,
+0x3F, 0x01, 0x14, 0xAD, 0x24, 0xB3, 0x08, 0xF0, 0xE7, 0x00, 0x16, 0x00,
+0xE0, 0xA9, 0x1D, 0x00, 0xE0, 0xCD, 0xC2, 0x00, 0xF6, 0x06, 0x00, 0xE0,
+0x58, 0x1C, 0x5F, 0x3E, 0x9F, 0x3C, 0x02, 0x15, 0x10, 0xE4, 0x00, 0x11,
+0x0B, 0xBC, 0x01, 0xBE, 0x83, 0x39, 0x0E, 0xB4, 0x00, 0x10, 0x39, 0x0A,
+0x00, 0xF0, 0x1F, 0xC0, 0xC7, 0x8E, 0x2F, 0x03, 0xE0, 0xAC, 0x3C, 0x10,
+0xE2, 0x80, 0xC9, 0x8E, 0xBF, 0x8B, 0x05, 0x03, 0xE0, 0x12, 0x3E, 0xFD,
+0x39, 0x8B, 0xBF, 0x10, 0xE0, 0x00, 0xC6, 0xE7, 0x05, 0x00, 0x14, 0xE1,
+0x09, 0x82, 0x38, 0x01, 0x14, 0x8B, 0xBF, 0xE1, 0x09, 0x00, 0x14, 0x82,
+0x38, 0x78, 0x00, 0x10, 0x1A, 0x78, 0x00, 0x50, 0x17, 0x7F, 0x3F, 0x83,
+0x05, 0x12, 0x00, 0xF0, 0x13, 0xB5, 0x08, 0x00, 0xE0, 0xD8, 0x1F, 0x00,
+0xE0, 0xA9, 0x1A, 0xE8, 0x39, 0x85, 0xBF, 0x69, 0x3A, 0x00, 0xE0, 0xCD,
+0x1F, 0x6A, 0x39, 0x0F, 0xBD, 0xEA, 0x3F, 0x00, 0xE2, 0x83, 0xC7, 0x82,
+0x2F, 0x53, 0xDF, 0x8A, 0x00, 0xF0, 0x28, 0x80, 0x17, 0x8E, 0xBF, 0x85,
+0xBF, 0x16, 0x22, 0x02, 0x8F, 0x83, 0x8F, 0x7F, 0x3F, 0x94, 0x01, 0x64,
+0x3F, 0x7F, 0xC7, 0xE3, 0x3F, 0x08, 0xE0, 0x9E, 0x39, 0x0A, 0xE0, 0x23,
+0x39, 0x86, 0x00, 0x1E, 0x8F, 0x80, 0xE0, 0x9F, 0x8E, 0xFE, 0x3E, 0x87,
+0x01, 0xF8, 0x3F, 0x0E, 0xE0, 0x9A, 0x3F, 0xF8, 0x01, 0x01, 0x14, 0xE1,
+0x0A, 0x00, 0x04, 0x00, 0xF0, 0x2A, 0xE0, 0x1B, 0x1C, 0x01, 0xE0, 0x08,
+0x15, 0x80, 0x14, 0x4E, 0xE0, 0xFC, 0x00, 0x00, 0x17, 0x90, 0x17, 0x2F,
+0xE1, 0x1F, 0x3C, 0x2D, 0xE0, 0x8E, 0x3C, 0xCD, 0x3F, 0x8E, 0x2F, 0x09,
+0xA7, 0x0A, 0x27, 0x00, 0xE0, 0x9B, 0x1F, 0x23, 0x34, 0x1F, 0x3C, 0x09,
+0xE0, 0x0F, 0x0F, 0x08, 0xE0, 0x1F, 0x0F, 0x81, 0x17, 0x6F, 0x3C, 0x82,
+0x38, 0xEE, 0x3F, 0x06, 0x00, 0x40, 0xB6, 0x08, 0x3F, 0x0C, 0xFD, 0x01,
+0x00, 0x08, 0x02, 0xF0, 0x25, 0x02, 0xE0, 0x1E, 0xA1, 0x2B, 0x21, 0x80,
+0x11, 0x00, 0xE0, 0x1B, 0x1A, 0x90, 0x12, 0x63, 0x3B, 0x8C, 0x00, 0x14,
+0xA4, 0x81, 0x3F, 0x81, 0xC1, 0x41, 0x31, 0x2F, 0xE1, 0xA3, 0x3A, 0x2E,
+0xE1, 0x06, 0x39, 0x08, 0xC2, 0x9B, 0x27, 0x1A, 0x27, 0xE2, 0x3F, 0x00,
+0xE2, 0x81, 0xC7, 0xF4, 0x27, 0x84, 0xA7, 0xF0, 0x2F, 0x90, 0x02, 0xA0,
+0x41, 0x31, 0x01, 0xE0, 0x5F, 0xA7, 0x81, 0x17, 0xB3, 0x37, 0xB8, 0x01,
+0x86, 0x57, 0x1F, 0x81, 0xC1, 0x01, 0xE0, 0xDE, 0xBF, 0x34, 0x00, 0x53,
+0xE7, 0x2F, 0x04, 0xE0, 0x80, 0x50, 0x03, 0xF0, 0x03, 0x21, 0x0B, 0x00,
+0x38, 0xB1, 0x08, 0x00, 0xE0, 0xBB, 0x1F, 0x8F, 0xA7, 0x81, 0x3F, 0x00,
+0xE0, 0xC9, 0x1E, 0x32, 0x00, 0xF0, 0x1F, 0x05, 0xE0, 0xFD, 0x8D, 0x01,
+0xE0, 0x4E, 0xA6, 0x81, 0x17, 0xBB, 0x37, 0x0C, 0xE3, 0x5F, 0x3E, 0x01,
+0xE0, 0x4E, 0xBE, 0x01, 0x16, 0x01, 0xE0, 0x5D, 0xBC, 0x02, 0xE0, 0xAE,
+0xBF, 0x06, 0xE0, 0x0D, 0xAE, 0xE1, 0x08, 0x00, 0xE0, 0xC9, 0x1F, 0x06,
+0xE0, 0x0F, 0x8F, 0x1A, 0x27, 0x6E, 0x00, 0xF0, 0xCB, 0x2E, 0x3C, 0x03,
+0xE2, 0x74, 0xCC, 0x94, 0x05, 0x02, 0xE0, 0x5F, 0x9F, 0x04, 0x27, 0x7F,
+0xC7, 0x02, 0xE0, 0x5F, 0xB7, 0x80, 0x15, 0x00, 0xE0, 0x54, 0x1E, 0x03,
+0xE0, 0x4F, 0x9F, 0x8C, 0xA6, 0x01, 0xC7, 0x82, 0xCE, 0x8C, 0xBE, 0x06,
+0xE0, 0x8F, 0xAD, 0x03, 0xE0, 0x4F, 0xB7, 0x82, 0x38, 0x83, 0x3F, 0x00,
+0xE0, 0x49, 0x1F, 0x03, 0xE0, 0x4E, 0x9C, 0x84, 0x3F, 0x82, 0x38, 0x01,
+0xE0, 0x12, 0x24, 0xB8, 0xA7, 0x01, 0xE0, 0x8F, 0x27, 0x28, 0xA7, 0x01,
+0xE0, 0x0C, 0x27, 0x88, 0x8E, 0x01, 0xE0, 0x89, 0x2E, 0xB5, 0x08, 0x70,
+0xC0, 0x98, 0x9E, 0xED, 0x39, 0xFF, 0xE3, 0x80, 0xC1, 0x00, 0xE0, 0xFE,
+0x29, 0x58, 0xA6, 0x00, 0xE0, 0x7B, 0x26, 0x00, 0xE0, 0x49, 0x19, 0xE8,
+0xA5, 0x01, 0xE0, 0x82, 0xBD, 0x00, 0xE0, 0xF4, 0x25, 0x18, 0xA5, 0xC8,
+0xA5, 0xD2, 0xBF, 0x82, 0x17, 0xC2, 0xB6, 0xFE, 0x12, 0x32, 0xBD, 0x42,
+0xBF, 0xE2, 0xBD, 0x01, 0xE0, 0x62, 0xB6, 0x92, 0xBF, 0x82, 0xA9, 0x01,
+0xE0, 0xF2, 0xB1, 0x01, 0xE0, 0x92, 0xB9, 0x01, 0xE0, 0xA2, 0xB9, 0x02,
+0xE0, 0xE2, 0xB1, 0x03, 0xE0, 0xC2, 0xB1, 0x02, 0xE0, 0x67, 0xD4, 0xE8,
+0x3D, 0x68, 0x3E, 0x01, 0xE2, 0x7F, 0xC6, 0x0D, 0xE0, 0xC8, 0x35, 0x00,
+0xE0, 0xB6, 0x1C, 0x6C, 0x3F, 0x01, 0xE2, 0xFF, 0xC6, 0x0F, 0xE0, 0xA4,
+0x36, 0x00, 0xE2, 0x0F, 0xC7, 0x59, 0xA5, 0x4F, 0x3F, 0x00, 0xE0, 0xD9,
+0x1F, 0x01, 0xE2, 0x7F, 0xC7, 0x5F, 0x3D, 0x0E, 0xE4, 0x20, 0x37, 0x52,
+0x01, 0xF0, 0x6B, 0x4A, 0x3F, 0x59, 0xBF, 0x81, 0x10, 0x01, 0xE0, 0x1F,
+0xA7, 0x0A, 0xE0, 0xBC, 0x30, 0x0D, 0xE0, 0xBD, 0x30, 0xCA, 0x3E, 0x4D,
+0x3F, 0x01, 0xE0, 0x1F, 0xBF, 0xAF, 0xA4, 0x04, 0x74, 0xCD, 0x3C, 0xAF,
+0xBC, 0xE0, 0x3C, 0x4F, 0xA4, 0x00, 0xE0, 0x54, 0x1F, 0xC8, 0x3E, 0xCF,
+0xBE, 0x8C, 0xC4, 0x8E, 0xA6, 0x01, 0xE0, 0x02, 0x8A, 0xD5, 0x3E, 0x8E,
+0xBE, 0x01, 0xE0, 0xFF, 0x16, 0xBE, 0xBE, 0xA2, 0x16, 0x1E, 0xBA, 0x6C,
+0x3C, 0xFE, 0xB9, 0xDE, 0xBE, 0xFE, 0xB8, 0x8E, 0xA6, 0x84, 0x79, 0xC1,
+0x3E, 0x8E, 0xBE, 0x6E, 0xA7, 0x00, 0xE0, 0x96, 0x1E, 0x07, 0x6F, 0x01,
+0xE0, 0x6F, 0xA7, 0x05, 0xE0, 0x72, 0xAE, 0x4A, 0x3F, 0x01, 0xE0, 0x6F,
+0xBF, 0x02, 0xE0, 0x0F, 0xA7, 0x83, 0x7E, 0x4A, 0x3F, 0x02, 0xE0, 0x0F,
+0xBF, 0xE4, 0xDE, 0x62, 0x3C, 0xD0, 0x01, 0x20, 0x10, 0xC0, 0x52, 0x02,
+0x02, 0x06, 0x00, 0x60, 0x82, 0x38, 0xE8, 0x3F, 0x10, 0x24, 0x54, 0x01,
+0xF2, 0x05, 0xFE, 0x15, 0x8C, 0xA6, 0x00, 0x17, 0xDB, 0x3E, 0x6E, 0x3C,
+0x8C, 0xBE, 0x4F, 0xBF, 0x5F, 0xBF, 0x01, 0xE0, 0x6F, 0xB7, 0xC0, 0x04,
+0x21, 0x01, 0xE0, 0xF2, 0x02, 0xF4, 0x12, 0x17, 0x2F, 0xE0, 0x8E, 0x3C,
+0x2E, 0xE0, 0x0E, 0x3D, 0xCE, 0x3F, 0x8C, 0x2F, 0x2F, 0xE0, 0x0F, 0x3C,
+0x89, 0x2F, 0x01, 0xE0, 0x88, 0xA6, 0x01, 0xE0, 0x68, 0x9F, 0x89, 0xBE,
+0x6F, 0x3C, 0x0A, 0xB7, 0x2A, 0x00, 0xA0, 0xB4, 0x08, 0x3F, 0x0C, 0x7C,
+0xC0, 0x00, 0xE0, 0xD4, 0x19, 0x58, 0x01, 0xF0, 0x23, 0xC3, 0xA7, 0x00,
+0x17, 0x86, 0x6F, 0xA3, 0xA7, 0x06, 0xE0, 0x02, 0xAF, 0x87, 0x6F, 0x86,
+0x4F, 0x00, 0xE2, 0xA0, 0xC7, 0x8F, 0x27, 0x22, 0x17, 0x92, 0xA7, 0x53,
+0xBF, 0x00, 0xE0, 0xC3, 0x2F, 0xC2, 0xA7, 0x01, 0xE0, 0x72, 0x9D, 0x32,
+0xA4, 0x01, 0xE0, 0x82, 0xA4, 0x81, 0x3F, 0x82, 0x17, 0x92, 0xBF, 0x24,
+0x00, 0x60, 0x84, 0xC7, 0x00, 0xE0, 0xCA, 0x2F, 0x0A, 0x00, 0xF0, 0x16,
+0x98, 0xC7, 0x96, 0x27, 0x12, 0xA2, 0x00, 0xE2, 0x01, 0xCA, 0x01, 0xE0,
+0x07, 0x01, 0x10, 0x2A, 0x01, 0xE0, 0xF2, 0x9F, 0x01, 0xE0, 0x62, 0x9F,
+0x7F, 0x3F, 0x8A, 0x04, 0x6F, 0x3E, 0x01, 0xC6, 0x87, 0x4E, 0x01, 0xE0,
+0x02, 0x44, 0x00, 0xA3, 0xB6, 0x2F, 0xE0, 0xFE, 0xAE, 0x86, 0x4F, 0xC3,
+0xBF, 0x20, 0x8A, 0x02, 0x02, 0x6C, 0x00, 0x11, 0xA4, 0x46, 0x00, 0xC2,
+0x84, 0xC7, 0x83, 0x27, 0x02, 0x17, 0x53, 0xBF, 0xC3, 0xA7, 0x85, 0x27,
+0x20, 0x00, 0xF2, 0x17, 0x90, 0x3F, 0x04, 0xC0, 0xA8, 0x0F, 0x21, 0x0A,
+0x00, 0x38, 0x00, 0xE2, 0x81, 0xCF, 0xC6, 0x01, 0x02, 0xE0, 0xE2, 0x9C,
+0x02, 0xE0, 0x52, 0x9F, 0xE2, 0xA7, 0x9E, 0x3C, 0xFF, 0xE3, 0xFF, 0xC4,
+0x32, 0xA4, 0x02, 0xE0, 0xE2, 0xB4, 0x92, 0x00, 0xDF, 0xFF, 0xE7, 0xB7,
+0x00, 0x4F, 0xDD, 0xDC, 0x00, 0x4D, 0xDD, 0x92, 0xA7, 0x8A, 0xB2, 0x00,
+0x00, 0x20, 0x87, 0x4F, 0x2E, 0x03, 0xF0, 0x35, 0xAE, 0x27, 0x01, 0x12,
+0x00, 0x17, 0x00, 0xE0, 0xC8, 0x1D, 0x00, 0xE0, 0x47, 0x1D, 0x00, 0xE0,
+0xC6, 0x1C, 0x32, 0xA4, 0xD2, 0xA7, 0x12, 0xBA, 0x05, 0xE0, 0x62, 0xAF,
+0x81, 0x3F, 0xFF, 0xE7, 0x33, 0x2C, 0x02, 0xE0, 0xC2, 0x9F, 0x02, 0xE0,
+0x52, 0xB4, 0x02, 0xE0, 0x62, 0xB4, 0x00, 0xE0, 0xCD, 0x27, 0x01, 0xE0,
+0x92, 0xA7, 0x02, 0xE0, 0x52, 0xB2, 0x8F, 0x8F, 0xB3, 0xBF, 0x81, 0x17,
+0x05, 0xE0, 0xF2, 0x8E, 0x2A, 0x03, 0x20, 0xBD, 0x37, 0x12, 0x03, 0xF0,
+0x11, 0x01, 0xE0, 0xCE, 0xA6, 0xCD, 0x3F, 0x01, 0xE0, 0xCE, 0xBF, 0xFF,
+0xE7, 0x96, 0x00, 0x92, 0xBF, 0x01, 0xE0, 0xF2, 0xB7, 0x02, 0xE0, 0xD2,
+0xB7, 0x02, 0xE0, 0xE2, 0xB7, 0xFF, 0xE7, 0x8D, 0x00, 0xD6, 0x00, 0x60,
+0x81, 0xC7, 0xFF, 0xE7, 0x88, 0x2F, 0xB6, 0x00, 0xEA, 0x02, 0xE0, 0xC2,
+0x9E, 0xFE, 0x3E, 0xA8, 0x02, 0x05, 0xE0, 0x62, 0x8F, 0x20, 0x27, 0x84,
+0x00, 0xF0, 0x09, 0x52, 0xA7, 0x05, 0xE0, 0xE2, 0xAF, 0x01, 0x3F, 0xFE,
+0xE7, 0x72, 0x2C, 0x02, 0xE0, 0xE2, 0x9F, 0x02, 0xE0, 0xD2, 0x9E, 0x02,
+0xE0, 0x42, 0x9F, 0xE5, 0x01, 0x22, 0x9D, 0x3F, 0x8C, 0x00, 0x00, 0x50,
+0x00, 0xF2, 0x0B, 0x3C, 0x2F, 0x01, 0xE0, 0x25, 0x17, 0x33, 0xBF, 0xFF,
+0xE7, 0xBD, 0x00, 0x01, 0xE0, 0xA5, 0x17, 0xB3, 0xBF, 0xFF, 0xE7, 0xB8,
+0x00, 0xEE, 0x3E, 0x81, 0xC6, 0xA4, 0x00, 0x60, 0xD2, 0xB6, 0x2E, 0xE0,
+0xFF, 0x8F, 0x16, 0x00, 0xF0, 0x32, 0xAD, 0x00, 0xB1, 0x08, 0xEA, 0x3F,
+0x69, 0x3D, 0xE8, 0x3C, 0x6F, 0x3C, 0x02, 0xE0, 0xFD, 0xD4, 0x01, 0x14,
+0xE1, 0x08, 0xFF, 0xFF, 0x68, 0x3E, 0x00, 0xE2, 0x03, 0xC6, 0x14, 0x26,
+0x00, 0x16, 0xFC, 0x3C, 0x8F, 0x05, 0x9A, 0x3C, 0x2A, 0x3C, 0x7F, 0xC6,
+0x1C, 0x3D, 0xFF, 0xC4, 0x00, 0xE0, 0x01, 0xC4, 0x0F, 0xE0, 0x1A, 0x3C,
+0x80, 0xE0, 0x1A, 0x8F, 0xFA, 0x3C, 0x0F, 0xAF, 0xFA, 0x01, 0x01, 0x4C,
+0x02, 0xFF, 0x34, 0xE2, 0x83, 0xCC, 0xEC, 0x05, 0xB2, 0x08, 0x69, 0x3E,
+0x7C, 0xC6, 0x0B, 0xE0, 0x42, 0x36, 0xEA, 0x3F, 0x84, 0xC7, 0xA2, 0x35,
+0x9F, 0x3D, 0x01, 0xE0, 0x2A, 0x3C, 0xEA, 0x3F, 0x3F, 0x89, 0xAF, 0x8E,
+0x28, 0x31, 0x1F, 0x8F, 0xC2, 0x3E, 0xA8, 0x36, 0x02, 0xE0, 0x9F, 0x38,
+0x4D, 0x3F, 0x80, 0xE1, 0xCF, 0x8E, 0x28, 0x37, 0x4D, 0x3F, 0xFF, 0x3D,
+0x02, 0xBF, 0xF1, 0x01, 0xFC, 0x17, 0x5F, 0x3E, 0x04, 0xC6, 0x68, 0x00,
+0x0F, 0xF0, 0x33, 0x61, 0x09, 0x00, 0xE0, 0x50, 0x1D, 0x00, 0xE0, 0x98,
+0x1D, 0xAA, 0x3D, 0xCB, 0x35, 0x9C, 0x25, 0x00, 0xE0, 0xDA, 0x1C, 0x80,
+0x17, 0x8A, 0x00, 0x79, 0x3E, 0xEF, 0x3E, 0xFF, 0xC6, 0x83, 0x01, 0xDE,
+0x9F, 0x9D, 0x3F, 0x81, 0xC7, 0xFF, 0x3D, 0x8D, 0x05, 0x0E, 0xE0, 0xAB,
+0x37, 0x1A, 0x3F, 0x0E, 0xE0, 0x0D, 0x0E, 0xF8, 0x3E, 0xF1, 0x01, 0x79,
+0x3E, 0xF5, 0x01, 0x6E, 0x3C, 0x0C, 0xC4, 0x82, 0x38, 0xCE, 0x02, 0xF0,
+0x1D, 0x6B, 0x3C, 0x82, 0x38, 0xFF, 0xFF, 0x80, 0x17, 0x2D, 0xE0, 0x8F,
+0x3C, 0x2E, 0xE0, 0x0F, 0x3D, 0xFE, 0x3E, 0x8D, 0x01, 0xB6, 0x08, 0x64,
+0xC0, 0x2E, 0xE0, 0x8F, 0x3D, 0x68, 0x39, 0x2F, 0xE1, 0x0F, 0x3E, 0x07,
+0x27, 0x01, 0x14, 0x85, 0x27, 0x1C, 0xC0, 0x61, 0x0B, 0xDC, 0x00, 0xF0,
+0x2B, 0x86, 0x25, 0x00, 0x17, 0x2E, 0xE0, 0x0E, 0x3E, 0x01, 0x14, 0x77,
+0x2F, 0x6A, 0x3F, 0x00, 0xE2, 0x03, 0xC7, 0x03, 0x27, 0x01, 0x14, 0xF1,
+0x2F, 0x0E, 0xE0, 0x1C, 0x3D, 0x80, 0x17, 0x04, 0x7F, 0xFF, 0xE3, 0x7F,
+0xC7, 0x81, 0x7F, 0x02, 0x7F, 0x11, 0x27, 0xEE, 0x3F, 0x8C, 0xC7, 0xFF,
+0xE3, 0xFF, 0xC7, 0x6F, 0x3F, 0xF0, 0xE3, 0x80, 0xC7, 0x0F, 0xE2, 0x18,
+0x00, 0x60, 0x06, 0x27, 0x10, 0xE0, 0x80, 0xC7, 0x10, 0x00, 0xF0, 0x5B,
+0x81, 0x7F, 0x00, 0xE0, 0x50, 0x1C, 0x00, 0xE0, 0x98, 0x19, 0xA8, 0x39,
+0xCB, 0x31, 0x00, 0xE0, 0xF4, 0x21, 0x80, 0x17, 0x03, 0x7E, 0x6F, 0x3B,
+0x00, 0xE0, 0x5A, 0x1A, 0xEF, 0x3A, 0x6F, 0x3F, 0x01, 0x66, 0x89, 0x00,
+0x00, 0xE0, 0xE3, 0x22, 0x81, 0xC7, 0x01, 0xE2, 0xFF, 0xC7, 0xF3, 0x3F,
+0x6F, 0x3F, 0xBD, 0x03, 0x2B, 0x37, 0x18, 0x3F, 0x9E, 0xA6, 0xF2, 0x3E,
+0xF4, 0x01, 0x8E, 0xA6, 0xF4, 0x3E, 0x01, 0xE0, 0x04, 0x01, 0xF1, 0x2A,
+0xF3, 0x3F, 0x01, 0xE0, 0x89, 0x03, 0x0D, 0xE0, 0xAB, 0x37, 0x98, 0x3E,
+0x8D, 0xA0, 0x80, 0x16, 0xF4, 0x38, 0x1A, 0x01, 0xEF, 0x38, 0x81, 0xC0,
+0x01, 0xE2, 0xFF, 0xC0, 0xF1, 0x39, 0x10, 0xE0, 0x80, 0xC6, 0xEB, 0x01,
+0xF0, 0x10, 0x05, 0xE0, 0xAB, 0x30, 0x98, 0x3A, 0xFF, 0xE3, 0xFF, 0xC6,
+0x84, 0x05, 0x85, 0xA2, 0xF4, 0x3A, 0xF2, 0x01, 0x1F, 0xE2, 0xFF, 0xCE,
+0x87, 0x05, 0xFF, 0xC7, 0x01, 0xE0, 0xCB, 0x36, 0x91, 0xCC, 0x04, 0xD0,
+0xC7, 0x7D, 0x3E, 0xED, 0x38, 0x61, 0xE0, 0xA6, 0x3A, 0x81, 0xC7, 0x7D,
+0x3E, 0x10, 0x00, 0xF0, 0x1D, 0x80, 0x12, 0x65, 0xE0, 0xAE, 0x3D, 0xF3,
+0x3F, 0x61, 0x3B, 0x6F, 0x3F, 0xC5, 0x04, 0x03, 0x66, 0xA4, 0x22, 0x01,
+0x67, 0x26, 0xE1, 0x16, 0x3F, 0x20, 0x2B, 0x6B, 0x3B, 0xEA, 0x39, 0x69,
+0x3A, 0x03, 0x7E, 0x21, 0xDB, 0x00, 0xE0, 0x3E, 0x1F, 0x01, 0xE0, 0xFE,
+0xA7, 0xA8, 0x02, 0xF0, 0x09, 0xFC, 0x2F, 0x0F, 0xE0, 0x46, 0x3A, 0x94,
+0x2F, 0x60, 0x3C, 0x65, 0x3D, 0x84, 0x14, 0x14, 0xC4, 0x85, 0x7F, 0x5F,
+0xDC, 0x17, 0xDB, 0x00, 0x14, 0x36, 0x01, 0x00, 0xAC, 0x00, 0xF4, 0x41,
+0xFF, 0xE7, 0x1D, 0x01, 0xFF, 0xE7, 0xAB, 0x00, 0x02, 0x14, 0xFE, 0xE7,
+0xDC, 0x00, 0x84, 0x64, 0x65, 0x3C, 0x13, 0xDC, 0x7F, 0x17, 0x81, 0x67,
+0x65, 0x3D, 0x60, 0x3C, 0x05, 0x7F, 0xCB, 0x37, 0x02, 0x67, 0x04, 0xC5,
+0x88, 0x14, 0x18, 0xC4, 0x06, 0x79, 0x8F, 0x77, 0x0E, 0x77, 0x41, 0xDC,
+0x06, 0x22, 0x65, 0x3D, 0x0C, 0xC5, 0xE3, 0x3C, 0x64, 0x3C, 0x3B, 0xDC,
+0x07, 0x23, 0x63, 0x3D, 0x0C, 0xC5, 0x83, 0x64, 0x15, 0x3D, 0x66, 0x3C,
+0x34, 0xDC, 0x60, 0x3C, 0x00, 0xE0, 0xDA, 0x1F, 0x66, 0x00, 0xF0, 0x03,
+0x2C, 0xDC, 0xCD, 0x00, 0x5E, 0x9B, 0xEE, 0x3A, 0x06, 0xE4, 0x2B, 0x33,
+0x06, 0xE4, 0x40, 0x33, 0x03, 0x66, 0x66, 0x00, 0xF0, 0x27, 0x80, 0x16,
+0xFF, 0xE7, 0x98, 0x00, 0x00, 0xE0, 0xB6, 0x1F, 0x02, 0x17, 0x2F, 0xBF,
+0x01, 0xE0, 0x4F, 0xBF, 0xE8, 0xE3, 0x04, 0x17, 0x0E, 0xA7, 0xFF, 0xE3,
+0x7F, 0xCF, 0x84, 0x01, 0x17, 0x17, 0x03, 0xE0, 0x4F, 0xBF, 0x08, 0x17,
+0x06, 0xE0, 0x2F, 0xBF, 0x00, 0x3B, 0x82, 0x38, 0x03, 0x3C, 0x82, 0x38,
+0x04, 0x3C, 0x82, 0x38, 0xD4, 0x04, 0xF0, 0x21, 0xA0, 0x1F, 0x8F, 0xA7,
+0x0F, 0xA4, 0x04, 0xC0, 0x82, 0x38, 0x00, 0xE0, 0xD4, 0x1F, 0x8F, 0xA7,
+0x00, 0xE2, 0x89, 0xC7, 0x00, 0xE2, 0x89, 0xCF, 0x0C, 0x01, 0xB2, 0x08,
+0x00, 0xE0, 0x39, 0x19, 0xE8, 0x3C, 0x02, 0xA4, 0x62, 0xD1, 0x00, 0x3A,
+0x02, 0xA4, 0x21, 0x09, 0x03, 0xE0, 0x9B, 0x00, 0x3C, 0x02, 0x0A, 0x2A,
+0x00, 0x32, 0x3C, 0x01, 0xB3, 0x2A, 0x00, 0x90, 0x39, 0x90, 0xDA, 0x02,
+0xA4, 0xE3, 0x3C, 0x4B, 0xD1, 0x88, 0x00, 0xF2, 0x1B, 0xCF, 0x16, 0x2F,
+0xA7, 0x5D, 0x3F, 0x10, 0xCF, 0x2F, 0xBF, 0x2F, 0xA7, 0x01, 0xE2, 0x40,
+0xC7, 0x00, 0xE2, 0x40, 0xCF, 0xFB, 0x01, 0x81, 0x16, 0x7F, 0x17, 0x8F,
+0xBE, 0x08, 0x3F, 0x0F, 0xA7, 0x00, 0xE2, 0x02, 0xC7, 0x07, 0x27, 0x8D,
+0x00, 0x8F, 0xBE, 0x0C, 0x00, 0x82, 0x08, 0x2F, 0x0F, 0xBF, 0x00, 0x00,
+0x00, 0x00, 0x0E, 0x00, 0x84, 0x75, 0x27, 0x2F, 0xA7, 0xCF, 0x16, 0x5D,
+0x3F, 0x3E, 0x00, 0xF0, 0x27, 0x7D, 0x2F, 0x00, 0x3B, 0x02, 0xA4, 0x63,
+0xD1, 0x57, 0xDA, 0x65, 0xDA, 0x02, 0xA4, 0xA1, 0x09, 0x02, 0xE0, 0xD6,
+0x00, 0x82, 0x38, 0xB1, 0x08, 0x81, 0x15, 0x07, 0xE0, 0x68, 0x15, 0x80,
+0x14, 0x02, 0x14, 0xAB, 0xD0, 0x00, 0xE0, 0xB9, 0x1F, 0x0F, 0xBC, 0xA1,
+0x08, 0x02, 0xE0, 0xC8, 0x00, 0x08, 0x8F, 0x88, 0xA7, 0x00, 0xE2, 0xBB,
+0x01, 0xF0, 0x1D, 0x02, 0xC7, 0xC2, 0x37, 0x00, 0xE2, 0xBF, 0xC7, 0x0B,
+0x27, 0xF8, 0xEB, 0x6C, 0x7F, 0x00, 0xE8, 0x00, 0xC7, 0xA3, 0x37, 0x9E,
+0x3F, 0x8F, 0xA7, 0x00, 0x17, 0x3F, 0xBF, 0x82, 0x38, 0xF8, 0xEB, 0xE4,
+0x7E, 0x00, 0xE8, 0x80, 0xC6, 0xA3, 0x37, 0x9D, 0x3F, 0x8F, 0xA7, 0x12,
+0x00, 0x97, 0xB2, 0x08, 0x68, 0x39, 0xE3, 0xDF, 0x02, 0x8F, 0x82, 0x3C,
+0x00, 0x11, 0x13, 0x3C, 0x00, 0x24, 0x92, 0xA6, 0x3E, 0x00, 0xF5, 0x0A,
+0x0F, 0xA7, 0x42, 0xA1, 0x00, 0xE2, 0x82, 0xCE, 0x85, 0x17, 0x87, 0x16,
+0x6F, 0xE0, 0x2D, 0x39, 0x1E, 0xB9, 0xBE, 0xBF, 0x61, 0x09, 0xF8, 0xEB,
+0x64, 0x60, 0x00, 0xF0, 0x13, 0x42, 0xA1, 0x8F, 0xA7, 0x00, 0xE0, 0x5B,
+0x1F, 0x0F, 0xB9, 0x1F, 0xBF, 0x05, 0x17, 0x3F, 0xBF, 0x61, 0x09, 0xB2,
+0x08, 0x7C, 0xC0, 0x2F, 0xEB, 0x30, 0x79, 0x00, 0xE8, 0x02, 0xC1, 0x02,
+0xE0, 0xC2, 0x8F, 0x40, 0x02, 0xF0, 0x15, 0x87, 0x27, 0x01, 0xE0, 0x82,
+0xA7, 0x84, 0x27, 0x01, 0x7C, 0x81, 0x3F, 0x01, 0x64, 0x62, 0xA7, 0xF8,
+0xEB, 0xEC, 0x7F, 0x00, 0xE8, 0x80, 0xC7, 0x23, 0x34, 0x00, 0xE2, 0x02,
+0xCF, 0x98, 0x3F, 0x8F, 0xA7, 0x83, 0x01, 0xA8, 0x00, 0xF3, 0x02, 0x03,
+0x17, 0x2F, 0xBF, 0x04, 0xC0, 0x61, 0x09, 0xB1, 0x08, 0x3F, 0x0C, 0x00,
+0x14, 0xDB, 0xDF, 0x81, 0x94, 0x08, 0x71, 0xA1, 0x08, 0x00, 0x38, 0xBF,
+0x0F, 0x82, 0x0E, 0x00, 0x75, 0xAF, 0x0F, 0x00, 0x38, 0xB2, 0x08, 0x78,
+0x64, 0x00, 0x11, 0x82, 0x62, 0x00, 0x35, 0x86, 0x27, 0xB2, 0x60, 0x00,
+0x5F, 0x12, 0xA7, 0xF8, 0xEB, 0xE4, 0x60, 0x00, 0x02, 0x55, 0xCF, 0xA7,
+0x8B, 0x6F, 0x08, 0x60, 0x00, 0x35, 0xDD, 0xDF, 0x10, 0xF6, 0x08, 0x00,
+0x62, 0x00, 0xF0, 0x31, 0xB2, 0x08, 0x1C, 0x25, 0xB8, 0x25, 0x2F, 0xEB,
+0xB0, 0x7F, 0x00, 0xE8, 0x82, 0xC7, 0x0F, 0x8F, 0x00, 0xE2, 0x01, 0xC7,
+0x13, 0x2F, 0x0F, 0xAF, 0x0B, 0x17, 0x6F, 0x39, 0x01, 0xE0, 0x0F, 0xAF,
+0x82, 0x8F, 0xB2, 0xBC, 0x00, 0xE2, 0x82, 0xC7, 0x8C, 0x27, 0x00, 0xE2,
+0x01, 0xCC, 0x00, 0xE0, 0x43, 0x01, 0x36, 0x24, 0x00, 0xE2, 0x02, 0xCC,
+0x33, 0x01, 0x00, 0x11, 0x62, 0x3C, 0x61, 0x09, 0x16, 0x00, 0x31, 0x34,
+0x01, 0x04, 0x14, 0x00, 0xF0, 0x15, 0xF7, 0x01, 0x7A, 0xE0, 0x89, 0x17,
+0x2E, 0xE1, 0x3F, 0x3D, 0x2A, 0xE1, 0x4F, 0x3D, 0x07, 0xE4, 0x68, 0xC7,
+0x2E, 0x2D, 0x42, 0xBF, 0x68, 0x3F, 0x82, 0x8F, 0x62, 0x3C, 0x81, 0xCF,
+0x82, 0xAF, 0x12, 0xBF, 0x40, 0xDF, 0x34, 0x00, 0x04, 0x6E, 0x00, 0x40,
+0x5F, 0xA7, 0x6B, 0x39, 0x70, 0x00, 0x71, 0x5C, 0x2F, 0x02, 0xE0, 0x4F,
+0x8F, 0x6F, 0x0C, 0x00, 0xF0, 0x27, 0x02, 0xCF, 0x02, 0xE0, 0x4F, 0xAF,
+0x14, 0xC1, 0x03, 0xE0, 0xCF, 0xAD, 0xC2, 0x00, 0x02, 0xE4, 0x77, 0xC5,
+0x8A, 0x17, 0x2A, 0xE1, 0x3F, 0x3D, 0x42, 0xBD, 0xDC, 0x00, 0x00, 0xE0,
+0xDB, 0x1F, 0xC2, 0xBF, 0xD8, 0x00, 0xFF, 0x17, 0xC2, 0xBF, 0xD5, 0x00,
+0x07, 0xE4, 0x68, 0xC5, 0x01, 0xC7, 0x2F, 0xE1, 0x3F, 0x3D, 0x9E, 0x3F,
+0xDA, 0x01, 0x60, 0xC2, 0xBF, 0xCD, 0x00, 0x80, 0x17, 0xE2, 0x07, 0x80,
+0x97, 0x2F, 0x2F, 0xE0, 0x8F, 0x3C, 0x94, 0x2F, 0x1E, 0x02, 0xA0, 0x81,
+0xC7, 0x90, 0x27, 0x88, 0x8F, 0xFF, 0xE3, 0xFF, 0xCC, 0xC2, 0x00, 0xF1,
+0x2C, 0x8B, 0x27, 0x1D, 0x01, 0x02, 0xE4, 0xF7, 0xC4, 0x8A, 0x17, 0x29,
+0xE1, 0xBF, 0x3C, 0xC8, 0xBC, 0xFD, 0xE7, 0xFA, 0x00, 0x82, 0x38, 0x16,
+0x01, 0x7A, 0xE0, 0x09, 0x17, 0x2F, 0xE1, 0xBE, 0x3C, 0x29, 0xE1, 0xCE,
+0x3C, 0x07, 0xE4, 0xE8, 0xC7, 0x84, 0x2C, 0xC8, 0xBF, 0xFD, 0xE7, 0xEC,
+0x00, 0x07, 0xE4, 0xE8, 0xC4, 0x81, 0xC7, 0x29, 0xE1, 0xBE, 0x3C, 0x9F,
+0x2E, 0x00, 0x11, 0xE3, 0x80, 0x00, 0x62, 0xC8, 0xBF, 0xF2, 0x00, 0x05,
+0x24, 0x5E, 0x00, 0x93, 0x82, 0x2F, 0x82, 0x38, 0xFD, 0xE7, 0xD7, 0x00,
+0x07, 0x10, 0x00, 0xF0, 0x07, 0x83, 0x27, 0xFD, 0xE7, 0xB5, 0x00, 0x82,
+0x38, 0x3F, 0x24, 0x88, 0xA7, 0x81, 0x16, 0xDF, 0x3E, 0x00, 0x17, 0x96,
+0x26, 0x08, 0x8F, 0x66, 0x02, 0x20, 0x02, 0xC7, 0x6A, 0x02, 0x1B, 0x11,
+0xA6, 0x02, 0xF0, 0x01, 0x02, 0xE0, 0x77, 0x14, 0x0F, 0xA7, 0x00, 0xE4,
+0x0A, 0xC7, 0x2E, 0xE1, 0x38, 0x3F, 0x6E, 0x3C, 0xB2, 0x02, 0x06, 0x66,
+0x02, 0xF0, 0x0D, 0x8F, 0xA7, 0x18, 0xA6, 0x48, 0xA7, 0xAF, 0xA6, 0x00,
+0xE2, 0x02, 0xCE, 0x0F, 0xE0, 0x2D, 0x3F, 0x0D, 0x01, 0x6F, 0x3F, 0x04,
+0xE4, 0x71, 0xC7, 0x07, 0xE0, 0x68, 0x14, 0x30, 0x00, 0x51, 0x00, 0xE4,
+0x8F, 0xC7, 0x1F, 0x36, 0x00, 0x40, 0xFE, 0x3E, 0xF3, 0x05, 0x9C, 0x00,
+0x71, 0x9E, 0x3F, 0xAD, 0x3F, 0xEE, 0x00, 0x68, 0x14, 0x00, 0xF0, 0x05,
+0x61, 0xE0, 0x00, 0x3F, 0x01, 0xE0, 0x08, 0x8C, 0x81, 0x17, 0xB8, 0x37,
+0xDE, 0x3F, 0x00, 0x14, 0x28, 0xE1, 0x88, 0x3F, 0x02, 0x04, 0xF5, 0x1F,
+0xC4, 0x1F, 0x24, 0xE0, 0xB4, 0x15, 0xAF, 0xBD, 0xAC, 0xE0, 0x65, 0x16,
+0x3F, 0xBE, 0x86, 0xE0, 0xA1, 0x16, 0x00, 0xE4, 0x25, 0xC4, 0xAF, 0xBE,
+0x1F, 0xEB, 0x08, 0x7F, 0x0F, 0xBC, 0x00, 0xE8, 0x02, 0xC7, 0xAF, 0xBD,
+0x3F, 0xBE, 0xAF, 0xBE, 0x81, 0x16, 0x0E, 0xBC, 0x9F, 0xBE, 0x32, 0x00,
+0x10, 0x16, 0x20, 0x00, 0x20, 0xAF, 0xBE, 0x20, 0x00, 0x51, 0xAC, 0xE0,
+0xE5, 0x16, 0xBF, 0x3A, 0x00, 0x40, 0x0E, 0xA7, 0xAF, 0xBE, 0x6E, 0x09,
+0xF0, 0x7B, 0x18, 0xA7, 0x38, 0xA4, 0x08, 0xE0, 0x28, 0x3F, 0x82, 0x38,
+0x80, 0x17, 0x08, 0xE0, 0x9A, 0x0C, 0xA8, 0xBF, 0xB8, 0xBF, 0x82, 0x38,
+0xB5, 0x08, 0xB8, 0xA6, 0xA8, 0xA7, 0x18, 0xA7, 0x9D, 0x3F, 0x0C, 0xE0,
+0x9A, 0x3F, 0x88, 0xA6, 0x2F, 0xE1, 0xCE, 0x3F, 0x2C, 0xE1, 0x4E, 0x3E,
+0x68, 0x39, 0x08, 0xE0, 0x9F, 0x3E, 0x9C, 0x3E, 0x7D, 0x3C, 0x6A, 0x3A,
+0x8C, 0x05, 0x03, 0xE0, 0x2F, 0x3F, 0x63, 0x3D, 0xE9, 0x3A, 0x02, 0xE0,
+0x31, 0xD1, 0x02, 0xA4, 0x0A, 0xE0, 0x23, 0x3A, 0x09, 0xE0, 0x93, 0x3A,
+0x02, 0xE0, 0x2A, 0xD1, 0x32, 0xA5, 0x14, 0x3D, 0x32, 0xBD, 0xE1, 0x0A,
+0xB8, 0xA7, 0x96, 0x27, 0x28, 0xA7, 0x98, 0xA6, 0x9E, 0x3C, 0x99, 0x3F,
+0x08, 0xA7, 0x29, 0xE1, 0xCD, 0x3C, 0x2F, 0xE1, 0xCD, 0x3F, 0x08, 0xE0,
+0x19, 0x3F, 0x1F, 0x3F, 0x7E, 0x3C, 0x85, 0x04, 0x09, 0xE0, 0xA9, 0x3E,
+0x8A, 0xBC, 0x82, 0x38, 0xA9, 0x3F, 0x8A, 0xBF, 0xDF, 0x01, 0x40, 0x82,
+0x38, 0x6F, 0x3C, 0x06, 0x00, 0x80, 0xA8, 0xA7, 0x98, 0xA6, 0x38, 0xA7,
+0x99, 0x3F, 0x2A, 0x00, 0xB2, 0x29, 0x3F, 0xA8, 0xBF, 0x38, 0xBF, 0x82,
+0x38, 0x2F, 0xEB, 0xD8, 0xE4, 0x02, 0xF1, 0x00, 0xBC, 0x82, 0x38, 0x8C,
+0xEB, 0x98, 0x7F, 0x00, 0xE0, 0x5C, 0x1E, 0x00, 0xE0, 0xDD, 0x1E, 0x14,
+0x00, 0x33, 0xE0, 0x1D, 0x0E, 0x16, 0x00, 0x74, 0xE8, 0x82, 0xC7, 0x00,
+0x16, 0x80, 0x16, 0x12, 0x00, 0x20, 0x18, 0x7F, 0xF4, 0x00, 0xF0, 0x06,
+0x8E, 0xA7, 0x1E, 0xA4, 0x00, 0xE0, 0x5C, 0x1F, 0x0F, 0xE2, 0xCE, 0x3F,
+0x00, 0xE0, 0x5D, 0x1F, 0x08, 0xE2, 0x4E, 0x3C, 0xC8, 0x56, 0x01, 0x10,
+0xE0, 0x56, 0x01, 0x31, 0x8C, 0xEB, 0x94, 0x38, 0x00, 0x22, 0x8F, 0xA7,
+0x10, 0x00, 0x24, 0xFF, 0xFF, 0x6C, 0x00, 0xF0, 0x1D, 0x8F, 0xA7, 0x96,
+0x27, 0x0F, 0xA4, 0x13, 0x24, 0x1F, 0xA6, 0x23, 0x34, 0x0B, 0xE0, 0x1C,
+0x3C, 0x00, 0x14, 0x9C, 0xA6, 0x89, 0x26, 0x8C, 0xA7, 0x0D, 0xE0, 0x9F,
+0x3E, 0x80, 0xE1, 0x1F, 0x8F, 0xFF, 0x3E, 0x1E, 0x3C, 0xFC, 0x01, 0x08,
+0xC6, 0x7B, 0x3E, 0xF4, 0x01, 0xBC, 0x00, 0x06, 0x4C, 0x00, 0x00, 0xA6,
+0x00, 0xF0, 0xC5, 0xFF, 0xFF, 0xB6, 0x08, 0x5C, 0xC0, 0xE9, 0x38, 0x00,
+0xE4, 0x8C, 0xC0, 0x02, 0xE0, 0xE8, 0xA7, 0xE1, 0x3A, 0x9F, 0x3A, 0x58,
+0xA3, 0xE5, 0x8D, 0x02, 0x7B, 0x68, 0x3A, 0x84, 0x7D, 0xE9, 0x39, 0x85,
+0x78, 0x00, 0xE0, 0xFE, 0x2D, 0x85, 0x9D, 0x86, 0x7D, 0x00, 0x15, 0x80,
+0x17, 0xEA, 0x3C, 0x02, 0x64, 0xD5, 0xAF, 0x88, 0x00, 0x87, 0xC4, 0x01,
+0xE2, 0x8C, 0xCC, 0x29, 0xC4, 0x20, 0xC5, 0x00, 0xE0, 0x59, 0x01, 0x88,
+0x8F, 0x6F, 0x3F, 0x00, 0xE2, 0x7F, 0xC7, 0xFE, 0x39, 0xF4, 0x01, 0x43,
+0xE0, 0x8F, 0x3F, 0x00, 0xE2, 0x80, 0xCF, 0x6F, 0x03, 0x01, 0xE0, 0x64,
+0x89, 0x6C, 0x21, 0x01, 0xE0, 0xA4, 0xA7, 0x80, 0x16, 0x29, 0xE0, 0xFF,
+0x8F, 0x00, 0xE0, 0x82, 0x7F, 0x0B, 0xE0, 0xA1, 0x36, 0x02, 0x67, 0x0F,
+0xE0, 0x9A, 0x3D, 0x7D, 0x3F, 0x32, 0x01, 0x85, 0x65, 0x02, 0xE0, 0x44,
+0xA6, 0x74, 0xA3, 0x1B, 0x3E, 0x01, 0xE0, 0x8C, 0x8D, 0x02, 0xE0, 0xD4,
+0xA0, 0x01, 0xE0, 0x1C, 0x8F, 0x83, 0x7D, 0x9A, 0x38, 0x0B, 0xE0, 0x1F,
+0x3B, 0x03, 0x63, 0x2D, 0xE0, 0xF1, 0x97, 0x28, 0x37, 0x8B, 0x90, 0x46,
+0x3F, 0x0F, 0xE0, 0xAF, 0x38, 0x03, 0x7F, 0x43, 0xE0, 0x1E, 0x3F, 0xFE,
+0x3F, 0x00, 0xE7, 0x00, 0x17, 0x2F, 0x05, 0x01, 0xE0, 0x3C, 0x8F, 0x01,
+0xE0, 0xAC, 0x88, 0xFF, 0xE2, 0xFF, 0xCF, 0x0C, 0xE0, 0x28, 0x37, 0xFF,
+0xE0, 0x7F, 0x17, 0x6E, 0xE0, 0x2F, 0x3D, 0x41, 0x3E, 0x81, 0x17, 0x28,
+0x00, 0xC6, 0x15, 0xB6, 0xD5, 0xAF, 0x0B, 0xB7, 0x81, 0xC6, 0xF2, 0x3E,
+0xC6, 0x01, 0xAE, 0x00, 0xF1, 0x04, 0xFF, 0xE7, 0xAB, 0x01, 0xD5, 0x8F,
+0x85, 0x2F, 0x95, 0x9F, 0x83, 0x27, 0xFF, 0xC7, 0x95, 0xB7, 0x86, 0x67,
+0xFF, 0x6C, 0x08, 0xF0, 0x25, 0x85, 0xB7, 0x83, 0x2F, 0x81, 0x17, 0xE5,
+0xAF, 0x04, 0x64, 0x24, 0xC0, 0x61, 0x0B, 0xFE, 0x3F, 0x63, 0x04, 0x43,
+0xE0, 0x1F, 0x3F, 0xE0, 0x00, 0xA5, 0xA7, 0x02, 0xE0, 0x44, 0xA7, 0x81,
+0xC7, 0x80, 0x16, 0x61, 0x3C, 0x1E, 0x3C, 0xE5, 0xAE, 0xA5, 0xBF, 0xB8,
+0x8F, 0x28, 0x8F, 0xA8, 0x37, 0xCE, 0x3F, 0xC5, 0x8C, 0xDA, 0x01, 0xF0,
+0x13, 0x86, 0x7F, 0x85, 0xB7, 0x01, 0xE0, 0x85, 0x2C, 0x00, 0xE0, 0xFF,
+0x17, 0xE9, 0x38, 0x88, 0x79, 0x87, 0x14, 0x02, 0x61, 0x89, 0x7A, 0xEF,
+0x39, 0x87, 0x00, 0x81, 0xC0, 0x00, 0xE2, 0x94, 0xC8, 0x29, 0xC1, 0x1C,
+0x01, 0x43, 0x82, 0x8F, 0x88, 0x66, 0x1E, 0x01, 0x1B, 0x3E, 0x1E, 0x01,
+0xF0, 0x36, 0x8F, 0x03, 0x7F, 0x6B, 0x27, 0xE1, 0x3F, 0x00, 0xE4, 0x87,
+0xC7, 0x01, 0xE0, 0x24, 0xA7, 0x05, 0xE0, 0xA5, 0x30, 0x2F, 0xE0, 0xFE,
+0x8F, 0x00, 0x16, 0x81, 0x78, 0x87, 0x7F, 0x87, 0x67, 0xFC, 0x3F, 0x2E,
+0x01, 0x0B, 0xE0, 0x21, 0x36, 0x02, 0xE0, 0x54, 0xA5, 0xF4, 0xA7, 0x0D,
+0xE0, 0x95, 0x3D, 0x58, 0x8F, 0x0B, 0xE0, 0x1D, 0x3D, 0x95, 0x3F, 0x48,
+0x8D, 0x2C, 0xE0, 0xFF, 0x96, 0x28, 0x37, 0x8B, 0x97, 0x4A, 0x3F, 0xEC,
+0x00, 0xF1, 0x00, 0x0A, 0xE0, 0xAF, 0x3E, 0x7E, 0x3D, 0x2F, 0x04, 0x78,
+0x8F, 0x68, 0x8B, 0x28, 0x37, 0x46, 0x14, 0x00, 0xF2, 0x1D, 0x89, 0x60,
+0x7E, 0x3D, 0x11, 0x9B, 0x29, 0x03, 0x1B, 0x2B, 0x83, 0x14, 0x87, 0x11,
+0xB3, 0x3F, 0x9D, 0x3F, 0x99, 0x37, 0x00, 0xE7, 0x80, 0x16, 0xFD, 0x3F,
+0x00, 0xE0, 0x63, 0x03, 0x8B, 0xB6, 0x01, 0xC6, 0x03, 0x63, 0x76, 0x3E,
+0xCD, 0x01, 0x81, 0x60, 0x29, 0xC1, 0xB0, 0x00, 0x00, 0x1C, 0x01, 0x82,
+0x88, 0x61, 0x89, 0x62, 0xFE, 0xE7, 0x8C, 0x00, 0x30, 0x00, 0xF5, 0x2E,
+0xFF, 0xE0, 0xFF, 0x16, 0xFD, 0x3F, 0x65, 0x05, 0x8B, 0xB6, 0xE9, 0x00,
+0x80, 0x14, 0xE9, 0x39, 0x8B, 0xB6, 0xE5, 0x00, 0x00, 0xE2, 0x00, 0xCB,
+0x89, 0x14, 0x05, 0x17, 0x03, 0xE0, 0xFF, 0x11, 0x9F, 0x10, 0x69, 0xE0,
+0x2E, 0x39, 0x63, 0xE0, 0x21, 0x39, 0xD0, 0x00, 0x66, 0x3E, 0x80, 0x16,
+0x86, 0x00, 0x81, 0xC6, 0x00, 0xE2, 0x94, 0xCE, 0x29, 0xC6, 0x2C, 0x01,
+0x8C, 0x14, 0x02, 0x15, 0xF6, 0xF6, 0x00, 0x10, 0x71, 0xF6, 0x00, 0x45,
+0x8C, 0x6E, 0x24, 0xED, 0xF4, 0x00, 0xF4, 0x17, 0x0A, 0xE0, 0xA5, 0x36,
+0x2F, 0xE0, 0xFE, 0x88, 0x80, 0x17, 0xFF, 0x38, 0x0A, 0x01, 0xF4, 0xA5,
+0x02, 0xE0, 0x54, 0xA7, 0x9A, 0x3D, 0x2F, 0xE0, 0xFB, 0x95, 0x1A, 0x3F,
+0x2F, 0xE0, 0xFE, 0xB5, 0x81, 0xC7, 0xF8, 0x3F, 0xF3, 0x01, 0x56, 0x00,
+0xF0, 0x07, 0xD6, 0x01, 0x80, 0x17, 0x84, 0x7C, 0xC5, 0xAF, 0xFD, 0xE7,
+0xBB, 0x00, 0x43, 0xE0, 0x9F, 0x3E, 0x8B, 0xB6, 0xFF, 0xE7, 0x9D, 0x00,
+0xB6, 0x02, 0xC0, 0x00, 0xE4, 0x8C, 0xC4, 0x01, 0x17, 0x9F, 0x3C, 0x49,
+0xAF, 0x69, 0xAF, 0xD2, 0x07, 0xF1, 0x06, 0x00, 0xE0, 0x8A, 0x1F, 0x00,
+0xE0, 0x5E, 0x1C, 0x8F, 0xA7, 0x9F, 0xA7, 0x81, 0x3F, 0xE8, 0x3C, 0x0A,
+0x24, 0x98, 0x8F, 0x08, 0xB8, 0x01, 0xF1, 0x00, 0x59, 0xE1, 0x5C, 0x17,
+0xFE, 0x3F, 0x00, 0x14, 0x02, 0x01, 0xE1, 0x08, 0xB9, 0x8F, 0x29, 0x14,
+0x00, 0xF0, 0x2F, 0x00, 0xE2, 0x94, 0xCF, 0xF9, 0x01, 0x00, 0xE0, 0x21,
+0x1C, 0x00, 0xE0, 0x52, 0x1D, 0x28, 0x3D, 0x01, 0xE0, 0x1D, 0xDF, 0x01,
+0x14, 0xE1, 0x08, 0x00, 0xE0, 0x2F, 0x1E, 0x01, 0xE0, 0x68, 0xA5, 0x9C,
+0x8E, 0x8C, 0x8C, 0x2C, 0x8F, 0xBC, 0x8F, 0xA8, 0x36, 0x80, 0x15, 0xC9,
+0x3E, 0x92, 0xEB, 0x5E, 0x7E, 0x0E, 0xE4, 0x20, 0x37, 0x02, 0xE0, 0x88,
+0xA4, 0x88, 0xBD, 0x00, 0xE8, 0xEA, 0x01, 0xF2, 0x09, 0x00, 0xC6, 0x4D,
+0x3F, 0x0F, 0xE4, 0xA8, 0x37, 0x01, 0xE0, 0x0A, 0xBE, 0xCE, 0x3F, 0x01,
+0xE0, 0x1A, 0xBC, 0xC9, 0xBF, 0x08, 0xE0, 0xD8, 0xAD, 0x0A, 0x08, 0xF0,
+0x1D, 0xBA, 0xDF, 0xC2, 0xA7, 0x11, 0x24, 0x00, 0x17, 0x4F, 0xAF, 0xBC,
+0x16, 0x5F, 0x8F, 0x0F, 0xAF, 0x02, 0xE0, 0xC2, 0xA7, 0x9F, 0x3E, 0x1F,
+0x8F, 0x8C, 0xC7, 0x40, 0xCF, 0xFD, 0x3F, 0x41, 0xE0, 0x3F, 0xAF, 0xFA,
+0x01, 0x61, 0x09, 0x7E, 0x17, 0x4F, 0xAF, 0xF0, 0x00, 0x8C, 0x03, 0x80,
+0x60, 0xC0, 0x68, 0x39, 0x00, 0xE0, 0x8B, 0xD8, 0x28, 0x00, 0xF0, 0x8E,
+0xE0, 0x3E, 0x3C, 0x16, 0x9C, 0xC6, 0x6F, 0x3F, 0x1F, 0x3E, 0x9E, 0x8D,
+0x0C, 0xC7, 0x7E, 0x3E, 0x80, 0xE1, 0x9D, 0xAD, 0xFB, 0x01, 0xA0, 0x49,
+0x52, 0xA7, 0x63, 0x3A, 0x43, 0xE0, 0x83, 0x38, 0x00, 0xE2, 0x3F, 0xC2,
+0x00, 0xE2, 0xC0, 0xC1, 0x00, 0x15, 0x6E, 0x3C, 0x87, 0x00, 0x01, 0xC5,
+0x00, 0xE2, 0x14, 0xCD, 0x29, 0xC4, 0x00, 0xE0, 0x40, 0x01, 0x88, 0x8E,
+0x43, 0xE0, 0x0D, 0x3E, 0x00, 0xE2, 0x00, 0xCE, 0x75, 0x03, 0x00, 0xE2,
+0xFC, 0xC6, 0xF2, 0x26, 0x00, 0xE2, 0x80, 0xC8, 0x6F, 0x03, 0x6E, 0x2A,
+0xEA, 0x3E, 0x00, 0xE4, 0x87, 0xC6, 0x01, 0xE0, 0x22, 0xA6, 0x09, 0xE0,
+0x25, 0x35, 0x2D, 0xE0, 0xFC, 0x8A, 0x05, 0xE0, 0xE3, 0x29, 0x80, 0x16,
+0xF5, 0x3E, 0x0C, 0xE0, 0xA1, 0x36, 0x19, 0x3E, 0x18, 0x01, 0x72, 0xA3,
+0x02, 0xE0, 0xD2, 0xA5, 0x16, 0x3E, 0x99, 0x3D, 0x2D, 0xE0, 0x7B, 0x93,
+0x8C, 0x95, 0xA6, 0x3D, 0x00, 0xE3, 0x80, 0xCD, 0x00, 0xE7, 0x00, 0x13,
+0x66, 0xE0, 0x2B, 0x3B, 0xFF, 0xE2, 0x7F, 0xCB, 0xE6, 0x3D, 0xFF, 0xE0,
+0x7F, 0x0E, 0x00, 0x30, 0x3D, 0x0C, 0xB3, 0x9C, 0x01, 0x44, 0x90, 0xCE,
+0xE1, 0x01, 0x7E, 0x00, 0x20, 0xC3, 0x01, 0x6A, 0x00, 0xF4, 0x0E, 0x04,
+0xE0, 0x7F, 0x04, 0x88, 0x21, 0x31, 0x16, 0x2F, 0xE0, 0xFC, 0x8E, 0x01,
+0xE2, 0xBF, 0xC6, 0x2F, 0xE0, 0xFC, 0xAE, 0x80, 0x15, 0x6E, 0x3D, 0xEB,
+0x3C, 0x01, 0x7F, 0x87, 0x3E, 0x04, 0x6D, 0xC5, 0xA0, 0xC5, 0x2F, 0x01,
+0x8A, 0xAA, 0x00, 0xF2, 0x2B, 0x04, 0xE0, 0xCA, 0x88, 0x00, 0xE2, 0x93,
+0xC8, 0xED, 0x02, 0x01, 0xE0, 0xA2, 0xA6, 0x00, 0x14, 0x29, 0xE0, 0xFD,
+0x89, 0x68, 0x3E, 0xFC, 0x39, 0x0B, 0x01, 0xF2, 0xA6, 0x9B, 0x3E, 0x2C,
+0xE0, 0xFD, 0x96, 0x04, 0xE4, 0x8F, 0x36, 0x0D, 0xE2, 0x4D, 0x3A, 0xA4,
+0x3E, 0x1D, 0x3C, 0x01, 0xC6, 0x00, 0xE2, 0x10, 0xCE, 0xF1, 0x01, 0x03,
+0xE0, 0x92, 0xA6, 0x58, 0x00, 0x40, 0x21, 0xE0, 0x7D, 0xBC, 0x5C, 0x00,
+0xF1, 0x06, 0xD3, 0x01, 0xE0, 0x3D, 0x9C, 0xC5, 0x6F, 0x3E, 0x3C, 0xC6,
+0xEB, 0x3E, 0x84, 0x7D, 0x8C, 0xC7, 0x41, 0xE0, 0xBF, 0x8D, 0x7F, 0x44,
+0x01, 0xF0, 0x17, 0xFA, 0x01, 0x80, 0x16, 0xE0, 0x3C, 0x6D, 0x3E, 0x9C,
+0xC4, 0x04, 0x15, 0xED, 0x3D, 0x87, 0x00, 0x87, 0xC6, 0x01, 0xE2, 0x8C,
+0xCE, 0x29, 0xC7, 0x20, 0xC6, 0x29, 0x01, 0x8E, 0x8F, 0x43, 0xE0, 0x0F,
+0x3C, 0x00, 0xE2, 0x00, 0xCC, 0x90, 0x00, 0xF0, 0x1D, 0xFF, 0xC7, 0x00,
+0xE2, 0x84, 0xCF, 0x6A, 0x3B, 0x66, 0xE0, 0x2F, 0x3D, 0x26, 0xE0, 0xF9,
+0x8F, 0x00, 0xE2, 0xC0, 0xC7, 0xE9, 0x27, 0x01, 0xE0, 0x22, 0xA4, 0x80,
+0x17, 0x2D, 0xE0, 0xF8, 0x88, 0xFF, 0x38, 0x06, 0x01, 0x01, 0xE0, 0x12,
+0xA4, 0x1C, 0x3C, 0x2F, 0xE0, 0xF2, 0x01, 0xA6, 0xF8, 0xB5, 0x81, 0xC7,
+0x00, 0xE2, 0x90, 0xCF, 0xF6, 0x01, 0x50, 0x00, 0xF1, 0x1E, 0xD9, 0x01,
+0x00, 0x14, 0xE8, 0x39, 0xE8, 0x3A, 0xE8, 0x38, 0x02, 0x7C, 0x8D, 0x00,
+0x81, 0x65, 0x82, 0x66, 0xA0, 0xC1, 0xA9, 0xC5, 0x89, 0xC6, 0x05, 0xE2,
+0x80, 0xC9, 0x81, 0x7D, 0x87, 0xC0, 0x82, 0x7E, 0x01, 0xE0, 0x6F, 0x01,
+0x01, 0x64, 0x08, 0x8C, 0x43, 0xE0, 0x88, 0x24, 0x03, 0xF1, 0x0E, 0x03,
+0x7C, 0x6D, 0x03, 0x83, 0x67, 0x00, 0xE2, 0xFC, 0xC7, 0xE9, 0x2F, 0x02,
+0xE0, 0xF2, 0xA5, 0x21, 0xE0, 0xFB, 0x84, 0x91, 0x3D, 0x00, 0xE2, 0x80,
+0xCC, 0x00, 0xE0, 0x4A, 0x1A, 0x00, 0x20, 0x1C, 0x7B, 0x98, 0x00, 0x71,
+0x2F, 0xE0, 0x76, 0x8F, 0x43, 0xE0, 0x8E, 0x34, 0x00, 0x40, 0x54, 0x03,
+0xEE, 0x3F, 0xFC, 0x07, 0x21, 0xD0, 0x2F, 0x32, 0x01, 0xF3, 0x2F, 0xE2,
+0x40, 0xC7, 0x21, 0xE0, 0x7D, 0x8E, 0x22, 0x2F, 0x80, 0x17, 0x7F, 0x3E,
+0x0E, 0xE0, 0xA1, 0x37, 0x0B, 0xE0, 0x13, 0x3F, 0x15, 0x01, 0x72, 0xA7,
+0x02, 0xE0, 0xD2, 0xA6, 0x1B, 0x3F, 0x93, 0x3E, 0x2F, 0xE0, 0xFD, 0x95,
+0x8E, 0x96, 0x00, 0xE7, 0x00, 0x14, 0xAB, 0x3E, 0xF8, 0x3E, 0xFF, 0xE0,
+0xFF, 0x15, 0x68, 0xE0, 0x2D, 0x3B, 0x7B, 0x3C, 0x6B, 0xE0, 0x28, 0x3D,
+0x8E, 0xC6, 0x00, 0xF1, 0x01, 0xE3, 0x01, 0xFF, 0xE7, 0xA9, 0x00, 0x7F,
+0x3E, 0x0A, 0x01, 0xF2, 0xA6, 0x02, 0xE0, 0x52, 0xA7, 0x36, 0x00, 0x20,
+0x96, 0x13, 0x96, 0x03, 0x12, 0xB6, 0x22, 0x00, 0xF0, 0x43, 0xF2, 0x01,
+0xD0, 0x00, 0x01, 0x63, 0x03, 0xE0, 0x12, 0xA5, 0x2B, 0x8F, 0x04, 0xE0,
+0x46, 0x8C, 0x1B, 0x8E, 0x28, 0xE0, 0x7A, 0xA4, 0x28, 0x37, 0x4C, 0x3F,
+0x03, 0xE0, 0x82, 0xA6, 0x02, 0x66, 0x7E, 0x3C, 0x1D, 0x3E, 0x29, 0xE0,
+0x7A, 0xA5, 0x01, 0xE0, 0xFC, 0x03, 0x7A, 0x3F, 0x02, 0xE0, 0xE8, 0x05,
+0x0C, 0x8F, 0x01, 0xC7, 0x01, 0xE2, 0x7F, 0xC7, 0x0C, 0xAF, 0xEB, 0x8E,
+0x7D, 0x3F, 0x02, 0xE0, 0xFB, 0x03, 0xEC, 0x8F, 0x5C, 0x8D, 0x7C, 0x8F,
+0x01, 0xE0, 0x8C, 0x8E, 0xA8, 0x37, 0xCA, 0x3F, 0x56, 0x03, 0x10, 0x4F,
+0x4C, 0x03, 0xF0, 0x25, 0x36, 0xCE, 0x3F, 0xEF, 0x3C, 0x6C, 0x3C, 0x01,
+0xE2, 0xFF, 0xC4, 0x01, 0xC4, 0x9C, 0xAC, 0x0A, 0xE0, 0xC8, 0x37, 0x0D,
+0xE4, 0xC0, 0x37, 0x0E, 0xE4, 0xC8, 0x37, 0x00, 0xE2, 0x82, 0xCF, 0x38,
+0xAF, 0xA8, 0xAE, 0x18, 0xAD, 0x01, 0xE0, 0x5C, 0x01, 0x00, 0xE2, 0x83,
+0xCF, 0x02, 0xE0, 0x13, 0x01, 0x01, 0xE0, 0xF4, 0xFC, 0x00, 0xF0, 0x20,
+0xA7, 0x00, 0x14, 0x91, 0x3F, 0x85, 0x7F, 0x06, 0x7E, 0xA4, 0x00, 0x6E,
+0x3A, 0x7F, 0xC7, 0x3F, 0x3F, 0xA6, 0x3E, 0x1D, 0x3F, 0xCB, 0x8E, 0x2E,
+0xE0, 0x34, 0x3F, 0x3B, 0x8B, 0xA8, 0x36, 0x04, 0xE0, 0x2F, 0x3F, 0xC6,
+0x3E, 0x7D, 0x3A, 0x02, 0xE0, 0x47, 0x05, 0x0E, 0xE0, 0x9F, 0x3E, 0x28,
+0x05, 0xF0, 0x43, 0x0C, 0xB7, 0x8A, 0x96, 0x89, 0x97, 0x9F, 0x3E, 0x1D,
+0x3F, 0x0D, 0xE4, 0x4F, 0x37, 0x1D, 0x3F, 0x01, 0x37, 0x0A, 0xB7, 0x01,
+0xC4, 0x00, 0xE2, 0x10, 0xCC, 0x02, 0xE0, 0x44, 0x01, 0x85, 0x66, 0x8D,
+0x8F, 0xF8, 0x3F, 0x78, 0x01, 0x09, 0xE0, 0x21, 0x34, 0x01, 0xE0, 0x12,
+0xA6, 0x0E, 0xE0, 0x93, 0x3C, 0x72, 0xA5, 0x01, 0xE0, 0x82, 0xA4, 0x1E,
+0x3E, 0x8C, 0x97, 0x1E, 0x3D, 0x9E, 0x3C, 0x8A, 0x96, 0x09, 0x93, 0x88,
+0x2F, 0x0F, 0xE0, 0xA6, 0x3E, 0x43, 0xE0, 0x9F, 0x3F, 0x8C, 0xB7, 0x8A,
+0x96, 0xD3, 0x01, 0xF0, 0x0F, 0x09, 0x93, 0x5B, 0x8F, 0x41, 0x2F, 0x65,
+0x3F, 0x01, 0x12, 0xC1, 0x00, 0x60, 0x3A, 0x80, 0x11, 0x1C, 0xC2, 0x23,
+0xE0, 0xF4, 0x8F, 0x43, 0xE0, 0x8F, 0x3E, 0x00, 0xE2, 0x80, 0xCE, 0x16,
+0x05, 0x10, 0x3F, 0xFC, 0x04, 0xF0, 0x06, 0x04, 0x81, 0xC1, 0x00, 0xE2,
+0x84, 0xC9, 0xF2, 0x01, 0x84, 0x65, 0x80, 0x17, 0xFF, 0xE7, 0x3F, 0x16,
+0x80, 0xE1, 0x1B, 0x8F, 0xBC, 0x01, 0xF0, 0x33, 0x07, 0x27, 0x02, 0xE0,
+0x42, 0xA7, 0x1F, 0x3F, 0x9E, 0x8E, 0xDC, 0x3E, 0x9E, 0xAE, 0x8C, 0xC7,
+0x00, 0xE2, 0xB0, 0xCF, 0xF2, 0x01, 0x00, 0xE0, 0x88, 0x1E, 0x00, 0x17,
+0x02, 0xBF, 0xFF, 0xE7, 0x85, 0x17, 0x9D, 0xAF, 0x82, 0x17, 0xAD, 0xAF,
+0x8E, 0x17, 0xBD, 0xAF, 0xEE, 0x3C, 0x00, 0xE0, 0x07, 0x1C, 0x52, 0xA6,
+0x86, 0x00, 0x20, 0xC7, 0x05, 0xE2, 0x00, 0xCF, 0x29, 0xC6, 0x29, 0x01,
+0x8C, 0x87, 0x14, 0x02, 0xF0, 0x21, 0x78, 0x03, 0x01, 0xE0, 0x62, 0x8D,
+0x75, 0x25, 0x80, 0x15, 0x05, 0xE0, 0x8C, 0x8F, 0x04, 0xE0, 0xFC, 0x88,
+0xA8, 0x37, 0xC1, 0x3F, 0x9B, 0x37, 0xE9, 0x38, 0x00, 0xE2, 0x81, 0xC7,
+0x81, 0xC0, 0x8C, 0x27, 0xF2, 0xA7, 0x9E, 0x3F, 0x2B, 0xE0, 0xFF, 0x97,
+0x29, 0xE0, 0xF8, 0xB7, 0xE1, 0x3C, 0x2E, 0x00, 0xA2, 0xFF, 0xE3, 0xFF,
+0xC4, 0x81, 0xC5, 0xFA, 0x3D, 0xE7, 0x04, 0x4E, 0x00, 0xF1, 0x17, 0x00,
+0xE0, 0x29, 0xC6, 0xD9, 0x01, 0x09, 0xE4, 0xA1, 0x34, 0x09, 0xE4, 0xC0,
+0x34, 0x0F, 0xE0, 0xC8, 0x34, 0xDD, 0xAF, 0x00, 0xE0, 0xB2, 0x1F, 0xCD,
+0xAC, 0x85, 0xC4, 0xCF, 0xA7, 0x00, 0xE0, 0x06, 0x1D, 0x02, 0xE0, 0x32,
+0xA4, 0x36, 0x00, 0xF0, 0x34, 0x3F, 0x00, 0xE0, 0xDF, 0x1F, 0x8F, 0xA7,
+0x00, 0xE2, 0x88, 0xC7, 0x01, 0xE0, 0xAF, 0x27, 0x20, 0xC0, 0x61, 0x0B,
+0x82, 0x65, 0x7A, 0x3F, 0x2B, 0xE0, 0xFD, 0xAF, 0x6C, 0x3F, 0x01, 0xC7,
+0xBC, 0x05, 0x82, 0x16, 0x9C, 0xAE, 0x9E, 0xAF, 0xAE, 0xAF, 0xBE, 0xAF,
+0x80, 0x17, 0x01, 0xE0, 0x22, 0xA7, 0x21, 0xE0, 0xFE, 0x8D, 0xFF, 0x3D,
+0x10, 0x01, 0x01, 0xE0, 0x82, 0xA6, 0x01, 0xE0, 0x12, 0xA7, 0x93, 0x3E,
+0x5C, 0x02, 0xA8, 0x7E, 0x9D, 0x2F, 0xE0, 0xFD, 0x9E, 0x72, 0xA7, 0x9A,
+0x3E, 0x6A, 0x02, 0xF0, 0x15, 0xEC, 0x01, 0x82, 0x14, 0x00, 0x15, 0xE5,
+0x3E, 0x65, 0x3F, 0xEC, 0x3F, 0x85, 0xC7, 0xDC, 0xAC, 0x1F, 0xAD, 0xAF,
+0xAE, 0x3F, 0xAF, 0xFC, 0xE7, 0xFA, 0x00, 0x00, 0xE2, 0x01, 0xCF, 0xFE,
+0xE7, 0xDC, 0x01, 0xE3, 0x3A, 0x9A, 0x03, 0xFF, 0x04, 0x01, 0xE2, 0xFF,
+0xC2, 0x00, 0xE0, 0xF4, 0x2F, 0xE5, 0x3C, 0x62, 0x3C, 0x95, 0xDB, 0xFE,
+0xE7, 0xD0, 0x00, 0x83, 0x76, 0x00, 0x02, 0xF1, 0x05, 0x0A, 0xE0, 0xA1,
+0x37, 0x13, 0x3D, 0x15, 0x01, 0xF2, 0xA4, 0x01, 0xE0, 0x02, 0xA7, 0x01,
+0xE0, 0x92, 0xA6, 0x19, 0x3D, 0x7E, 0x00, 0x32, 0x97, 0x8A, 0x94, 0xE8,
+0x02, 0x28, 0x19, 0x3F, 0x10, 0x02, 0x02, 0x86, 0x00, 0x33, 0xE4, 0x01,
+0x83, 0x86, 0x00, 0xF3, 0x00, 0xFF, 0xE7, 0xBD, 0x00, 0xEC, 0x3D, 0x80,
+0xE1, 0x9B, 0xAF, 0x01, 0x14, 0x1C, 0xAC, 0x81, 0x16, 0x00, 0x90, 0xBB,
+0xAF, 0xAB, 0xAF, 0x9B, 0xAF, 0xFF, 0xE7, 0xAF, 0x96, 0x00, 0x30, 0xCA,
+0xFB, 0xE7, 0xE3, 0x01, 0xE0, 0x81, 0x01, 0x00, 0xE0, 0xC8, 0x29, 0x84,
+0x14, 0x62, 0x3C, 0x4F, 0xDB, 0x52, 0xA7, 0xD0, 0x05, 0xC2, 0xFA, 0xE7,
+0xF7, 0x00, 0x6C, 0x3F, 0x80, 0xE1, 0x9E, 0xAE, 0x9C, 0xAF, 0x96, 0x00,
+0xF1, 0x00, 0xFD, 0xE7, 0xA6, 0x00, 0x41, 0xE0, 0x4D, 0x3B, 0x76, 0x3A,
+0x08, 0x03, 0x0E, 0xE0, 0xAD, 0xBA, 0x07, 0x64, 0x0C, 0xB7, 0xFD, 0xE7,
+0xB7, 0x00, 0x0A, 0x00, 0x60, 0xB2, 0x00, 0x80, 0x14, 0x65, 0x3D, 0x60,
+0x00, 0xE0, 0x06, 0x66, 0xFF, 0xE7, 0x81, 0x00, 0x20, 0xC0, 0x21, 0x0B,
+0xE7, 0xE7, 0x95, 0x00, 0xE4, 0x00, 0x20, 0x83, 0xDC, 0x06, 0x00, 0x90,
+0x20, 0xDB, 0xFD, 0xE7, 0xDB, 0x00, 0xE4, 0x3E, 0xF5, 0xAC, 0x03, 0x50,
+0xA5, 0x02, 0xE0, 0x52, 0xA6, 0xBA, 0x05, 0x82, 0xFB, 0x95, 0x19, 0x3E,
+0x2D, 0xE0, 0xFC, 0xB5, 0xA0, 0x05, 0x60, 0xF2, 0x01, 0xFA, 0xE7, 0x8F,
+0x00, 0x8C, 0x00, 0xF0, 0xA1, 0x69, 0xDC, 0xFF, 0xE7, 0xB7, 0x00, 0xB6,
+0x08, 0x64, 0xC0, 0x98, 0xA0, 0x80, 0x17, 0x28, 0xA4, 0x69, 0x3B, 0x81,
+0xBF, 0x7F, 0xC3, 0x01, 0x7B, 0x6F, 0x3E, 0xEF, 0x39, 0x6F, 0x3A, 0xEF,
+0x3A, 0x82, 0x78, 0x6F, 0x3B, 0x83, 0x7F, 0x84, 0x7C, 0x85, 0x7F, 0x06,
+0x7D, 0x88, 0xBF, 0xA8, 0xB7, 0xA8, 0xBF, 0xB8, 0xBF, 0x86, 0x00, 0x28,
+0x9F, 0xCE, 0x38, 0xA8, 0xB0, 0x81, 0xC1, 0x02, 0xC6, 0x01, 0x65, 0x00,
+0xE0, 0xB5, 0x1D, 0x80, 0xE0, 0x1A, 0x8F, 0xEC, 0x38, 0x0F, 0xE0, 0x44,
+0x37, 0x2F, 0xE0, 0xFB, 0x8F, 0x00, 0xE2, 0x0F, 0xC7, 0x2E, 0xE0, 0x7B,
+0x8F, 0xA4, 0x37, 0xCE, 0x3F, 0x01, 0xE2, 0xFF, 0xC7, 0x0D, 0xE0, 0x84,
+0x37, 0x01, 0x11, 0x81, 0xC0, 0x5F, 0x39, 0x09, 0xE0, 0x81, 0x37, 0x0E,
+0xE0, 0x85, 0x37, 0x00, 0xE2, 0x81, 0xC6, 0xB1, 0x36, 0x3C, 0x31, 0x00,
+0xE2, 0x81, 0xC4, 0x00, 0xE2, 0x01, 0xC7, 0x01, 0x7D, 0x0A, 0xE0, 0x83,
+0x37, 0x0B, 0xE0, 0xC7, 0x37, 0xC2, 0x3E, 0x31, 0x37, 0xBC, 0x34, 0x00,
+0xE2, 0x01, 0xC5, 0xB1, 0x35, 0x4D, 0x3B, 0x49, 0x3F, 0x0D, 0xE0, 0x82,
+0x37, 0x3C, 0x35, 0xCE, 0x3A, 0xCA, 0x3D, 0x6D, 0x3F, 0x86, 0x37, 0x02,
+0x65, 0xAE, 0x02, 0x00, 0x32, 0x00, 0xF2, 0x53, 0x3C, 0x37, 0x01, 0xE0,
+0xB1, 0x37, 0x0A, 0xBB, 0x4B, 0x3A, 0x00, 0xE2, 0x87, 0xC9, 0x0F, 0xE0,
+0xCE, 0x38, 0x38, 0xBA, 0x0F, 0xE4, 0xC0, 0x37, 0x88, 0xBA, 0xCE, 0x38,
+0xFF, 0xE7, 0xB1, 0x05, 0x83, 0x65, 0x00, 0xE2, 0x8F, 0xC9, 0xCF, 0x3D,
+0x83, 0x7D, 0xA8, 0xBD, 0xFF, 0xE7, 0xAC, 0x01, 0x84, 0x66, 0x02, 0x66,
+0x80, 0x17, 0x80, 0x11, 0xBC, 0xB7, 0x8F, 0xC6, 0x84, 0x7A, 0x81, 0x15,
+0x83, 0x62, 0x05, 0x7B, 0x63, 0x3B, 0x07, 0x7A, 0x63, 0x3A, 0x81, 0x7E,
+0x01, 0xE0, 0x98, 0xB7, 0xB8, 0xB7, 0xEB, 0x38, 0x81, 0x67, 0x00, 0xE0,
+0x35, 0x1D, 0x80, 0xE0, 0x1F, 0x8F, 0xFF, 0xC0, 0x81, 0x7F, 0xCE, 0x00,
+0x13, 0xFA, 0xCE, 0x00, 0x15, 0x7A, 0xCE, 0x00, 0xF0, 0x03, 0x0E, 0xE0,
+0x84, 0x37, 0x6F, 0x3D, 0x0D, 0xE0, 0x81, 0x37, 0x09, 0xE0, 0x85, 0x37,
+0x0C, 0xE0, 0x83, 0x37, 0x90, 0x00, 0x00, 0xB2, 0x00, 0x71, 0x31, 0x35,
+0x3B, 0x37, 0x02, 0xE0, 0xC7, 0xDE, 0x00, 0x03, 0xDA, 0x00, 0xF0, 0x04,
+0xC6, 0xBB, 0x34, 0x3B, 0x31, 0x4A, 0x3F, 0xB1, 0x36, 0x31, 0x36, 0x0A,
+0xE0, 0xAE, 0x37, 0x44, 0x3F, 0xAA, 0x37, 0x01, 0x02, 0xF0, 0x01, 0xC9,
+0x3E, 0x42, 0x3E, 0xC6, 0x3E, 0x43, 0x3E, 0x00, 0xEA, 0x01, 0xC5, 0x00,
+0xEA, 0x81, 0xC7, 0xDA, 0x01, 0xF0, 0xAF, 0xBB, 0x37, 0x31, 0x35, 0x6E,
+0x3A, 0x43, 0xE0, 0x9D, 0x3E, 0x43, 0xE0, 0x1C, 0x3E, 0x82, 0x60, 0xFF,
+0xE3, 0x7F, 0xC2, 0xCA, 0x3F, 0x6D, 0x3B, 0xEC, 0x39, 0x82, 0xC5, 0x31,
+0xB2, 0xFF, 0xE3, 0x7F, 0xC3, 0xFF, 0xE3, 0xFF, 0xC1, 0xCF, 0x3A, 0x00,
+0xE2, 0x91, 0xCD, 0x38, 0xB3, 0xA8, 0xBA, 0x01, 0xE0, 0x98, 0xB1, 0xFF,
+0xE7, 0xA8, 0x01, 0x06, 0x65, 0x83, 0x7A, 0x8A, 0x8F, 0x07, 0x62, 0x00,
+0xE2, 0x8F, 0xCF, 0x84, 0x62, 0xBA, 0x02, 0x01, 0x15, 0x0B, 0xE0, 0x3F,
+0x35, 0xDB, 0x39, 0x90, 0xC7, 0x3F, 0x35, 0x91, 0x21, 0x41, 0xE0, 0x8B,
+0x3C, 0x43, 0xE0, 0x99, 0x3C, 0x83, 0x60, 0x59, 0x3E, 0x01, 0xE0, 0x18,
+0xB6, 0xD9, 0x3E, 0x0F, 0xE3, 0xDA, 0x38, 0x02, 0x66, 0x59, 0x3F, 0xB8,
+0xB6, 0xA8, 0xBF, 0x3C, 0xB7, 0x0F, 0xE0, 0x5A, 0x3A, 0x8F, 0x27, 0x28,
+0xA7, 0x41, 0xE0, 0x8A, 0x3F, 0x0E, 0xE3, 0x5B, 0x3F, 0x85, 0x66, 0x5F,
+0x3A, 0xDF, 0x3A, 0x28, 0xBF, 0xDD, 0x3F, 0x02, 0x67, 0x88, 0xBA, 0x38,
+0xBA, 0x8E, 0xBF, 0x0F, 0xE0, 0xD4, 0x3D, 0x8F, 0x27, 0x82, 0x60, 0xA8,
+0x9E, 0x08, 0xA7, 0x81, 0xA7, 0x41, 0xE0, 0x8B, 0x3D, 0x5B, 0x3A, 0xDB,
+0x3E, 0x5B, 0x3F, 0x08, 0xBF, 0xDF, 0x3D, 0xA8, 0xB6, 0x38, 0xBA, 0x81,
+0xBD, 0x1C, 0xC0, 0x61, 0x0B, 0xA6, 0x08, 0xF0, 0x37, 0x00, 0xE2, 0x93,
+0xCC, 0x13, 0x17, 0x6E, 0xE0, 0xA9, 0x3D, 0xEE, 0x3D, 0xD8, 0xA4, 0x00,
+0xE4, 0xA9, 0xC5, 0x00, 0xE0, 0x84, 0x1F, 0x02, 0xE0, 0x9B, 0x3C, 0xE8,
+0x3E, 0x8F, 0xA7, 0x03, 0xE0, 0x12, 0x8B, 0x02, 0xE0, 0x0D, 0xA2, 0x7F,
+0x3B, 0x04, 0x7A, 0x00, 0xE4, 0x07, 0xC7, 0x01, 0xE0, 0x68, 0xA4, 0x85,
+0x04, 0x6F, 0x3B, 0x7F, 0xC3, 0x01, 0xE2, 0x7F, 0xC3, 0x03, 0xE0, 0x22,
+0x8E, 0x00, 0xE0, 0xC0, 0x1F, 0xEC, 0x39, 0x32, 0x04, 0xF0, 0x11, 0xFF,
+0xC1, 0xFF, 0x39, 0x85, 0x04, 0xEF, 0x39, 0xFF, 0xC1, 0x01, 0xE2, 0xFF,
+0xC1, 0x00, 0xE0, 0x85, 0x1F, 0x03, 0xE0, 0xB2, 0x8A, 0x8F, 0xA7, 0xFF,
+0x3A, 0x85, 0x04, 0xEF, 0x3A, 0xFF, 0xC2, 0xD6, 0x03, 0xF0, 0x05, 0x01,
+0xE0, 0xCD, 0x8F, 0x00, 0xE2, 0x81, 0xCF, 0x04, 0xE0, 0x3B, 0x01, 0x04,
+0xE0, 0xC2, 0x88, 0x00, 0xE0, 0x97, 0x1F, 0x68, 0x08, 0xF0, 0x16, 0x00,
+0x15, 0x8F, 0xA7, 0x6A, 0xE0, 0x21, 0x3B, 0x7F, 0x3D, 0x85, 0x04, 0x6F,
+0x3D, 0x7F, 0xC5, 0x01, 0xE2, 0x7F, 0xC5, 0x00, 0xE0, 0xB4, 0x18, 0x04,
+0xE0, 0xD2, 0x8F, 0x81, 0xA0, 0xF1, 0x3F, 0x85, 0x04, 0xE1, 0x3F, 0xFF,
+0x18, 0x04, 0xF0, 0x0E, 0xC7, 0x2B, 0xE0, 0xF9, 0x8D, 0x84, 0x10, 0x00,
+0xE2, 0xFF, 0xC5, 0x00, 0xE2, 0x84, 0xCD, 0x02, 0xE0, 0xCD, 0xA4, 0x61,
+0xE0, 0x2B, 0x3D, 0xE1, 0x3D, 0x00, 0xE4, 0x8C, 0xC5, 0x1C, 0x00, 0xF9,
+0x12, 0x83, 0x7D, 0x00, 0xE0, 0x8D, 0x1D, 0x03, 0x62, 0x8B, 0xA5, 0x7B,
+0x3A, 0x85, 0x04, 0xFF, 0xC5, 0x01, 0xE2, 0xFF, 0xC5, 0x83, 0x7D, 0x04,
+0xE0, 0xE2, 0x8D, 0x85, 0x7D, 0x00, 0xE0, 0xCA, 0x1D, 0x05, 0x1A, 0x00,
+0xF0, 0x25, 0x85, 0x7D, 0x70, 0x12, 0x98, 0xA4, 0x00, 0xE0, 0x8C, 0x1D,
+0x47, 0x36, 0x2F, 0xE0, 0xFB, 0x8D, 0x99, 0xA7, 0x01, 0xE0, 0xC2, 0x35,
+0xD4, 0x3F, 0x00, 0xE0, 0x37, 0x1A, 0x00, 0xE2, 0x8F, 0xC0, 0x2A, 0xE0,
+0x74, 0x8D, 0xC1, 0x3F, 0x00, 0xE2, 0x83, 0xC5, 0xCF, 0x10, 0xA4, 0x35,
+0xDF, 0x38, 0x6A, 0x3A, 0xCB, 0x38, 0x00, 0x02, 0xF2, 0x63, 0x00, 0xE0,
+0xA3, 0x1F, 0xF1, 0xE7, 0xFF, 0x15, 0x00, 0xE2, 0x07, 0xC2, 0x28, 0x32,
+0xDB, 0x38, 0xC4, 0x38, 0x23, 0xE0, 0xFF, 0x9D, 0x23, 0x35, 0xFE, 0xE7,
+0xBF, 0x17, 0x01, 0xE2, 0x40, 0xC5, 0xDF, 0x38, 0xCA, 0x38, 0x58, 0xA5,
+0xEF, 0xE7, 0xFF, 0x17, 0x06, 0x7D, 0xDF, 0x38, 0x04, 0x65, 0x2B, 0x36,
+0x2A, 0xA5, 0x41, 0x3E, 0x07, 0x7D, 0x0F, 0xE0, 0xA6, 0x35, 0x04, 0x65,
+0x1F, 0xE6, 0x7F, 0x12, 0x3A, 0xA5, 0xE0, 0xE3, 0x80, 0xC7, 0x54, 0x3E,
+0x08, 0x7D, 0x4F, 0x3E, 0x28, 0xA2, 0xB8, 0xA1, 0xC8, 0xA7, 0x19, 0xBE,
+0x0A, 0xE0, 0xA4, 0x35, 0xC4, 0xA4, 0xFD, 0xE7, 0x7F, 0x16, 0x02, 0xE2,
+0x00, 0xC5, 0x59, 0x3E, 0x4A, 0x3E, 0xFF, 0xE6, 0xFF, 0x14, 0x0A, 0xE0,
+0xAA, 0x35, 0x00, 0xE3, 0x10, 0x00, 0xF0, 0x31, 0x44, 0xBE, 0xFE, 0xE7,
+0x0F, 0x15, 0x0F, 0xA6, 0x00, 0xE2, 0x8F, 0xC5, 0x5A, 0x3E, 0xA4, 0x35,
+0xCC, 0x3D, 0x8F, 0xBD, 0xE2, 0x3C, 0x01, 0xE0, 0x2D, 0xA5, 0x81, 0xC4,
+0x1E, 0x3D, 0x82, 0x7F, 0xFA, 0xDD, 0x00, 0xE0, 0xC5, 0x1E, 0x44, 0xA7,
+0x26, 0xE0, 0xFD, 0x9E, 0xC7, 0x15, 0x6D, 0x3E, 0x00, 0xE2, 0x07, 0xC6,
+0x23, 0x36, 0x5B, 0x3F, 0xF8, 0x14, 0x4C, 0x3F, 0x0C, 0xE0, 0xC3, 0x36,
+0x10, 0x00, 0xF0, 0x33, 0x59, 0x3F, 0x4C, 0x3F, 0xE3, 0xE7, 0xFF, 0x15,
+0x5B, 0x3F, 0x0C, 0xE0, 0xA3, 0x36, 0x00, 0xE0, 0xA7, 0x1D, 0x1C, 0xE2,
+0x00, 0xC6, 0x25, 0xE0, 0xFB, 0x8D, 0x4E, 0x3E, 0xA5, 0x36, 0x7F, 0xE7,
+0x7F, 0x17, 0x80, 0xE2, 0x80, 0xC6, 0x5C, 0x3F, 0x01, 0x15, 0xFE, 0xE7,
+0x7F, 0x14, 0x4D, 0x3F, 0x5B, 0x3D, 0x27, 0x35, 0x58, 0x3F, 0x4A, 0x3F,
+0x44, 0xBF, 0x70, 0x16, 0x82, 0x67, 0xC2, 0x35, 0x0F, 0xA7, 0x7E, 0x00,
+0xF0, 0x0B, 0x5C, 0x3F, 0xCE, 0x3D, 0x8F, 0xBD, 0x77, 0x13, 0x03, 0x67,
+0x00, 0xE0, 0x9F, 0x1F, 0x44, 0xA6, 0x2E, 0xE0, 0xFF, 0xA6, 0xFF, 0xE7,
+0x8F, 0x12, 0xED, 0x3F, 0xE6, 0x03, 0xF0, 0x09, 0x0E, 0xE0, 0xA6, 0x37,
+0xFF, 0xE7, 0xBF, 0x17, 0xDC, 0x3F, 0xCE, 0x3F, 0x9F, 0xE7, 0x7F, 0x16,
+0x0E, 0xE0, 0xAB, 0x36, 0x60, 0xE2, 0x00, 0xC7, 0x10, 0x00, 0xF1, 0x02,
+0xC4, 0xBF, 0x08, 0x16, 0x03, 0xE0, 0x42, 0x8F, 0x83, 0xA7, 0x5E, 0x3E,
+0xD6, 0x3F, 0xCC, 0x3F, 0x6E, 0xA6, 0x00, 0x11, 0xD9, 0x0A, 0x00, 0xF0,
+0x05, 0x01, 0xE2, 0x00, 0xC6, 0xD8, 0x3F, 0xCC, 0x3F, 0xD5, 0x3F, 0x00,
+0xE2, 0x70, 0xC7, 0x0C, 0xE0, 0xCE, 0x3F, 0x03, 0xBE, 0x46, 0x01, 0xF2,
+0x20, 0x03, 0xE0, 0x52, 0x8F, 0x5F, 0x3E, 0x0F, 0xE0, 0x28, 0x37, 0x10,
+0xE2, 0x80, 0xC7, 0x87, 0x15, 0xF1, 0xE7, 0x7F, 0x12, 0x4F, 0x3E, 0xDE,
+0x3D, 0xA8, 0x35, 0x44, 0x37, 0x54, 0x3E, 0xFF, 0xE6, 0x7F, 0x15, 0x4B,
+0x3E, 0x0F, 0xE0, 0x43, 0x37, 0xAF, 0x37, 0x5A, 0x3E, 0x4F, 0x3E, 0x1F,
+0x9A, 0x01, 0x40, 0xC7, 0x5B, 0x3E, 0x2C, 0xC2, 0x08, 0xF0, 0x02, 0xBF,
+0x0B, 0xE0, 0xA9, 0x36, 0x03, 0xE0, 0x62, 0x8D, 0x00, 0xE0, 0x60, 0x1A,
+0x0F, 0xE0, 0x43, 0x35, 0xA2, 0x00, 0xF1, 0x00, 0x0C, 0xE4, 0xA3, 0x37,
+0x0F, 0xE0, 0x54, 0x3F, 0xCC, 0x3F, 0x00, 0xE0, 0x61, 0x1F, 0x6A, 0x84,
+0x00, 0xF1, 0x08, 0x44, 0x35, 0x0C, 0xE4, 0x20, 0x36, 0xDE, 0x3F, 0x00,
+0xE0, 0x62, 0x1F, 0xCC, 0x3F, 0x0C, 0xE0, 0x43, 0x35, 0x0C, 0xE4, 0x27,
+0x36, 0xDE, 0x24, 0x00, 0xF0, 0x07, 0x63, 0x1E, 0x00, 0xE2, 0x07, 0xC5,
+0x0A, 0xE4, 0x24, 0x35, 0xDC, 0x3F, 0x0C, 0xE0, 0xCA, 0x3F, 0x03, 0xBE,
+0xE0, 0xE3, 0x80, 0xC5, 0xF1, 0x01, 0x80, 0x03, 0xE0, 0x72, 0x8F, 0x00,
+0xE0, 0xE4, 0x18, 0x7C, 0x00, 0x00, 0x56, 0x00, 0x90, 0x0A, 0xE4, 0xAB,
+0x37, 0x0F, 0xE0, 0x51, 0x3E, 0xCA, 0xD6, 0x00, 0x30, 0xE0, 0x65, 0x1D,
+0x56, 0x00, 0xE1, 0x81, 0x7D, 0x44, 0x37, 0x0C, 0xE4, 0x28, 0x36, 0xDA,
+0x3F, 0x00, 0xE0, 0xE6, 0x1D, 0x58, 0x00, 0xA0, 0x37, 0x00, 0xE0, 0x67,
+0x1D, 0x0C, 0xE4, 0x2F, 0x36, 0xDB, 0x5C, 0x00, 0xF2, 0x27, 0xE2, 0x07,
+0xC7, 0x0E, 0xE4, 0x2C, 0x37, 0xDA, 0x3F, 0xCE, 0x3F, 0x83, 0xBF, 0x1F,
+0xE6, 0x7F, 0x16, 0x07, 0x67, 0x93, 0xA7, 0x5C, 0x3F, 0x04, 0xE0, 0x02,
+0x8E, 0x88, 0x15, 0xDC, 0x3D, 0xD6, 0x3F, 0xCB, 0x3F, 0x6C, 0x3B, 0x00,
+0xE2, 0x07, 0xC3, 0xD9, 0x3F, 0xC6, 0x3F, 0x6C, 0x3B, 0x01, 0xE2, 0x00,
+0xC3, 0xD8, 0x3F, 0xC6, 0x24, 0x01, 0x41, 0xC6, 0x4F, 0x3E, 0x13, 0x22,
+0x01, 0xB1, 0x04, 0xE0, 0x92, 0x8A, 0xDC, 0x3F, 0x01, 0x66, 0xF1, 0xE7,
+0xFF, 0xEC, 0x01, 0xF0, 0x14, 0xA8, 0x32, 0x10, 0xE2, 0x00, 0xC6, 0x4F,
+0x3E, 0xE5, 0x3F, 0x00, 0xE2, 0x87, 0xC7, 0xC4, 0x32, 0xA8, 0x37, 0x59,
+0x3E, 0x4F, 0x3E, 0x0B, 0xE0, 0xC3, 0x32, 0xFF, 0xE6, 0xFF, 0x17, 0xAF,
+0x35, 0x5F, 0x3E, 0x4B, 0x28, 0x01, 0xF1, 0x01, 0x14, 0x00, 0xE2, 0x87,
+0xC2, 0xAC, 0x32, 0x59, 0x3E, 0x45, 0x3E, 0x13, 0xBE, 0x5C, 0x3A, 0x04,
+0xCE, 0x03, 0x60, 0xE3, 0x1C, 0x0F, 0xE0, 0x43, 0x36, 0xD0, 0x00, 0x71,
+0x0F, 0xE4, 0xA3, 0x37, 0x4F, 0x3A, 0xEC, 0x44, 0x00, 0xF0, 0x10, 0x05,
+0xE4, 0xA0, 0x37, 0x00, 0xE0, 0xE1, 0x1F, 0x44, 0x36, 0x5F, 0x3A, 0x0F,
+0xE0, 0x45, 0x3A, 0x00, 0xE0, 0x62, 0x1A, 0x06, 0xE0, 0x43, 0x36, 0x06,
+0xE4, 0x27, 0x33, 0xD4, 0x3F, 0xC6, 0xC8, 0x00, 0x50, 0xC6, 0x0C, 0xE4,
+0x24, 0x36, 0xCA, 0x01, 0xF2, 0x01, 0x93, 0xBF, 0xDF, 0x38, 0x04, 0xE0,
+0x32, 0x89, 0x00, 0xE0, 0x65, 0x1E, 0x0F, 0xE0, 0x43, 0x31, 0x4C, 0x00,
+0x51, 0xAB, 0x37, 0xCF, 0x38, 0xE2, 0x4C, 0x00, 0xA0, 0xDC, 0x38, 0x44,
+0x31, 0x00, 0xE0, 0xE6, 0x1C, 0x0F, 0xE4, 0xCA, 0x08, 0x40, 0x0C, 0xE0,
+0x43, 0x31, 0x0E, 0x01, 0xF0, 0x51, 0xDF, 0x3C, 0xCC, 0x3C, 0x00, 0xE2,
+0x07, 0xC1, 0x02, 0xE4, 0x2C, 0x31, 0x59, 0x3D, 0x42, 0x3D, 0x13, 0xBD,
+0x0B, 0xE0, 0xA1, 0x36, 0x06, 0x62, 0xEB, 0x3F, 0xE1, 0xE7, 0xFF, 0x15,
+0x04, 0xA6, 0x5B, 0x3F, 0x00, 0xE0, 0x68, 0x1D, 0x85, 0x65, 0x1E, 0xE2,
+0x80, 0xC7, 0xCE, 0x3F, 0xFE, 0xE7, 0x8F, 0x14, 0x0E, 0xE0, 0xC7, 0x36,
+0x0B, 0xE4, 0xAE, 0x35, 0x5A, 0x3E, 0x4B, 0x3E, 0x01, 0xE2, 0x70, 0xC7,
+0xD9, 0x3F, 0x08, 0x62, 0x86, 0x65, 0xCE, 0x3F, 0xCF, 0x36, 0x7C, 0x17,
+0x0B, 0xBE, 0x54, 0x3F, 0x04, 0x66, 0x00, 0xE2, 0x83, 0xC6, 0x81, 0xCF,
+0xCE, 0x3E, 0xAC, 0xBF, 0xBC, 0xBE, 0xCA, 0x08, 0xF1, 0x32, 0x02, 0xE0,
+0xFD, 0xA7, 0x2E, 0xE0, 0xFF, 0x80, 0xFB, 0xE7, 0xC5, 0x00, 0xB2, 0x08,
+0x01, 0xE0, 0x68, 0x8F, 0xA8, 0xA7, 0x01, 0xE0, 0xD8, 0x8E, 0xEA, 0x3C,
+0x68, 0x39, 0x0A, 0xE0, 0x21, 0x37, 0xA5, 0x37, 0x8E, 0x2E, 0x78, 0xA4,
+0x1F, 0x3C, 0x01, 0xE0, 0x01, 0xD8, 0x82, 0xA4, 0x8F, 0x24, 0x92, 0xA7,
+0x00, 0xE2, 0x93, 0xCF, 0x8F, 0x05, 0x82, 0x17, 0x82, 0xBF, 0x61, 0x09,
+0x01, 0xE0, 0x08, 0x1C, 0x00, 0xF0, 0x01, 0xF3, 0xD7, 0x82, 0xA4, 0xF3,
+0x2C, 0x69, 0x3C, 0x21, 0x09, 0x25, 0xE0, 0xDC, 0x00, 0x01, 0xE0, 0xD9,
+0x01, 0xF0, 0x19, 0x42, 0x8F, 0x02, 0xE0, 0x02, 0xA4, 0xA2, 0xBF, 0x01,
+0xE0, 0x52, 0xAF, 0x01, 0xE0, 0x02, 0xD4, 0x01, 0xE0, 0xE2, 0xA4, 0x01,
+0xE0, 0x52, 0xA4, 0x01, 0xE0, 0x1E, 0xD3, 0x01, 0xE0, 0xC2, 0x8F, 0x92,
+0xA4, 0xA0, 0x27, 0x81, 0xC4, 0x80, 0x17, 0x6A, 0x05, 0xD0, 0x01, 0xE0,
+0xC2, 0xAF, 0x97, 0x02, 0x69, 0x3F, 0x00, 0xE4, 0x29, 0xC7, 0xD2, 0x8C,
+0x00, 0xF0, 0x0A, 0x86, 0x00, 0xE2, 0x80, 0xCE, 0x21, 0x04, 0x57, 0xC7,
+0x9E, 0x3F, 0x87, 0x00, 0x0A, 0xE0, 0x2F, 0x87, 0xA9, 0xC7, 0x00, 0xE2,
+0x00, 0xCF, 0x18, 0x04, 0x86, 0x06, 0xF5, 0x0E, 0x94, 0xCC, 0xF7, 0x01,
+0x92, 0xBC, 0x61, 0x09, 0xE9, 0x3F, 0x00, 0xE4, 0x87, 0xC7, 0x02, 0xE0,
+0x72, 0xA7, 0x2F, 0xE0, 0xFE, 0x87, 0x00, 0xE2, 0x80, 0xCF, 0x58, 0x04,
+0x81, 0x50, 0x00, 0xF3, 0x10, 0x83, 0x05, 0x61, 0x09, 0x92, 0xBC, 0x62,
+0x3C, 0x21, 0x09, 0xFA, 0xE7, 0x98, 0x00, 0xB4, 0x08, 0x00, 0x11, 0xD8,
+0xA7, 0x85, 0x00, 0x01, 0xC1, 0x00, 0xE2, 0x14, 0xC9, 0x3B, 0x01, 0x0F,
+0x52, 0x00, 0xF3, 0x30, 0x78, 0x03, 0xE8, 0x39, 0x81, 0x14, 0x00, 0x14,
+0x01, 0xE0, 0x82, 0xD2, 0x80, 0x17, 0x01, 0x12, 0xE2, 0x3C, 0x63, 0x3C,
+0x03, 0xBA, 0x13, 0xB9, 0x23, 0xB9, 0xE3, 0xB7, 0xFC, 0xDC, 0x61, 0xE0,
+0x82, 0x3F, 0x6F, 0x17, 0xDE, 0x3F, 0x61, 0xE0, 0x92, 0x3F, 0x02, 0xE0,
+0x03, 0xA4, 0x01, 0xE0, 0x9E, 0xD3, 0x01, 0xE0, 0x53, 0xA4, 0x01, 0xE0,
+0xE3, 0xA4, 0x01, 0xE0, 0xBA, 0xD2, 0xE2, 0x82, 0x00, 0x15, 0x73, 0x82,
+0x00, 0x60, 0x10, 0x04, 0x01, 0xE0, 0x43, 0xAA, 0x46, 0x00, 0x40, 0xDD,
+0xDC, 0x13, 0xB9, 0x40, 0x00, 0x20, 0x90, 0xCF, 0x3E, 0x00, 0x82, 0x01,
+0x14, 0x61, 0x0A, 0x00, 0x14, 0x61, 0x0A, 0x80, 0x00, 0x31, 0x73, 0x01,
+0x62, 0xEC, 0x00, 0x15, 0xD3, 0xEC, 0x00, 0x1D, 0x67, 0xEC, 0x00, 0x22,
+0x5E, 0x04, 0x2C, 0x00, 0xF0, 0x1D, 0xF7, 0x01, 0xDC, 0x00, 0xB5, 0x08,
+0x88, 0xA1, 0x68, 0x39, 0x00, 0xE2, 0x82, 0xC9, 0x00, 0xE0, 0x46, 0x01,
+0x00, 0xE0, 0xCD, 0x29, 0xC2, 0xA7, 0x3F, 0x8F, 0x01, 0xE2, 0x28, 0xCF,
+0x01, 0xE0, 0x1B, 0x01, 0x00, 0xE2, 0x01, 0xCF, 0x00, 0xE0, 0x60, 0x01,
+0x4F, 0x8F, 0x0A, 0x00, 0xF0, 0x81, 0x01, 0xE0, 0x00, 0x01, 0x8F, 0x8C,
+0x08, 0xE0, 0x52, 0x8F, 0xA9, 0x24, 0x01, 0xE0, 0x2C, 0x27, 0x9F, 0x89,
+0x2F, 0x8A, 0x00, 0xE0, 0xBB, 0x1F, 0x28, 0x32, 0x8F, 0xA7, 0x43, 0x3A,
+0x81, 0x3F, 0x02, 0xE0, 0xA2, 0xA1, 0x07, 0xE4, 0x68, 0xC2, 0xF8, 0x39,
+0xE8, 0x3A, 0xAB, 0x05, 0xA8, 0x39, 0x41, 0xE0, 0x83, 0x39, 0xF4, 0x39,
+0xAA, 0x04, 0x82, 0xA7, 0x83, 0x2F, 0x62, 0x3C, 0x6C, 0xDF, 0xB7, 0xD2,
+0x00, 0xE0, 0x8B, 0x1F, 0x2F, 0xA4, 0x01, 0xD2, 0x01, 0xE0, 0x31, 0x2C,
+0x00, 0xE0, 0x62, 0x2A, 0x03, 0xE0, 0xA3, 0x3A, 0x02, 0xE0, 0xA2, 0xB9,
+0xE1, 0x0A, 0x7F, 0x27, 0x69, 0x3C, 0x08, 0xE0, 0xD2, 0xAC, 0xA1, 0x0A,
+0x23, 0xE0, 0xEA, 0x00, 0x80, 0x14, 0x69, 0x3C, 0x01, 0xE0, 0xE6, 0xD1,
+0x62, 0x3C, 0x14, 0xD8, 0x82, 0xA1, 0xFF, 0xE7, 0xB7, 0x21, 0xA1, 0x0A,
+0x05, 0xE0, 0x98, 0x00, 0x03, 0xE0, 0x23, 0x3C, 0xF4, 0x39, 0xD8, 0x03,
+0xC2, 0xA7, 0xEF, 0x8F, 0x00, 0xE0, 0xF5, 0x01, 0xF0, 0x11, 0xE2, 0x27,
+0x00, 0xE0, 0x95, 0x1F, 0x8F, 0xA7, 0xCF, 0xA7, 0x81, 0x3F, 0x00, 0xE0,
+0x5B, 0x2C, 0x23, 0x3A, 0x0E, 0xE2, 0x6B, 0xCA, 0xEB, 0x05, 0x65, 0x3C,
+0xF1, 0xE1, 0x14, 0xC4, 0x14, 0x3C, 0x34, 0x00, 0xF0, 0x21, 0x85, 0x00,
+0xFF, 0xEF, 0x49, 0xD3, 0xC2, 0xA7, 0x00, 0xE0, 0x0A, 0x1F, 0x0F, 0x8A,
+0xBF, 0xA9, 0xE8, 0x3A, 0x8F, 0xA9, 0x63, 0x3D, 0x8E, 0xA6, 0xCF, 0xA9,
+0xE3, 0x3C, 0x00, 0xE0, 0x21, 0x1F, 0x00, 0xE0, 0x52, 0x1E, 0x8D, 0xA7,
+0x00, 0xE0, 0x5E, 0x1C, 0xEE, 0x3D, 0x2E, 0x3E, 0x81, 0x3F, 0x2A, 0x00,
+0xE2, 0x5F, 0x2C, 0xBF, 0xA9, 0x65, 0x3C, 0x0F, 0xAA, 0xFF, 0xEF, 0x2E,
+0xD3, 0xC2, 0xA7, 0xFC, 0x00, 0x80, 0xFF, 0xE7, 0x84, 0x01, 0xFF, 0xEF,
+0x71, 0xD7, 0x20, 0x00, 0xF0, 0x03, 0x4B, 0x24, 0x00, 0x17, 0x4F, 0xAF,
+0xFE, 0xE7, 0xFB, 0x00, 0xA4, 0x39, 0x73, 0x3A, 0xFF, 0xE7, 0x9E, 0x02,
+0x08, 0x00, 0xF1, 0x02, 0xFA, 0x05, 0xFF, 0xE7, 0x99, 0x00, 0xFF, 0xEF,
+0x12, 0xD3, 0x00, 0xE0, 0x8A, 0x1F, 0x68, 0x3A, 0x8F, 0x56, 0x00, 0xA0,
+0x8F, 0xA7, 0x63, 0x3E, 0xE3, 0x3D, 0x63, 0x3D, 0xE3, 0x3C, 0x5C, 0x00,
+0xF0, 0x15, 0x2A, 0x2C, 0xBF, 0xA9, 0x64, 0x3C, 0xFF, 0xEF, 0x02, 0xD3,
+0xC2, 0xA7, 0xFE, 0xE7, 0xD6, 0x00, 0x20, 0xD2, 0x00, 0xE2, 0x01, 0xCC,
+0xFF, 0xE7, 0x92, 0x01, 0x00, 0x14, 0xA1, 0x0A, 0x04, 0xE0, 0xAE, 0x00,
+0x25, 0xD2, 0x52, 0x01, 0xF0, 0x01, 0x01, 0x17, 0x8F, 0xA7, 0x08, 0xE0,
+0x52, 0xAF, 0x81, 0x3F, 0x82, 0xA7, 0x02, 0xE0, 0x22, 0xBC, 0x40, 0x01,
+0x22, 0xCC, 0xDE, 0x3E, 0x01, 0xF1, 0x08, 0x62, 0xD1, 0xFE, 0xE7, 0x69,
+0x24, 0xFF, 0xEF, 0x9E, 0xD5, 0xA1, 0x0A, 0xEB, 0xE7, 0xB8, 0x00, 0x7E,
+0x17, 0x3F, 0xAF, 0xD6, 0x00, 0x7E, 0x92, 0x00, 0x11, 0xB2, 0x0E, 0x00,
+0xF1, 0x1A, 0xFF, 0xE7, 0xA2, 0x00, 0xFF, 0xEF, 0x8E, 0xD5, 0xFF, 0xEF,
+0xA9, 0xD5, 0xFE, 0xE7, 0xCD, 0x00, 0xB6, 0x08, 0x6C, 0xC0, 0x00, 0x13,
+0xE8, 0x39, 0xD8, 0xA4, 0x87, 0x00, 0x01, 0xC3, 0x00, 0xE2, 0x14, 0xCB,
+0xA9, 0xC4, 0x01, 0xE0, 0x1D, 0x01, 0x89, 0x58, 0x02, 0x42, 0x77, 0x03,
+0x66, 0x3F, 0x6A, 0x08, 0xF1, 0x8A, 0x23, 0xA6, 0x2E, 0xE0, 0xFC, 0x8E,
+0x0F, 0xE0, 0x1E, 0x3E, 0x00, 0xE2, 0x8F, 0xCE, 0xEB, 0x02, 0xF3, 0xA0,
+0x00, 0xE0, 0x09, 0x1A, 0xE1, 0x3D, 0x26, 0xE0, 0x74, 0xA1, 0x05, 0xE0,
+0x25, 0x33, 0x95, 0x3D, 0x2D, 0xE0, 0x7B, 0x94, 0x81, 0x78, 0x0D, 0xE0,
+0x08, 0x31, 0x3F, 0x8D, 0x43, 0xE0, 0x9D, 0x3E, 0xAF, 0x88, 0x0D, 0xE0,
+0x2D, 0x3C, 0x04, 0xE4, 0x8F, 0x36, 0x28, 0x35, 0x02, 0x7D, 0x0A, 0xE0,
+0x21, 0x33, 0x83, 0x78, 0x01, 0xE2, 0x4D, 0x3A, 0xA4, 0x38, 0x04, 0x7D,
+0x02, 0x62, 0x03, 0x65, 0x4A, 0x3A, 0x02, 0x7A, 0x04, 0x65, 0x01, 0xE0,
+0x33, 0xA2, 0x1A, 0x3A, 0x02, 0x65, 0xFA, 0x38, 0x00, 0xE0, 0x64, 0x03,
+0xEF, 0x8D, 0x28, 0x34, 0x86, 0x25, 0x3B, 0x39, 0x81, 0xC5, 0x12, 0x3C,
+0x28, 0xE0, 0x3B, 0x3C, 0x00, 0xE0, 0x89, 0x1D, 0x80, 0x10, 0x26, 0xE0,
+0x7B, 0xBC, 0x84, 0xB0, 0x6F, 0x8D, 0x07, 0x25, 0x81, 0x65, 0x2E, 0xE0,
+0x7C, 0x8C, 0x95, 0x3D, 0x28, 0xE0, 0xFB, 0xB6, 0x02, 0xE0, 0xF3, 0xA6,
+0x2E, 0xE0, 0xFD, 0xC8, 0x02, 0xC0, 0xFF, 0xE7, 0x23, 0x04, 0x00, 0xE0,
+0xAC, 0x18, 0x01, 0xE0, 0x83, 0xA5, 0xA8, 0x00, 0x60, 0x26, 0xE0, 0x71,
+0xA1, 0x81, 0x7D, 0x94, 0x00, 0xB0, 0x01, 0x20, 0x7B, 0x94, 0x92, 0x00,
+0x2A, 0x82, 0x7D, 0x92, 0x00, 0x33, 0xBF, 0x8D, 0x85, 0x8C, 0x00, 0xF1,
+0x0E, 0x05, 0x62, 0xA8, 0x35, 0x4B, 0x3A, 0x03, 0x7A, 0x84, 0x65, 0x01,
+0xE0, 0x43, 0xA2, 0x1B, 0x3A, 0x83, 0x65, 0xFB, 0x38, 0x2E, 0x03, 0x28,
+0x34, 0x06, 0x25, 0x3A, 0x39, 0x01, 0x86, 0x00, 0x20, 0x3A, 0x3C, 0x5A,
+0x00, 0xF0, 0x09, 0x00, 0x15, 0x26, 0xE0, 0x71, 0xBC, 0x04, 0xB5, 0xEF,
+0x8F, 0xFE, 0xE7, 0xED, 0x27, 0x81, 0x67, 0x2E, 0xE0, 0x7C, 0x8F, 0x01,
+0xC3, 0x95, 0x3F, 0x32, 0x01, 0xF1, 0x2C, 0x2E, 0xE0, 0xFF, 0xB6, 0xA9,
+0xC4, 0xFE, 0xE7, 0xE7, 0x01, 0x14, 0xC0, 0x61, 0x0B, 0x5F, 0x8D, 0x4F,
+0x89, 0x28, 0x35, 0x42, 0x3D, 0xFA, 0x38, 0x18, 0x05, 0x00, 0xE0, 0x09,
+0x1D, 0x28, 0x34, 0x26, 0xE0, 0x7A, 0xBC, 0x80, 0x15, 0x84, 0xB5, 0xFF,
+0xE7, 0x9F, 0x00, 0xDF, 0x8D, 0x4F, 0x8D, 0xA8, 0x35, 0xCA, 0x3D, 0xFB,
+0x38, 0x1E, 0x05, 0x00, 0xE0, 0xAC, 0x1E, 0x00, 0xF0, 0x39, 0x7B, 0xBC,
+0x80, 0x10, 0x84, 0xB0, 0xD3, 0x00, 0x04, 0x9D, 0x01, 0xC5, 0xFF, 0xE3,
+0x7F, 0xC5, 0x04, 0xB5, 0x1F, 0x8C, 0x7A, 0x3C, 0xA4, 0x03, 0x2E, 0xE0,
+0x7C, 0x8D, 0x00, 0xE0, 0x89, 0x18, 0x2A, 0xE0, 0xFB, 0x95, 0x00, 0x15,
+0xA8, 0x35, 0x26, 0xE0, 0xF1, 0xBD, 0x04, 0xB5, 0xFE, 0xE7, 0xFC, 0x00,
+0x84, 0x9D, 0x81, 0xC5, 0xFF, 0xE3, 0xFF, 0xC5, 0x84, 0xB5, 0x1F, 0x8D,
+0x7B, 0x3D, 0x9D, 0x03, 0x2E, 0xE0, 0xFC, 0x8D, 0x02, 0x65, 0xA8, 0x00,
+0x37, 0x2B, 0xE0, 0xFA, 0x2C, 0x00, 0xF0, 0x15, 0xFF, 0xE7, 0xA9, 0x00,
+0x6B, 0x3C, 0x2E, 0xE0, 0xFC, 0x88, 0x20, 0xC4, 0xF6, 0x38, 0x04, 0x01,
+0x0B, 0x9D, 0x2D, 0x3D, 0x0B, 0xB5, 0x82, 0xC5, 0x7B, 0x3C, 0xF9, 0x01,
+0xFE, 0xE7, 0xD8, 0x00, 0x82, 0x65, 0x20, 0x14, 0x1E, 0x00, 0x2C, 0x1B,
+0x3C, 0x1E, 0x00, 0xF9, 0x1A, 0xFF, 0xE7, 0x8C, 0x00, 0x00, 0xE2, 0x86,
+0xCC, 0xB3, 0x02, 0xFC, 0xEB, 0x98, 0x7F, 0x00, 0xE8, 0x80, 0xC7, 0x29,
+0xE0, 0xFF, 0xA7, 0x82, 0x3F, 0x3C, 0xC4, 0x08, 0xE0, 0x8F, 0x0E, 0x01,
+0x14, 0x0A, 0xE0, 0x9F, 0x0E, 0x82, 0x38, 0x00, 0xE0, 0x48, 0x10, 0x00,
+0x19, 0x0C, 0x0E, 0x00, 0x19, 0x18, 0x0E, 0x00, 0x19, 0x24, 0x0E, 0x00,
+0x1A, 0x30, 0x48, 0x00, 0xF0, 0x18, 0x14, 0x82, 0x38, 0x81, 0x17, 0x0A,
+0xE0, 0xC8, 0xAF, 0x82, 0x38, 0xB3, 0x08, 0x68, 0x39, 0xFF, 0xEF, 0x7D,
+0xD1, 0x80, 0x17, 0x0A, 0xE0, 0xC2, 0x89, 0x0A, 0xE0, 0xC2, 0xAF, 0xFF,
+0xEF, 0x78, 0xD1, 0x63, 0x3C, 0xE1, 0x09, 0xB3, 0x08, 0x00, 0x03, 0xF0,
+0x27, 0x31, 0xEB, 0x84, 0x79, 0x8F, 0xA7, 0x00, 0xE8, 0x82, 0xC1, 0x33,
+0xA1, 0x81, 0x3F, 0xC3, 0xA7, 0x08, 0xE0, 0x28, 0x39, 0x2F, 0xE0, 0xA8,
+0x3F, 0x8B, 0x27, 0x80, 0x17, 0x2F, 0xE0, 0x1F, 0x3C, 0x87, 0x27, 0x00,
+0xE0, 0xB8, 0x1F, 0x8F, 0xA7, 0x8F, 0xA7, 0xA1, 0x09, 0x82, 0x3F, 0xE1,
+0x09, 0xB4, 0x08, 0x31, 0xEB, 0x04, 0x79, 0xA5, 0x01, 0xF0, 0x03, 0x00,
+0xE8, 0x02, 0xC1, 0x68, 0x3A, 0xE9, 0x39, 0x18, 0x15, 0x80, 0x14, 0x62,
+0x3C, 0x01, 0xE0, 0x11, 0xD5, 0x4C, 0x00, 0x40, 0x42, 0xBA, 0x8F, 0xA7,
+0x7C, 0x03, 0xB5, 0xD2, 0xB9, 0x1F, 0x3C, 0x32, 0xBC, 0x61, 0x0A, 0xFF,
+0xFF, 0xB6, 0x2E, 0x00, 0xF0, 0x3F, 0xD2, 0xA6, 0x01, 0x16, 0x8D, 0x8F,
+0x5F, 0x3E, 0x6F, 0x3F, 0x07, 0x26, 0x01, 0x17, 0x02, 0xBF, 0x01, 0xE2,
+0xFE, 0xC7, 0x22, 0xBF, 0x0D, 0x8F, 0x00, 0xE2, 0x02, 0xC7, 0x07, 0x27,
+0x02, 0x17, 0x22, 0xBF, 0x00, 0x17, 0x01, 0xE2, 0xFD, 0xC7, 0x02, 0xBF,
+0x8D, 0xAF, 0xFF, 0xEF, 0x25, 0xD1, 0x00, 0x17, 0x82, 0xA7, 0xC2, 0x8E,
+0xD2, 0x8A, 0x22, 0xB7, 0xE8, 0x39, 0xAA, 0x27, 0x00, 0xE2, 0x81, 0xCF,
+0x9C, 0x01, 0x00, 0xE0, 0x3B, 0x1A, 0xAE, 0x2A, 0x84, 0xA7, 0x32, 0xA3,
+0x66, 0x00, 0x40, 0x08, 0xE0, 0x28, 0x3B, 0xAA, 0x00, 0xA0, 0xAC, 0x27,
+0x2F, 0xE0, 0x15, 0x3C, 0xA9, 0x27, 0xA2, 0xA7, 0x26, 0x00, 0x42, 0x02,
+0x01, 0x82, 0xBA, 0xB2, 0x00, 0x80, 0x9F, 0xA7, 0x81, 0x3F, 0x84, 0x00,
+0xA2, 0xBF, 0x36, 0x00, 0x11, 0x84, 0x98, 0x00, 0xF0, 0x09, 0x98, 0x3F,
+0x63, 0x3C, 0xB2, 0xBF, 0x21, 0x0B, 0xE1, 0xE7, 0xF7, 0x00, 0x22, 0xA7,
+0x00, 0xE2, 0x02, 0xCF, 0x71, 0x01, 0x8B, 0x2A, 0x81, 0x17, 0x22, 0x00,
+0x80, 0x82, 0xBF, 0xEE, 0x00, 0xED, 0x2E, 0x76, 0xDF, 0x0C, 0x00, 0x62,
+0xE9, 0x00, 0xE6, 0x2E, 0xFB, 0x00, 0x50, 0x00, 0xF4, 0x05, 0x63, 0x01,
+0x80, 0x17, 0x82, 0xBF, 0xE0, 0x00, 0x31, 0xEB, 0x84, 0x7F, 0x00, 0xE8,
+0x82, 0xC7, 0x0F, 0xA4, 0x82, 0x38, 0x0C, 0x00, 0x66, 0x02, 0xE0, 0x01,
+0x17, 0x2F, 0xB7, 0x10, 0x00, 0x71, 0x01, 0x17, 0x5F, 0xAF, 0x82, 0x38,
+0xB2, 0x58, 0x01, 0x20, 0x68, 0x39, 0x0C, 0x01, 0x04, 0x1A, 0x00, 0xA6,
+0x3F, 0xA7, 0x72, 0x3F, 0x02, 0x05, 0x3F, 0xB9, 0x61, 0x09, 0x2C, 0x00,
+0x47, 0x0F, 0xBF, 0x2F, 0xBF, 0x4C, 0x00, 0x70, 0x17, 0x2F, 0xBF, 0x00,
+0x17, 0x0F, 0xBF, 0x06, 0x02, 0xF2, 0x0B, 0x9D, 0x1F, 0x00, 0xE2, 0x83,
+0xC4, 0x0F, 0xBC, 0x22, 0x35, 0x98, 0x8F, 0x00, 0xE2, 0x0C, 0xC5, 0x01,
+0xE2, 0xF0, 0xC7, 0xC9, 0x3F, 0xCA, 0x3F, 0x98, 0xAF, 0x1E, 0x00, 0x40,
+0x0F, 0xA7, 0xAE, 0x8F, 0x2C, 0x01, 0x3B, 0x82, 0xCF, 0xAE, 0x12, 0x00,
+0x04, 0x10, 0x00, 0xF2, 0x11, 0x20, 0x17, 0x8F, 0xA7, 0x1F, 0x8C, 0x58,
+0x3F, 0x02, 0x27, 0x02, 0x34, 0xAF, 0x8F, 0x01, 0x17, 0x00, 0xE2, 0x03,
+0xC4, 0x08, 0xE0, 0x38, 0x37, 0x5F, 0x3C, 0x80, 0x17, 0x28, 0xE1, 0x0F,
+0x3C, 0x26, 0x00, 0xFF, 0x13, 0xA0, 0x16, 0x0F, 0xA7, 0x9E, 0x8F, 0xDF,
+0x3E, 0x82, 0x26, 0x82, 0x37, 0x00, 0xE2, 0x83, 0xC7, 0x3E, 0x8F, 0x01,
+0x14, 0xA1, 0x37, 0x0F, 0xE0, 0x3F, 0x34, 0xDE, 0x3F, 0x00, 0x14, 0x28,
+0xE1, 0x88, 0x3F, 0x28, 0x00, 0x05, 0x13, 0x02, 0x28, 0x00, 0xF5, 0x01,
+0x06, 0x28, 0x00, 0x80, 0x07, 0x24, 0x00, 0xE0, 0xD6, 0x1F, 0x08, 0xA4,
+0x24, 0x06, 0x40, 0x82, 0x3F, 0x01, 0xE0, 0x84, 0x02, 0x04, 0x12, 0x00,
+0x40, 0xBF, 0xA7, 0x82, 0x3F, 0x0C, 0x00, 0xF0, 0xC5, 0x8F, 0xA7, 0xAF,
+0xA7, 0x82, 0x3F, 0xB6, 0x08, 0x74, 0xC0, 0x80, 0x17, 0x23, 0xE0, 0x0F,
+0x3C, 0x00, 0xE0, 0x40, 0x17, 0x2F, 0xE0, 0x8F, 0x3C, 0x07, 0x77, 0xCF,
+0x39, 0x01, 0xE0, 0x00, 0x17, 0x87, 0x29, 0x69, 0x3A, 0x68, 0x39, 0xA0,
+0xDF, 0x68, 0x3B, 0x63, 0x3F, 0x04, 0x2C, 0x6E, 0x3C, 0x0C, 0xC0, 0x61,
+0x0B, 0xAC, 0xDF, 0xE8, 0x3A, 0xBE, 0xDF, 0x00, 0xE0, 0x50, 0x2C, 0x84,
+0x8F, 0x25, 0xE1, 0x83, 0x3A, 0x81, 0xC2, 0x01, 0xE0, 0x02, 0x8F, 0x00,
+0xE0, 0xD3, 0x27, 0xFE, 0x3A, 0x00, 0xE0, 0x63, 0x01, 0x01, 0xE0, 0x92,
+0x89, 0x00, 0xE0, 0xDF, 0x21, 0x01, 0xE0, 0x92, 0xA9, 0x2C, 0x15, 0x80,
+0x14, 0x64, 0x3C, 0x02, 0x7F, 0x01, 0xE0, 0xC9, 0xD3, 0x02, 0x67, 0xEE,
+0x3A, 0x02, 0xE0, 0xC2, 0x88, 0x01, 0xE0, 0x7F, 0x17, 0xDB, 0x20, 0x62,
+0x3B, 0x80, 0x11, 0x18, 0xC3, 0x01, 0x7A, 0x85, 0x00, 0x95, 0x2E, 0x81,
+0xC1, 0xF3, 0x38, 0x52, 0x05, 0x42, 0xA4, 0x0F, 0xE0, 0xA3, 0x31, 0x1F,
+0x3C, 0x98, 0xA7, 0x01, 0xE0, 0xFF, 0x16, 0x1F, 0xA2, 0x00, 0xE2, 0x0E,
+0x7E, 0x29, 0xE0, 0x0D, 0x3A, 0xE6, 0x3D, 0x01, 0x65, 0x2D, 0xE0, 0x05,
+0x3A, 0xEC, 0x24, 0x82, 0xA4, 0xAF, 0xA7, 0x81, 0x3F, 0x01, 0xE2, 0x06,
+0xCC, 0x68, 0x3F, 0x29, 0x01, 0x66, 0x3D, 0x0B, 0x2C, 0x00, 0xE0, 0x56,
+0x1F, 0x87, 0x5C, 0x8E, 0xA7, 0x02, 0xA4, 0xBF, 0xA7, 0x01, 0xE0, 0xB2,
+0xB4, 0x81, 0x3F, 0x68, 0x3F, 0x64, 0x00, 0xF0, 0x01, 0xD7, 0x00, 0x00,
+0xE2, 0x80, 0xCA, 0x88, 0x17, 0x84, 0x12, 0x65, 0xE0, 0xAF, 0x39, 0x84,
+0x8F, 0xA2, 0x00, 0xF0, 0x00, 0xFF, 0xE7, 0xB1, 0x2F, 0x02, 0xE0, 0xA4,
+0x9E, 0xFE, 0x3A, 0x26, 0xE1, 0x8F, 0x3E, 0x0E, 0xA8, 0x00, 0xD0, 0x8F,
+0x8B, 0x27, 0x90, 0x2E, 0x01, 0xE0, 0x82, 0xAA, 0xFF, 0xE7, 0xAA, 0x00,
+0x38, 0x00, 0x60, 0x00, 0x17, 0xFF, 0xE7, 0xBA, 0x00, 0x12, 0x00, 0x40,
+0x01, 0xE0, 0x12, 0xAB, 0x5E, 0x04, 0xF0, 0x63, 0xEF, 0x39, 0xFF, 0xE7,
+0x9C, 0x00, 0xFF, 0xFF, 0xB4, 0x08, 0x74, 0xC0, 0x0C, 0x15, 0xE9, 0x39,
+0x68, 0x3A, 0x80, 0x14, 0x00, 0xE2, 0x04, 0x7C, 0x01, 0xE0, 0x60, 0xD3,
+0x00, 0xE0, 0xD9, 0x21, 0x83, 0x9F, 0x00, 0xE0, 0xD6, 0x27, 0x01, 0xE0,
+0xE3, 0x9F, 0x00, 0xE0, 0xD2, 0x27, 0x01, 0xE0, 0x83, 0xA7, 0x00, 0xE0,
+0xCE, 0x27, 0x40, 0xEA, 0x0E, 0xCC, 0x00, 0xE0, 0x9B, 0xDB, 0x00, 0xE0,
+0x48, 0x24, 0x01, 0xE0, 0xD8, 0x8F, 0x01, 0xE0, 0x48, 0x8E, 0x01, 0xE0,
+0x68, 0x8F, 0xA8, 0x37, 0x01, 0xE0, 0xF8, 0x8E, 0xCC, 0x3F, 0x0E, 0xE4,
+0x20, 0x37, 0x4F, 0x3F, 0x0F, 0xE4, 0xA8, 0x36, 0xCE, 0x3F, 0xB6, 0x27,
+0x01, 0xE0, 0x18, 0x8F, 0x01, 0xE0, 0x88, 0x8E, 0x28, 0x37, 0x4D, 0x3F,
+0x2F, 0x27, 0xD4, 0x00, 0x71, 0x03, 0xE0, 0x23, 0x8C, 0x31, 0xEB, 0x1C,
+0xA8, 0x03, 0xF0, 0x15, 0x80, 0x16, 0x0E, 0xA6, 0x01, 0xE0, 0xE3, 0x9C,
+0x01, 0xE0, 0x83, 0xA0, 0x01, 0xE0, 0x13, 0xA5, 0x01, 0xE0, 0xA3, 0xA5,
+0x02, 0xE0, 0x42, 0xAC, 0xA8, 0xEB, 0x34, 0x7F, 0xC2, 0xB6, 0x00, 0xE8,
+0x00, 0xC7, 0x0C, 0xA6, 0x92, 0x00, 0xE0, 0x02, 0xE0, 0xF2, 0xBF, 0x01,
+0x79, 0x02, 0x7F, 0x83, 0x79, 0x12, 0xBA, 0xD2, 0xB4, 0xFB, 0x01, 0xF0,
+0x43, 0xB2, 0xB8, 0x42, 0xBD, 0x01, 0xE0, 0xB2, 0xB6, 0x02, 0xE0, 0xE2,
+0xBD, 0x01, 0x3E, 0xE8, 0x3F, 0x82, 0xBF, 0x62, 0x3C, 0x82, 0x2F, 0x00,
+0x14, 0x0C, 0xC0, 0x61, 0x0A, 0x22, 0x24, 0xB5, 0x08, 0x02, 0xE0, 0xC8,
+0x8E, 0xE8, 0x3A, 0x96, 0x26, 0x00, 0x11, 0x48, 0xA7, 0x40, 0xE0, 0x62,
+0x3A, 0x03, 0xE0, 0x23, 0x31, 0x0F, 0xE0, 0x13, 0x3F, 0x8F, 0xA7, 0x01,
+0xC1, 0x6F, 0x3C, 0x88, 0x27, 0x01, 0xE0, 0x8D, 0xD0, 0x45, 0xA7, 0x9E,
+0x39, 0x03, 0xBA, 0x02, 0xE0, 0xC5, 0x8E, 0xF2, 0x3E, 0x70, 0x02, 0x30,
+0x02, 0x20, 0x05, 0xA4, 0xC6, 0x03, 0xF1, 0x44, 0xA1, 0x0A, 0x82, 0x3F,
+0x82, 0x38, 0xFF, 0xFF, 0xB2, 0x08, 0x7C, 0xC0, 0xE9, 0x3F, 0xFF, 0xC7,
+0x0D, 0x17, 0x2F, 0xE1, 0x9E, 0x3F, 0xE9, 0x38, 0xB7, 0x2F, 0x2F, 0xE0,
+0x0F, 0x3C, 0xB4, 0x2F, 0x3F, 0x26, 0x02, 0xE0, 0xE8, 0xA7, 0x9C, 0x27,
+0x00, 0xE2, 0x02, 0xCD, 0x00, 0xE0, 0x70, 0x01, 0x00, 0xE2, 0x03, 0xCD,
+0x95, 0x01, 0x1F, 0x8F, 0xAF, 0xA7, 0x12, 0x27, 0x8F, 0xA6, 0x8D, 0x8C,
+0xFB, 0x3C, 0x27, 0x01, 0x7F, 0xC7, 0x01, 0xE2, 0x7F, 0xC7, 0x22, 0x37,
+0x1F, 0x3F, 0x86, 0x00, 0x80, 0xE0, 0x9F, 0x16, 0x00, 0xB1, 0x1C, 0x01,
+0xFE, 0x3F, 0xFA, 0x01, 0x00, 0xE2, 0x8E, 0xC8, 0xA0, 0x34, 0x00, 0xF0,
+0x47, 0x80, 0x17, 0x90, 0x01, 0x00, 0xE2, 0x95, 0xCD, 0x01, 0xE0, 0xFF,
+0x17, 0x8B, 0x01, 0x58, 0x9F, 0xB8, 0xA6, 0x81, 0x17, 0x8C, 0xB7, 0x80,
+0x17, 0x1C, 0xB7, 0xAC, 0xBE, 0x83, 0x00, 0x01, 0xE0, 0x80, 0x17, 0x6F,
+0x3C, 0x04, 0xC0, 0x61, 0x09, 0x98, 0xA4, 0x9D, 0xA6, 0xEC, 0x3D, 0x61,
+0x3D, 0x04, 0xC0, 0x21, 0x09, 0x82, 0x3E, 0x8C, 0x9F, 0x0B, 0x38, 0x00,
+0xE2, 0x82, 0xC8, 0x68, 0x39, 0x00, 0xE0, 0x4D, 0x01, 0x9F, 0x05, 0x00,
+0xE2, 0x83, 0xC8, 0x00, 0xE0, 0x4F, 0x01, 0x00, 0xE2, 0x88, 0xC8, 0x92,
+0x01, 0x6B, 0x3C, 0x7A, 0x03, 0x20, 0x29, 0x24, 0x7C, 0x08, 0x80, 0x8B,
+0x01, 0x01, 0x7E, 0x01, 0xE0, 0x6F, 0xD0, 0xDA, 0x00, 0x50, 0x02, 0xA4,
+0x8F, 0xA7, 0xDF, 0x5E, 0x02, 0x52, 0x66, 0xAC, 0xA7, 0xAC, 0x27, 0x68,
+0x00, 0xF2, 0x0D, 0xD1, 0x00, 0x00, 0xE2, 0x81, 0xC8, 0xF8, 0x01, 0x00,
+0xE0, 0xD1, 0x1F, 0x02, 0xA5, 0x8F, 0xA7, 0xA3, 0xEB, 0xF2, 0x7C, 0x01,
+0x7E, 0x00, 0xE8, 0x80, 0xC4, 0x61, 0x3C, 0x2A, 0x00, 0xA0, 0xEB, 0x00,
+0x0F, 0x8F, 0x9F, 0xA7, 0xFF, 0xE7, 0x95, 0x00, 0x4A, 0x00, 0x20, 0x4A,
+0xD0, 0x14, 0x00, 0xF1, 0x0C, 0xE1, 0x00, 0x2A, 0xE0, 0x8A, 0x3D, 0x05,
+0x2D, 0x86, 0x17, 0x2B, 0xE0, 0x8F, 0x3D, 0xD9, 0x25, 0x01, 0xE0, 0xB2,
+0x9F, 0x9C, 0xB7, 0x93, 0x2F, 0xAC, 0xBF, 0x80, 0x56, 0x00, 0xF0, 0x03,
+0xFF, 0xE7, 0xA6, 0x00, 0x00, 0xE2, 0x01, 0xCD, 0x6D, 0x01, 0x80, 0x17,
+0x9C, 0xB7, 0xAC, 0xBF, 0xF5, 0x00, 0xEC, 0x00, 0xF0, 0x0B, 0x7A, 0x01,
+0xAC, 0xA7, 0xC4, 0x00, 0x62, 0x3C, 0x18, 0xC4, 0x2C, 0xBC, 0xC1, 0x00,
+0xB5, 0x08, 0x78, 0xC0, 0x69, 0x39, 0xE8, 0x39, 0x80, 0x14, 0x6A, 0x3A,
+0xDC, 0x01, 0xF0, 0x2B, 0x06, 0x15, 0xEB, 0x3A, 0x01, 0xE0, 0x27, 0xD2,
+0x00, 0xE2, 0x84, 0x7C, 0x62, 0x3C, 0x00, 0xE0, 0x13, 0xDE, 0x00, 0xE2,
+0x88, 0x7C, 0x00, 0xE0, 0x1E, 0xDE, 0x81, 0x67, 0x0F, 0xE4, 0xCC, 0x37,
+0x00, 0xE2, 0x86, 0xCF, 0x8E, 0x02, 0x00, 0xE0, 0x03, 0x1F, 0x2F, 0xE0,
+0xFE, 0xA7, 0x89, 0x27, 0x65, 0x3E, 0xE4, 0x3D, 0x62, 0x3D, 0x82, 0x14,
+0x63, 0x3C, 0xCB, 0x01, 0x60, 0x81, 0x3F, 0x08, 0xC0, 0xE1, 0x0A, 0xFE,
+0x03, 0x00, 0x08, 0x00, 0x1D, 0xB4, 0x58, 0x00, 0x44, 0x01, 0xE0, 0xFC,
+0xD1, 0x56, 0x00, 0x22, 0xE8, 0xDD, 0x56, 0x00, 0x2F, 0xF3, 0xDD, 0x56,
+0x00, 0x03, 0x20, 0x00, 0x16, 0x56, 0x00, 0x13, 0x83, 0x56, 0x00, 0x13,
+0x61, 0x56, 0x00, 0xE0, 0x61, 0x0A, 0xB6, 0x08, 0x50, 0xC0, 0xEA, 0x39,
+0xE8, 0x3A, 0x69, 0x3A, 0x06, 0x15, 0x1E, 0x03, 0xC0, 0x18, 0x7C, 0x6B,
+0x39, 0x01, 0xE0, 0xD0, 0xD1, 0xE3, 0x3F, 0xFE, 0xC7, 0xB2, 0x05, 0xF0,
+0x7B, 0x00, 0xE0, 0xD2, 0x02, 0x00, 0xE0, 0x5B, 0x21, 0x82, 0x9F, 0x00,
+0xE0, 0xD0, 0x27, 0x22, 0xA4, 0x00, 0xE0, 0x4D, 0x24, 0x92, 0x9F, 0x00,
+0xE2, 0x85, 0xCF, 0x00, 0xE0, 0xC8, 0x05, 0x00, 0xE2, 0x98, 0x7C, 0x00,
+0xE0, 0xAA, 0xDD, 0xE0, 0x3C, 0x9C, 0xC4, 0x00, 0xE0, 0xB5, 0xDD, 0x00,
+0xE2, 0x83, 0xC9, 0x00, 0xE0, 0x47, 0x01, 0x60, 0x3C, 0x14, 0x15, 0x80,
+0x14, 0x20, 0xC4, 0x01, 0xE0, 0xAB, 0xD1, 0x00, 0xE0, 0xB2, 0x1F, 0x60,
+0x3D, 0xE0, 0x3C, 0xBF, 0xA7, 0x12, 0xC5, 0x94, 0xC4, 0x65, 0x3C, 0x81,
+0x3F, 0xE8, 0x39, 0x2F, 0x2C, 0x09, 0x5F, 0x8E, 0x5F, 0xEE, 0x3E, 0xFE,
+0xC6, 0xFF, 0x3E, 0x06, 0x02, 0xEE, 0x3F, 0xFD, 0xC7, 0xFF, 0xE3, 0xFF,
+0xC7, 0x8E, 0x77, 0x81, 0x16, 0x05, 0x67, 0x12, 0x9D, 0xA2, 0xA4, 0x02,
+0xC7, 0x00, 0xE2, 0xA0, 0x7D, 0x64, 0x3C, 0x90, 0x76, 0x91, 0x77, 0x0A,
+0x7F, 0x57, 0xDF, 0xE8, 0x39, 0x30, 0x24, 0x3A, 0x06, 0xF0, 0x0F, 0xA2,
+0xBF, 0x00, 0xE2, 0x80, 0xC9, 0x01, 0xE0, 0x86, 0x17, 0x6F, 0xE0, 0x23,
+0x39, 0xEF, 0x39, 0x63, 0x3C, 0x30, 0xC0, 0x61, 0x0B, 0x01, 0xE0, 0x80,
+0x11, 0x06, 0x21, 0x80, 0x17, 0x08, 0x00, 0x00, 0x24, 0x00, 0x06, 0x16,
+0x00, 0xF0, 0x0F, 0xFB, 0x00, 0x8E, 0x59, 0x22, 0xA4, 0x86, 0xC1, 0xFF,
+0xE3, 0xFF, 0xC1, 0xE3, 0x3C, 0x00, 0xE0, 0x84, 0xDD, 0xA2, 0xA4, 0x23,
+0xE0, 0xF9, 0x8F, 0xF8, 0x3F, 0x00, 0xE0, 0x6F, 0x01, 0x32, 0x00, 0x11,
+0x86, 0x32, 0x00, 0xF0, 0x8F, 0xE7, 0x00, 0x89, 0x5E, 0x85, 0x65, 0x10,
+0x5E, 0x82, 0x7D, 0x83, 0x14, 0x83, 0x7E, 0x0C, 0x26, 0xE0, 0x3E, 0xA2,
+0xC6, 0x68, 0x3F, 0x80, 0xE1, 0x9D, 0x9F, 0x01, 0xC7, 0x7E, 0x3E, 0x9F,
+0x3C, 0xFF, 0xE3, 0xFF, 0xC4, 0x79, 0x02, 0x02, 0x67, 0x8A, 0x67, 0x7F,
+0x3F, 0x9E, 0x05, 0x00, 0xE2, 0x01, 0xCE, 0x00, 0xE0, 0xFD, 0x05, 0x00,
+0x13, 0x60, 0x3D, 0x60, 0x3A, 0x28, 0xC5, 0x22, 0xC2, 0xE6, 0x3A, 0x80,
+0xE1, 0x1A, 0xA4, 0x80, 0xE1, 0x94, 0x9C, 0x01, 0x7D, 0x00, 0xE0, 0x51,
+0xDD, 0x10, 0x5E, 0x65, 0x3F, 0x01, 0xC7, 0x7C, 0x3F, 0x18, 0x3B, 0x01,
+0xE2, 0x7F, 0xC3, 0x01, 0x65, 0x00, 0xE0, 0xC1, 0x03, 0xEE, 0x3A, 0xEE,
+0x00, 0x83, 0x65, 0x1B, 0x3F, 0xFE, 0x3F, 0xE0, 0x03, 0x11, 0x5F, 0xFE,
+0xC7, 0x02, 0xC7, 0x6F, 0x3C, 0x8A, 0x7F, 0x11, 0x77, 0x00, 0xE0, 0x31,
+0xDD, 0x89, 0x5E, 0x05, 0x66, 0x90, 0x5F, 0x02, 0x7E, 0x83, 0x7E, 0xD6,
+0x2F, 0x02, 0x66, 0x89, 0x65, 0xFC, 0x3D, 0x93, 0x04, 0x83, 0x66, 0x6C,
+0x3A, 0x1D, 0x3A, 0xF4, 0x3D, 0x8E, 0x03, 0x95, 0x01, 0xF0, 0x2D, 0x6F,
+0x3B, 0xFF, 0x12, 0x0E, 0xE0, 0xA1, 0x32, 0x00, 0xE2, 0xA0, 0x7F, 0x1F,
+0x3F, 0x9E, 0x9E, 0x6D, 0x3E, 0x01, 0xC6, 0x1E, 0xB6, 0x2D, 0xE0, 0x7B,
+0xAB, 0xE0, 0x3F, 0xA0, 0xC7, 0x0F, 0xE0, 0xCE, 0x0D, 0x02, 0xE0, 0xDE,
+0x0D, 0x80, 0xE1, 0x9F, 0xA5, 0x80, 0xE1, 0x92, 0xBD, 0xFF, 0xE7, 0x81,
+0x00, 0x12, 0x9D, 0x64, 0x3C, 0xE8, 0xDE, 0x80, 0x17, 0xE8, 0x39, 0xDE,
+0x00, 0xF0, 0x61, 0xFE, 0xE7, 0xE6, 0x00, 0xE5, 0x3D, 0x82, 0xC5, 0x00,
+0xE2, 0xA0, 0x7E, 0x2B, 0xE0, 0xFD, 0xA5, 0x82, 0x67, 0xFF, 0x3D, 0x86,
+0x04, 0x83, 0x66, 0x6F, 0x3D, 0x1D, 0x3D, 0xFA, 0x3D, 0xD3, 0x04, 0x00,
+0xE2, 0x82, 0xCA, 0x5B, 0x01, 0x83, 0x67, 0x02, 0x65, 0xFF, 0xC7, 0xE0,
+0x3D, 0xA0, 0xC5, 0x0D, 0xE0, 0x21, 0x37, 0x1F, 0x3D, 0x02, 0xC7, 0x2E,
+0xE0, 0x7B, 0xBD, 0x9B, 0x3E, 0x01, 0xC6, 0x01, 0x17, 0x82, 0x65, 0x10,
+0x76, 0x1D, 0xB7, 0x2F, 0xE0, 0x7B, 0xAB, 0xC7, 0x00, 0x11, 0x5F, 0x92,
+0x5E, 0x0B, 0x66, 0x02, 0x64, 0x8B, 0x7F, 0x82, 0x17, 0x12, 0x77, 0x91,
+0x77, 0x93, 0x76, 0x0A, 0x7C, 0x0C, 0x7E, 0x00, 0xE0, 0xCE, 0xDC, 0x90,
+0x5F, 0x89, 0x5D, 0x81, 0xC7, 0x05, 0x67, 0xCC, 0x01, 0xA0, 0x02, 0x7F,
+0x83, 0x7D, 0x90, 0x77, 0xFF, 0xE7, 0x99, 0x00, 0xB8, 0x02, 0x31, 0x06,
+0x15, 0x69, 0xB4, 0x02, 0xA0, 0x80, 0x14, 0x6C, 0x39, 0xEB, 0x39, 0x01,
+0xE0, 0xA0, 0xD0, 0xB8, 0x02, 0x62, 0x64, 0x3C, 0x00, 0xE0, 0x8C, 0xDC,
+0xB8, 0x02, 0xF0, 0x01, 0x97, 0xDC, 0x82, 0x9C, 0x01, 0x64, 0x63, 0x3D,
+0xFE, 0xEF, 0x56, 0xDB, 0x00, 0xE2, 0x00, 0xCC, 0x9C, 0x01, 0x60, 0x01,
+0x14, 0x68, 0xE0, 0xAF, 0x39, 0xA6, 0x02, 0x12, 0xB2, 0x44, 0x00, 0x12,
+0x39, 0x44, 0x00, 0x44, 0x01, 0xE0, 0x80, 0xD0, 0xF8, 0x02, 0x13, 0x6C,
+0x40, 0x00, 0xBE, 0x77, 0xDC, 0x68, 0x3D, 0x84, 0x5C, 0x01, 0x64, 0xFE,
+0xEF, 0x40, 0x40, 0x00, 0x49, 0x09, 0xB5, 0x08, 0x70, 0xE6, 0x02, 0x11,
+0x0C, 0xE6, 0x02, 0x26, 0x5D, 0xD0, 0xE6, 0x02, 0x51, 0xC2, 0x02, 0x00,
+0xE0, 0x4B, 0xE6, 0x02, 0x53, 0xC0, 0x27, 0x22, 0xA4, 0x3D, 0xE4, 0x02,
+0xF0, 0x03, 0xB9, 0x05, 0x00, 0xE2, 0x8C, 0x7C, 0x00, 0xE0, 0x39, 0xDC,
+0x00, 0xE2, 0x90, 0x7C, 0x00, 0xE0, 0x44, 0xDC, 0xE2, 0x02, 0x26, 0x39,
+0x01, 0xD4, 0x02, 0x33, 0x06, 0xC5, 0x88, 0xD4, 0x02, 0xF0, 0x09, 0x28,
+0x2C, 0x83, 0x5F, 0x08, 0x5F, 0xEF, 0x3E, 0xFE, 0xC6, 0xFE, 0x3E, 0x03,
+0x02, 0xFD, 0xC7, 0x88, 0x77, 0x00, 0xE2, 0x10, 0x7E, 0x82, 0x65, 0xD0,
+0x02, 0x9F, 0x64, 0x3C, 0x82, 0xC5, 0x7C, 0xDF, 0xE8, 0x39, 0x2F, 0xC6,
+0x02, 0x04, 0x11, 0x10, 0xE8, 0x03, 0x0C, 0xC6, 0x02, 0x04, 0x16, 0x00,
+0x31, 0xFB, 0x00, 0x88, 0xC6, 0x02, 0xE5, 0x01, 0x04, 0xC6, 0x02, 0x24,
+0x21, 0xDC, 0xC6, 0x02, 0x17, 0x22, 0xC4, 0x02, 0x71, 0xE8, 0x00, 0x88,
+0x5F, 0x02, 0x64, 0x83, 0x4A, 0x03, 0xF1, 0x02, 0xEF, 0x3C, 0x83, 0x77,
+0x00, 0xE0, 0x05, 0xDC, 0x88, 0x5A, 0x02, 0x62, 0xE5, 0x3C, 0x82, 0xC4,
+0x64, 0xC2, 0x02, 0xF1, 0x06, 0x00, 0xE0, 0x04, 0xDC, 0x15, 0x3A, 0x24,
+0xAC, 0x01, 0x17, 0x02, 0xB7, 0x83, 0x5F, 0x02, 0x67, 0x92, 0xB7, 0x22,
+0xBF, 0xCD, 0x2C, 0x02, 0x24, 0x50, 0xDF, 0x2C, 0x02, 0xF0, 0x0A, 0xFF,
+0xE7, 0xB3, 0x00, 0xB6, 0x08, 0x4C, 0xC0, 0xE8, 0x39, 0x69, 0x3B, 0xEA,
+0x3A, 0x6B, 0x39, 0x00, 0xE0, 0x77, 0xDD, 0x01, 0xE0, 0x6A, 0x24, 0x80,
+0x5C, 0x08, 0x40, 0x39, 0x01, 0xE0, 0xAE, 0x28, 0x06, 0x50, 0x39, 0x01,
+0xE0, 0xAA, 0x2F, 0x36, 0x02, 0xF0, 0x05, 0x68, 0x3A, 0x09, 0x01, 0x00,
+0xE2, 0x83, 0xCA, 0xEF, 0x39, 0x01, 0xE0, 0x26, 0x01, 0x63, 0x3C, 0x34,
+0xC0, 0x61, 0x0B, 0x1C, 0x01, 0xC0, 0x62, 0x3D, 0xE2, 0x3C, 0xBF, 0xA7,
+0x63, 0x3C, 0x02, 0xC5, 0x88, 0xC4, 0x1C, 0x01, 0xF1, 0x77, 0x73, 0x2C,
+0x92, 0x9F, 0x81, 0x10, 0x04, 0xE2, 0x94, 0xCF, 0x82, 0xB0, 0x01, 0xE0,
+0xCB, 0x05, 0x94, 0xA7, 0x22, 0xA7, 0x87, 0x7F, 0xDA, 0xE0, 0xC9, 0x16,
+0xA4, 0xA7, 0x31, 0xEB, 0x7C, 0x7E, 0x88, 0x7F, 0x04, 0xE0, 0x95, 0x17,
+0x92, 0xB7, 0x95, 0x17, 0x8E, 0xAF, 0x87, 0x17, 0xAE, 0xAF, 0xEE, 0x3F,
+0x9E, 0xAA, 0x83, 0xC7, 0xA3, 0x48, 0x8E, 0x76, 0x00, 0xE8, 0x02, 0xC6,
+0xA2, 0x4D, 0x9E, 0x4A, 0x1F, 0x4C, 0xA0, 0x4C, 0x21, 0x4D, 0x84, 0x78,
+0x00, 0xE0, 0xED, 0x10, 0xBE, 0xAE, 0xEF, 0xAD, 0x84, 0x65, 0x8C, 0x8E,
+0xAF, 0xAA, 0x3F, 0xAC, 0xCF, 0xAC, 0x5F, 0xAD, 0x9F, 0xA8, 0xFF, 0xAD,
+0xC2, 0x26, 0x14, 0x15, 0xE3, 0x3C, 0x00, 0xE2, 0x24, 0x7C, 0x82, 0x7F,
+0x01, 0x7F, 0x03, 0x7E, 0x00, 0xE0, 0x6E, 0xDF, 0x03, 0x66, 0x01, 0x67,
+0x8B, 0x16, 0x8C, 0xA9, 0x9E, 0x3E, 0x9C, 0xA4, 0x6D, 0x3C, 0x84, 0x7E,
+0x16, 0x00, 0xF0, 0x26, 0xDB, 0x03, 0x66, 0xCC, 0x9C, 0x00, 0xE0, 0x77,
+0xDB, 0x03, 0x66, 0x84, 0x64, 0x4C, 0x9E, 0xE8, 0x3A, 0x81, 0x10, 0x66,
+0x3C, 0x00, 0xE2, 0xA4, 0x7D, 0x06, 0x15, 0x22, 0xA1, 0x92, 0x70, 0x13,
+0x76, 0x8B, 0x7A, 0x1F, 0xDD, 0x68, 0x3B, 0x01, 0x67, 0x82, 0x67, 0x01,
+0xE0, 0x38, 0x2C, 0x13, 0x5E, 0x0F, 0xE0, 0xA2, 0x3A, 0x54, 0x01, 0xA0,
+0x94, 0x5D, 0x9C, 0x3F, 0x9B, 0x3F, 0x04, 0xE2, 0x95, 0xCF, 0x94, 0x01,
+0xF0, 0x31, 0xFF, 0xE7, 0x0A, 0x02, 0x92, 0x5F, 0x01, 0xE0, 0x95, 0x27,
+0xE0, 0x3D, 0x01, 0x11, 0xAC, 0xC5, 0x05, 0x7A, 0x62, 0x3A, 0x6B, 0x39,
+0x80, 0xE1, 0x92, 0xA4, 0xE0, 0x39, 0xF5, 0x3C, 0x06, 0x7F, 0xA4, 0xC1,
+0x6C, 0x3D, 0x65, 0x3C, 0x05, 0x01, 0x00, 0xE0, 0xF0, 0xDE, 0x24, 0xE0,
+0x73, 0x9E, 0x83, 0x9E, 0x64, 0x3F, 0xF4, 0x3E, 0x01, 0xC7, 0x9C, 0x3A,
+0x6E, 0x3A, 0x00, 0xE0, 0xF8, 0x05, 0x2A, 0x00, 0x60, 0x2E, 0xE0, 0x73,
+0x9E, 0xF5, 0x3C, 0x28, 0x00, 0x30, 0xED, 0x01, 0xF0, 0x14, 0x07, 0x12,
+0x11, 0x42, 0x01, 0xF0, 0x11, 0xA2, 0xA1, 0x33, 0x8F, 0x00, 0xE2, 0x06,
+0xCF, 0x3D, 0x01, 0xA3, 0x05, 0x00, 0xE2, 0x07, 0xCF, 0x3C, 0x01, 0x00,
+0xE2, 0x08, 0xCF, 0xB3, 0x01, 0x32, 0xEB, 0x80, 0x7A, 0x00, 0xE8, 0x82,
+0xC2, 0xF3, 0x01, 0xF0, 0x15, 0x63, 0x3C, 0xE5, 0x3C, 0xF4, 0xAF, 0x04,
+0xC4, 0x00, 0xE0, 0xED, 0xDA, 0xE5, 0x3C, 0x84, 0xC4, 0x00, 0xE0, 0xF8,
+0xDA, 0xFC, 0xC2, 0xC5, 0x9F, 0x04, 0xE2, 0x82, 0xCF, 0x99, 0x05, 0x83,
+0x17, 0xF4, 0xAF, 0x80, 0x17, 0x56, 0x02, 0x00, 0xD0, 0x01, 0x01, 0x92,
+0x01, 0xF0, 0x02, 0xE2, 0x03, 0xCF, 0x94, 0x01, 0x31, 0xEB, 0x7C, 0x7F,
+0x00, 0xE8, 0x02, 0xC7, 0xF8, 0xAF, 0x8E, 0xAF, 0x6E, 0x00, 0x13, 0x81,
+0x6E, 0x00, 0xF2, 0x11, 0x81, 0x10, 0x85, 0xA8, 0xE8, 0x00, 0x01, 0xE0,
+0x85, 0x11, 0xFE, 0xE7, 0xA0, 0x00, 0x8B, 0x17, 0xF4, 0xAF, 0xE1, 0x00,
+0xE8, 0xA7, 0x81, 0x3F, 0xDE, 0x00, 0xE0, 0x3C, 0x63, 0x3C, 0xA4, 0xC4,
+0x6A, 0x00, 0x22, 0xB8, 0xDA, 0xE4, 0x05, 0xF2, 0x67, 0xC3, 0xDA, 0x8E,
+0x5C, 0x04, 0xE2, 0x89, 0xCC, 0x83, 0x05, 0xF4, 0xAA, 0xCD, 0x00, 0x0F,
+0xE0, 0x19, 0x3C, 0x9F, 0x8F, 0x29, 0xE0, 0x78, 0x8F, 0x63, 0x3C, 0xA8,
+0x37, 0x87, 0xC4, 0x03, 0xC4, 0x03, 0xE0, 0xCE, 0x3F, 0x00, 0xE0, 0x21,
+0xDB, 0x73, 0x3C, 0x2C, 0x01, 0x8C, 0x17, 0xF4, 0xAF, 0xFF, 0xE7, 0xBB,
+0x00, 0x05, 0x62, 0x06, 0x67, 0x84, 0x66, 0x01, 0x7F, 0x09, 0xE0, 0xAD,
+0x3A, 0x6D, 0x3C, 0x00, 0xE0, 0x12, 0xDB, 0xE8, 0x3C, 0x65, 0x3C, 0x00,
+0xE0, 0xB5, 0xDA, 0x01, 0x67, 0x80, 0x17, 0xEE, 0xAF, 0xE6, 0x39, 0xF4,
+0xAF, 0xFD, 0xE7, 0xE2, 0x00, 0x03, 0x17, 0x3F, 0xAF, 0x84, 0x67, 0x74,
+0xAF, 0x09, 0xE0, 0xAF, 0x3A, 0x40, 0xE0, 0xA5, 0xA9, 0x6F, 0x3C, 0x40,
+0xE0, 0x95, 0xA9, 0x00, 0xE0, 0xFA, 0xDA, 0x30, 0x00, 0xF1, 0x0C, 0x9D,
+0xDA, 0xFD, 0xE7, 0xCF, 0x00, 0x0E, 0x5D, 0xA2, 0xA4, 0x06, 0xC5, 0xFF,
+0xE3, 0x7F, 0xC5, 0x66, 0x3C, 0x84, 0xC4, 0x75, 0xDC, 0xFF, 0xE7, 0x0A,
+0x24, 0x88, 0x6A, 0x00, 0xF0, 0x17, 0x86, 0x00, 0x00, 0xE0, 0x50, 0xC4,
+0xD9, 0xE7, 0xE4, 0x00, 0xB6, 0x08, 0x7C, 0xC0, 0x68, 0x39, 0xE9, 0x39,
+0x35, 0x2D, 0x01, 0xE0, 0xC8, 0xA4, 0xE8, 0x3A, 0xB4, 0xC2, 0x8B, 0x24,
+0xF5, 0x3C, 0x09, 0x01, 0x02, 0xE0, 0x38, 0xA4, 0xA2, 0x05, 0xF0, 0x18,
+0xC7, 0xDB, 0x01, 0x65, 0x01, 0xE0, 0x42, 0xBD, 0x63, 0x3F, 0x0E, 0xE0,
+0x4D, 0x0D, 0xE2, 0x3F, 0xB8, 0xC7, 0x0F, 0xE0, 0x5D, 0x0D, 0x80, 0xE1,
+0x1E, 0xA5, 0x80, 0xE1, 0x1F, 0xBD, 0x83, 0x9F, 0x00, 0xE2, 0x82, 0xCF,
+0x00, 0xE0, 0x58, 0xDC, 0x02, 0x52, 0xCF, 0x00, 0xE0, 0x46, 0x01, 0x24,
+0x04, 0xF0, 0x08, 0x4B, 0x01, 0x80, 0x17, 0x03, 0xE0, 0xA2, 0xB7, 0xE2,
+0x3F, 0xB4, 0xC7, 0x00, 0x17, 0x1F, 0xB7, 0x00, 0x12, 0x01, 0xE0, 0xC2,
+0xBA, 0x64, 0xC8, 0x08, 0x10, 0x0B, 0x5A, 0x00, 0xF2, 0x43, 0x80, 0x14,
+0x00, 0xE0, 0x7A, 0xDB, 0x01, 0xE0, 0x05, 0x12, 0xE8, 0x3A, 0x75, 0x24,
+0xFE, 0xEF, 0x69, 0xDA, 0xE2, 0x3F, 0x00, 0xE0, 0xD0, 0xC7, 0x68, 0x3B,
+0x6F, 0x3C, 0x81, 0x7F, 0xFE, 0xEF, 0x98, 0xDC, 0x13, 0x9D, 0x81, 0x67,
+0x7A, 0x3C, 0xB2, 0x04, 0xA3, 0xA4, 0x6F, 0x3C, 0xFE, 0xEF, 0x9B, 0xDC,
+0x13, 0x9F, 0x80, 0x17, 0x02, 0xE0, 0x32, 0xA4, 0xE5, 0x3C, 0x95, 0xB7,
+0xB5, 0xBF, 0x05, 0xB7, 0x00, 0xE0, 0x5D, 0xDB, 0x05, 0xE0, 0xC2, 0x8F,
+0x87, 0x2F, 0x00, 0xE0, 0x95, 0x1F, 0x01, 0x14, 0xD8, 0x08, 0xF0, 0x05,
+0x66, 0x3C, 0xFE, 0xEF, 0x45, 0xDA, 0x00, 0x12, 0xCB, 0x00, 0x93, 0x9F,
+0xA3, 0x9E, 0x33, 0x9F, 0x9D, 0x3F, 0x9E, 0x3F, 0x88, 0x00, 0xF4, 0x01,
+0x62, 0xFF, 0xE7, 0xBC, 0x00, 0x93, 0x9F, 0x0A, 0x00, 0x64, 0xB7, 0x00,
+0x93, 0x9F, 0x23, 0x9F, 0x18, 0x00, 0x22, 0xB0, 0x00, 0x56, 0x00, 0x40,
+0x00, 0xE0, 0x85, 0xDB, 0x3E, 0x00, 0xF2, 0x11, 0x26, 0xDA, 0xFF, 0xE7,
+0xAD, 0x00, 0xB4, 0x08, 0x6C, 0xC0, 0x68, 0x3A, 0x60, 0x3C, 0xE9, 0x39,
+0x6A, 0x39, 0x80, 0x14, 0x10, 0x15, 0x08, 0xC4, 0x00, 0xE0, 0xDB, 0xDD,
+0x81, 0x17, 0x01, 0x15, 0x8E, 0x05, 0xF0, 0x17, 0x82, 0x77, 0x83, 0x71,
+0x03, 0x79, 0x62, 0xDF, 0x14, 0xC0, 0x61, 0x0A, 0x05, 0x24, 0x28, 0xA4,
+0x03, 0x24, 0xCE, 0xE7, 0xF6, 0x00, 0x82, 0x38, 0xB6, 0x08, 0x74, 0xC0,
+0x01, 0x17, 0x01, 0xE0, 0xC8, 0xA7, 0x05, 0xE0, 0x48, 0xAF, 0x58, 0x01,
+0x80, 0x6A, 0x3A, 0xEB, 0x3A, 0x00, 0xE0, 0xC7, 0x27, 0xA6, 0x00, 0xF0,
+0x0F, 0x8F, 0xA7, 0xBF, 0xA7, 0x81, 0x3F, 0x01, 0xE0, 0xC2, 0xA7, 0xB4,
+0x27, 0x62, 0x3F, 0x34, 0xC7, 0xFE, 0x3F, 0x9F, 0x9C, 0x1A, 0x01, 0x60,
+0x3D, 0x62, 0x3C, 0x00, 0x13, 0x04, 0xC5, 0x92, 0x01, 0x60, 0x01, 0x7B,
+0xFE, 0xEF, 0x49, 0xDC, 0x22, 0x00, 0xF1, 0x12, 0x81, 0x64, 0x0F, 0x9F,
+0x9F, 0x9E, 0x03, 0xBC, 0x2D, 0x3F, 0x79, 0x3F, 0xA2, 0x05, 0x01, 0x17,
+0x05, 0xAF, 0x69, 0x3F, 0xFF, 0xE3, 0x7F, 0xC7, 0x04, 0xB7, 0x90, 0x00,
+0x3F, 0x9F, 0xBF, 0x24, 0xAE, 0xA8, 0x04, 0xF0, 0x17, 0x4F, 0x9F, 0xA8,
+0x24, 0x79, 0x3F, 0xDF, 0x9E, 0x30, 0x01, 0x80, 0x16, 0x84, 0xB6, 0x00,
+0x17, 0x03, 0xBF, 0x85, 0xAE, 0x00, 0x14, 0x9F, 0x9C, 0x19, 0x3F, 0x1F,
+0xB7, 0x0C, 0xC0, 0x61, 0x0B, 0x84, 0xB7, 0x00, 0x14, 0x83, 0xBF, 0x0A,
+0x00, 0x00, 0x3C, 0x00, 0xC0, 0x05, 0xAB, 0x04, 0xB7, 0xF1, 0x00, 0x02,
+0xE0, 0xB2, 0xA4, 0x6F, 0x3D, 0x20, 0x06, 0xA0, 0x00, 0xE0, 0xFC, 0xDA,
+0x81, 0x67, 0xFF, 0xE7, 0xB3, 0x2F, 0xC2, 0x03, 0xF0, 0x51, 0xC2, 0xBF,
+0xFF, 0xE7, 0xAE, 0x00, 0x4F, 0xA6, 0x04, 0xB7, 0x82, 0x16, 0x03, 0xBE,
+0x83, 0xC6, 0x2D, 0xE0, 0xFF, 0xA6, 0x88, 0x26, 0x81, 0x16, 0x85, 0xAE,
+0xD7, 0x00, 0x5F, 0xA6, 0x84, 0xB6, 0x6D, 0x3F, 0x03, 0xBE, 0x80, 0x16,
+0x85, 0xAE, 0xD0, 0x00, 0x3F, 0xA6, 0x04, 0xB7, 0x81, 0x16, 0x03, 0xBE,
+0xEE, 0x00, 0xB6, 0x08, 0x5C, 0xC0, 0x80, 0x17, 0x00, 0xE2, 0x01, 0xCD,
+0x89, 0x77, 0x00, 0xE0, 0xF2, 0x05, 0xE9, 0x3A, 0xE0, 0x3C, 0x68, 0x3A,
+0x90, 0xC4, 0x65, 0x3C, 0x6A, 0x3B, 0x00, 0xE0, 0x42, 0xD9, 0x08, 0x59,
+0xE6, 0x39, 0x00, 0xE2, 0x05, 0xC9, 0xFE, 0xC1, 0xE8, 0x3F, 0x94, 0x05,
+0xF0, 0x0D, 0x39, 0x01, 0x00, 0xE2, 0x06, 0xC9, 0x00, 0xE0, 0x70, 0x01,
+0x00, 0xE2, 0x04, 0xC9, 0x01, 0xE0, 0x27, 0x01, 0x02, 0xE0, 0x54, 0x9F,
+0x72, 0x3F, 0x01, 0xE0, 0x36, 0x01, 0x08, 0x09, 0xF0, 0x04, 0x00, 0xE2,
+0x14, 0x7C, 0x81, 0x7F, 0x00, 0xE0, 0x25, 0xDD, 0x12, 0xE2, 0x00, 0xC9,
+0x81, 0x67, 0x01, 0xE0, 0x6E, 0x18, 0x04, 0xF1, 0x29, 0x05, 0x12, 0xE2,
+0x02, 0xC9, 0x01, 0xE0, 0x38, 0x01, 0x01, 0xE0, 0xD8, 0x04, 0x12, 0xE2,
+0x03, 0xC9, 0x92, 0x01, 0x00, 0xE2, 0x85, 0xC9, 0xB9, 0x05, 0x81, 0x16,
+0x04, 0xA4, 0x14, 0xA7, 0x00, 0xE2, 0x14, 0x7E, 0xB3, 0x15, 0x8A, 0x76,
+0x87, 0x7F, 0x03, 0x15, 0x82, 0x14, 0x8B, 0x71, 0x01, 0x3F, 0x00, 0xE0,
+0x6C, 0x24, 0x00, 0x14, 0x24, 0xD2, 0x03, 0xC0, 0x81, 0xC9, 0xA5, 0x05,
+0xE0, 0x3C, 0x8C, 0xC4, 0x00, 0xE0, 0xFA, 0xD8, 0xAA, 0x01, 0x20, 0x06,
+0x5F, 0x90, 0x00, 0x73, 0x0F, 0xC7, 0x00, 0xE2, 0x0F, 0xCF, 0xFC, 0x94,
+0x00, 0x60, 0x02, 0xE0, 0x07, 0x01, 0x03, 0x67, 0x16, 0x00, 0xF1, 0x0C,
+0x0B, 0x6F, 0x94, 0x29, 0x06, 0x5F, 0x02, 0xE0, 0x80, 0x16, 0x1E, 0xE2,
+0x00, 0xC7, 0x2D, 0xE0, 0x0D, 0x3F, 0x00, 0xE0, 0xE4, 0x2E, 0x10, 0xE0,
+0x80, 0x16, 0x2E, 0x0C, 0x00, 0x46, 0x5E, 0x2F, 0x01, 0xE0, 0x56, 0x00,
+0xA0, 0x7A, 0x01, 0x1F, 0x8F, 0x8F, 0x8E, 0x28, 0x37, 0x4D, 0x3F, 0x82,
+0x04, 0x70, 0x00, 0xE0, 0xCF, 0x01, 0xFE, 0xC1, 0x82, 0x54, 0x06, 0xF3,
+0x09, 0xC1, 0x06, 0x5F, 0x0A, 0xE0, 0x00, 0x16, 0xEE, 0x3E, 0x1E, 0xE2,
+0x80, 0xC6, 0x2D, 0xE0, 0x8C, 0x3E, 0x88, 0x2E, 0x16, 0xE2, 0x00, 0xC7,
+0x06, 0x48, 0x00, 0x20, 0x3A, 0x27, 0x3E, 0x00, 0xA2, 0xDB, 0x05, 0xE0,
+0x3C, 0x92, 0xC4, 0x6F, 0x3C, 0xAB, 0x00, 0x0A, 0x01, 0x20, 0x34, 0x01,
+0x28, 0x01, 0xF1, 0x00, 0x01, 0xE0, 0x18, 0x01, 0x00, 0xE2, 0x02, 0xC9,
+0xFF, 0xE7, 0xA2, 0x01, 0x04, 0xA4, 0x94, 0xDA, 0x00, 0xF0, 0x19, 0x95,
+0x15, 0x03, 0x15, 0x8E, 0x14, 0x81, 0x3F, 0xFF, 0xE7, 0x18, 0x2C, 0x8A,
+0x5F, 0xFF, 0xE7, 0x95, 0x27, 0x8B, 0x5F, 0xFF, 0xE7, 0x92, 0x27, 0xE0,
+0x3C, 0x00, 0x15, 0x94, 0xC4, 0x64, 0x3C, 0x1F, 0xDE, 0x00, 0x14, 0xFF,
+0xE7, 0x8B, 0x00, 0x56, 0x00, 0x31, 0xFF, 0xE7, 0xB0, 0x58, 0x00, 0x00,
+0x44, 0x01, 0xE2, 0x83, 0xD8, 0x09, 0x5F, 0x81, 0x67, 0x73, 0x3F, 0xFF,
+0xE7, 0xA6, 0x02, 0x08, 0x59, 0x68, 0x01, 0xF4, 0x17, 0xFE, 0xE7, 0xCE,
+0x01, 0x60, 0x3C, 0x10, 0x15, 0x80, 0x14, 0x18, 0xC4, 0x00, 0xE0, 0x72,
+0xDC, 0x00, 0xE0, 0x69, 0x1F, 0xE4, 0x3F, 0x8C, 0xC7, 0x00, 0x15, 0x00,
+0xE2, 0x94, 0x7C, 0x64, 0x3C, 0x05, 0x7F, 0x87, 0x7F, 0xF7, 0xDD, 0xE4,
+0x00, 0x91, 0x85, 0xC9, 0xFF, 0xE7, 0x88, 0x05, 0x5F, 0x8F, 0xCF, 0xE6,
+0x00, 0x20, 0x06, 0xC7, 0x4C, 0x00, 0xF6, 0x05, 0x00, 0x03, 0x66, 0x3D,
+0x7F, 0xC5, 0x2A, 0xE0, 0x75, 0x8F, 0x81, 0x16, 0x75, 0xC7, 0x2A, 0xE0,
+0x75, 0xAF, 0x03, 0x15, 0x84, 0x01, 0xF0, 0x01, 0xEA, 0x3C, 0x8A, 0x76,
+0x8B, 0x71, 0x87, 0x7F, 0x01, 0x3F, 0x00, 0x14, 0xFE, 0xE7, 0xC1, 0x00,
+0x44, 0x00, 0x60, 0xFE, 0xE7, 0xE6, 0x05, 0x81, 0x16, 0x20, 0x00, 0x11,
+0xB2, 0x2A, 0x00, 0x00, 0xA8, 0x01, 0x33, 0xFE, 0xE7, 0xAC, 0x1C, 0x00,
+0x19, 0xD8, 0x60, 0x00, 0x37, 0xFE, 0xE7, 0x50, 0x60, 0x00, 0x1B, 0x77,
+0x60, 0x00, 0x1B, 0xB2, 0x60, 0x00, 0xF0, 0x01, 0x91, 0x00, 0x83, 0x64,
+0x89, 0x5E, 0x01, 0x16, 0x0A, 0xE0, 0xC4, 0x34, 0x8B, 0x4D, 0xC8, 0x34,
+0x28, 0x00, 0xC0, 0x0A, 0x76, 0x00, 0xE2, 0x03, 0xC5, 0x00, 0xE2, 0x8F,
+0xC4, 0x8B, 0x76, 0x34, 0x00, 0x00, 0x2C, 0x00, 0xF0, 0x03, 0xFE, 0xE7,
+0x65, 0x24, 0x00, 0x14, 0xFD, 0xE7, 0xF9, 0x00, 0xAF, 0x8D, 0x89, 0x5E,
+0x01, 0x15, 0x04, 0xA4, 0xDB, 0x01, 0x40, 0x14, 0xA7, 0x0A, 0x75, 0x1E,
+0x00, 0x82, 0x83, 0x14, 0x8B, 0x6D, 0x02, 0x15, 0x8B, 0x76, 0x52, 0x00,
+0xF3, 0x02, 0xFD, 0xE7, 0xE8, 0x00, 0xFE, 0xE7, 0x8F, 0x21, 0xE0, 0x3C,
+0x8B, 0xC4, 0xE6, 0x39, 0xE9, 0xD7, 0xFB, 0x22, 0x02, 0x97, 0xFD, 0xE7,
+0xF5, 0x00, 0xB2, 0x08, 0x74, 0xC0, 0x00, 0xDA, 0x03, 0x31, 0x96, 0x27,
+0x68, 0xC2, 0x03, 0xA0, 0x27, 0x01, 0x0F, 0x9F, 0x79, 0x3F, 0xAA, 0x02,
+0xEE, 0x3C, 0xC0, 0x03, 0x80, 0xFE, 0xEF, 0x84, 0xDA, 0x01, 0xE0, 0xC2,
+0xA4, 0x54, 0x04, 0x60, 0x00, 0xE0, 0x5C, 0xD9, 0x80, 0x17, 0x58, 0x03,
+0x20, 0x00, 0x15, 0x74, 0x03, 0x02, 0x72, 0x03, 0x51, 0x43, 0xD9, 0x81,
+0x67, 0x8A, 0xB4, 0x04, 0xF0, 0x05, 0x02, 0x67, 0x8F, 0xA7, 0x01, 0x14,
+0xDF, 0xA7, 0x01, 0xE0, 0x42, 0xBF, 0x81, 0x3F, 0x00, 0x14, 0x0C, 0xC0,
+0x61, 0x09, 0x36, 0x05, 0xF3, 0x06, 0xC8, 0xB7, 0x02, 0xE0, 0x88, 0xBF,
+0xE3, 0x00, 0x00, 0xE0, 0x15, 0x1F, 0x80, 0x16, 0x0E, 0xA7, 0x9F, 0xB6,
+0x01, 0x14, 0xDE, 0x38, 0x04, 0x22, 0xDB, 0x27, 0x28, 0x00, 0xF1, 0x04,
+0xB6, 0x08, 0x70, 0xC0, 0xE8, 0x39, 0xFE, 0xEF, 0xCD, 0xD7, 0x01, 0xE0,
+0xC3, 0xA7, 0x01, 0x7C, 0x87, 0x27, 0x63, 0x8E, 0x00, 0xF0, 0x2B, 0x03,
+0x01, 0x1F, 0x99, 0x26, 0x21, 0x63, 0x3A, 0x0A, 0x11, 0x80, 0x12, 0x00,
+0xE0, 0x50, 0xC2, 0x02, 0xE0, 0xB3, 0xA4, 0x00, 0xE2, 0x08, 0x7C, 0x65,
+0x3D, 0x00, 0xE0, 0x06, 0xD9, 0x82, 0x67, 0x7F, 0xC1, 0x64, 0x3C, 0x8B,
+0x2F, 0x03, 0x63, 0x86, 0x9C, 0xFE, 0xEF, 0x2F, 0xDA, 0x02, 0xE0, 0x33,
+0xA4, 0xE6, 0x3C, 0x00, 0xE0, 0x08, 0xD9, 0x6C, 0x29, 0x92, 0x00, 0x13,
+0x00, 0x46, 0x05, 0xD3, 0x01, 0x64, 0x10, 0xC0, 0x21, 0x0B, 0xCF, 0xE7,
+0xA0, 0x00, 0x8F, 0x9C, 0x63, 0xD8, 0x00, 0x60, 0x18, 0xDA, 0x01, 0xE0,
+0xC3, 0xA4, 0x32, 0x00, 0xF0, 0x16, 0x00, 0xE0, 0xF0, 0xD8, 0x01, 0xE0,
+0x43, 0xB9, 0xCD, 0x00, 0x05, 0x24, 0xB1, 0x08, 0xBB, 0xDF, 0x00, 0x14,
+0xE1, 0x08, 0x00, 0x14, 0x82, 0x38, 0x00, 0x17, 0x2F, 0xE0, 0x8E, 0x3C,
+0x2E, 0xE0, 0x0E, 0x3D, 0xCE, 0x3F, 0x87, 0xFC, 0x08, 0x90, 0x3C, 0x84,
+0x2F, 0x28, 0xA4, 0xC9, 0xE7, 0xFE, 0x00, 0x36, 0x03, 0xF0, 0x29, 0x82,
+0x38, 0xB3, 0x08, 0x68, 0xC0, 0x68, 0x39, 0xFE, 0xEF, 0x73, 0xD7, 0xE8,
+0x39, 0x62, 0x3C, 0x9F, 0xDF, 0x05, 0xE0, 0xD2, 0x8F, 0x86, 0x27, 0x63,
+0x3C, 0xFE, 0xEF, 0x6C, 0xD7, 0x18, 0xC0, 0xE1, 0x09, 0x60, 0x3C, 0xEF,
+0x3C, 0x10, 0x15, 0x0C, 0xC4, 0x82, 0x77, 0x00, 0xE0, 0x25, 0xDB, 0x00,
+0xE0, 0x6A, 0x1F, 0xE0, 0x3F, 0x84, 0xC7, 0x72, 0x05, 0xA0, 0x88, 0x7C,
+0x62, 0x3C, 0x02, 0x7F, 0x84, 0x7F, 0xAA, 0xDC, 0x2E, 0x00, 0x11, 0x55,
+0x2E, 0x00, 0xF1, 0x04, 0x02, 0x24, 0xD8, 0x00, 0x82, 0x38, 0xB4, 0x08,
+0x4C, 0xC0, 0x8A, 0x17, 0x85, 0x7F, 0xE8, 0x39, 0x98, 0x17, 0x1C, 0x40,
+0x04, 0xF0, 0x1F, 0x1C, 0x7C, 0x86, 0x7F, 0x00, 0xE0, 0x05, 0xDB, 0xBE,
+0xEB, 0xD0, 0x7E, 0xBC, 0xEB, 0x60, 0x7F, 0xC4, 0xEB, 0xBA, 0x7F, 0x00,
+0xE8, 0x80, 0xC6, 0x00, 0xE8, 0x00, 0xC7, 0x00, 0xE8, 0x80, 0xC7, 0x89,
+0x7E, 0x0A, 0x7F, 0x8B, 0x7F, 0x01, 0xE0, 0x9D, 0x21, 0x93, 0xA7, 0x01,
+0xE0, 0xF8, 0x01, 0xF3, 0x0A, 0x9A, 0x27, 0xA3, 0xA7, 0x0F, 0x9F, 0x01,
+0xE0, 0x16, 0x27, 0x01, 0xE0, 0x6F, 0x9F, 0x01, 0xE0, 0x12, 0x27, 0x01,
+0xE0, 0xCF, 0x9F, 0x01, 0xE0, 0x8E, 0xB0, 0x05, 0xF2, 0x31, 0x8F, 0xA7,
+0x81, 0x3F, 0x40, 0xEA, 0x00, 0xCC, 0x28, 0xD3, 0x01, 0xE0, 0x04, 0x24,
+0xFE, 0xEF, 0x19, 0xD7, 0x32, 0xEB, 0x08, 0x79, 0x00, 0xE8, 0x02, 0xC1,
+0x0F, 0xE4, 0x40, 0x34, 0x68, 0x3F, 0x01, 0xE2, 0xFF, 0xC7, 0x08, 0xE0,
+0x68, 0x15, 0x80, 0x14, 0x62, 0x3C, 0x03, 0x7F, 0x8F, 0x77, 0x00, 0xE0,
+0xC8, 0xDA, 0xE2, 0x3C, 0x62, 0x3C, 0x08, 0xE0, 0x08, 0x15, 0x00, 0xE0,
+0xE0, 0xC4, 0x3C, 0x01, 0xF2, 0x65, 0x36, 0xD9, 0x13, 0xA7, 0x03, 0xA2,
+0x12, 0xBF, 0x62, 0x3C, 0x00, 0xE0, 0x6B, 0x1F, 0xA3, 0xA7, 0x32, 0xBF,
+0x04, 0x15, 0x00, 0xE0, 0x6C, 0x1F, 0x01, 0xE0, 0xEF, 0x98, 0x01, 0xE0,
+0x3F, 0x9E, 0x01, 0xE0, 0xAF, 0x9D, 0x72, 0xBF, 0x80, 0x14, 0x8F, 0x9E,
+0x1F, 0x9F, 0xAF, 0x9F, 0x01, 0xE0, 0x82, 0xB0, 0x82, 0x10, 0x01, 0xE0,
+0xB2, 0xB5, 0x26, 0xC4, 0x84, 0x15, 0x01, 0xE0, 0x92, 0xB0, 0x83, 0x10,
+0x01, 0xE0, 0x52, 0xB6, 0x02, 0xE0, 0x82, 0xB6, 0x02, 0xE0, 0x12, 0xB7,
+0x01, 0xE0, 0xC2, 0xB5, 0x01, 0xE0, 0xA2, 0xB0, 0x02, 0xE0, 0xA2, 0xB7,
+0x02, 0xBA, 0x00, 0xE0, 0x8F, 0xDA, 0xFE, 0xEF, 0xCD, 0xD6, 0xA3, 0xA7,
+0x04, 0x7C, 0x05, 0xE0, 0xCF, 0x8F, 0x02, 0xE0, 0x52, 0xB4, 0x05, 0xE0,
+0xD2, 0xAF, 0x7A, 0x02, 0xF0, 0x07, 0x1B, 0xD7, 0xAC, 0x17, 0x82, 0x7F,
+0xE8, 0x3C, 0x00, 0xE0, 0xA5, 0x1F, 0x00, 0xE0, 0x33, 0x1E, 0x00, 0xE0,
+0x22, 0x1D, 0x60, 0x3C, 0xE2, 0x04, 0xF0, 0x0D, 0x88, 0x15, 0x14, 0xC4,
+0x81, 0x7F, 0x72, 0xD7, 0x02, 0xE0, 0x32, 0xBC, 0xE8, 0x39, 0x18, 0x24,
+0x3A, 0xEB, 0xF0, 0x7F, 0x00, 0xE8, 0x82, 0xC7, 0x04, 0xE0, 0x26, 0x17,
+0x46, 0x01, 0xF0, 0x04, 0x08, 0x79, 0x0C, 0x7F, 0x8D, 0x7F, 0xFE, 0xEF,
+0x77, 0xD3, 0x22, 0xBC, 0x06, 0x24, 0x62, 0x3C, 0x21, 0xDF, 0x62, 0x04,
+0x09, 0x30, 0x0A, 0x00, 0x14, 0x06, 0x00, 0x81, 0x22, 0xA4, 0x7C, 0x24,
+0xFE, 0xEF, 0xFD, 0xD3, 0x18, 0x09, 0xF0, 0x44, 0x0A, 0xB5, 0x08, 0x68,
+0xC0, 0xE9, 0x3E, 0xFE, 0xC6, 0x00, 0xE2, 0x81, 0xCE, 0x01, 0xE0, 0x00,
+0x11, 0xBE, 0x02, 0x01, 0xE0, 0x01, 0x25, 0x05, 0x17, 0x2E, 0xE1, 0x2B,
+0x3F, 0x00, 0xE0, 0x7C, 0x2F, 0x00, 0xE2, 0x82, 0xCC, 0x84, 0x01, 0x33,
+0x26, 0x0C, 0x9F, 0x31, 0x27, 0xE9, 0x39, 0xE0, 0x3C, 0x88, 0xC4, 0x6A,
+0x3C, 0x6A, 0x39, 0x6C, 0x3A, 0x22, 0xD6, 0x62, 0x3C, 0xE0, 0x3C, 0x86,
+0xC4, 0x04, 0xC4, 0x2C, 0xD6, 0x02, 0x61, 0x00, 0xE0, 0xED, 0x1A, 0x0F,
+0xE4, 0x48, 0x31, 0x00, 0xE2, 0x8F, 0xC7, 0x56, 0x08, 0x82, 0xD2, 0x3A,
+0x00, 0xE0, 0x69, 0x01, 0x9B, 0x05, 0x5A, 0x08, 0xF0, 0x1F, 0x5E, 0x01,
+0x00, 0xE2, 0x84, 0xCF, 0x9C, 0x01, 0x00, 0xE0, 0xA6, 0x1F, 0x8F, 0xA7,
+0x9F, 0x3A, 0x00, 0xE2, 0x82, 0xC9, 0x83, 0x5C, 0x00, 0xE0, 0x43, 0x01,
+0x68, 0x3D, 0x65, 0x3C, 0xFE, 0xEF, 0xDA, 0xD4, 0x00, 0x11, 0x00, 0xE0,
+0x41, 0x24, 0x62, 0x3C, 0x18, 0xC0, 0xE1, 0x0A, 0x86, 0x08, 0x51, 0x86,
+0x01, 0x00, 0xE0, 0x9A, 0x2C, 0x00, 0x60, 0xEA, 0x00, 0x6F, 0x3F, 0x7F,
+0xC7, 0xDC, 0x09, 0xC0, 0xE5, 0x05, 0xAF, 0x2F, 0x82, 0x14, 0x23, 0xE0,
+0x89, 0x39, 0xAB, 0x21, 0x1E, 0x00, 0x80, 0x00, 0xE2, 0x0C, 0x7C, 0x8F,
+0xA4, 0xF8, 0xD5, 0xD6, 0x01, 0xF1, 0x01, 0x00, 0xE0, 0xBF, 0x1F, 0x8F,
+0xA4, 0xF4, 0xD5, 0x00, 0xE0, 0x91, 0x1F, 0x8F, 0xA4, 0xF0, 0xD5, 0x66,
+0x00, 0xF0, 0x1C, 0xA4, 0xEC, 0xD5, 0x00, 0xE0, 0xEE, 0x1F, 0x5F, 0x39,
+0x15, 0x29, 0x03, 0x5D, 0x90, 0x17, 0xA5, 0x3F, 0xFA, 0x3F, 0x00, 0xE2,
+0x8C, 0x7C, 0x24, 0xA4, 0x6A, 0xE0, 0xAF, 0x3D, 0x95, 0x3C, 0x00, 0xE0,
+0x98, 0xD9, 0x03, 0x5F, 0x14, 0xB7, 0xC7, 0x00, 0x24, 0xA5, 0x82, 0x00,
+0x82, 0x8F, 0xD4, 0x17, 0x2C, 0x01, 0xE0, 0x7F, 0x11, 0x82, 0x00, 0x00,
+0x08, 0x01, 0x03, 0x8C, 0x00, 0x00, 0x54, 0x00, 0x71, 0xA7, 0x9F, 0x3A,
+0xFF, 0xE7, 0xA7, 0x00, 0x68, 0x00, 0x01, 0x0C, 0x00, 0xF0, 0x05, 0xA1,
+0x00, 0x03, 0x5F, 0x00, 0x11, 0x14, 0xB7, 0xFF, 0xE7, 0xA8, 0x00, 0x69,
+0x3F, 0x7E, 0xC7, 0x00, 0xE2, 0x01, 0xCF, 0x28, 0x03, 0xF1, 0x02, 0x00,
+0xE0, 0xEF, 0x02, 0x00, 0xE0, 0x6E, 0x25, 0x85, 0x17, 0x2F, 0xE1, 0xAB,
+0x3F, 0x00, 0xE0, 0xE9, 0x3E, 0x01, 0x00, 0xCC, 0x00, 0x90, 0x63, 0x26,
+0x8C, 0x9F, 0x00, 0xE0, 0xE0, 0x27, 0xB6, 0x6E, 0x01, 0x70, 0x39, 0xE0,
+0x3C, 0x6A, 0x3C, 0x8C, 0xC4, 0x46, 0x01, 0xF0, 0x3F, 0x7F, 0xD5, 0xE0,
+0x3C, 0x62, 0x3C, 0x8A, 0xC4, 0x04, 0xC4, 0x89, 0xD5, 0x00, 0xE0, 0x8E,
+0x1F, 0x83, 0x62, 0x0F, 0xA5, 0x0C, 0xE4, 0xC8, 0x32, 0x68, 0x3B, 0x00,
+0xE2, 0x0F, 0xC6, 0x00, 0xE0, 0x43, 0x25, 0x00, 0xE0, 0xCB, 0x1D, 0x00,
+0x11, 0x6B, 0x3F, 0x84, 0x00, 0x01, 0xC1, 0x7A, 0x39, 0x3A, 0x01, 0x80,
+0xE1, 0x9E, 0xA7, 0x8F, 0xA6, 0xFC, 0x3E, 0xF9, 0x01, 0x9F, 0xA6, 0xF7,
+0x26, 0x2F, 0xA4, 0x75, 0x24, 0x09, 0xE4, 0xC4, 0x32, 0x81, 0x7D, 0x00,
+0xE2, 0x10, 0x7D, 0x3A, 0x05, 0xC0, 0x81, 0x3E, 0x81, 0x65, 0x27, 0x24,
+0x0F, 0xE0, 0xCC, 0x32, 0x06, 0x67, 0xE2, 0x02, 0xF0, 0x07, 0xBE, 0x3F,
+0x1F, 0xE2, 0xFF, 0xC2, 0x85, 0x5C, 0x9F, 0x3A, 0x85, 0x67, 0x0E, 0xE0,
+0x99, 0x3A, 0x7F, 0x3F, 0x95, 0x02, 0x04, 0x64, 0x82, 0x01, 0xF1, 0x1C,
+0x15, 0x3C, 0x1B, 0x01, 0x66, 0x3D, 0x81, 0x7D, 0xFE, 0xEF, 0x1A, 0xD4,
+0x81, 0x65, 0xE8, 0x39, 0x22, 0xE0, 0x7B, 0xA7, 0xBE, 0xA7, 0x83, 0x27,
+0x2E, 0xA4, 0x81, 0x3F, 0xFF, 0xEF, 0xA9, 0xD4, 0x84, 0x21, 0x00, 0x14,
+0x18, 0xC0, 0x61, 0x0B, 0x01, 0xE0, 0x7F, 0x08, 0x00, 0x22, 0x82, 0x38,
+0x0C, 0x04, 0xF0, 0x0D, 0x24, 0xA5, 0xFE, 0xEF, 0xF7, 0xD3, 0x75, 0x24,
+0x85, 0x5F, 0x00, 0x14, 0x94, 0xB7, 0xF3, 0x00, 0x3F, 0xEB, 0x1C, 0x7F,
+0x3F, 0xEB, 0x98, 0x7F, 0x00, 0xE8, 0x02, 0xC7, 0x86, 0x02, 0x68, 0x0E,
+0xBC, 0x8F, 0xBC, 0x82, 0x38, 0x18, 0x01, 0x73, 0x01, 0xE0, 0x9D, 0x02,
+0x01, 0xE0, 0x1C, 0x18, 0x01, 0x33, 0x01, 0xE0, 0x97, 0x18, 0x01, 0x51,
+0x01, 0xE0, 0x11, 0x26, 0x8C, 0xB2, 0x03, 0x00, 0x8C, 0x08, 0x11, 0x69,
+0x18, 0x01, 0xF2, 0x03, 0x94, 0xC4, 0x6A, 0x3A, 0xEC, 0x39, 0xF3, 0xD4,
+0xE0, 0x3C, 0x64, 0x3C, 0x92, 0xC4, 0x04, 0xC4, 0xFD, 0xD4, 0x5C, 0x00,
+0x74, 0x82, 0xC7, 0x85, 0x62, 0x8F, 0xA4, 0x0A, 0x1C, 0x01, 0xF0, 0x04,
+0xC5, 0x00, 0xE0, 0xEF, 0x24, 0x3F, 0xEB, 0x1C, 0x7A, 0x00, 0xE8, 0x02,
+0xC2, 0x84, 0xA6, 0x80, 0x17, 0xFC, 0xC6, 0xAD, 0x01, 0xF1, 0x14, 0x84,
+0x00, 0xFF, 0x3C, 0x00, 0xE0, 0x64, 0x01, 0x80, 0xE0, 0x1D, 0xA7, 0x0B,
+0xE0, 0xA2, 0x37, 0x0E, 0xA6, 0x81, 0xC7, 0x7A, 0x3E, 0xF6, 0x01, 0x1E,
+0xA6, 0x74, 0x26, 0x2E, 0xA4, 0x72, 0x24, 0x09, 0xE4, 0xC0, 0x28, 0x01,
+0xF0, 0x11, 0x18, 0x7D, 0x01, 0xE2, 0xFF, 0xC4, 0x01, 0x3E, 0x81, 0x65,
+0x00, 0xE0, 0x4D, 0x24, 0x89, 0x5C, 0xFF, 0xE3, 0xFF, 0xC2, 0x87, 0x67,
+0x0E, 0xE0, 0x95, 0x3C, 0x7F, 0x3F, 0x00, 0xE0, 0xC2, 0x02, 0xC4, 0x07,
+0xF0, 0x43, 0x89, 0x67, 0x00, 0xE0, 0x47, 0x01, 0xBD, 0x27, 0x88, 0x67,
+0x00, 0xE0, 0xE3, 0x27, 0xE5, 0x3F, 0xFF, 0xC7, 0x1F, 0x3B, 0x80, 0x16,
+0x00, 0xE2, 0x18, 0x79, 0x81, 0x11, 0xA9, 0x24, 0x02, 0xA4, 0x0E, 0xE0,
+0x95, 0x3E, 0x00, 0xE2, 0x11, 0x7D, 0xE3, 0x3C, 0x1E, 0x3C, 0x81, 0x7D,
+0x82, 0x7E, 0x03, 0x7F, 0xFE, 0xEF, 0x6D, 0xD3, 0x03, 0x67, 0x22, 0xA6,
+0x91, 0x4F, 0x2E, 0xE0, 0x7C, 0x8D, 0x02, 0xA4, 0x0F, 0xE3, 0xDA, 0x3F,
+0x91, 0x6F, 0xE3, 0x3C, 0x2E, 0xE0, 0x7C, 0x8E, 0x80, 0xE0, 0x96, 0x88,
+0x2E, 0x00, 0xF5, 0x0E, 0x51, 0x3E, 0xCC, 0x3F, 0x1E, 0x3C, 0x91, 0x6F,
+0xFE, 0xEF, 0x61, 0xD3, 0x82, 0x66, 0x89, 0x5F, 0x81, 0xC6, 0xFD, 0x3F,
+0x81, 0x65, 0xD9, 0x02, 0x84, 0xA7, 0x9F, 0x3D, 0x0B, 0x7C, 0x01, 0x40,
+0x00, 0x14, 0x83, 0x00, 0x74, 0x01, 0x17, 0x24, 0x74, 0x01, 0x00, 0x14,
+0x03, 0xF0, 0x1C, 0x76, 0x01, 0x06, 0x64, 0x23, 0xA5, 0x15, 0x3C, 0xFE,
+0xEF, 0x38, 0xD3, 0x70, 0x24, 0x89, 0x5F, 0x08, 0x67, 0x93, 0xB7, 0x6A,
+0x27, 0xE9, 0x27, 0x80, 0x17, 0x82, 0x00, 0x08, 0x67, 0xA3, 0xA6, 0x1F,
+0x3F, 0x2F, 0xE0, 0x7D, 0x8E, 0x25, 0xE0, 0x7E, 0x8F, 0x5C, 0x0A, 0x00,
+0xF0, 0x04, 0xAF, 0x81, 0xC7, 0x09, 0x5F, 0x7F, 0x3F, 0xF3, 0x02, 0x00,
+0x14, 0xDB, 0x00, 0x06, 0x64, 0x66, 0x3D, 0x15, 0x3C, 0xEC, 0x01, 0xF0,
+0x02, 0x24, 0xD3, 0x81, 0x65, 0xC8, 0x00, 0x00, 0xE2, 0x88, 0xCC, 0x00,
+0xE0, 0xC6, 0x02, 0xFC, 0xEB, 0xFC, 0x62, 0x05, 0xF9, 0x09, 0xC7, 0x29,
+0xE0, 0xFF, 0xA7, 0x82, 0x3F, 0x00, 0xE0, 0x70, 0xC4, 0x08, 0xE0, 0x0F,
+0x0E, 0x01, 0x14, 0x0A, 0xE0, 0x1F, 0x0E, 0x82, 0x38, 0x10, 0x0E, 0x00,
+0x19, 0x20, 0x0E, 0x00, 0x19, 0x30, 0x0E, 0x00, 0x3B, 0x00, 0xE0, 0x40,
+0x10, 0x00, 0x1B, 0x50, 0x10, 0x00, 0x19, 0x60, 0x10, 0x00, 0x3A, 0x01,
+0xE0, 0x00, 0x20, 0x00, 0x91, 0x14, 0x82, 0x38, 0x81, 0x17, 0x12, 0xE0,
+0x88, 0xAF, 0x6C, 0x06, 0xF0, 0x0A, 0x39, 0xFE, 0xEF, 0x3E, 0xD4, 0x80,
+0x17, 0x12, 0xE0, 0x82, 0x89, 0x12, 0xE0, 0x82, 0xAF, 0xFE, 0xEF, 0x39,
+0xD4, 0x63, 0x3C, 0xE1, 0x09, 0x83, 0x24, 0x28, 0x00, 0x60, 0xB4, 0x08,
+0x08, 0xA2, 0xEA, 0x39, 0x24, 0x00, 0xF0, 0x07, 0x00, 0xD1, 0x0F, 0xE0,
+0x48, 0x34, 0x94, 0xAF, 0x02, 0xE0, 0x0F, 0x0E, 0x04, 0xAC, 0x01, 0x14,
+0x03, 0xE0, 0x1F, 0x0E, 0x61, 0x0A, 0xBF, 0x01, 0x37, 0x81, 0x17, 0x02,
+0x48, 0x00, 0x91, 0x1A, 0xD4, 0x80, 0x17, 0x02, 0xE0, 0x82, 0x89, 0x02,
+0x48, 0x00, 0x11, 0x15, 0x48, 0x00, 0xF1, 0x04, 0xB2, 0x08, 0x00, 0xE0,
+0x8A, 0x1F, 0x00, 0xE0, 0x6F, 0x1C, 0x8F, 0xA7, 0x9F, 0xA7, 0x81, 0x3F,
+0x3F, 0xEB, 0xB0, 0x62, 0x02, 0xF0, 0x13, 0x0F, 0xA7, 0x80, 0x17, 0x22,
+0xE1, 0x0F, 0x3C, 0x2F, 0xE1, 0x0F, 0x3F, 0x5F, 0x39, 0x03, 0x29, 0x62,
+0x3C, 0x61, 0x09, 0xD8, 0x8F, 0x48, 0x8D, 0xA8, 0x37, 0xE8, 0x3C, 0x4F,
+0x3D, 0x6E, 0x3C, 0x7D, 0xD7, 0x12, 0x00, 0x31, 0x3F, 0xEB, 0xB4, 0x2E,
+0x00, 0xFF, 0x48, 0x8F, 0xA6, 0xE0, 0xE7, 0x80, 0x14, 0xD8, 0x3C, 0xBC,
+0x26, 0x5D, 0x8D, 0xCD, 0x8F, 0x28, 0x35, 0x4F, 0x3D, 0xED, 0x3F, 0x88,
+0xC7, 0x1D, 0x3D, 0xFA, 0x3F, 0x6F, 0x3C, 0xB2, 0x03, 0x5F, 0x8F, 0x4F,
+0x8E, 0x28, 0x37, 0x4C, 0x3F, 0x2D, 0x27, 0xB1, 0x08, 0x9F, 0x8D, 0x01,
+0xE0, 0x8D, 0x88, 0x2F, 0x8E, 0xA8, 0x35, 0xBF, 0x8E, 0xC1, 0x3D, 0x0C,
+0xE4, 0x20, 0x36, 0x4B, 0x3E, 0x0D, 0xE4, 0xA8, 0x36, 0xCC, 0x3E, 0xFD,
+0x3C, 0x95, 0x01, 0x99, 0x00, 0x5F, 0x8F, 0xCF, 0x8E, 0x28, 0x37, 0x4D,
+0x3F, 0x15, 0x27, 0x9F, 0x8D, 0x8F, 0x28, 0x00, 0x02, 0x60, 0xF9, 0x3E,
+0x06, 0x01, 0x9E, 0x3F, 0x5A, 0x00, 0x20, 0xEA, 0x04, 0xB4, 0x07, 0x22,
+0x6E, 0x3C, 0xB8, 0x07, 0x06, 0xBA, 0x00, 0x72, 0x00, 0x14, 0x07, 0x27,
+0x3F, 0xEB, 0xAC, 0x9A, 0x00, 0xD0, 0xA4, 0x82, 0x2C, 0x82, 0x38, 0xB1,
+0x08, 0xD9, 0x8F, 0x49, 0x8D, 0xA8, 0x37, 0xBA, 0x00, 0x30, 0x20, 0xD7,
+0x01, 0xEA, 0x07, 0xF0, 0x0A, 0xE0, 0x44, 0x24, 0xE8, 0x3F, 0x18, 0x8E,
+0xAF, 0x8E, 0x08, 0x8C, 0x28, 0x36, 0x3F, 0x8F, 0x48, 0x3E, 0x0D, 0xE4,
+0xA0, 0x36, 0xCC, 0x3E, 0x0E, 0xE4, 0x7E, 0x00, 0x40, 0x00, 0xE0, 0xF0,
+0x1E, 0x6E, 0x02, 0x40, 0x7D, 0x3F, 0x02, 0x01, 0x3E, 0x00, 0xB0, 0x3F,
+0xEB, 0x34, 0x7E, 0x3F, 0xEB, 0xB0, 0x7E, 0x3F, 0xEB, 0x2C, 0xDC, 0x03,
+0x50, 0xC6, 0x00, 0xE8, 0x82, 0xC6, 0xE4, 0x03, 0xF0, 0x09, 0x8C, 0xBF,
+0x8D, 0xBC, 0x0E, 0xBD, 0x96, 0x25, 0x02, 0xE0, 0x9B, 0x8E, 0x02, 0xE0,
+0x0B, 0x8E, 0x02, 0xE0, 0x2B, 0x8F, 0x02, 0xE0, 0xBB, 0x8F, 0xA8, 0x00,
+0xE0, 0x0E, 0xE4, 0x20, 0x37, 0x3F, 0xEB, 0x28, 0x7E, 0x4D, 0x3F, 0x0F,
+0xE4, 0xA8, 0x37, 0x36, 0x00, 0xA0, 0xCE, 0x3F, 0x8C, 0xBF, 0x85, 0x24,
+0x47, 0xDF, 0x03, 0x24, 0xB8, 0x00, 0x11, 0xA8, 0x72, 0x08, 0x04, 0x54,
+0x08, 0xF4, 0x05, 0x3F, 0xEB, 0xA8, 0x79, 0x00, 0xE8, 0x82, 0xC1, 0x83,
+0xA7, 0x0F, 0x89, 0xE2, 0x3F, 0x00, 0xE2, 0x81, 0xC7, 0x95, 0x27, 0xD2,
+0x00, 0xF0, 0x03, 0x8F, 0xA5, 0xA4, 0x25, 0x00, 0xE0, 0x0A, 0x1F, 0xDB,
+0x8F, 0x0E, 0xA7, 0x4B, 0x8E, 0xA8, 0x37, 0x00, 0x15, 0xB0, 0x01, 0xA0,
+0x0E, 0xA7, 0x4F, 0x3E, 0xEA, 0x3C, 0x01, 0x3F, 0x16, 0x2C, 0x30, 0x00,
+0x36, 0x82, 0xC7, 0x89, 0x30, 0x00, 0x70, 0xA7, 0x91, 0x27, 0x14, 0xDF,
+0x0F, 0x24, 0x18, 0x00, 0x60, 0x84, 0xC7, 0x93, 0x2F, 0x78, 0x17, 0xB3,
+0x01, 0xF4, 0x03, 0x83, 0xA7, 0x5E, 0x39, 0x0F, 0xA9, 0xE1, 0x09, 0x01,
+0xE2, 0x7F, 0xC1, 0x01, 0xE0, 0x00, 0xC9, 0xE7, 0x00, 0x0A, 0x00, 0x02,
+0x24, 0x00, 0x60, 0xEF, 0x27, 0x61, 0xDF, 0x6D, 0x2C, 0x14, 0x00, 0x00,
+0x2C, 0x00, 0x00, 0x18, 0x00, 0x02, 0x30, 0x00, 0x01, 0x8C, 0x04, 0x06,
+0xBE, 0x04, 0x85, 0x11, 0x01, 0xE0, 0xA7, 0x02, 0x01, 0xE0, 0x28, 0xBE,
+0x04, 0x15, 0xA3, 0xBE, 0x04, 0x11, 0x1B, 0xBE, 0x04, 0x11, 0x98, 0x18,
+0x07, 0x13, 0x9C, 0x18, 0x07, 0x20, 0x96, 0xD2, 0xD2, 0x05, 0x64, 0x9A,
+0xC4, 0x04, 0xC4, 0xA0, 0xD2, 0x2A, 0x02, 0x40, 0x87, 0x62, 0x8F, 0xA7,
+0x2C, 0x02, 0xF8, 0x29, 0xD5, 0x3C, 0x01, 0xE0, 0x89, 0x27, 0x5F, 0x8D,
+0x4F, 0x8F, 0x28, 0x35, 0x4E, 0x3D, 0x6F, 0x39, 0x08, 0xC1, 0x1F, 0x3D,
+0x7A, 0x39, 0x00, 0xE0, 0xFF, 0x03, 0x52, 0x8E, 0xC2, 0x8D, 0x0D, 0xE0,
+0x28, 0x36, 0xCB, 0x3E, 0x00, 0xE0, 0xF8, 0x26, 0x92, 0x88, 0x01, 0xE0,
+0x0F, 0x8B, 0x8E, 0x00, 0x1D, 0x39, 0x72, 0x3D, 0x00, 0xE0, 0xF0, 0x05,
+0x1E, 0x00, 0xE0, 0xE9, 0x26, 0x92, 0x88, 0x02, 0x8B, 0x22, 0x8F, 0xA8,
+0x30, 0xB2, 0x8F, 0xC6, 0x38, 0x70, 0x01, 0x11, 0x41, 0x6C, 0x01, 0xA0,
+0xCE, 0x3F, 0xFF, 0x3C, 0xE8, 0x01, 0x65, 0x3F, 0xFF, 0xE3, 0x2E, 0x07,
+0xF2, 0x15, 0x82, 0xC9, 0xEE, 0x3F, 0x65, 0x3B, 0x0D, 0x5D, 0x07, 0xE2,
+0xFF, 0xC7, 0x18, 0xE2, 0x00, 0xC3, 0x00, 0xE0, 0x61, 0x01, 0x00, 0xE0,
+0x50, 0x23, 0x08, 0xE2, 0x00, 0xCB, 0x00, 0xE0, 0xC2, 0x01, 0x02, 0xE0,
+0x92, 0x8D, 0x16, 0x03, 0xF1, 0x02, 0x22, 0x8E, 0x01, 0xE0, 0xB2, 0x8E,
+0x02, 0xE0, 0xB2, 0x8C, 0x01, 0xE0, 0xA2, 0x88, 0xA8, 0x35, 0xC3, 0x78,
+0x02, 0xF3, 0x32, 0xEE, 0x39, 0xA8, 0x36, 0x4B, 0x3E, 0x09, 0xE4, 0xA8,
+0x34, 0x07, 0xE2, 0xF8, 0xC1, 0xC1, 0x3E, 0x49, 0x3E, 0x00, 0xE0, 0xCF,
+0x21, 0xF8, 0xC7, 0xFF, 0xE3, 0xFF, 0xC7, 0xEA, 0x39, 0x8E, 0x21, 0x2E,
+0xE1, 0x9F, 0x3E, 0x0B, 0x27, 0x0E, 0xE0, 0x93, 0x3F, 0x7D, 0x3F, 0x00,
+0xE0, 0x50, 0x02, 0xE8, 0x3C, 0x63, 0x3D, 0x08, 0xE0, 0x1F, 0x3E, 0xEC,
+0xD5, 0x00, 0x11, 0x0F, 0x2B, 0x3F, 0xEB, 0xA4, 0x96, 0x02, 0x52, 0x09,
+0x27, 0x3F, 0xEB, 0xA0, 0x0C, 0x00, 0x90, 0xA4, 0x63, 0x3D, 0xE5, 0x3C,
+0x01, 0x3F, 0x62, 0x3C, 0xD8, 0x04, 0x02, 0x62, 0x07, 0x02, 0x0A, 0x00,
+0x15, 0x06, 0x0A, 0x00, 0xF0, 0x0D, 0xD2, 0x8D, 0x01, 0xE0, 0xC2, 0x89,
+0x01, 0xE0, 0x62, 0x8E, 0x01, 0xE0, 0x92, 0x8E, 0xA8, 0x35, 0x01, 0xE0,
+0xF2, 0x8C, 0x01, 0xE0, 0x82, 0x88, 0xFF, 0xE7, 0xB6, 0x00, 0xBA, 0x00,
+0xF4, 0x03, 0x22, 0x01, 0x10, 0xE2, 0x00, 0xCB, 0x01, 0xE0, 0x1F, 0x01,
+0x01, 0xE0, 0x0D, 0x23, 0x80, 0x17, 0x94, 0xB7, 0x46, 0x00, 0xF0, 0x0D,
+0x08, 0x17, 0x2F, 0x3F, 0x7E, 0x3D, 0xC2, 0x04, 0xEA, 0x3D, 0xF8, 0xC5,
+0x9F, 0x3D, 0xE3, 0x3F, 0xEB, 0x39, 0x1E, 0x3C, 0xFF, 0xE3, 0xFF, 0xC1,
+0xFF, 0xE7, 0xAB, 0x00, 0xE9, 0x01, 0x62, 0x0E, 0xE0, 0xAF, 0x3E, 0xEE,
+0x39, 0x0E, 0x00, 0x22, 0xAD, 0x00, 0xEE, 0x00, 0x20, 0x92, 0x8D, 0xEE,
+0x00, 0x40, 0x02, 0xE0, 0x02, 0x8C, 0x02, 0x01, 0x00, 0xFE, 0x00, 0x71,
+0xA8, 0x36, 0xA8, 0x35, 0xC1, 0x3E, 0xC8, 0xFE, 0x00, 0x22, 0x88, 0xC6,
+0xFC, 0x00, 0xF0, 0x00, 0xFF, 0xE3, 0xFF, 0xC6, 0x06, 0xE0, 0xCC, 0x3C,
+0xFF, 0x3E, 0xCA, 0x05, 0x14, 0x9C, 0xEA, 0x52, 0x00, 0xF0, 0x12, 0xC4,
+0x24, 0xA6, 0x79, 0x3C, 0x05, 0x7E, 0xE8, 0x3D, 0x82, 0x05, 0xEA, 0x3D,
+0x03, 0xE0, 0xAF, 0x3E, 0xFF, 0xE3, 0xFF, 0xC5, 0xF3, 0x3D, 0xF8, 0xE7,
+0x80, 0x14, 0x63, 0xE0, 0x2B, 0x3D, 0xE3, 0x3D, 0x10, 0x00, 0xF0, 0x49,
+0x94, 0xB5, 0xD5, 0x3C, 0x00, 0xE2, 0x20, 0x7C, 0x03, 0x7F, 0x82, 0x7D,
+0x81, 0x7F, 0x84, 0x7E, 0xA6, 0xD1, 0x84, 0x66, 0xED, 0x3C, 0xB0, 0xD1,
+0xF2, 0x8E, 0xE2, 0x8C, 0xA8, 0x36, 0xCD, 0x3C, 0xAB, 0xD1, 0x03, 0x67,
+0x81, 0x67, 0x07, 0xE2, 0x78, 0xC7, 0x82, 0x65, 0x1B, 0x2F, 0x08, 0x12,
+0x63, 0x3D, 0xFF, 0xE3, 0x7F, 0xC5, 0x02, 0xE0, 0x2F, 0x3A, 0x72, 0x3D,
+0x00, 0xE2, 0xA0, 0x7C, 0x9F, 0x3C, 0x05, 0x64, 0x98, 0x04, 0x62, 0x3D,
+0x81, 0x7F, 0x82, 0x7D, 0x43, 0xD5, 0x81, 0x67, 0x82, 0x65, 0xF8, 0xC7,
+0x9F, 0x3D, 0x85, 0x67, 0x5C, 0x00, 0xE0, 0x92, 0x3F, 0x85, 0x7F, 0xE4,
+0x3F, 0xFF, 0xE7, 0x84, 0x25, 0xEF, 0x3C, 0xF8, 0xC4, 0x92, 0x00, 0xE0,
+0x05, 0x64, 0x6B, 0x3D, 0x96, 0x3C, 0x2F, 0xD5, 0x00, 0x11, 0xFE, 0xE7,
+0xFA, 0x00, 0x3A, 0x01, 0x02, 0x4A, 0x01, 0x60, 0x82, 0x88, 0x01, 0xE0,
+0x42, 0x8C, 0x4E, 0x01, 0x00, 0xDC, 0x00, 0x00, 0x4C, 0x01, 0x42, 0xFF,
+0xE7, 0x90, 0x00, 0x48, 0x02, 0x40, 0xF4, 0xC6, 0x62, 0x3B, 0xDE, 0x00,
+0xF0, 0x31, 0x14, 0xC3, 0xFF, 0xE7, 0x92, 0x00, 0xB4, 0x24, 0x00, 0xE2,
+0x81, 0xCC, 0xAF, 0x01, 0xB4, 0x08, 0x00, 0xE0, 0x36, 0x1A, 0x00, 0xE0,
+0xBB, 0x1F, 0x00, 0xE0, 0x71, 0x1F, 0x02, 0xE0, 0xC4, 0xA1, 0x8F, 0xA7,
+0x69, 0x39, 0xDE, 0x39, 0x81, 0x3F, 0x00, 0xE0, 0x3E, 0x1E, 0x08, 0xE0,
+0x83, 0xC9, 0x02, 0xE0, 0xC4, 0xB9, 0x3F, 0xEB, 0xB8, 0x7E, 0x01, 0xE0,
+0xFC, 0xA7, 0x00, 0xE0, 0xF2, 0x1D, 0x14, 0x04, 0xF0, 0x05, 0xDB, 0x3F,
+0x00, 0xE8, 0x84, 0xCF, 0x01, 0xE0, 0xFC, 0xBF, 0x3F, 0xEB, 0x3C, 0x7F,
+0x06, 0xE0, 0xA4, 0xA7, 0x7C, 0x16, 0x28, 0x04, 0xF0, 0x00, 0x0D, 0xBC,
+0xDC, 0x3F, 0x02, 0x14, 0x0E, 0xB9, 0x06, 0xE0, 0xA4, 0xBF, 0x61, 0x0A,
+0x03, 0xC6, 0x06, 0x90, 0xE0, 0xB6, 0x1F, 0xFC, 0x16, 0x02, 0xE0, 0x4F,
+0xA7, 0x50, 0x00, 0xD5, 0x5D, 0x3F, 0x02, 0xE0, 0x4F, 0xBF, 0x3F, 0xEB,
+0xBC, 0x7E, 0x01, 0xE0, 0x7C, 0x4E, 0x00, 0xF0, 0x31, 0x5B, 0x3F, 0x01,
+0xE0, 0x7C, 0xBF, 0x69, 0x3C, 0x06, 0xE0, 0x2F, 0xA7, 0x8D, 0xBC, 0x03,
+0xCF, 0x06, 0xE0, 0x2F, 0xBF, 0x82, 0x38, 0x80, 0x17, 0x2F, 0xE0, 0x0F,
+0x3C, 0x00, 0xE0, 0xF2, 0x2F, 0x2E, 0xE0, 0x8F, 0x3C, 0x00, 0xE0, 0x6E,
+0x2F, 0x01, 0xE0, 0x99, 0xA6, 0x01, 0xE0, 0x09, 0xA6, 0x00, 0xE0, 0xBE,
+0x1F, 0xB8, 0xBE, 0x89, 0xA6, 0x18, 0xBF, 0x28, 0xBE, 0x29, 0xA7, 0xFF,
+0xBE, 0x16, 0x00, 0xF0, 0x07, 0x0F, 0xBF, 0x39, 0xA7, 0x01, 0xE0, 0x9F,
+0xBE, 0xC9, 0xA6, 0x01, 0xE0, 0x2F, 0xBF, 0x03, 0xE0, 0x09, 0x8F, 0x01,
+0xE0, 0xBF, 0xBE, 0xCE, 0x01, 0xF0, 0x17, 0xD9, 0xA6, 0x01, 0xE0, 0xCF,
+0xBE, 0x01, 0xE0, 0xA9, 0xA6, 0x20, 0x2F, 0x94, 0x26, 0x05, 0xE0, 0x59,
+0x8F, 0x05, 0xE0, 0x49, 0x8E, 0x7E, 0x3E, 0x00, 0xE0, 0xC7, 0x05, 0x2E,
+0xE0, 0x7D, 0x8F, 0x00, 0xE0, 0x73, 0x1E, 0xEF, 0xA6, 0x52, 0x03, 0xF1,
+0x20, 0x00, 0xEA, 0x1F, 0xC7, 0xDC, 0x3E, 0x4D, 0x3F, 0x6F, 0xBF, 0x01,
+0xE0, 0xFF, 0xA6, 0x00, 0xE0, 0x74, 0x1E, 0x01, 0x17, 0x08, 0xBF, 0xCC,
+0x3E, 0x01, 0xE0, 0xFF, 0xBE, 0x6E, 0x3C, 0x82, 0x38, 0x03, 0xE0, 0x39,
+0x8F, 0x00, 0xE0, 0xF5, 0x1D, 0x79, 0xA6, 0x42, 0x37, 0x7F, 0xC7, 0x5B,
+0x40, 0x05, 0xF4, 0x01, 0x4C, 0x3F, 0x01, 0xE0, 0x5F, 0xBF, 0x81, 0x15,
+0x03, 0xE0, 0x29, 0x8F, 0xDE, 0x3D, 0x9F, 0x2D, 0x14, 0x00, 0x37, 0x6F,
+0xBF, 0x93, 0x6C, 0x00, 0x1F, 0x91, 0x6A, 0x00, 0x0A, 0xF0, 0x07, 0x88,
+0xCE, 0xCA, 0x00, 0x04, 0x14, 0x82, 0x38, 0x01, 0xC7, 0x01, 0xE2, 0x7F,
+0xC7, 0xDF, 0x00, 0x03, 0x24, 0x08, 0xA4, 0x82, 0x38, 0x12, 0x00, 0x33,
+0x3F, 0xEB, 0xC0, 0xE6, 0x04, 0xF0, 0x27, 0x00, 0xE0, 0x3E, 0x1F, 0x1F,
+0xA6, 0x01, 0xE0, 0xFE, 0xA6, 0x01, 0x15, 0x01, 0xE0, 0xFE, 0xBE, 0x80,
+0x15, 0x1C, 0x3D, 0xAF, 0xA6, 0x8F, 0xBD, 0x1F, 0xBD, 0x8C, 0x26, 0xB1,
+0x08, 0x7E, 0xA7, 0x00, 0xE0, 0x76, 0x1D, 0x3F, 0xA4, 0x2C, 0xE0, 0xFE,
+0xA4, 0x81, 0x3E, 0xA1, 0x08, 0xDF, 0xE7, 0xC5, 0x00, 0xDF, 0xE7, 0xC3,
+0x00, 0x36, 0x00, 0xF4, 0x39, 0x88, 0xA5, 0x98, 0xA7, 0x8E, 0xBD, 0xA8,
+0xA5, 0x9E, 0xBF, 0xB8, 0xA7, 0xAE, 0xBD, 0xC8, 0xA5, 0x01, 0xE0, 0xA8,
+0x9E, 0xEE, 0xBF, 0x00, 0xEA, 0x8C, 0xCF, 0xDE, 0xBD, 0x01, 0xE0, 0x7E,
+0xA6, 0xCC, 0x3F, 0x01, 0xE0, 0xFE, 0xBF, 0x80, 0x17, 0x0F, 0xE0, 0xFE,
+0xBF, 0x8C, 0x26, 0xE8, 0xA7, 0xA2, 0x36, 0xFC, 0xC7, 0x0D, 0xE0, 0x9F,
+0x3E, 0x80, 0xE0, 0x9F, 0xA5, 0xFD, 0x3F, 0x10, 0xE0, 0x8E, 0xBD, 0xFB,
+0x01, 0x01, 0xE0, 0x7E, 0xBE, 0x8E, 0x01, 0xE0, 0x92, 0x2F, 0x2F, 0xE0,
+0x8F, 0x3C, 0x8F, 0x2F, 0xB2, 0x08, 0x3F, 0xEB, 0xC0, 0x7E, 0xBC, 0x01,
+0xF0, 0x03, 0x69, 0x39, 0x10, 0x15, 0xEF, 0x3C, 0x0D, 0xBC, 0x23, 0xD4,
+0x62, 0x3C, 0xC7, 0xDF, 0x01, 0x14, 0x61, 0x09, 0xE8, 0x05, 0x20, 0x08,
+0xA7, 0xA4, 0x01, 0xF5, 0x0C, 0x0F, 0xBF, 0x18, 0xA7, 0x1F, 0xBF, 0x28,
+0xA7, 0x2F, 0xBF, 0x38, 0xA7, 0x48, 0xA4, 0x6F, 0xBF, 0x5F, 0xBC, 0x82,
+0x38, 0x98, 0x8E, 0x08, 0x8E, 0x28, 0x8F, 0xB8, 0x3A, 0x06, 0x02, 0x36,
+0x06, 0xF1, 0x26, 0xCE, 0x3F, 0x04, 0xC4, 0x89, 0xBF, 0x82, 0x38, 0x18,
+0x8F, 0x80, 0xE1, 0xA8, 0x8F, 0x28, 0x37, 0xCE, 0x3F, 0x89, 0xB7, 0x82,
+0x38, 0x80, 0xE1, 0x98, 0x8F, 0x89, 0xAF, 0x82, 0x38, 0xE8, 0x3F, 0x0C,
+0xE0, 0xC8, 0x34, 0x0D, 0xE4, 0xC0, 0x34, 0x0E, 0xE4, 0xC8, 0x34, 0x04,
+0xC4, 0x8F, 0xAC, 0x1F, 0xAE, 0xAF, 0xAE, 0x3F, 0x1A, 0x00, 0x50, 0x0E,
+0xE0, 0xC8, 0x34, 0x02, 0x12, 0x00, 0xB0, 0xAF, 0x82, 0x38, 0xFF, 0xFF,
+0x92, 0x24, 0xFF, 0xC4, 0xE8, 0x3F, 0x22, 0x03, 0xE0, 0x0E, 0xE0, 0x19,
+0x3C, 0xFF, 0xC7, 0x00, 0xE0, 0x00, 0x14, 0x80, 0xE0, 0x9F, 0x8C, 0xD9,
+0x01, 0xF0, 0x03, 0xFE, 0x3F, 0x19, 0x3C, 0x01, 0xE2, 0x7F, 0xC4, 0xFA,
+0x01, 0x82, 0x38, 0x69, 0x3C, 0x82, 0x38, 0x6A, 0x3F, 0x6E, 0x01, 0xF1,
+0x10, 0x0F, 0xE0, 0x48, 0x35, 0xB2, 0x24, 0x00, 0xE0, 0x94, 0x15, 0x00,
+0xE2, 0x94, 0xCC, 0x6B, 0x3E, 0x6C, 0xE0, 0xA9, 0x3D, 0xAC, 0x3C, 0x0C,
+0xE0, 0x18, 0x3E, 0x80, 0xE1, 0x98, 0x8E, 0x1D, 0x58, 0x05, 0x30, 0x7C,
+0x3C, 0x9E, 0x50, 0x00, 0xF1, 0x07, 0xC7, 0xF7, 0x01, 0x6E, 0x3E, 0xEF,
+0x3E, 0x01, 0xE2, 0x7F, 0xC6, 0x48, 0x37, 0x01, 0xE2, 0xFF, 0xC6, 0xC8,
+0x37, 0x1C, 0x3F, 0x9D, 0x22, 0x00, 0x00, 0x1E, 0x00, 0x2F, 0xE0, 0x2C,
+0x1E, 0x00, 0x09, 0x50, 0xA8, 0x37, 0x08, 0xE0, 0xCE, 0x0E, 0x00, 0xF0,
+0x10, 0xC4, 0x82, 0x38, 0xFF, 0xE1, 0x7F, 0x15, 0xC1, 0x00, 0xB5, 0x08,
+0x69, 0x39, 0xE8, 0x39, 0xFD, 0xEF, 0xC5, 0xDF, 0x92, 0x8F, 0x97, 0x27,
+0x32, 0x8F, 0x02, 0x8E, 0x01, 0xC7, 0xEE, 0x3E, 0x3A, 0x00, 0xF6, 0x1B,
+0xFF, 0xC7, 0xB2, 0xAE, 0x7D, 0x3E, 0x2E, 0xE0, 0x72, 0xA2, 0x92, 0xAF,
+0x80, 0x12, 0x82, 0x02, 0xB2, 0xAA, 0xFD, 0xEF, 0xB4, 0xDF, 0x63, 0x3C,
+0x83, 0xBA, 0x13, 0xBA, 0x23, 0xB9, 0xE1, 0x0A, 0x6F, 0x3A, 0xFD, 0xEF,
+0xAC, 0xDF, 0x01, 0xE0, 0xC1, 0x12, 0x14, 0x00, 0x00, 0x72, 0x01, 0x22,
+0xB4, 0x08, 0xA2, 0x01, 0x80, 0x9F, 0x2F, 0x22, 0xE1, 0x8F, 0x3C, 0x1C,
+0x29, 0x5E, 0x00, 0xD1, 0x96, 0xDF, 0x23, 0xA6, 0x62, 0x3A, 0x12, 0x26,
+0x83, 0xA5, 0x90, 0x25, 0xEC, 0x6C, 0x07, 0xF0, 0x13, 0x9C, 0x2F, 0x01,
+0x15, 0x82, 0x00, 0x90, 0x2E, 0x81, 0xC7, 0xFF, 0x3D, 0x0E, 0xE0, 0x3F,
+0x35, 0x0D, 0xE0, 0x5C, 0x3F, 0xF9, 0x01, 0x00, 0x12, 0xFD, 0xEF, 0x82,
+0xDF, 0x64, 0x3C, 0x61, 0x0A, 0x00, 0x12, 0x06, 0x00, 0xF2, 0x09, 0x41,
+0xE0, 0x0E, 0x3F, 0x93, 0xA6, 0x33, 0xA2, 0xBD, 0x3F, 0x5C, 0x3F, 0x1F,
+0x3A, 0x23, 0xBF, 0xF1, 0x00, 0x7E, 0x17, 0xE2, 0x3F, 0xF7, 0x00, 0x62,
+0x00, 0x11, 0xAB, 0x04, 0x02, 0xF0, 0x01, 0xA8, 0x2F, 0xB3, 0x08, 0x68,
+0x39, 0x02, 0xA6, 0x92, 0xA5, 0x32, 0xA7, 0x0D, 0xE0, 0x3B, 0x3E, 0xE0,
+0x07, 0xF0, 0x11, 0x9E, 0x3E, 0xF9, 0x3E, 0x90, 0x04, 0x0F, 0x26, 0x79,
+0x3F, 0x1C, 0x01, 0x1B, 0x3F, 0x84, 0x00, 0xFE, 0x3C, 0x6D, 0x3F, 0x09,
+0x01, 0x81, 0xC7, 0x7F, 0x3E, 0x0D, 0xE0, 0x9E, 0x3D, 0xF9, 0x01, 0x24,
+0x00, 0xF0, 0x04, 0xE1, 0x09, 0x81, 0x11, 0xBF, 0x31, 0xFD, 0xEF, 0x48,
+0xDF, 0xA2, 0xA7, 0xC3, 0x3F, 0xA2, 0xBF, 0xFD, 0xEF, 0x45, 0x20, 0x08,
+0x12, 0x09, 0x20, 0x08, 0xF0, 0x27, 0x81, 0x11, 0xF3, 0x00, 0xB2, 0x08,
+0x83, 0x65, 0x00, 0x17, 0x2F, 0xE0, 0x0E, 0x3E, 0x2E, 0xE0, 0x8E, 0x3D,
+0x4F, 0x3F, 0x27, 0x2F, 0x2F, 0xE0, 0x0E, 0x3D, 0xA4, 0x2F, 0x88, 0xA0,
+0x00, 0xE2, 0xA0, 0xC8, 0xA2, 0x02, 0x98, 0xA4, 0x61, 0x39, 0x41, 0xE0,
+0x49, 0x3F, 0x00, 0xE2, 0x03, 0xC7, 0x19, 0x3F, 0x09, 0xE0, 0xBE, 0x38,
+0xD0, 0x07, 0xF0, 0x17, 0x90, 0xC4, 0xF9, 0x3E, 0x9B, 0x04, 0xFF, 0x16,
+0xB1, 0x36, 0xEC, 0x3C, 0x41, 0xE0, 0x8D, 0x3E, 0x90, 0xC4, 0x8C, 0xB8,
+0x6A, 0x3C, 0x1C, 0xBF, 0xAC, 0xBE, 0xBC, 0xBC, 0x0A, 0xBE, 0x0B, 0xA9,
+0x9B, 0xAF, 0x9B, 0xB7, 0x9A, 0xBD, 0xD7, 0x01, 0x00, 0x9E, 0x02, 0xF6,
+0x05, 0x61, 0x09, 0x01, 0xE2, 0xFF, 0xC8, 0x8A, 0xBF, 0x8B, 0x05, 0x6F,
+0x3C, 0x9A, 0xBF, 0x61, 0x09, 0x8A, 0xBF, 0x6F, 0x3C, 0x20, 0x00, 0x44,
+0x6F, 0x3C, 0x8B, 0xA8, 0x0C, 0x00, 0xF1, 0x14, 0x08, 0xA4, 0xFE, 0xE7,
+0xD5, 0x00, 0xB4, 0x08, 0x18, 0xA1, 0xE9, 0x39, 0xFD, 0xEF, 0xEF, 0xDE,
+0x92, 0x8F, 0x02, 0x8F, 0x01, 0xE0, 0x05, 0x12, 0xFE, 0x3F, 0x8F, 0x03,
+0xA2, 0x8E, 0x81, 0xC7, 0x81, 0xC6, 0x6D, 0xF4, 0x01, 0xF0, 0x05, 0x22,
+0xAE, 0x7C, 0x3F, 0x2D, 0xE0, 0xF2, 0xB9, 0x00, 0x12, 0x92, 0xAF, 0x82,
+0x02, 0x22, 0xAA, 0xFD, 0xEF, 0xDB, 0xDE, 0x48, 0x01, 0x13, 0xB3, 0x3A,
+0x00, 0xF0, 0x15, 0xD2, 0xDE, 0x12, 0x8F, 0x82, 0x8E, 0x7D, 0x3F, 0x91,
+0x03, 0xB2, 0x8F, 0x95, 0x27, 0xFF, 0xC7, 0x01, 0xE2, 0xFF, 0xC7, 0xB2,
+0xAF, 0x81, 0xC7, 0x2F, 0xE0, 0xF2, 0xB9, 0x01, 0xC7, 0x12, 0xAF, 0xFD,
+0xEF, 0xC3, 0xDE, 0xD6, 0x06, 0x00, 0x06, 0x01, 0x60, 0x05, 0x11, 0xFD,
+0xEF, 0xBC, 0xDE, 0x0C, 0x00, 0x22, 0xED, 0x3F, 0x2A, 0x00, 0xF0, 0x0D,
+0xEB, 0x00, 0xB2, 0x08, 0x68, 0x39, 0x99, 0xA4, 0x09, 0x25, 0x01, 0xE0,
+0x80, 0x17, 0x88, 0xBF, 0x80, 0x17, 0xA8, 0xBC, 0x98, 0xBF, 0x62, 0x3C,
+0x61, 0x09, 0xDD, 0xDE, 0x06, 0x00, 0x00, 0xA6, 0x00, 0xF0, 0x0F, 0xB4,
+0x00, 0x04, 0xE0, 0xA2, 0x00, 0x00, 0xE0, 0xA8, 0x1F, 0x8F, 0xA7, 0x89,
+0x27, 0xB1, 0x08, 0x3F, 0xEB, 0x44, 0x7C, 0x00, 0xE8, 0x02, 0xC4, 0x81,
+0x3F, 0x01, 0x14, 0xE1, 0x08, 0x5A, 0x01, 0x04, 0x12, 0x00, 0xF8, 0x1B,
+0x82, 0x38, 0x7C, 0xC0, 0x00, 0xE0, 0xAB, 0x1F, 0x0F, 0x8F, 0x01, 0xE2,
+0x7F, 0xCF, 0x0B, 0x01, 0x0F, 0x8F, 0x9F, 0x8F, 0x04, 0x6F, 0x85, 0x6F,
+0x85, 0x4F, 0x04, 0x4C, 0xA8, 0x37, 0x4F, 0x3C, 0x04, 0xC0, 0x82, 0x38,
+0x0A, 0xE0, 0x84, 0x17, 0x82, 0x77, 0x12, 0x00, 0xF0, 0x07, 0x00, 0xE0,
+0xB2, 0x1F, 0xFD, 0xEB, 0xBC, 0x7C, 0x8F, 0xA7, 0x00, 0xE8, 0x80, 0xC4,
+0x82, 0x3F, 0x00, 0xE2, 0x01, 0xCC, 0x03, 0x01, 0x58, 0x00, 0xF0, 0x09,
+0xB1, 0x08, 0xFE, 0xEF, 0xFD, 0xD0, 0x00, 0xE0, 0xF7, 0x1F, 0x77, 0xE0,
+0x44, 0x17, 0x00, 0x14, 0x0F, 0xBF, 0xE1, 0x08, 0xB1, 0x08, 0x3F, 0x0C,
+0x00, 0x04, 0xF0, 0x0D, 0x01, 0xE0, 0x7F, 0xA7, 0x01, 0xE0, 0x7F, 0xBF,
+0x90, 0x17, 0x61, 0xE0, 0x91, 0x3F, 0x00, 0x3B, 0x97, 0xDD, 0xA8, 0x0F,
+0xA1, 0x08, 0x00, 0x38, 0xB1, 0x08, 0x05, 0x24, 0x42, 0x00, 0xF1, 0x02,
+0x07, 0x01, 0xE1, 0x08, 0xFE, 0xEF, 0xAC, 0xDD, 0xA1, 0x08, 0xDB, 0xE7,
+0x91, 0x00, 0xFE, 0xEF, 0xB0, 0x0A, 0x00, 0xF2, 0x39, 0x84, 0x00, 0x00,
+0xE0, 0xF8, 0x1E, 0x00, 0xE0, 0x79, 0x1F, 0x8D, 0xA7, 0x07, 0xE0, 0xCF,
+0xCF, 0x8D, 0xBF, 0xF8, 0xE7, 0xB0, 0x16, 0x8E, 0xA7, 0xDD, 0x3F, 0x8E,
+0xBF, 0x82, 0x38, 0xB2, 0x08, 0x8D, 0xDF, 0x0B, 0x2C, 0x81, 0x17, 0x6A,
+0xE0, 0x94, 0x3F, 0x61, 0xE0, 0x82, 0x3F, 0x34, 0xE0, 0x91, 0xCF, 0x61,
+0xE0, 0x92, 0x3F, 0x61, 0x09, 0x8F, 0xDF, 0x68, 0x39, 0x01, 0xE0, 0x82,
+0xA7, 0x00, 0xE0, 0x90, 0x1C, 0x00, 0x14, 0x81, 0x3F, 0x0C, 0x00, 0x35,
+0xAA, 0x1C, 0x01, 0x0C, 0x00, 0x33, 0x9C, 0x1C, 0x02, 0x0C, 0x00, 0xE7,
+0x01, 0x55, 0x00, 0xE0, 0xBC, 0x1C, 0x04, 0x0C, 0x00, 0x35, 0xD5, 0x1C,
+0x09, 0x0C, 0x00, 0x35, 0x94, 0x1C, 0x0B, 0x0C, 0x00, 0x6F, 0xB0, 0x1C,
+0x0C, 0x14, 0x81, 0x3F, 0x6C, 0x00, 0x01, 0xF0, 0xFF, 0xAA, 0xB6, 0x08,
+0x00, 0xE0, 0xCE, 0x1E, 0x48, 0xA6, 0x14, 0x17, 0x80, 0x17, 0x2D, 0xAF,
+0x5C, 0x15, 0xFF, 0xE7, 0x2C, 0x17, 0xBD, 0xAF, 0xEC, 0x3D, 0x1D, 0xAF,
+0x6F, 0x3F, 0x0D, 0xAD, 0x0A, 0x15, 0x80, 0xE1, 0x9B, 0xAF, 0x6E, 0x12,
+0x1C, 0xAD, 0xFF, 0xE7, 0xB5, 0x11, 0x9B, 0xAF, 0x7F, 0x11, 0xBC, 0xAF,
+0xAC, 0x10, 0xCC, 0xAF, 0x81, 0x14, 0xDC, 0xAF, 0x82, 0x16, 0xEC, 0xAF,
+0x3C, 0x16, 0x02, 0xE0, 0xC8, 0xA7, 0x00, 0xE0, 0x58, 0x15, 0xFF, 0xE7,
+0x96, 0x15, 0x1F, 0x3E, 0x0F, 0xAF, 0x8C, 0xC7, 0x7F, 0x3E, 0x41, 0xE0,
+0x3F, 0xAF, 0x41, 0xE0, 0x2F, 0xAA, 0x41, 0xE0, 0x9F, 0xAE, 0x41, 0xE0,
+0x8F, 0xA9, 0x40, 0xE0, 0x7F, 0xA9, 0x40, 0xE0, 0xEF, 0xA8, 0x40, 0xE0,
+0xDF, 0xAC, 0x40, 0xE0, 0x4F, 0xAD, 0x40, 0xE0, 0xBF, 0xAE, 0x40, 0xE0,
+0xAF, 0xAD, 0x40, 0xE0, 0x1F, 0xAF, 0xE7, 0x01, 0x58, 0xA5, 0x01, 0xE0,
+0x28, 0xA6, 0x98, 0x17, 0x01, 0xE0, 0x0C, 0x13, 0x02, 0xE0, 0xF8, 0xA5,
+0x80, 0x16, 0x00, 0xE0, 0x44, 0x17, 0x81, 0x12, 0x13, 0x12, 0xFF, 0x10,
+0x9A, 0x3F, 0x1C, 0x3B, 0x00, 0xE0, 0x0A, 0x14, 0xEA, 0x3C, 0x43, 0xE0,
+0x8F, 0xAE, 0x80, 0xE0, 0x19, 0xAF, 0xF9, 0x3F, 0xFD, 0x01, 0x9F, 0xAE,
+0xA9, 0xC7, 0x44, 0xE0, 0xFF, 0xAE, 0x29, 0xC5, 0x44, 0xE0, 0xEF, 0xAA,
+0xEB, 0x3C, 0x44, 0xE0, 0xDF, 0xAE, 0x6B, 0x39, 0x44, 0xE0, 0xCF, 0xAE,
+0x87, 0xC5, 0x44, 0xE0, 0xBF, 0xAE, 0xC8, 0x11, 0x44, 0xE0, 0xAF, 0xAE,
+0x03, 0xC1, 0x44, 0xE0, 0x9F, 0xAE, 0x07, 0xC6, 0x44, 0xE0, 0x8F, 0xAE,
+0x7C, 0x3B, 0x43, 0xE0, 0xFF, 0xAE, 0x43, 0xE0, 0xEF, 0xAE, 0x43, 0xE0,
+0x5F, 0xAA, 0x43, 0xE0, 0xCF, 0xAE, 0x40, 0xE0, 0x9A, 0xA8, 0x40, 0xE0,
+0xAA, 0xA8, 0x43, 0xE0, 0xBF, 0xAE, 0x80, 0xE1, 0x99, 0xAE, 0x40, 0xE0,
+0xEB, 0xA9, 0xFF, 0x11, 0x99, 0xAE, 0x99, 0x14, 0x40, 0xE0, 0x4B, 0xAC,
+0x92, 0xAE, 0x40, 0xE0, 0xAB, 0xAC, 0x85, 0x14, 0x40, 0xE0, 0x9B, 0xAC,
+0xB2, 0x14, 0x40, 0xE0, 0xDC, 0xAC, 0xAC, 0x14, 0x40, 0xE0, 0xBC, 0xAC,
+0x81, 0x14, 0x40, 0xE0, 0xAC, 0xAC, 0x9F, 0x14, 0x40, 0xE0, 0xFC, 0xA9,
+0x40, 0xE0, 0x6C, 0xAC, 0x40, 0xE0, 0xCC, 0xAE, 0x40, 0xE0, 0x9C, 0xAC,
+0xFF, 0xE7, 0xB0, 0x01, 0x61, 0x0B, 0x00, 0xEA, 0x04, 0xCC, 0x10, 0xE0,
+0x60, 0xCC, 0x80, 0x14, 0x00, 0xEA, 0x04, 0xCD, 0x40, 0xE0, 0x5C, 0xCD,
+0x28, 0x3D, 0xFC, 0xD0, 0x00, 0xEA, 0x00, 0xCC, 0x00, 0xE0, 0x00, 0xCC,
+0x02, 0x24, 0x01, 0x3C, 0x00, 0x14, 0x80, 0x14, 0x04, 0xD0, 0x80, 0x3A,
+0x00, 0x00, 0x80, 0x3A, 0xB6, 0x08, 0xFF, 0xDE, 0xFD, 0xEF, 0x15, 0xDD,
+0x00, 0xE0, 0x7D, 0x1C, 0x00, 0xE0, 0x95, 0x19, 0xFD, 0xEF, 0x2F, 0xDF,
+0xE8, 0xDE, 0xFD, 0xEF, 0x63, 0xD9, 0x00, 0xE0, 0x9E, 0x1F, 0x00, 0xE0,
+0x53, 0x1C, 0x8F, 0xA4, 0x00, 0xE0, 0x13, 0x1A, 0xFF, 0xEF, 0xAF, 0xD7,
+0xFD, 0xEF, 0xDF, 0xD7, 0xFD, 0xEF, 0x77, 0xDD, 0x83, 0xA7, 0x00, 0xE0,
+0x31, 0x19, 0x8F, 0xA7, 0x81, 0x3F, 0x0A, 0x00, 0x40, 0x41, 0x14, 0x9F,
+0xA7, 0xDE, 0x08, 0x40, 0x92, 0x1D, 0x00, 0xE0, 0xE8, 0x01, 0xF1, 0x1E,
+0x41, 0x1D, 0x00, 0xE0, 0xC3, 0x1C, 0x64, 0x3C, 0x6D, 0xD9, 0x00, 0x14,
+0x8E, 0xDE, 0xE8, 0x39, 0x00, 0xE0, 0x42, 0x1C, 0x00, 0x15, 0x81, 0x14,
+0xFE, 0xEF, 0x52, 0xDC, 0x14, 0xE0, 0x54, 0x8F, 0x14, 0xE0, 0xC4, 0x8E,
+0x14, 0xE0, 0xE4, 0x8F, 0x14, 0xE0, 0xF4, 0x8C, 0x28, 0xAC, 0x06, 0xF0,
+0x19, 0xA0, 0x37, 0xCE, 0x3F, 0x00, 0xE0, 0x7E, 0x1C, 0x09, 0xE4, 0xA8,
+0x34, 0xCF, 0x3C, 0xFE, 0xEF, 0x8D, 0xDB, 0x00, 0x14, 0xFE, 0xEF, 0x1B,
+0xDC, 0x81, 0x14, 0x00, 0x14, 0x56, 0xDB, 0x02, 0xE0, 0x82, 0xA4, 0x01,
+0xE0, 0x52, 0xA4, 0x69, 0xDC, 0x06, 0x00, 0x60, 0x01, 0xE0, 0xE2, 0xA4,
+0x9D, 0xDB, 0x0A, 0x00, 0x20, 0x15, 0xDC, 0xF0, 0x02, 0xF0, 0x1D, 0x7B,
+0x01, 0x80, 0x14, 0x69, 0x3C, 0x43, 0xDB, 0x00, 0xE0, 0x31, 0x1C, 0x02,
+0xE0, 0xB2, 0xB9, 0xFE, 0xEF, 0x36, 0xD1, 0x00, 0xE0, 0x2E, 0x1C, 0xFD,
+0xEF, 0x4B, 0xDF, 0xFD, 0xEF, 0x63, 0xDF, 0x06, 0x24, 0xFD, 0xEF, 0x7C,
+0xDF, 0xFD, 0xEF, 0x71, 0xDF, 0x0E, 0x2C, 0x24, 0x00, 0x20, 0xCD, 0xDE,
+0x06, 0x00, 0xF0, 0x27, 0xFE, 0xEF, 0x43, 0xD1, 0xFD, 0xEF, 0x40, 0xDF,
+0xFD, 0xEF, 0x6E, 0xDF, 0xFD, 0xEF, 0x89, 0xDF, 0x00, 0xE0, 0xBB, 0x1A,
+0x00, 0xE0, 0x31, 0x1A, 0x00, 0xE0, 0xFF, 0x19, 0x00, 0x11, 0x88, 0x00,
+0x85, 0xA7, 0x14, 0x29, 0x81, 0x3F, 0x68, 0x3B, 0x01, 0x11, 0xFE, 0xEF,
+0x5D, 0xDB, 0x64, 0x3C, 0xFE, 0xEF, 0xE0, 0xD8, 0x4C, 0xD9, 0x46, 0x04,
+0xF5, 0x20, 0x83, 0xA7, 0x00, 0xE2, 0x88, 0xC7, 0xF0, 0x2F, 0xFD, 0xEF,
+0xE3, 0xD7, 0x00, 0x11, 0xF1, 0x00, 0x81, 0x3F, 0x26, 0x3C, 0x0D, 0xE3,
+0x9F, 0x17, 0x7F, 0x3C, 0xEB, 0x05, 0xFD, 0xEF, 0xD9, 0xD7, 0x00, 0x11,
+0xE7, 0x00, 0x00, 0xE0, 0xBD, 0x1F, 0xE8, 0x3C, 0x0F, 0xA4, 0x01, 0xE0,
+0xD1, 0x0C, 0x00, 0xF0, 0x33, 0x00, 0xE0, 0xF8, 0x00, 0xFF, 0xFF, 0xE8,
+0x3D, 0x00, 0xE2, 0x03, 0xCD, 0xAD, 0x05, 0x0C, 0xE0, 0x49, 0x3C, 0x00,
+0xE2, 0x03, 0xC6, 0x28, 0x2E, 0x7C, 0xC5, 0x0C, 0xE0, 0x21, 0x35, 0x00,
+0xE2, 0x18, 0xC6, 0x80, 0xE1, 0x99, 0xA7, 0x08, 0x26, 0x00, 0xEA, 0x82,
+0xCE, 0xD5, 0xE0, 0xD0, 0xCE, 0xAC, 0x3E, 0x6F, 0x3F, 0x82, 0x3E, 0x70,
+0xC5, 0x93, 0x06, 0x80, 0xE1, 0x19, 0xA7, 0x80, 0xE1, 0x9B, 0xBF, 0x20,
+0x00, 0x48, 0x80, 0xE1, 0x1B, 0xBF, 0x10, 0x00, 0x20, 0x70, 0xC5, 0x12,
+0x00, 0x20, 0x6F, 0x06, 0x10, 0x00, 0x70, 0x00, 0xE2, 0x03, 0xC5, 0x7F,
+0xC5, 0x87, 0x30, 0x00, 0x20, 0x86, 0x7F, 0x18, 0x00, 0x30, 0xAE, 0x7B,
+0x06, 0xC0, 0x07, 0x00, 0x72, 0x00, 0xF0, 0x07, 0xB1, 0x05, 0x01, 0xE2,
+0xFF, 0xC4, 0x0C, 0xE0, 0xA8, 0x34, 0xCC, 0x3C, 0x0C, 0xE4, 0xA0, 0x34,
+0xCC, 0x3C, 0x41, 0xE0, 0x48, 0x3E, 0x82, 0x00, 0xF0, 0x00, 0x0B, 0xE0,
+0x18, 0x3E, 0x0D, 0xE0, 0x2C, 0x3D, 0x6D, 0x3E, 0x00, 0xE2, 0x0C, 0xC6,
+0x07, 0x80, 0x00, 0xE0, 0xCF, 0xD6, 0xE0, 0xC0, 0xCF, 0xAC, 0x3F, 0x82,
+0x3F, 0xFF, 0xE1, 0xF0, 0xC6, 0x8B, 0x5C, 0x00, 0x14, 0xBC, 0x04, 0x00,
+0x20, 0xF0, 0xC6, 0x06, 0x00, 0xF0, 0x0A, 0x77, 0x06, 0x18, 0x3D, 0xC0,
+0xE0, 0xBA, 0xAC, 0x9A, 0xAC, 0xAA, 0xAC, 0x88, 0xAC, 0x98, 0xAC, 0xA8,
+0xAC, 0x82, 0x38, 0xE8, 0x3D, 0x7F, 0xC5, 0x85, 0x2C, 0x00, 0x50, 0xAC,
+0x7F, 0xC5, 0x7D, 0x06, 0xDE, 0x04, 0x00, 0x02, 0xF0, 0x41, 0xD2, 0x24,
+0xB3, 0x08, 0x40, 0xE0, 0x99, 0xA7, 0x69, 0x39, 0x00, 0xE2, 0x80, 0xCF,
+0x7C, 0xC1, 0x02, 0x03, 0x1F, 0x39, 0xE8, 0x39, 0xB8, 0xD0, 0x00, 0xE0,
+0x4F, 0x1F, 0x8E, 0xA7, 0x6E, 0x3E, 0x87, 0x2F, 0x92, 0xBF, 0x0E, 0xB9,
+0x63, 0x3C, 0xA1, 0x09, 0x01, 0xE0, 0xAF, 0x00, 0xF2, 0x3F, 0x9B, 0x02,
+0x80, 0x15, 0x1F, 0xA7, 0x2D, 0xE1, 0x0B, 0x3F, 0x2C, 0xE1, 0x2E, 0x39,
+0xDC, 0x3E, 0x9F, 0x2E, 0x8F, 0xA6, 0x0C, 0xE0, 0x9D, 0x3F, 0x72, 0x3E,
+0x9C, 0x01, 0x02, 0xA6, 0x9C, 0x3E, 0x0C, 0x00, 0xF0, 0x65, 0x7C, 0x3F,
+0x8F, 0xBE, 0xE7, 0x01, 0x0E, 0xA6, 0x1E, 0xA7, 0x9C, 0x3E, 0x0F, 0xE0,
+0x9E, 0x0E, 0xE1, 0x00, 0x82, 0xA6, 0x0E, 0xE0, 0x1D, 0x39, 0xFE, 0x3F,
+0x85, 0x01, 0x0F, 0xE0, 0x0F, 0x0F, 0x1D, 0x3F, 0x02, 0xBF, 0x92, 0xBF,
+0x0C, 0xB9, 0xD5, 0x00, 0xEE, 0x3F, 0xDA, 0x00, 0x84, 0x05, 0x8C, 0x17,
+0x83, 0xBF, 0xCF, 0x00, 0x02, 0xA6, 0x0D, 0xE0, 0x1C, 0x39, 0x7D, 0x3F,
+0x85, 0x01, 0x0E, 0xE0, 0x8E, 0x0E, 0x9C, 0x3E, 0x82, 0xBE, 0x12, 0xBF,
+0x1F, 0xB9, 0xC3, 0x00, 0x82, 0x38, 0xB5, 0x08, 0xE9, 0x3F, 0x83, 0xC7,
+0x7C, 0x17, 0xDE, 0x3F, 0x88, 0xC7, 0x00, 0xE2, 0x8C, 0xCF, 0x0C, 0x12,
+0x64, 0xE0, 0xAF, 0x3B, 0x0F, 0xE4, 0x4F, 0x32, 0xE8, 0x39, 0x84, 0x2F,
+0x29, 0xE1, 0x94, 0x3C, 0x85, 0x24, 0x44, 0x00, 0xF0, 0x2D, 0x00, 0x14,
+0xE1, 0x0A, 0x5B, 0xD0, 0x00, 0xE0, 0xCF, 0x1F, 0x0F, 0xA7, 0xEF, 0x3E,
+0x6E, 0x39, 0x14, 0x29, 0x00, 0xE0, 0xCC, 0x1A, 0x85, 0xA7, 0x85, 0x2F,
+0xE2, 0x3C, 0x63, 0x3C, 0x3F, 0xD0, 0x05, 0xBC, 0xE4, 0x3C, 0x63, 0x3C,
+0x3B, 0xD0, 0xFF, 0xE3, 0x7F, 0xCC, 0xAA, 0x01, 0x8C, 0x17, 0x63, 0x3C,
+0x83, 0xBF, 0x44, 0xD0, 0xE5, 0x00, 0x82, 0xA7, 0xA4, 0x3F, 0xFE, 0x00,
+0xF1, 0x44, 0x1D, 0x04, 0x00, 0xE2, 0x8B, 0xCF, 0x85, 0x05, 0x82, 0xBF,
+0x1F, 0x39, 0x02, 0xBA, 0x85, 0x00, 0x72, 0x3F, 0x92, 0xA7, 0x91, 0x01,
+0x8D, 0xBF, 0x63, 0x3C, 0x31, 0xD0, 0x62, 0x3C, 0xF8, 0x17, 0x62, 0x3F,
+0x0B, 0xC4, 0x04, 0xC7, 0x5F, 0x3C, 0x0F, 0xE0, 0x2E, 0x3C, 0xCB, 0x27,
+0x1F, 0x39, 0x28, 0x3F, 0x02, 0xBF, 0xC7, 0x00, 0x9E, 0xBF, 0xF0, 0x00,
+0x62, 0x3F, 0x12, 0xA1, 0xC9, 0x00, 0x68, 0x39, 0x03, 0xC1, 0xFC, 0x17,
+0x5F, 0x39, 0x72, 0x3C, 0x61, 0x01, 0x09, 0xE0, 0x28, 0x39, 0x63, 0x3C,
+0x05, 0x6C, 0x00, 0xF1, 0x04, 0xDA, 0x01, 0xCA, 0x00, 0xB3, 0x08, 0x00,
+0xE0, 0x0F, 0x19, 0x80, 0x17, 0xE8, 0x39, 0x69, 0x3C, 0x82, 0xBF, 0x0A,
+0x18, 0x00, 0xC0, 0x84, 0x01, 0x82, 0xA7, 0x82, 0x27, 0x83, 0xBF, 0xE1,
+0x09, 0x82, 0x38, 0x50, 0x06, 0xF1, 0x20, 0x2E, 0xEB, 0x5C, 0x7F, 0x03,
+0xC4, 0xFC, 0x17, 0x00, 0xE8, 0x02, 0xC7, 0xD8, 0x3F, 0x0E, 0xA4, 0xEF,
+0x3E, 0x0C, 0xE0, 0x20, 0x3C, 0x02, 0xE0, 0x80, 0xC6, 0x9C, 0x3E, 0xFC,
+0x3E, 0x86, 0x03, 0x08, 0xD0, 0x8C, 0x17, 0x88, 0xBF, 0x7F, 0x14, 0xE1,
+0x08, 0x98, 0x3F, 0x8E, 0xBF, 0xFD, 0xB6, 0x02, 0xF2, 0x10, 0x0F, 0xA4,
+0x82, 0x38, 0x66, 0x19, 0x02, 0x00, 0xA8, 0x19, 0x02, 0x00, 0xC0, 0x19,
+0x02, 0x00, 0x54, 0x19, 0x02, 0x00, 0xD4, 0x19, 0x02, 0x00, 0xEA, 0x19,
+0x02, 0x00, 0x00, 0xB0, 0x04, 0x04, 0x00, 0xF2, 0x0E, 0xF0, 0x01, 0x00,
+0x00, 0x00, 0x04, 0x00, 0x6C, 0x21, 0x02, 0x00, 0x22, 0x21, 0x02, 0x00,
+0x7E, 0x23, 0x02, 0x00, 0xA8, 0x23, 0x02, 0x00, 0x20, 0x30, 0x05, 0x00,
+0xB0, 0x08, 0x24, 0x00, 0xF2, 0x01, 0xFB, 0x52, 0xC4, 0x08, 0x04, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00,
+0x39, 0x00, 0x00, 0x00, 0xC0, 0xCC, 0xDB, 0xF0, 0x04, 0x08, 0x0C, 0x10,
+0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C, 0x21,
+0x25, 0x29, 0x2D, 0x31, 0x35, 0x39, 0x3D, 0x22, 0x26, 0x2A, 0x2E, 0x32,
+0x36, 0x3A, 0x3E, 0x23, 0x27, 0x2B, 0x2F, 0x33, 0x37, 0x3B, 0x3F, 0x00,
+0x1F, 0x1E, 0x1D, 0x1C, 0x17, 0x16, 0x15, 0x14, 0x0F, 0x0E, 0x0D, 0x0C,
+0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x3D, 0x00, 0x0C,
+0x35, 0x00, 0xF1, 0xFF, 0x15, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
+0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49,
+0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F,
+0x00, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D,
+0x00, 0x6E, 0x00, 0x6F, 0x00, 0xA9, 0x00, 0xAA, 0x00, 0xAB, 0x00, 0xAC,
+0x00, 0xAD, 0x00, 0xAE, 0x00, 0xAF, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED,
+0x00, 0xEE, 0x00, 0xEF, 0x00, 0x2C, 0x01, 0x2D, 0x01, 0x2E, 0x01, 0x2F,
+0x01, 0x6D, 0x01, 0x6E, 0x01, 0x6F, 0x01, 0xAD, 0x01, 0xAE, 0x01, 0xAF,
+0x01, 0xED, 0x01, 0xEE, 0x01, 0xEF, 0x01, 0x2E, 0x02, 0x2F, 0x02, 0x6E,
+0x02, 0x6F, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xEE, 0x02, 0xEF, 0x02, 0x2E,
+0x03, 0x2F, 0x03, 0x6E, 0x03, 0x6F, 0x03, 0xAE, 0x03, 0xAF, 0x03, 0xEF,
+0x03, 0x3F, 0x02, 0x7E, 0x02, 0x7F, 0x02, 0xBE, 0x02, 0xBF, 0x02, 0xFE,
+0x02, 0xFF, 0x02, 0x3E, 0x03, 0x3F, 0x03, 0x7E, 0x03, 0x7F, 0x03, 0xBE,
+0x03, 0xBF, 0x03, 0xFF, 0x03, 0xF0, 0x01, 0xF1, 0x01, 0xF2, 0x01, 0xF3,
+0x01, 0xF4, 0x01, 0xF5, 0x01, 0xF6, 0x01, 0xF7, 0x01, 0xB7, 0x01, 0x77,
+0x01, 0x37, 0x01, 0xF7, 0x00, 0xB7, 0x00, 0x76, 0x00, 0x77, 0x00, 0x37,
+0x00, 0xB7, 0x02, 0x77, 0x02, 0x37, 0x02, 0xE0, 0x01, 0xE1, 0x01, 0xE2,
+0x01, 0xE3, 0x01, 0xE4, 0x01, 0xE5, 0x01, 0xE6, 0x01, 0xE7, 0x01, 0xA7,
+0x01, 0x67, 0x01, 0x27, 0x01, 0xE7, 0x00, 0xA7, 0x00, 0x66, 0x00, 0x67,
+0x00, 0x27, 0x00, 0xA7, 0x02, 0x67, 0x02, 0x27, 0x02, 0xD0, 0x01, 0xD1,
+0x01, 0xD2, 0x01, 0xD3, 0x01, 0xD4, 0x01, 0xD5, 0x01, 0xD6, 0x01, 0xD7,
+0x01, 0x97, 0x01, 0x57, 0x01, 0x17, 0x01, 0xD7, 0x00, 0x97, 0x00, 0x56,
+0x00, 0x57, 0x00, 0x17, 0x00, 0x97, 0x02, 0x57, 0x02, 0x17, 0x02, 0xFF,
+0xFF, 0xD9, 0x23, 0x00, 0x00, 0x5E, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x02,
+0x03, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x05, 0x01, 0x00, 0xF0, 0x51,
+0x0A, 0x40, 0x02, 0x00, 0x26, 0x40, 0x02, 0x00, 0x34, 0x40, 0x02, 0x00,
+0x42, 0x40, 0x02, 0x00, 0x50, 0x40, 0x02, 0x00, 0x08, 0x40, 0x02, 0x00,
+0x16, 0x40, 0x02, 0x00, 0x20, 0x44, 0x02, 0x00, 0xEC, 0x44, 0x02, 0x00,
+0xFC, 0x42, 0x02, 0x00, 0xD2, 0x42, 0x02, 0x00, 0xE6, 0x42, 0x02, 0x00,
+0x32, 0x00, 0x00, 0x00, 0x3C, 0x47, 0x02, 0x00, 0x33, 0x00, 0x00, 0x00,
+0x22, 0x4A, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x50, 0x4B, 0x02, 0x00,
+0xD0, 0x54, 0x02, 0x00, 0x54, 0x4F, 0x02, 0x00, 0xCA, 0x54, 0x02, 0x00,
+0x28, 0x4F, 0x02, 0x00, 0x5C, 0x54, 0x02, 0x00, 0x4E, 0x54, 0x02, 0x00,
+0xB4, 0x01, 0xF0, 0x39, 0x0A, 0x4E, 0x02, 0x00, 0x66, 0x5A, 0x02, 0x00,
+0x72, 0x5A, 0x02, 0x00, 0x80, 0x5A, 0x02, 0x00, 0x8E, 0x5A, 0x02, 0x00,
+0x9C, 0x5A, 0x02, 0x00, 0xAC, 0x5A, 0x02, 0x00, 0xBC, 0x5A, 0x02, 0x00,
+0x62, 0x5A, 0x02, 0x00, 0xCC, 0x5A, 0x02, 0x00, 0x43, 0x69, 0x72, 0x71,
+0x75, 0x65, 0x00, 0x00, 0x43, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x4D, 0x65,
+0x61, 0x73, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x41, 0x42, 0x00, 0x00,
+0x88, 0x04, 0x15, 0x10, 0x40, 0x02, 0xF0, 0x06, 0xA0, 0x6F, 0x02, 0x00,
+0xA8, 0x6F, 0x02, 0x00, 0xB4, 0x6F, 0x02, 0x00, 0x1E, 0x00, 0x00, 0x00,
+0x7A, 0x00, 0x00, 0x00, 0x34, 0x8A, 0x02, 0x10, 0x70, 0x66, 0x02, 0x42,
+0x00, 0x00, 0xEC, 0x6F, 0x08, 0x00, 0x22, 0x00, 0x03, 0x14, 0x00, 0xF4,
+0x22, 0xF8, 0x6F, 0x02, 0x00, 0x48, 0x6F, 0x02, 0x00, 0x50, 0x6F, 0x02,
+0x00, 0x58, 0x6F, 0x02, 0x00, 0x06, 0x01, 0xFF, 0x09, 0x02, 0xA1, 0x01,
+0x09, 0x00, 0x85, 0x07, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x96,
+0x12, 0x02, 0xB1, 0x02, 0xC0, 0x06, 0x00, 0xFF, 0x09, 0x01, 0xA1, 0x01,
+0x85, 0x0D, 0x16, 0x00, 0xB0, 0x82, 0x02, 0x09, 0x01, 0x81, 0x02, 0x09,
+0x01, 0x91, 0x02, 0xC0, 0x52, 0x00, 0x00, 0xEE, 0x02, 0x51, 0x43, 0x72,
+0x6F, 0x53, 0xA8, 0x0A, 0x00, 0x51, 0x00, 0x20, 0x34, 0x00, 0x01, 0x02,
+0x00, 0x93, 0xBC, 0x1D, 0x04, 0x00, 0xC8, 0x14, 0x04, 0x00, 0x0A, 0xA2,
+0x00, 0x40, 0xA4, 0x06, 0xB1, 0x26, 0x21, 0x00, 0x60, 0x40, 0x70, 0x02,
+0x00, 0xB0, 0x1D, 0xFE, 0x02, 0x31, 0x00, 0x00, 0x80, 0x06, 0x00, 0x32,
+0x01, 0x20, 0x30, 0x3C, 0x00, 0x0B, 0x01, 0x00, 0x2F, 0x03, 0x00, 0x01,
+0x00, 0x03, 0x51, 0x0E, 0x20, 0x14, 0x00, 0x01, 0x40, 0x03, 0x13, 0xB8,
+0x48, 0x00, 0x51, 0x00, 0x00, 0x16, 0x20, 0x14, 0x4E, 0x03, 0x11, 0x1F,
+0x0E, 0x00, 0x20, 0x3C, 0x07, 0x18, 0x00, 0x11, 0x0A, 0x28, 0x00, 0xF3,
+0x02, 0x09, 0x00, 0x01, 0x00, 0xBD, 0x1D, 0x04, 0x00, 0xCC, 0x14, 0x04,
+0x00, 0x43, 0x72, 0x77, 0x53, 0x16, 0x3C, 0x00, 0xC8, 0x00, 0x64, 0x00,
+0x2C, 0x01, 0xB0, 0x04, 0x88, 0x13, 0x00, 0xFF, 0xFF, 0x5E, 0x00, 0xF1,
+0x30, 0xD8, 0x04, 0x04, 0x00, 0x8C, 0x6D, 0x02, 0x00, 0x84, 0x6D, 0x02,
+0x00, 0x61, 0x15, 0x04, 0x00, 0x66, 0x15, 0x04, 0x00, 0x60, 0x15, 0x04,
+0x00, 0x34, 0x09, 0x04, 0x00, 0x64, 0x07, 0x04, 0x00, 0xF8, 0x05, 0x04,
+0x00, 0x94, 0x6D, 0x02, 0x00, 0x78, 0x6D, 0x02, 0x00, 0x3C, 0x70, 0x02,
+0x00, 0x58, 0x20, 0x04, 0x00, 0x1C, 0x25, 0x02, 0x00, 0x48, 0x6D, 0x02,
+0x00, 0x48, 0x70, 0x02, 0xE0, 0x00, 0xE0, 0x7C, 0x25, 0x02, 0x00, 0x7C,
+0x00, 0x04, 0x00, 0x9C, 0x1C, 0x02, 0x00, 0x80, 0x6D, 0x98, 0x00, 0xF0,
+0x08, 0x04, 0x00, 0x0C, 0x00, 0x05, 0x00, 0x4C, 0x6D, 0x02, 0x00, 0xD8,
+0x14, 0x04, 0x00, 0x20, 0x19, 0x02, 0x00, 0xE8, 0x17, 0x04, 0x00, 0x38,
+0x9C, 0x01, 0x30, 0x6F, 0x02, 0x00, 0xAC, 0x01, 0xF1, 0x12, 0xD4, 0x04,
+0x04, 0x00, 0x80, 0x32, 0x04, 0x00, 0xEC, 0x17, 0x04, 0x00, 0xF0, 0x6D,
+0x02, 0x00, 0x08, 0x00, 0x05, 0x00, 0xF4, 0x17, 0x04, 0x00, 0x44, 0x6D,
+0x02, 0x00, 0xD0, 0x6D, 0x02, 0x00, 0x64, 0xB2, 0x00, 0xF0, 0x1C, 0x05,
+0x00, 0x30, 0x25, 0x02, 0x00, 0xF5, 0x17, 0x02, 0x00, 0xE4, 0x08, 0x04,
+0x00, 0x80, 0x00, 0x04, 0x00, 0xF4, 0x04, 0x04, 0x00, 0x90, 0x6D, 0x02,
+0x00, 0x98, 0x1E, 0x02, 0x00, 0x64, 0x06, 0x04, 0x00, 0x34, 0x6F, 0x02,
+0x00, 0x20, 0x18, 0x04, 0x00, 0x7C, 0x44, 0x00, 0x00, 0xF0, 0x01, 0x40,
+0x08, 0x05, 0x00, 0xBC, 0xCC, 0x00, 0x40, 0x00, 0x04, 0x00, 0xAC, 0x7C,
+0x04, 0xC0, 0xD0, 0x04, 0x00, 0x78, 0x00, 0x04, 0x00, 0xB6, 0x66, 0x02,
+0x00, 0x68, 0x24, 0x01, 0xE1, 0x10, 0x05, 0x00, 0x50, 0x6D, 0x02, 0x00,
+0x88, 0x6D, 0x02, 0x00, 0xE8, 0x70, 0x02, 0x50, 0x01, 0x01, 0x9C, 0x01,
+0xF0, 0x12, 0xC0, 0x04, 0x00, 0x8C, 0x6E, 0x02, 0x00, 0x94, 0x08, 0x04,
+0x00, 0x98, 0x08, 0x04, 0x00, 0x9E, 0x08, 0x04, 0x00, 0x70, 0x08, 0x04,
+0x00, 0x74, 0x6D, 0x02, 0x00, 0xF4, 0x05, 0x04, 0x00, 0xD0, 0x14, 0xC0,
+0x04, 0x11, 0x05, 0xB4, 0x00, 0xF0, 0x0E, 0xD4, 0x14, 0x04, 0x00, 0x00,
+0xF8, 0x03, 0x00, 0x5C, 0x07, 0x04, 0x00, 0x13, 0x37, 0x04, 0x00, 0x14,
+0x05, 0x04, 0x00, 0x00, 0x28, 0x05, 0x00, 0x2C, 0x1C, 0x02, 0x00, 0x60,
+0x64, 0x00, 0xF0, 0x10, 0x20, 0x05, 0x00, 0xC1, 0x62, 0x9B, 0xD8, 0xFF,
+0xFF, 0x00, 0xFF, 0x5A, 0x5A, 0xA5, 0xA5, 0xFF, 0xFF, 0xFF, 0x00, 0xF8,
+0xE7, 0xD6, 0xE5, 0xD4, 0xC3, 0xB2, 0xA1, 0x43, 0x53, 0x4D, 0x45, 0x2C,
+0x00, 0xFE, 0x02, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x11, 0x00, 0x71, 0x3F,
+0x01, 0x00, 0x1E, 0x00, 0x01, 0x00, 0xDC, 0x02, 0x50, 0x01, 0x05, 0x00,
+0x06, 0x00, 0x48, 0x00, 0x80, 0xF0, 0xFF, 0xFF, 0x00, 0x43, 0x66, 0x67,
+0x20, 0x80, 0x02, 0xF1, 0x00, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF3,
+0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x31, 0x00, 0x04, 0x20, 0x00, 0xB1, 0x40,
+0x10, 0x05, 0x00, 0x60, 0x08, 0x05, 0x00, 0x0C, 0x20, 0x05, 0x88, 0x00,
+0x10, 0x14, 0x08, 0x00, 0xE1, 0x80, 0x03, 0x00, 0xFF, 0x7F, 0xFC, 0xFF,
+0x50, 0x34, 0x03, 0x00, 0x40, 0x0D, 0x03, 0xAC, 0x00, 0x71, 0x86, 0x18,
+0x02, 0x00, 0x2C, 0x6D, 0x02, 0x86, 0x02, 0x30, 0x5C, 0x6D, 0x02, 0x3C,
+0x00, 0xF2, 0x00, 0xFF, 0x01, 0x00, 0xF0, 0xDF, 0x06, 0x00, 0x2C, 0x00,
+0x30, 0xD8, 0x00, 0x00, 0x00, 0x17, 0x94, 0x05, 0x00, 0x21, 0x00, 0x24,
+0xA8, 0x00, 0x74, 0x02, 0x03, 0xB5, 0x02, 0x13, 0x01, 0x05, 0x00, 0x15,
+0x01, 0x07, 0x00, 0x01, 0x03, 0x00, 0x03, 0x05, 0x00, 0x04, 0x07, 0x00,
+0x17, 0x01, 0x07, 0x00, 0x00, 0x03, 0x00, 0x04, 0x07, 0x00, 0x02, 0x05,
+0x00, 0x03, 0x06, 0x00, 0x93, 0x00, 0x09, 0x01, 0x00, 0x15, 0x02, 0x06,
+0x00, 0x16, 0x02, 0x03, 0x00, 0x03, 0x05, 0x00, 0x14, 0x02, 0x05, 0x00,
+0x03, 0x03, 0x00, 0x03, 0x05, 0x00, 0x0A, 0x01, 0x00, 0x13, 0x03, 0x05,
+0x00, 0x04, 0x03, 0x00, 0x07, 0x02, 0x00, 0x03, 0x03, 0x00, 0x01, 0x04,
+0x00, 0x06, 0x07, 0x00, 0x00, 0x01, 0x00, 0x16, 0x04, 0x07, 0x00, 0x16,
+0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x06, 0x03, 0x00, 0x05, 0x04, 0x00,
+0x04, 0x06, 0x00, 0x06, 0x01, 0x00, 0x3D, 0x03, 0x05, 0x04, 0x01, 0x00,
+0x1F, 0x05, 0x0A, 0x00, 0x0A, 0x0A, 0x0F, 0x00, 0x07, 0x50, 0x00, 0x06,
+0x61, 0x00, 0x07, 0x7C, 0x00, 0x02, 0x89, 0x00, 0x01, 0x08, 0x00, 0x03,
+0x03, 0x00, 0x04, 0xBB, 0x00, 0x07, 0x01, 0x00, 0x03, 0xE3, 0x00, 0x05,
+0xF8, 0x00, 0x03, 0x03, 0x00, 0x09, 0x01, 0x00, 0x04, 0x44, 0x01, 0x04,
+0x5D, 0x01, 0x05, 0x7A, 0x01, 0x17, 0x01, 0xA8, 0x01, 0x04, 0xC9, 0x01,
+0x1F, 0x00, 0xA9, 0x04, 0x02, 0x0F, 0x01, 0x00, 0x3E, 0xEE, 0x00, 0x0F,
+0x01, 0x00, 0x8D, 0xF7, 0x20, 0x11, 0x90, 0x21, 0x08, 0xA4, 0x90, 0x00,
+0x00, 0x04, 0xD0, 0x40, 0x00, 0x0E, 0xD0, 0x20, 0x00, 0x47, 0xC1, 0xC0,
+0xFF, 0x42, 0xCA, 0x00, 0x00, 0x40, 0xA0, 0x40, 0x00, 0x48, 0xA0, 0x00,
+0x00, 0x11, 0x84, 0x00, 0x00, 0xA4, 0x84, 0x00, 0x00, 0x04, 0xE4, 0x40,
+0x00, 0x0C, 0xE4, 0x20, 0x30, 0x00, 0x5B, 0xC0, 0x02, 0x0C, 0xD0, 0x00,
+0x34, 0x00, 0x20, 0xC0, 0x02, 0x34, 0x00, 0x28, 0x48, 0x80, 0x38, 0x00,
+0x89, 0xC0, 0x02, 0x0C, 0xE4, 0x00, 0x00, 0x0C, 0xC4, 0x3C, 0x00, 0x10,
+0x09, 0x3C, 0x00, 0x04, 0x04, 0x00, 0x0B, 0x44, 0x00, 0x10, 0x09, 0x40,
+0x00, 0x08, 0x04, 0x00, 0x07, 0x4C, 0x00, 0x30, 0x09, 0x0C, 0xC4, 0x4C,
+0x00, 0x04, 0x04, 0x00, 0x08, 0x54, 0x00, 0x11, 0x00, 0x90, 0x00, 0xE1,
+0x44, 0xC0, 0x80, 0x00, 0x46, 0xC0, 0x20, 0x00, 0x07, 0xC1, 0xC0, 0xFF,
+0x02, 0xCA, 0x99, 0x06, 0x82, 0x02, 0x08, 0x80, 0x00, 0x00, 0x40, 0x84,
+0xC0, 0x48, 0x00, 0xFF, 0x05, 0x80, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x02,
+0x0C, 0xC0, 0x00, 0x00, 0x04, 0xC0, 0xE0, 0x00, 0x00, 0x81, 0x01, 0x00,
+0xFF, 0x19, 0x01, 0x01, 0xB1, 0x6E, 0x00, 0x00, 0x10, 0x32, 0x54, 0x76,
+0x98, 0xBA, 0xDC, 0xFE, 0xEC, 0x06, 0x65, 0x07, 0x00, 0xE0, 0x08, 0x18,
+0x02, 0x1F, 0x00, 0x22, 0x68, 0x5D, 0x0C, 0x00, 0xB1, 0x56, 0x56, 0x02,
+0x00, 0x96, 0x57, 0x02, 0x00, 0xAE, 0x58, 0x02, 0xE6, 0x06, 0x71, 0xFC,
+0x04, 0x04, 0x00, 0x84, 0x32, 0x04, 0x30, 0x08, 0xC0, 0x8B, 0x32, 0x04,
+0x00, 0x3C, 0x00, 0x00, 0x00, 0xC7, 0x32, 0x04, 0x00, 0x0D, 0x01, 0xB1,
+0x34, 0x03, 0x00, 0x00, 0x44, 0x05, 0x04, 0x00, 0x1C, 0x05, 0x04, 0x79,
+0x02, 0x90, 0x02, 0x5B, 0x02, 0x00, 0x30, 0x05, 0x04, 0x00, 0x28, 0x08,
+0x00, 0x8F, 0x5B, 0x02, 0x00, 0xF0, 0x10, 0x04, 0x00, 0x02, 0x87, 0x00,
+0x00, 0xFA, 0x03, 0x4C, 0x5A, 0x02, 0x00, 0x58, 0x05, 0x04, 0x00, 0xE0,
+0x5A, 0x02, 0x00, 0xE8, 0x5A, 0x02, 0x00, 0xF0, 0x05, 0x28, 0x00, 0x36,
+0xEC, 0x05, 0x04, 0xC6, 0x04, 0x01, 0xB6, 0x07, 0x11, 0x05, 0x10, 0x00,
+0x13, 0xEC, 0x28, 0x00, 0x1B, 0x04, 0x10, 0x00, 0x1B, 0x08, 0x10, 0x00,
+0x1B, 0x0C, 0x10, 0x00, 0x1B, 0x10, 0x10, 0x00, 0x1B, 0x14, 0x10, 0x00,
+0x1B, 0x18, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0xDE, 0x48, 0x02, 0x00,
+0x3B, 0x06, 0x03, 0xDC, 0x00, 0xF5, 0x00, 0xF4, 0x3F, 0x02, 0x00, 0x0C,
+0x06, 0x04, 0x00, 0x62, 0x40, 0x02, 0x00, 0x6A, 0x40, 0x02, 0x10, 0x01,
+0x17, 0x07, 0x0C, 0x01, 0x17, 0x29, 0x20, 0x01, 0xD0, 0x0C, 0x00, 0x00,
+0x00, 0x30, 0x1B, 0x04, 0x00, 0x80, 0x02, 0x00, 0x00, 0x20, 0x51, 0x00,
+0x16, 0x30, 0x0C, 0x00, 0x53, 0xFB, 0x35, 0x04, 0x00, 0x8C, 0x3C, 0x00,
+0x26, 0x87, 0x36, 0x0C, 0x00, 0x0E, 0x01, 0x00, 0x11, 0x10, 0x68, 0x00,
+0x00, 0x60, 0x00, 0x13, 0x14, 0x50, 0x00, 0x71, 0xD8, 0x1D, 0x04, 0x00,
+0x48, 0x12, 0x04, 0x38, 0x00, 0xF0, 0x03, 0x6C, 0x11, 0x04, 0x00, 0x44,
+0x11, 0x04, 0x00, 0xC8, 0x1D, 0x04, 0x00, 0x08, 0x07, 0x04, 0x00, 0x38,
+0x07, 0x4C, 0x00, 0x19, 0x04, 0x05, 0x04, 0x00, 0x90, 0x00, 0x00, 0x7C,
+0x00, 0x31, 0xCC, 0x06, 0x04, 0x78, 0x00, 0x62, 0x94, 0x11, 0x04, 0x00,
+0xF4, 0x10, 0x5E, 0x01, 0x17, 0x01, 0x2A, 0x00, 0x0F, 0x0C, 0x00, 0x19,
+0x00, 0x68, 0x00, 0xC0, 0xCC, 0x04, 0x04, 0x00, 0xB0, 0x04, 0x04, 0x00,
+0xDC, 0x08, 0x04, 0x00, 0x2F, 0x00, 0x7F, 0xAC, 0x04, 0x04, 0x00, 0xA8,
+0x04, 0x04, 0x90, 0x03, 0x06, 0x11, 0xC0, 0x03, 0x00, 0x0E, 0x01, 0x00,
+0x17, 0x80, 0x0C, 0x00, 0xFF, 0x00, 0x98, 0x66, 0x02, 0x00, 0x60, 0x6F,
+0x02, 0x00, 0x54, 0x6D, 0x02, 0x00, 0x6C, 0x07, 0x04, 0xB4, 0x04, 0xDE,
+0x40, 0x5C, 0x20, 0x04, 0x00, 
+};
+const unsigned long Oly1p3_CustomMeas_BL_Z_start       = 0x00021820;
+const unsigned long Oly1p3_CustomMeas_BL_Z_length      = 0x000062C8;
+const unsigned long Oly1p3_CustomMeas_BL_Z_checksum    = 0x62D671FA;
+
+#endif // FIRMWARE_Oly1p3_CustomMeas_BL_Z
@@ -2132,6 +2132,7 @@ const unsigned long Cirque_Oly1p2_SpiderMeas_BL_termination = 0x00000000;
 const unsigned long Cirque_Oly1p2_SpiderMeas_BL_start       = 0x00021820;
 const unsigned long Cirque_Oly1p2_SpiderMeas_BL_finish      = 0x00027B94;
 const unsigned long Cirque_Oly1p2_SpiderMeas_BL_length      = 0x00006374;
+const unsigned long Cirque_Oly1p2_SpiderMeas_BL_checksum    = 0xE2374C82;
 
 #define CIRQUE_OLY1P2_SPIDERMEAS_BL_TERMINATION 0x00000000
 #define CIRQUE_OLY1P2_SPIDERMEAS_BL_START       0x00021820
@@ -0,0 +1,1443 @@
+#ifndef FIRMWARE_Cirque_Oly1p2_SpiderMeas_BL_Z
+#define FIRMWARE_Cirque_Oly1p2_SpiderMeas_BL_Z
+
+// File: FW_SpiderMeas.h, compressed by ImageCompressor. 17153 bytes from 25460, see CompressedImage.h
+
+const unsigned char Cirque_Oly1p2_SpiderMeas_BL_Z[] =
+{
+0x43, 0x51, 0x4C, 0x5A, 0x01, 0x0B, 0x08, 0x02, 0x74, 0x63, 0x00, 0x00,
+0x20, 0x18, 0x02, 0x00, 0x28, 0x18, 0x02, 0x00, 0x82, 0x4C, 0x37, 0xE2,
+0x31, 0x00, 0x00, 0x00, 0xD8, 0x01, 0xF1, 0x52, 0x00, 0x00, 0x00, 0x00,
+0x28, 0x18, 0x02, 0x00, 0x60, 0xE0, 0x00, 0x3C, 0xF0, 0xE1, 0x02, 0xCC,
+0x60, 0xE0, 0x10, 0x3C, 0x00, 0xEA, 0x04, 0xC8, 0x7F, 0xE0, 0x7C, 0xC8,
+0x00, 0xEA, 0x82, 0xCB, 0xB8, 0xE0, 0xDC, 0xCB, 0x00, 0xEA, 0x04, 0xCC,
+0x00, 0xE0, 0x78, 0xCC, 0x00, 0xEA, 0x82, 0xCC, 0xBB, 0xE0, 0xEC, 0xCC,
+0x79, 0x3C, 0x08, 0x01, 0x00, 0xEA, 0x04, 0xCD, 0x3C, 0xE0, 0x20, 0xCD,
+0x28, 0x3D, 0x01, 0xE0, 0x0B, 0xDF, 0x00, 0xEA, 0x02, 0xCC, 0xA6, 0xE0,
+0x2C, 0xCC, 0x02, 0x3C, 0x83, 0xEB, 0xC8, 0x7F, 0x00, 0xE8, 0x82, 0xC7,
+0x8F, 0xA7, 0x00, 0x14, 0x86, 0x27, 0x83, 0xEB, 0xC4, 0x0E, 0x00, 0x45,
+0x0F, 0xA4, 0x82, 0x38, 0x0C, 0x00, 0xF2, 0x3A, 0xA7, 0x03, 0xE0, 0x74,
+0xC7, 0x6E, 0x3C, 0x0F, 0xBF, 0x03, 0xE0, 0xAE, 0x00, 0xB4, 0x08, 0x7C,
+0xC0, 0x83, 0xEB, 0x48, 0x79, 0x00, 0xE8, 0x02, 0xC1, 0x02, 0xA4, 0x80,
+0x17, 0x0F, 0x24, 0x83, 0xEB, 0xC4, 0x79, 0x00, 0xE8, 0x82, 0xC1, 0x83,
+0xA7, 0x81, 0x7F, 0x1C, 0xD6, 0x68, 0x3A, 0x02, 0xA4, 0x5B, 0xD6, 0x01,
+0x67, 0x83, 0xA7, 0x7F, 0x3F, 0x04, 0x01, 0x6F, 0x3C, 0x04, 0xC0, 0x61,
+0x0A, 0x81, 0x67, 0x06, 0x24, 0x03, 0xE0, 0xF4, 0xC7, 0x0E, 0x00, 0x22,
+0x94, 0x3F, 0x08, 0x00, 0x04, 0x7A, 0x00, 0x68, 0x0F, 0xA4, 0x0B, 0xE0,
+0xF9, 0x00, 0x0E, 0x00, 0xF5, 0x07, 0xEA, 0x00, 0xB1, 0x08, 0x80, 0x15,
+0x78, 0xEB, 0xAE, 0x7C, 0x03, 0xE0, 0x74, 0x15, 0x00, 0xE8, 0x80, 0xC4,
+0x6B, 0x3C, 0x7A, 0xD5, 0x22, 0x00, 0xF0, 0x04, 0xBC, 0x02, 0x24, 0xE1,
+0x08, 0x80, 0x00, 0xB3, 0x08, 0x3F, 0x0C, 0x83, 0xEB, 0xCC, 0x79, 0x00,
+0xE0, 0x2D, 0x19, 0x80, 0x00, 0xF1, 0x2A, 0x03, 0xA7, 0x83, 0x00, 0x12,
+0xA4, 0x0B, 0x2F, 0xA2, 0xA7, 0x00, 0xE2, 0x88, 0xC7, 0xFB, 0x27, 0x84,
+0x17, 0x61, 0xE0, 0x91, 0x3F, 0xA8, 0x0F, 0xA1, 0x09, 0x00, 0x38, 0x01,
+0xE2, 0x7F, 0xC4, 0x01, 0x3F, 0xEF, 0x00, 0x00, 0xE0, 0x46, 0x1F, 0x00,
+0xE0, 0xA5, 0x1E, 0x8E, 0xA7, 0x8D, 0xA6, 0xCD, 0x3F, 0x8E, 0xBF, 0x82,
+0x38, 0x00, 0xE0, 0xC6, 0x12, 0x00, 0xFA, 0x12, 0x0F, 0xA7, 0x0D, 0xA6,
+0x4C, 0x3F, 0x0F, 0xBF, 0x41, 0xE0, 0x0C, 0x3F, 0xBF, 0xA6, 0xCC, 0x3E,
+0xBF, 0xBE, 0xFF, 0xA6, 0xDE, 0x3E, 0xFF, 0xBE, 0x01, 0xE0, 0x8F, 0xA6,
+0x5D, 0x3F, 0x01, 0xE0, 0x0F, 0x2C, 0x00, 0xA1, 0xBC, 0x48, 0x3F, 0x0F,
+0xBF, 0x3F, 0xA7, 0x48, 0x3F, 0x3F, 0x18, 0x00, 0x01, 0x56, 0x00, 0x92,
+0x1F, 0x8E, 0xA6, 0x8F, 0xA7, 0x0F, 0xE3, 0xDF, 0x3E, 0x58, 0x00, 0x20,
+0x25, 0x1F, 0x30, 0x00, 0xF0, 0x49, 0x0E, 0xA4, 0x8F, 0xA7, 0xD8, 0x3F,
+0x00, 0x14, 0x28, 0xE0, 0x88, 0x3F, 0x82, 0x38, 0xFF, 0xFF, 0xB3, 0x08,
+0x0A, 0xE0, 0xC2, 0x34, 0x00, 0xE0, 0x53, 0x25, 0x22, 0x35, 0x00, 0xE0,
+0x9E, 0x18, 0x00, 0xE0, 0x11, 0x1F, 0x0C, 0xE0, 0x1A, 0x3C, 0x94, 0x15,
+0x18, 0x89, 0x88, 0x89, 0xA8, 0x8E, 0xB8, 0x8F, 0x28, 0x31, 0x43, 0x39,
+0x0D, 0xE4, 0xA0, 0x36, 0xC2, 0x3E, 0x0F, 0xE4, 0xA8, 0x37, 0xCD, 0x3F,
+0x81, 0xBF, 0x83, 0x3E, 0x8E, 0xBD, 0x8E, 0xA7, 0x00, 0xE2, 0x8F, 0xC7,
+0xFD, 0x2F, 0x84, 0x3E, 0x04, 0xC4, 0x7C, 0x3C, 0xEA, 0x01, 0xED, 0x01,
+0xF0, 0x1D, 0xFA, 0x3C, 0x8C, 0x05, 0x0A, 0xE0, 0xAA, 0x3C, 0x00, 0xE2,
+0x02, 0xCD, 0x25, 0x01, 0x00, 0xE2, 0x03, 0xCD, 0x17, 0x01, 0x00, 0xE2,
+0x01, 0xCD, 0x02, 0x01, 0xE1, 0x09, 0x8C, 0x8F, 0xFE, 0xE7, 0x00, 0x17,
+0xCE, 0x3F, 0x00, 0xE0, 0x1E, 0x1F, 0x8E, 0xBF, 0x83, 0x3E, 0x64, 0x00,
+0x46, 0x94, 0x17, 0x8E, 0xBF, 0x44, 0x00, 0xF1, 0x3C, 0xE1, 0x09, 0xAC,
+0x8F, 0x1C, 0x8F, 0x0F, 0xE4, 0xA0, 0x37, 0x28, 0x37, 0x8C, 0x8E, 0xCE,
+0x3F, 0xCD, 0x3F, 0xFE, 0xE9, 0x80, 0xCF, 0xE8, 0x00, 0x9C, 0x8F, 0x0C,
+0x8F, 0xA8, 0x37, 0xCE, 0x3F, 0xFF, 0xE9, 0xFF, 0xCF, 0xE1, 0x00, 0x68,
+0x3E, 0xCD, 0x00, 0x00, 0xE4, 0x00, 0x17, 0x18, 0x3F, 0xFF, 0xE3, 0xFF,
+0x16, 0x7D, 0x3F, 0xB4, 0x02, 0xE8, 0x3F, 0x01, 0x14, 0xAD, 0x24, 0xB3,
+0x08, 0xF0, 0xE7, 0x00, 0x16, 0x00, 0xE0, 0xA2, 0x1D, 0x00, 0xE0, 0xBE,
+0xC2, 0x00, 0xF6, 0x06, 0x00, 0xE0, 0x47, 0x1C, 0x5F, 0x3E, 0x9F, 0x3C,
+0x02, 0x15, 0x10, 0xE4, 0x00, 0x11, 0x0B, 0xBC, 0x01, 0xBE, 0x83, 0x39,
+0x0E, 0xB4, 0x00, 0x10, 0x39, 0x0A, 0x00, 0xF0, 0x1F, 0xC0, 0xC7, 0x8E,
+0x2F, 0x03, 0xE0, 0xAC, 0x3C, 0x10, 0xE2, 0x80, 0xC9, 0x8E, 0xBF, 0x8B,
+0x05, 0x03, 0xE0, 0x12, 0x3E, 0xFD, 0x39, 0x8B, 0xBF, 0x10, 0xE0, 0x00,
+0xC6, 0xE7, 0x05, 0x00, 0x14, 0xE1, 0x09, 0x82, 0x38, 0x01, 0x14, 0x8B,
+0xBF, 0xE1, 0x09, 0x00, 0x14, 0x82, 0x38, 0x78, 0x00, 0x10, 0x1A, 0x78,
+0x00, 0x50, 0x17, 0x7F, 0x3F, 0x83, 0x05, 0x12, 0x00, 0xF0, 0x13, 0xB5,
+0x08, 0x00, 0xE0, 0xC7, 0x1F, 0x00, 0xE0, 0xA2, 0x1A, 0xE8, 0x39, 0x85,
+0xBF, 0x69, 0x3A, 0x00, 0xE0, 0xBE, 0x1F, 0x6A, 0x39, 0x0F, 0xBD, 0xEA,
+0x3F, 0x00, 0xE2, 0x83, 0xC7, 0x82, 0x2F, 0x53, 0xDF, 0x8A, 0x00, 0xF0,
+0x28, 0x80, 0x17, 0x8E, 0xBF, 0x85, 0xBF, 0x16, 0x22, 0x02, 0x8F, 0x83,
+0x8F, 0x7F, 0x3F, 0x94, 0x01, 0x64, 0x3F, 0x7F, 0xC7, 0xE3, 0x3F, 0x08,
+0xE0, 0x9E, 0x39, 0x0A, 0xE0, 0x23, 0x39, 0x86, 0x00, 0x1E, 0x8F, 0x80,
+0xE0, 0x9F, 0x8E, 0xFE, 0x3E, 0x87, 0x01, 0xF8, 0x3F, 0x0E, 0xE0, 0x9A,
+0x3F, 0xF8, 0x01, 0x01, 0x14, 0xE1, 0x0A, 0x00, 0x04, 0x00, 0xF0, 0x02,
+0xE0, 0x15, 0x1C, 0x01, 0xE0, 0x08, 0x15, 0x80, 0x14, 0x3B, 0xE0, 0xB4,
+0x00, 0xB6, 0x08, 0x3F, 0x0C, 0xD8, 0x01, 0xF0, 0x25, 0x02, 0xE0, 0x1E,
+0xA1, 0x2B, 0x21, 0x80, 0x11, 0x00, 0xE0, 0x15, 0x1A, 0x90, 0x12, 0x63,
+0x3B, 0x8C, 0x00, 0x14, 0xA4, 0x81, 0x3F, 0x81, 0xC1, 0x41, 0x31, 0x2F,
+0xE1, 0xA3, 0x3A, 0x2E, 0xE1, 0x06, 0x39, 0x08, 0xC2, 0x9B, 0x27, 0x1A,
+0x27, 0xE2, 0x3F, 0x00, 0xE2, 0x81, 0xC7, 0xF4, 0x27, 0x84, 0xA7, 0xF0,
+0x2F, 0xF8, 0x01, 0xA0, 0x41, 0x31, 0x01, 0xE0, 0x5F, 0xA7, 0x81, 0x17,
+0xB3, 0x37, 0x88, 0x01, 0x86, 0x46, 0x1F, 0x81, 0xC1, 0x01, 0xE0, 0xDE,
+0xBF, 0x34, 0x00, 0x53, 0xE7, 0x2F, 0x04, 0xE0, 0x80, 0xA2, 0x02, 0xF0,
+0x2D, 0x21, 0x0B, 0x00, 0x38, 0x00, 0xE0, 0xBB, 0x1F, 0x05, 0xE0, 0x7F,
+0x8F, 0x1A, 0x27, 0x01, 0xE0, 0x4F, 0xA7, 0x2E, 0x3C, 0x03, 0xE2, 0x74,
+0xCC, 0x94, 0x05, 0x02, 0xE0, 0x5F, 0x9F, 0x04, 0x27, 0x7F, 0xC7, 0x02,
+0xE0, 0x5F, 0xB7, 0x80, 0x15, 0x00, 0xE0, 0x43, 0x1E, 0x03, 0xE0, 0x2F,
+0x9F, 0x8C, 0xA6, 0x01, 0xC7, 0x82, 0xCE, 0x8C, 0xBE, 0x05, 0xE0, 0xFF,
+0xAD, 0xF0, 0x01, 0xF0, 0x03, 0x03, 0xE0, 0x2F, 0xB7, 0x82, 0x38, 0x83,
+0x3F, 0x00, 0xE0, 0x3B, 0x1F, 0x03, 0xE0, 0x2E, 0x9C, 0x84, 0x3F, 0x7C,
+0x02, 0xF0, 0x73, 0x7E, 0x24, 0xB8, 0xA7, 0x00, 0xE0, 0xFB, 0x27, 0x28,
+0xA7, 0x00, 0xE0, 0x78, 0x27, 0x88, 0x8E, 0x00, 0xE0, 0xF5, 0x2E, 0xB3,
+0x08, 0x78, 0xC0, 0x98, 0x9E, 0xED, 0x39, 0xFF, 0xE3, 0x80, 0xC1, 0x00,
+0xE0, 0xEA, 0x29, 0x58, 0xA6, 0x00, 0xE0, 0x67, 0x26, 0x00, 0xE0, 0x3B,
+0x19, 0xE8, 0xA5, 0x01, 0xE0, 0x82, 0xBD, 0x00, 0xE0, 0xE0, 0x25, 0x18,
+0xA5, 0xC8, 0xA5, 0xD2, 0xBF, 0x82, 0x17, 0xC2, 0xB6, 0x32, 0xBD, 0x42,
+0xBF, 0xE2, 0xBD, 0x01, 0xE0, 0x62, 0xB6, 0x92, 0xBF, 0x82, 0xA9, 0x01,
+0xE0, 0xF2, 0xB1, 0x01, 0xE0, 0x92, 0xB9, 0x01, 0xE0, 0xA2, 0xB9, 0x02,
+0xE0, 0xE2, 0xB1, 0x03, 0xE0, 0xA2, 0xB1, 0x01, 0xE0, 0x7D, 0xD7, 0xE8,
+0x3D, 0xE8, 0x3E, 0x0E, 0xE0, 0xC8, 0x35, 0x01, 0xE2, 0xFF, 0xC6, 0x00,
+0xE0, 0xAB, 0x1C, 0x01, 0xE2, 0x7F, 0xC7, 0xED, 0x3F, 0x0C, 0xE0, 0x24,
+0x37, 0xFA, 0x01, 0xE0, 0x59, 0xA5, 0xCC, 0x3F, 0x00, 0xE0, 0x48, 0x1E,
+0x01, 0xE2, 0xFF, 0xC7, 0x5C, 0x3D, 0x6E, 0x02, 0xF0, 0x4B, 0x00, 0xE0,
+0x46, 0x1E, 0xCA, 0x3F, 0xD9, 0xBF, 0x01, 0x15, 0x01, 0xE0, 0x9C, 0xA7,
+0x0D, 0xE0, 0x3D, 0x35, 0x0E, 0xE0, 0x3E, 0x35, 0x4D, 0x3F, 0xCE, 0x3F,
+0x01, 0xE0, 0x9C, 0xBF, 0x62, 0x3C, 0xAC, 0xA6, 0x00, 0xE0, 0xC3, 0x1F,
+0xCE, 0x3E, 0xAC, 0xBE, 0xCC, 0xA6, 0x01, 0xE0, 0x82, 0x8C, 0x4D, 0x3F,
+0x4C, 0xBF, 0xFE, 0x16, 0x0F, 0xA7, 0x84, 0x75, 0x5D, 0x3F, 0x0F, 0xBF,
+0x01, 0xE0, 0x7F, 0x17, 0x3F, 0xBF, 0x22, 0x17, 0x9F, 0xBC, 0xFF, 0xB9,
+0x5F, 0xBF, 0x7F, 0xBD, 0x0F, 0xA7, 0x4A, 0x3F, 0x0F, 0xBF, 0xEF, 0xA7,
+0x87, 0x6F, 0x08, 0xC0, 0x36, 0x02, 0x02, 0x06, 0x00, 0x60, 0x82, 0x38,
+0xE8, 0x3F, 0x10, 0x24, 0x2C, 0x01, 0xF2, 0x05, 0xFE, 0x15, 0x8C, 0xA6,
+0x00, 0x17, 0xDB, 0x3E, 0x6E, 0x3C, 0x8C, 0xBE, 0x4F, 0xBF, 0x5F, 0xBF,
+0x01, 0xE0, 0x6F, 0xB7, 0xCA, 0x03, 0x21, 0x01, 0xE0, 0x64, 0x02, 0xF4,
+0x12, 0x17, 0x2F, 0xE0, 0x8E, 0x3C, 0x2E, 0xE0, 0x0E, 0x3D, 0xCE, 0x3F,
+0x8C, 0x2F, 0x2F, 0xE0, 0x0F, 0x3C, 0x89, 0x2F, 0x01, 0xE0, 0x88, 0xA6,
+0x01, 0xE0, 0x68, 0x9F, 0x89, 0xBE, 0x6F, 0x3C, 0x0A, 0xB7, 0x2A, 0x00,
+0xA0, 0xB4, 0x08, 0x3F, 0x0C, 0x7C, 0xC0, 0x00, 0xE0, 0xC3, 0x19, 0x30,
+0x01, 0xF0, 0x2F, 0x43, 0xA7, 0x01, 0xE0, 0xE2, 0xA7, 0x05, 0x6F, 0x80,
+0x16, 0x23, 0xA7, 0x05, 0xE0, 0xF2, 0xAE, 0x07, 0x6F, 0x05, 0x4F, 0x0F,
+0xE3, 0x5F, 0x3F, 0x86, 0x6F, 0x86, 0x4F, 0x00, 0xE2, 0xA0, 0xC7, 0xB9,
+0x27, 0x22, 0x17, 0x92, 0xA7, 0x53, 0xBF, 0x01, 0xE0, 0x92, 0x2F, 0xC2,
+0xA7, 0x01, 0xE0, 0x72, 0x9D, 0x32, 0xA4, 0x01, 0xE0, 0x82, 0xA4, 0x81,
+0x3F, 0x82, 0x17, 0x92, 0xBF, 0x24, 0x00, 0x40, 0x84, 0xC7, 0xB6, 0x2F,
+0x08, 0x00, 0xF3, 0x0C, 0x98, 0xC7, 0x00, 0xE0, 0xE8, 0x2F, 0x85, 0x4F,
+0x00, 0xE2, 0xDC, 0xC7, 0x00, 0xE0, 0xDE, 0x27, 0x85, 0x4F, 0xC3, 0xBF,
+0x80, 0x17, 0x01, 0xE0, 0xE2, 0xBF, 0x20, 0x1E, 0x02, 0x02, 0x2E, 0x00,
+0xA0, 0x83, 0x27, 0x02, 0x17, 0x53, 0xBF, 0x43, 0xA7, 0xD3, 0xA7, 0x68,
+0x00, 0x22, 0x85, 0x27, 0x1E, 0x00, 0xC0, 0x90, 0x3F, 0x04, 0xC0, 0xA8,
+0x0F, 0x21, 0x0A, 0x00, 0x38, 0x86, 0x4F, 0xD0, 0x01, 0x00, 0x26, 0x00,
+0x5F, 0xD7, 0x27, 0x92, 0xA7, 0x8A, 0x72, 0x00, 0x00, 0x20, 0x87, 0x4F,
+0x9C, 0x02, 0xF0, 0x45, 0x00, 0xE0, 0xDF, 0x27, 0x01, 0x12, 0x00, 0x17,
+0x00, 0xE0, 0xBA, 0x1D, 0x00, 0xE0, 0x39, 0x1D, 0x00, 0xE0, 0xB8, 0x1C,
+0x32, 0xA4, 0xD2, 0xA7, 0x12, 0xBA, 0x05, 0xE0, 0x62, 0xAF, 0x81, 0x3F,
+0xFF, 0xE7, 0x3D, 0x2C, 0x02, 0xE0, 0xC2, 0x9F, 0x02, 0xE0, 0x52, 0xB4,
+0x02, 0xE0, 0x62, 0xB4, 0x00, 0xE0, 0xE6, 0x27, 0x01, 0xE0, 0x92, 0xA7,
+0x02, 0xE0, 0x52, 0xB2, 0x8F, 0x8F, 0xB3, 0xBF, 0x00, 0xE0, 0xB7, 0x1F,
+0x8F, 0xA7, 0x81, 0x3F, 0x81, 0x17, 0x05, 0xE0, 0xF2, 0xAF, 0x85, 0x4F,
+0x01, 0xE0, 0x42, 0xBC, 0xB8, 0x00, 0x40, 0xFF, 0xE7, 0xA6, 0x2F, 0x0E,
+0x00, 0xF0, 0x1A, 0xE2, 0xBF, 0xFF, 0xE7, 0xA6, 0x00, 0x12, 0xA2, 0x00,
+0xE2, 0x01, 0xCA, 0x32, 0x01, 0xFF, 0xE7, 0x16, 0x2A, 0x01, 0xE0, 0xF2,
+0x9F, 0x01, 0xE0, 0x62, 0x9F, 0x7F, 0x3F, 0xFF, 0xE7, 0x8F, 0x04, 0x6F,
+0x3E, 0x01, 0xC6, 0x87, 0x4E, 0x01, 0xE0, 0x02, 0xA0, 0x00, 0xF2, 0x18,
+0xB6, 0x2F, 0xE0, 0xFE, 0xAE, 0xFF, 0xE7, 0x84, 0x00, 0x00, 0xE2, 0x81,
+0xCF, 0xFE, 0xE7, 0xF7, 0x01, 0x02, 0xE0, 0xE2, 0x9C, 0x02, 0xE0, 0x52,
+0x9F, 0xE2, 0xA7, 0x9E, 0x3C, 0xFF, 0xE3, 0xFF, 0xC4, 0x32, 0xA4, 0x02,
+0xE0, 0xE2, 0xB4, 0xC0, 0x00, 0xF0, 0x03, 0xFE, 0xE7, 0xE7, 0x00, 0x92,
+0xBF, 0x01, 0xE0, 0xF2, 0xB7, 0x02, 0xE0, 0xD2, 0xB7, 0x02, 0xE0, 0xE2,
+0xB7, 0x12, 0x00, 0x00, 0xF4, 0x00, 0x60, 0x81, 0xC7, 0xFE, 0xE7, 0xE2,
+0x2F, 0x38, 0x00, 0xC2, 0x02, 0xE0, 0xC2, 0x9E, 0xFE, 0x3E, 0x91, 0x05,
+0xEE, 0x3E, 0x81, 0xC6, 0xB6, 0x00, 0xF0, 0x01, 0xD2, 0xB6, 0x2E, 0xE0,
+0xFF, 0x8F, 0xB3, 0xBF, 0xFF, 0xE7, 0xA4, 0x00, 0x01, 0xE0, 0xA5, 0x17,
+0x0A, 0x00, 0x8A, 0x9F, 0x00, 0x05, 0xE0, 0x62, 0x8F, 0x79, 0x27, 0x04,
+0x01, 0xF2, 0x0B, 0x52, 0xA7, 0x05, 0xE0, 0xE2, 0xAF, 0x01, 0x3F, 0xFE,
+0xE7, 0x3C, 0x2C, 0x02, 0xE0, 0xE2, 0x9F, 0x02, 0xE0, 0xD2, 0x9E, 0x02,
+0xE0, 0x42, 0x9F, 0x9D, 0x3F, 0x0C, 0x01, 0x00, 0x70, 0x00, 0xF0, 0x3C,
+0x7C, 0x2F, 0x01, 0xE0, 0x25, 0x17, 0x33, 0xBF, 0xFE, 0xE7, 0xFD, 0x00,
+0xB1, 0x08, 0xEA, 0x3F, 0x69, 0x3D, 0xE8, 0x3C, 0x6F, 0x3C, 0x01, 0xE0,
+0x65, 0xDB, 0x01, 0x14, 0xE1, 0x08, 0xFF, 0xFF, 0x68, 0x3E, 0x00, 0xE2,
+0x03, 0xC6, 0x14, 0x26, 0x00, 0x16, 0xFC, 0x3C, 0x8F, 0x05, 0x9A, 0x3C,
+0x2A, 0x3C, 0x7F, 0xC6, 0x1C, 0x3D, 0xFF, 0xC4, 0x00, 0xE0, 0x01, 0xC4,
+0x0F, 0xE0, 0x1A, 0x3C, 0x80, 0xE0, 0x1A, 0x8F, 0xFA, 0x3C, 0x0F, 0xAF,
+0xFA, 0x01, 0x01, 0x7A, 0x02, 0xFF, 0x34, 0xE2, 0x83, 0xCC, 0xEC, 0x05,
+0xB2, 0x08, 0x69, 0x3E, 0x7C, 0xC6, 0x0B, 0xE0, 0x42, 0x36, 0xEA, 0x3F,
+0x84, 0xC7, 0xA2, 0x35, 0x9F, 0x3D, 0x01, 0xE0, 0x2A, 0x3C, 0xEA, 0x3F,
+0x3F, 0x89, 0xAF, 0x8E, 0x28, 0x31, 0x1F, 0x8F, 0xC2, 0x3E, 0xA8, 0x36,
+0x02, 0xE0, 0x9F, 0x38, 0x4D, 0x3F, 0x80, 0xE1, 0xCF, 0x8E, 0x28, 0x37,
+0x4D, 0x3F, 0xFF, 0x3D, 0x02, 0xBF, 0xF1, 0x01, 0xFC, 0x17, 0x5F, 0x3E,
+0x04, 0xC6, 0x68, 0x00, 0x03, 0xFD, 0x01, 0x08, 0x68, 0x00, 0xF0, 0x33,
+0x61, 0x09, 0x00, 0xE0, 0x40, 0x1D, 0x00, 0xE0, 0x90, 0x1D, 0xAA, 0x3D,
+0xCB, 0x35, 0x9C, 0x25, 0x00, 0xE0, 0xC9, 0x1C, 0x80, 0x17, 0x8A, 0x00,
+0x79, 0x3E, 0xEF, 0x3E, 0xFF, 0xC6, 0x83, 0x01, 0xDE, 0x9F, 0x9D, 0x3F,
+0x81, 0xC7, 0xFF, 0x3D, 0x8D, 0x05, 0x0E, 0xE0, 0xAB, 0x37, 0x1A, 0x3F,
+0x0E, 0xE0, 0x0D, 0x0E, 0xF8, 0x3E, 0xF1, 0x01, 0x79, 0x3E, 0xF5, 0x01,
+0x6E, 0x3C, 0x0C, 0xC4, 0x82, 0x38, 0xFC, 0x02, 0x20, 0x6B, 0x3C, 0xB8,
+0x06, 0xF0, 0x17, 0x80, 0x17, 0x2D, 0xE0, 0x8F, 0x3C, 0x2E, 0xE0, 0x0F,
+0x3D, 0xFE, 0x3E, 0x8D, 0x01, 0xB6, 0x08, 0x64, 0xC0, 0x2E, 0xE0, 0x8F,
+0x3D, 0x68, 0x39, 0x2F, 0xE1, 0x0F, 0x3E, 0x07, 0x27, 0x01, 0x14, 0x85,
+0x27, 0x1C, 0xC0, 0x61, 0x0B, 0xDC, 0x00, 0xF0, 0x2B, 0x86, 0x25, 0x00,
+0x17, 0x2E, 0xE0, 0x0E, 0x3E, 0x01, 0x14, 0x77, 0x2F, 0x6A, 0x3F, 0x00,
+0xE2, 0x03, 0xC7, 0x03, 0x27, 0x01, 0x14, 0xF1, 0x2F, 0x0E, 0xE0, 0x1C,
+0x3D, 0x80, 0x17, 0x04, 0x7F, 0xFF, 0xE3, 0x7F, 0xC7, 0x81, 0x7F, 0x02,
+0x7F, 0x11, 0x27, 0xEE, 0x3F, 0x8C, 0xC7, 0xFF, 0xE3, 0xFF, 0xC7, 0x6F,
+0x3F, 0xF0, 0xE3, 0x80, 0xC7, 0x0F, 0xE2, 0x18, 0x00, 0x60, 0x06, 0x27,
+0x10, 0xE0, 0x80, 0xC7, 0x10, 0x00, 0xF0, 0x1B, 0x81, 0x7F, 0x00, 0xE0,
+0x40, 0x1C, 0x00, 0xE0, 0x90, 0x19, 0xA8, 0x39, 0xCB, 0x31, 0x00, 0xE0,
+0xF4, 0x21, 0x80, 0x17, 0x03, 0x7E, 0x6F, 0x3B, 0x00, 0xE0, 0x49, 0x1A,
+0xEF, 0x3A, 0x6F, 0x3F, 0x01, 0x66, 0x89, 0x00, 0x00, 0xE0, 0xE3, 0x22,
+0x81, 0xC7, 0x60, 0x04, 0xF0, 0x4D, 0xF3, 0x3F, 0x6F, 0x3F, 0xBD, 0x03,
+0x2B, 0x37, 0x18, 0x3F, 0x9E, 0xA6, 0xF2, 0x3E, 0xF4, 0x01, 0x8E, 0xA6,
+0xF4, 0x3E, 0x01, 0xE0, 0x04, 0x01, 0xF1, 0x2A, 0xF3, 0x3F, 0x01, 0xE0,
+0x89, 0x03, 0x0D, 0xE0, 0xAB, 0x37, 0x98, 0x3E, 0x8D, 0xA0, 0x80, 0x16,
+0xF4, 0x38, 0x1A, 0x01, 0xEF, 0x38, 0x81, 0xC0, 0x01, 0xE2, 0xFF, 0xC0,
+0xF1, 0x39, 0x10, 0xE0, 0x80, 0xC6, 0x05, 0xE0, 0xAB, 0x30, 0x98, 0x3A,
+0xFF, 0xE3, 0xFF, 0xC6, 0x84, 0x05, 0x85, 0xA2, 0xF4, 0x3A, 0xF2, 0x01,
+0x1F, 0xE2, 0xFF, 0xCE, 0x87, 0x05, 0xFF, 0xC7, 0x01, 0xE0, 0xCB, 0x36,
+0x91, 0x3F, 0x60, 0x00, 0xC0, 0x7D, 0x3E, 0xED, 0x38, 0x61, 0xE0, 0xA6,
+0x3A, 0x81, 0xC7, 0x7D, 0x3E, 0x10, 0x00, 0xF0, 0x1D, 0x80, 0x12, 0x65,
+0xE0, 0xAE, 0x3D, 0xF3, 0x3F, 0x61, 0x3B, 0x6F, 0x3F, 0xC5, 0x04, 0x03,
+0x66, 0xA4, 0x22, 0x01, 0x67, 0x26, 0xE1, 0x16, 0x3F, 0x20, 0x2B, 0x6B,
+0x3B, 0xEA, 0x39, 0x69, 0x3A, 0x03, 0x7E, 0x90, 0xDB, 0x00, 0xE0, 0x31,
+0x1F, 0x01, 0xE0, 0xFE, 0xA7, 0xA8, 0x02, 0xF0, 0x09, 0xFC, 0x2F, 0x0F,
+0xE0, 0x46, 0x3A, 0x94, 0x2F, 0x60, 0x3C, 0x65, 0x3D, 0x84, 0x14, 0x14,
+0xC4, 0x85, 0x7F, 0x8F, 0xDC, 0x86, 0xDB, 0x00, 0x14, 0x36, 0x01, 0x00,
+0xAC, 0x00, 0xF0, 0x41, 0xFF, 0xE7, 0x1D, 0x01, 0xFF, 0xE7, 0xAB, 0x00,
+0x02, 0x14, 0xFE, 0xE7, 0xDC, 0x00, 0x84, 0x64, 0x65, 0x3C, 0x43, 0xDC,
+0x7F, 0x17, 0x81, 0x67, 0x65, 0x3D, 0x60, 0x3C, 0x05, 0x7F, 0xCB, 0x37,
+0x02, 0x67, 0x04, 0xC5, 0x88, 0x14, 0x18, 0xC4, 0x06, 0x79, 0x8F, 0x77,
+0x0E, 0x77, 0x71, 0xDC, 0x06, 0x22, 0x65, 0x3D, 0x0C, 0xC5, 0xE3, 0x3C,
+0x64, 0x3C, 0x6B, 0xDC, 0x07, 0x23, 0x63, 0x3D, 0x0C, 0xC5, 0x83, 0x64,
+0x15, 0x3D, 0x66, 0x3C, 0x64, 0xDC, 0x60, 0x3C, 0x00, 0xE0, 0xC9, 0x1F,
+0xBC, 0x01, 0x04, 0x66, 0x00, 0xF0, 0x03, 0x5C, 0xDC, 0xCD, 0x00, 0x5E,
+0x9B, 0xEE, 0x3A, 0x06, 0xE4, 0x2B, 0x33, 0x06, 0xE4, 0x40, 0x33, 0x03,
+0x66, 0x66, 0x00, 0xF0, 0x27, 0x80, 0x16, 0xFF, 0xE7, 0x98, 0x00, 0x00,
+0xE0, 0xAB, 0x1F, 0x02, 0x17, 0x2F, 0xBF, 0x01, 0xE0, 0x4F, 0xBF, 0xE8,
+0xE3, 0x04, 0x17, 0x0E, 0xA7, 0xFF, 0xE3, 0x7F, 0xCF, 0x84, 0x01, 0x17,
+0x17, 0x03, 0xE0, 0x4F, 0xBF, 0x08, 0x17, 0x06, 0xE0, 0x2F, 0xBF, 0x00,
+0x3B, 0x82, 0x38, 0x03, 0x3C, 0x82, 0x38, 0x04, 0x3C, 0x82, 0x38, 0x02,
+0x05, 0xF0, 0x47, 0x9C, 0x1F, 0x8F, 0xA7, 0x0F, 0xA4, 0x04, 0xC0, 0x82,
+0x38, 0xB1, 0x08, 0x81, 0x15, 0x07, 0xE0, 0x68, 0x15, 0x80, 0x14, 0x02,
+0x14, 0xAB, 0xD0, 0x00, 0xE0, 0xAC, 0x1F, 0x0F, 0xBC, 0xA1, 0x08, 0x02,
+0xE0, 0x93, 0x00, 0x08, 0x8F, 0x88, 0xA7, 0x00, 0xE2, 0x02, 0xC7, 0xC2,
+0x37, 0x00, 0xE2, 0xBF, 0xC7, 0x0B, 0x27, 0xFA, 0xEB, 0x00, 0x7F, 0x00,
+0xE8, 0x00, 0xC7, 0xA3, 0x37, 0x9E, 0x3F, 0x8F, 0xA7, 0x00, 0x17, 0x3F,
+0xBF, 0x82, 0x38, 0xF9, 0xEB, 0xF8, 0x7E, 0x00, 0xE8, 0x80, 0xC6, 0xA3,
+0x37, 0x9D, 0x3F, 0x8F, 0xA7, 0x12, 0x00, 0x97, 0xB2, 0x08, 0x68, 0x39,
+0xE3, 0xDF, 0x02, 0x8F, 0x82, 0x3C, 0x00, 0x11, 0x13, 0x3C, 0x00, 0x24,
+0x92, 0xA6, 0x3E, 0x00, 0xF5, 0x0A, 0x0F, 0xA7, 0x42, 0xA1, 0x00, 0xE2,
+0x82, 0xCE, 0x85, 0x17, 0x87, 0x16, 0x6F, 0xE0, 0x2D, 0x39, 0x1E, 0xB9,
+0xBE, 0xBF, 0x61, 0x09, 0xF9, 0xEB, 0x78, 0x60, 0x00, 0xF0, 0x13, 0x42,
+0xA1, 0x8F, 0xA7, 0x00, 0xE0, 0x4A, 0x1F, 0x0F, 0xB9, 0x1F, 0xBF, 0x05,
+0x17, 0x3F, 0xBF, 0x61, 0x09, 0xB2, 0x08, 0x7C, 0xC0, 0x84, 0xEB, 0x10,
+0x79, 0x00, 0xE8, 0x02, 0xC1, 0x02, 0xE0, 0xC2, 0x8F, 0x8E, 0x01, 0xF0,
+0x15, 0x87, 0x27, 0x01, 0xE0, 0x82, 0xA7, 0x84, 0x27, 0x01, 0x7C, 0x81,
+0x3F, 0x01, 0x64, 0x62, 0xA7, 0xFA, 0xEB, 0x80, 0x7F, 0x00, 0xE8, 0x80,
+0xC7, 0x23, 0x34, 0x00, 0xE2, 0x02, 0xCF, 0x98, 0x3F, 0x8F, 0xA7, 0x83,
+0x01, 0xA8, 0x00, 0x90, 0x03, 0x17, 0x2F, 0xBF, 0x04, 0xC0, 0x61, 0x09,
+0xB1, 0x0E, 0x08, 0x43, 0x14, 0xDB, 0xDF, 0x81, 0xB2, 0x07, 0x71, 0xA1,
+0x08, 0x00, 0x38, 0xBF, 0x0F, 0x82, 0x0E, 0x00, 0x75, 0xAF, 0x0F, 0x00,
+0x38, 0xB2, 0x08, 0x78, 0x64, 0x00, 0x11, 0x82, 0x62, 0x00, 0x35, 0x86,
+0x27, 0xB2, 0x60, 0x00, 0x5F, 0x12, 0xA7, 0xF9, 0xEB, 0xF8, 0x60, 0x00,
+0x02, 0x55, 0xCF, 0xA7, 0x8B, 0x6F, 0x08, 0x60, 0x00, 0x35, 0xDD, 0xDF,
+0x10, 0x14, 0x08, 0x00, 0x62, 0x00, 0xF0, 0x31, 0xB2, 0x08, 0x1C, 0x25,
+0xB8, 0x25, 0x84, 0xEB, 0x90, 0x7F, 0x00, 0xE8, 0x82, 0xC7, 0x0F, 0x8F,
+0x00, 0xE2, 0x01, 0xC7, 0x13, 0x2F, 0x0F, 0xAF, 0x0B, 0x17, 0x6F, 0x39,
+0x01, 0xE0, 0x0F, 0xAF, 0x82, 0x8F, 0xB2, 0xBC, 0x00, 0xE2, 0x82, 0xC7,
+0x8C, 0x27, 0x00, 0xE2, 0x01, 0xCC, 0x00, 0xE0, 0x43, 0x01, 0x36, 0x24,
+0x00, 0xE2, 0x02, 0xCC, 0x33, 0x01, 0x00, 0x11, 0x62, 0x3C, 0x61, 0x09,
+0x16, 0x00, 0xE1, 0x01, 0x31, 0x34, 0x01, 0x04, 0x14, 0x00, 0xF0, 0x15,
+0xF7, 0x01, 0x7A, 0xE0, 0x89, 0x17, 0x2E, 0xE1, 0x3F, 0x3D, 0x2A, 0xE1,
+0x4F, 0x3D, 0x07, 0xE4, 0x68, 0xC7, 0x2E, 0x2D, 0x42, 0xBF, 0x68, 0x3F,
+0x82, 0x8F, 0x62, 0x3C, 0x81, 0xCF, 0x82, 0xAF, 0x12, 0xBF, 0x40, 0xDF,
+0x34, 0x00, 0x04, 0x6E, 0x00, 0x40, 0x5F, 0xA7, 0x6B, 0x39, 0x70, 0x00,
+0x71, 0x5C, 0x2F, 0x02, 0xE0, 0x4F, 0x8F, 0x6F, 0x0C, 0x00, 0xF0, 0x2D,
+0x02, 0xCF, 0x02, 0xE0, 0x4F, 0xAF, 0x14, 0xC1, 0x03, 0xE0, 0xCF, 0xAD,
+0xC2, 0x00, 0x02, 0xE4, 0x77, 0xC5, 0x8A, 0x17, 0x2A, 0xE1, 0x3F, 0x3D,
+0x42, 0xBD, 0xDC, 0x00, 0x00, 0xE0, 0xCA, 0x1F, 0xC2, 0xBF, 0xD8, 0x00,
+0xFF, 0x17, 0xC2, 0xBF, 0xD5, 0x00, 0x07, 0xE4, 0x68, 0xC5, 0x01, 0xC7,
+0x2F, 0xE1, 0x3F, 0x3D, 0x9E, 0x3F, 0xC2, 0xBF, 0xCD, 0x00, 0x05, 0x24,
+0x12, 0x02, 0xB3, 0x81, 0xC7, 0x82, 0x2F, 0x82, 0x38, 0xFE, 0xE7, 0x8C,
+0x00, 0x07, 0x10, 0x00, 0xF0, 0x07, 0x83, 0x27, 0xFD, 0xE7, 0xEA, 0x00,
+0x82, 0x38, 0x3F, 0x24, 0x88, 0xA7, 0x81, 0x16, 0xDF, 0x3E, 0x00, 0x17,
+0x96, 0x26, 0x08, 0x8F, 0xFC, 0x01, 0x20, 0x02, 0xC7, 0x00, 0x02, 0x1B,
+0x11, 0x3C, 0x02, 0xF0, 0x01, 0x02, 0xE0, 0x77, 0x14, 0x0F, 0xA7, 0x00,
+0xE4, 0x0A, 0xC7, 0x2E, 0xE1, 0x38, 0x3F, 0x6E, 0x3C, 0x48, 0x02, 0x06,
+0xFC, 0x01, 0xF0, 0x0D, 0x8F, 0xA7, 0x18, 0xA6, 0x48, 0xA7, 0xAF, 0xA6,
+0x00, 0xE2, 0x02, 0xCE, 0x0F, 0xE0, 0x2D, 0x3F, 0x0D, 0x01, 0x6F, 0x3F,
+0x04, 0xE4, 0x71, 0xC7, 0x07, 0xE0, 0x68, 0x14, 0x30, 0x00, 0x51, 0x00,
+0xE4, 0x8F, 0xC7, 0x1F, 0x36, 0x00, 0x40, 0xFE, 0x3E, 0xF3, 0x05, 0xB2,
+0x00, 0x71, 0x9E, 0x3F, 0xAD, 0x3F, 0xEE, 0x00, 0x68, 0x14, 0x00, 0xF0,
+0x27, 0x61, 0xE0, 0x00, 0x3F, 0x01, 0xE0, 0x08, 0x8C, 0x81, 0x17, 0xB8,
+0x37, 0xDE, 0x3F, 0x00, 0x14, 0x28, 0xE1, 0x88, 0x3F, 0x82, 0x38, 0x00,
+0xE0, 0xB6, 0x1F, 0x24, 0xE0, 0xB4, 0x16, 0x48, 0xEB, 0x2C, 0x7F, 0xAF,
+0xBE, 0x00, 0xE8, 0x02, 0xC7, 0xAC, 0xE0, 0xE5, 0x16, 0xBF, 0xBE, 0x86,
+0xE0, 0xA1, 0x16, 0x0E, 0xA7, 0xAF, 0xBE, 0x4E, 0x08, 0xF0, 0x7F, 0x18,
+0xA7, 0x38, 0xA4, 0x08, 0xE0, 0x28, 0x3F, 0x82, 0x38, 0x80, 0x17, 0x08,
+0xE0, 0x9A, 0x0C, 0xA8, 0xBF, 0xB8, 0xBF, 0x82, 0x38, 0xB5, 0x08, 0xB8,
+0xA6, 0xA8, 0xA7, 0x18, 0xA7, 0x9D, 0x3F, 0x0C, 0xE0, 0x9A, 0x3F, 0x88,
+0xA6, 0x2F, 0xE1, 0xCE, 0x3F, 0x2C, 0xE1, 0x4E, 0x3E, 0x68, 0x39, 0x08,
+0xE0, 0x9F, 0x3E, 0x9C, 0x3E, 0x7D, 0x3C, 0x6A, 0x3A, 0x8C, 0x05, 0x03,
+0xE0, 0x2F, 0x3F, 0x63, 0x3D, 0xE9, 0x3A, 0x01, 0xE0, 0x40, 0xD8, 0x02,
+0xA4, 0x0A, 0xE0, 0x23, 0x3A, 0x09, 0xE0, 0x93, 0x3A, 0x01, 0xE0, 0x39,
+0xD8, 0x32, 0xA5, 0x14, 0x3D, 0x32, 0xBD, 0xE1, 0x0A, 0xB8, 0xA7, 0x96,
+0x27, 0x28, 0xA7, 0x98, 0xA6, 0x9E, 0x3C, 0x99, 0x3F, 0x08, 0xA7, 0x29,
+0xE1, 0xCD, 0x3C, 0x2F, 0xE1, 0xCD, 0x3F, 0x08, 0xE0, 0x19, 0x3F, 0x1F,
+0x3F, 0x7E, 0x3C, 0x85, 0x04, 0x09, 0xE0, 0xA9, 0x3E, 0x8A, 0xBC, 0x82,
+0x38, 0xA9, 0x3F, 0x8A, 0xBF, 0x82, 0x38, 0x6F, 0x3C, 0x06, 0x00, 0x80,
+0xA8, 0xA7, 0x98, 0xA6, 0x38, 0xA7, 0x99, 0x3F, 0x2A, 0x00, 0x60, 0x29,
+0x3F, 0xA8, 0xBF, 0x38, 0xBF, 0xA6, 0x01, 0x51, 0x82, 0x38, 0xBC, 0xEB,
+0xB8, 0xDA, 0x01, 0xF1, 0x00, 0x00, 0x16, 0x80, 0x16, 0x0F, 0xE0, 0x1D,
+0x0E, 0x82, 0x38, 0xB4, 0x08, 0x84, 0xEB, 0x38, 0xB4, 0x02, 0xF0, 0x05,
+0x68, 0x3A, 0xE9, 0x39, 0x18, 0x15, 0x80, 0x14, 0x62, 0x3C, 0x01, 0xE0,
+0x36, 0xD8, 0x00, 0xE0, 0xAE, 0x1F, 0x42, 0xBA, 0xEC, 0x07, 0xB3, 0xC2,
+0xA7, 0xD2, 0xB9, 0x1F, 0x3C, 0x32, 0xBC, 0x61, 0x0A, 0x84, 0x3E, 0x00,
+0x84, 0x02, 0xE0, 0x01, 0x17, 0x2F, 0xB7, 0x82, 0x38, 0x10, 0x00, 0x40,
+0x01, 0x17, 0x5F, 0xAF, 0xBC, 0x03, 0x00, 0x34, 0x00, 0x20, 0x68, 0x39,
+0x34, 0x00, 0x04, 0x1A, 0x00, 0x80, 0x3F, 0xA7, 0x72, 0x3F, 0x02, 0x05,
+0x3F, 0xB9, 0x54, 0x02, 0x04, 0x2C, 0x00, 0x46, 0x0F, 0xBF, 0x2F, 0xBF,
+0x3C, 0x00, 0x00, 0x7C, 0x04, 0x20, 0x00, 0x17, 0x42, 0x01, 0xF2, 0x0D,
+0x00, 0xE0, 0x97, 0x1F, 0x00, 0xE2, 0x83, 0xC4, 0x0F, 0xBC, 0x22, 0x35,
+0x98, 0x8F, 0x00, 0xE2, 0x0C, 0xC5, 0x01, 0xE2, 0xF0, 0xC7, 0xC9, 0x3F,
+0xCA, 0x3F, 0x98, 0xAF, 0x1E, 0x00, 0xBB, 0x0F, 0xA7, 0xAE, 0x8F, 0x01,
+0xE2, 0xFD, 0xC7, 0x82, 0xCF, 0xAE, 0x12, 0x00, 0x04, 0x10, 0x00, 0xF2,
+0x11, 0x20, 0x17, 0x8F, 0xA7, 0x1F, 0x8C, 0x58, 0x3F, 0x02, 0x27, 0x02,
+0x34, 0xAF, 0x8F, 0x01, 0x17, 0x00, 0xE2, 0x03, 0xC4, 0x08, 0xE0, 0x38,
+0x37, 0x5F, 0x3C, 0x80, 0x17, 0x28, 0xE1, 0x0F, 0x3C, 0x26, 0x00, 0xF8,
+0x0B, 0xA0, 0x16, 0x0F, 0xA7, 0x9E, 0x8F, 0xDF, 0x3E, 0x82, 0x26, 0x82,
+0x37, 0x00, 0xE2, 0x83, 0xC7, 0x3E, 0x8F, 0x01, 0x14, 0xA1, 0x37, 0x0F,
+0xE0, 0x3F, 0x34, 0xF4, 0x01, 0x0F, 0x28, 0x00, 0x01, 0x1D, 0x02, 0x28,
+0x00, 0xF0, 0x01, 0x07, 0x24, 0x00, 0xE0, 0xC5, 0x1F, 0x08, 0xA4, 0x8F,
+0xA7, 0xCF, 0xA7, 0x82, 0x3F, 0x01, 0xE0, 0x2E, 0x07, 0x04, 0x12, 0x00,
+0x40, 0xBF, 0xA7, 0x82, 0x3F, 0x0C, 0x00, 0xF0, 0x81, 0x8F, 0xA7, 0xAF,
+0xA7, 0x82, 0x3F, 0xB6, 0x08, 0x74, 0xC0, 0x80, 0x17, 0x23, 0xE0, 0x0F,
+0x3C, 0x00, 0xE0, 0x40, 0x17, 0x2F, 0xE0, 0x8F, 0x3C, 0x07, 0x77, 0xCF,
+0x39, 0x01, 0xE0, 0x00, 0x17, 0x87, 0x29, 0x69, 0x3A, 0x68, 0x39, 0xA0,
+0xDF, 0x68, 0x3B, 0x63, 0x3F, 0x04, 0x2C, 0x6E, 0x3C, 0x0C, 0xC0, 0x61,
+0x0B, 0xAC, 0xDF, 0xE8, 0x3A, 0xBE, 0xDF, 0x00, 0xE0, 0x50, 0x2C, 0x84,
+0x8F, 0x25, 0xE1, 0x83, 0x3A, 0x81, 0xC2, 0x01, 0xE0, 0x02, 0x8F, 0x00,
+0xE0, 0xD3, 0x27, 0xFE, 0x3A, 0x00, 0xE0, 0x63, 0x01, 0x01, 0xE0, 0x92,
+0x89, 0x00, 0xE0, 0xDF, 0x21, 0x01, 0xE0, 0x92, 0xA9, 0x2C, 0x15, 0x80,
+0x14, 0x64, 0x3C, 0x02, 0x7F, 0x01, 0xE0, 0x5A, 0xD7, 0x02, 0x67, 0xEE,
+0x3A, 0x02, 0xE0, 0xC2, 0x88, 0x01, 0xE0, 0x7F, 0x17, 0xDB, 0x20, 0x62,
+0x3B, 0x80, 0x11, 0x18, 0xC3, 0x01, 0x7A, 0x85, 0x00, 0x95, 0x2E, 0x81,
+0xC1, 0xF3, 0x38, 0x52, 0x05, 0x42, 0xA4, 0x0F, 0xE0, 0x01, 0x02, 0xF0,
+0x35, 0xA3, 0x31, 0x1F, 0x3C, 0x98, 0xA7, 0x01, 0xE0, 0xFF, 0x16, 0x1F,
+0xA2, 0x00, 0xE2, 0x0E, 0x7E, 0x29, 0xE0, 0x0D, 0x3A, 0xE6, 0x3D, 0x01,
+0x65, 0x2D, 0xE0, 0x05, 0x3A, 0xEC, 0x24, 0x82, 0xA4, 0xAF, 0xA7, 0x81,
+0x3F, 0x01, 0xE2, 0x06, 0xCC, 0x68, 0x3F, 0x29, 0x01, 0x66, 0x3D, 0x0B,
+0x2C, 0x00, 0xE0, 0x45, 0x1F, 0x87, 0x5C, 0x8E, 0xA7, 0x02, 0xA4, 0xBF,
+0xA7, 0x01, 0xE0, 0xB2, 0xB4, 0x81, 0x3F, 0x68, 0x3F, 0x64, 0x00, 0xF0,
+0x01, 0xD7, 0x00, 0x00, 0xE2, 0x80, 0xCA, 0x88, 0x17, 0x84, 0x12, 0x65,
+0xE0, 0xAF, 0x39, 0x84, 0x8F, 0xA2, 0x00, 0xF0, 0x00, 0xFF, 0xE7, 0xB1,
+0x2F, 0x02, 0xE0, 0xA4, 0x9E, 0xFE, 0x3A, 0x26, 0xE1, 0x8F, 0x3E, 0x0E,
+0xA8, 0x00, 0xD0, 0x8F, 0x8B, 0x27, 0x90, 0x2E, 0x01, 0xE0, 0x82, 0xAA,
+0xFF, 0xE7, 0xAA, 0x00, 0x38, 0x00, 0x60, 0x00, 0x17, 0xFF, 0xE7, 0xBA,
+0x00, 0x12, 0x00, 0xF0, 0x69, 0x01, 0xE0, 0x12, 0xAB, 0xFF, 0xE7, 0xA9,
+0x00, 0xEF, 0x39, 0xFF, 0xE7, 0x9C, 0x00, 0xB4, 0x08, 0x74, 0xC0, 0x0C,
+0x15, 0xE9, 0x39, 0x68, 0x3A, 0x80, 0x14, 0x00, 0xE2, 0x04, 0x7C, 0x01,
+0xE0, 0xF2, 0xD6, 0x00, 0xE0, 0xD9, 0x21, 0x83, 0x9F, 0x00, 0xE0, 0xD6,
+0x27, 0x01, 0xE0, 0xE3, 0x9F, 0x00, 0xE0, 0xD2, 0x27, 0x01, 0xE0, 0x83,
+0xA7, 0x00, 0xE0, 0xCE, 0x27, 0x40, 0xEA, 0x0E, 0xCC, 0x00, 0xE0, 0x9D,
+0xDB, 0x00, 0xE0, 0x48, 0x24, 0x01, 0xE0, 0xD8, 0x8F, 0x01, 0xE0, 0x48,
+0x8E, 0x01, 0xE0, 0x68, 0x8F, 0xA8, 0x37, 0x01, 0xE0, 0xF8, 0x8E, 0xCC,
+0x3F, 0x0E, 0xE4, 0x20, 0x37, 0x4F, 0x3F, 0x0F, 0xE4, 0xA8, 0x36, 0xCE,
+0x3F, 0xB6, 0x27, 0x01, 0xE0, 0x18, 0x8F, 0x01, 0xE0, 0x88, 0x8E, 0x28,
+0x37, 0x4D, 0x3F, 0x2F, 0x27, 0xD2, 0x00, 0x71, 0x03, 0xE0, 0x23, 0x8C,
+0x84, 0xEB, 0x50, 0xFC, 0x02, 0xF0, 0x0F, 0x80, 0x16, 0x0E, 0xA6, 0x01,
+0xE0, 0xE3, 0x9C, 0x01, 0xE0, 0x83, 0xA0, 0x01, 0xE0, 0x13, 0xA5, 0x01,
+0xE0, 0xA3, 0xA5, 0x02, 0xE0, 0x42, 0xAC, 0x9B, 0xEB, 0x30, 0x7F, 0xC2,
+0xB6, 0x5C, 0x04, 0x20, 0x0C, 0xA6, 0x92, 0x00, 0xF0, 0x51, 0x02, 0xE0,
+0xF2, 0xBF, 0x01, 0x79, 0x02, 0x7F, 0x83, 0x79, 0x12, 0xBA, 0xD2, 0xB4,
+0xB2, 0xB8, 0x42, 0xBD, 0x01, 0xE0, 0xB2, 0xB6, 0x02, 0xE0, 0xE2, 0xBD,
+0x01, 0x3E, 0xE8, 0x3F, 0x82, 0xBF, 0x62, 0x3C, 0x82, 0x2F, 0x00, 0x14,
+0x0C, 0xC0, 0x61, 0x0A, 0x22, 0x24, 0xB5, 0x08, 0x02, 0xE0, 0xC8, 0x8E,
+0xE8, 0x3A, 0x96, 0x26, 0x00, 0x11, 0x48, 0xA7, 0x40, 0xE0, 0x62, 0x3A,
+0x03, 0xE0, 0x23, 0x31, 0x0F, 0xE0, 0x13, 0x3F, 0x8F, 0xA7, 0x01, 0xC1,
+0x6F, 0x3C, 0x88, 0x27, 0x01, 0xE0, 0xC9, 0xD0, 0x45, 0xA7, 0x9E, 0x39,
+0x03, 0xBA, 0x02, 0xE0, 0xC5, 0x8E, 0xF2, 0x3E, 0x70, 0x02, 0x2E, 0x02,
+0xA0, 0x05, 0xA4, 0x8F, 0xA7, 0x9F, 0xA7, 0xA1, 0x0A, 0x82, 0x3F, 0x74,
+0x09, 0x00, 0xBA, 0x06, 0xF1, 0x38, 0xE9, 0x3F, 0xFF, 0xC7, 0x0D, 0x17,
+0x2F, 0xE1, 0x9E, 0x3F, 0xE9, 0x38, 0xB7, 0x2F, 0x2F, 0xE0, 0x0F, 0x3C,
+0xB4, 0x2F, 0x3F, 0x26, 0x02, 0xE0, 0xE8, 0xA7, 0x9C, 0x27, 0x00, 0xE2,
+0x02, 0xCD, 0x00, 0xE0, 0x70, 0x01, 0x00, 0xE2, 0x03, 0xCD, 0x95, 0x01,
+0x1F, 0x8F, 0xAF, 0xA7, 0x12, 0x27, 0x8F, 0xA6, 0x8D, 0x8C, 0xFB, 0x3C,
+0x27, 0x01, 0x7F, 0xC7, 0x01, 0xE2, 0x7F, 0xC7, 0x22, 0x37, 0x1F, 0x3F,
+0x86, 0x00, 0x80, 0xE0, 0x9F, 0x16, 0x00, 0xC0, 0x1C, 0x01, 0xFE, 0x3F,
+0xFA, 0x01, 0x00, 0xE2, 0x8E, 0xC8, 0xA0, 0x01, 0xC6, 0x01, 0x00, 0x34,
+0x00, 0xF0, 0x15, 0x80, 0x17, 0x90, 0x01, 0x00, 0xE2, 0x95, 0xCD, 0x01,
+0xE0, 0xFF, 0x17, 0x8B, 0x01, 0x58, 0x9F, 0xB8, 0xA6, 0x81, 0x17, 0x8C,
+0xB7, 0x80, 0x17, 0x1C, 0xB7, 0xAC, 0xBE, 0x83, 0x00, 0x01, 0xE0, 0x80,
+0x17, 0x6F, 0x3C, 0xFE, 0x06, 0xF0, 0x1F, 0x98, 0xA4, 0x9D, 0xA6, 0xEC,
+0x3D, 0x61, 0x3D, 0x04, 0xC0, 0x21, 0x09, 0x82, 0x3E, 0x8C, 0x9F, 0x0B,
+0x38, 0x00, 0xE2, 0x82, 0xC8, 0x68, 0x39, 0x00, 0xE0, 0x4D, 0x01, 0x9F,
+0x05, 0x00, 0xE2, 0x83, 0xC8, 0x00, 0xE0, 0x4F, 0x01, 0x00, 0xE2, 0x88,
+0xC8, 0x92, 0x01, 0x6B, 0x3C, 0x78, 0x03, 0x20, 0x29, 0x24, 0x7C, 0x06,
+0x80, 0x8B, 0x01, 0x01, 0x7E, 0x01, 0xE0, 0xEB, 0xD0, 0xDA, 0x00, 0x50,
+0x02, 0xA4, 0x8F, 0xA7, 0xDF, 0x5C, 0x02, 0x52, 0x66, 0xAC, 0xA7, 0xAC,
+0x27, 0x68, 0x00, 0xF0, 0x06, 0xD1, 0x00, 0x00, 0xE2, 0x81, 0xC8, 0xF8,
+0x01, 0x00, 0xE0, 0xC1, 0x1F, 0x02, 0xA5, 0x8F, 0xA7, 0x96, 0xEB, 0xF0,
+0x7C, 0x01, 0x16, 0x08, 0x32, 0xC4, 0x61, 0x3C, 0x2A, 0x00, 0xA0, 0xEB,
+0x00, 0x0F, 0x8F, 0x9F, 0xA7, 0xFF, 0xE7, 0x95, 0x00, 0x4A, 0x00, 0x20,
+0xC6, 0xD0, 0x14, 0x00, 0xF1, 0x0C, 0xE1, 0x00, 0x2A, 0xE0, 0x8A, 0x3D,
+0x05, 0x2D, 0x86, 0x17, 0x2B, 0xE0, 0x8F, 0x3D, 0xD9, 0x25, 0x01, 0xE0,
+0xB2, 0x9F, 0x9C, 0xB7, 0x93, 0x2F, 0xAC, 0xBF, 0x80, 0x56, 0x00, 0xF0,
+0x03, 0xFF, 0xE7, 0xA6, 0x00, 0x00, 0xE2, 0x01, 0xCD, 0x6D, 0x01, 0x80,
+0x17, 0x9C, 0xB7, 0xAC, 0xBF, 0xF5, 0x00, 0xEC, 0x00, 0xF0, 0x01, 0x7A,
+0x01, 0xAC, 0xA7, 0xC4, 0x00, 0x62, 0x3C, 0x18, 0xC4, 0x2C, 0xBC, 0xC1,
+0x00, 0x08, 0xA4, 0xA0, 0x05, 0xA0, 0x78, 0xC0, 0x69, 0x39, 0xE8, 0x39,
+0x80, 0x14, 0x6A, 0x3A, 0xE0, 0x01, 0xF0, 0x31, 0x06, 0x15, 0xEB, 0x3A,
+0x01, 0xE0, 0xB7, 0xD5, 0x00, 0xE2, 0x84, 0x7C, 0x62, 0x3C, 0x00, 0xE0,
+0x4E, 0xDE, 0x00, 0xE2, 0x88, 0x7C, 0x00, 0xE0, 0x59, 0xDE, 0x81, 0x67,
+0x0F, 0xE4, 0xCC, 0x37, 0x00, 0xE2, 0x86, 0xCF, 0x8E, 0x02, 0x00, 0xE0,
+0x03, 0x1F, 0x2F, 0xE0, 0xFE, 0xA7, 0x89, 0x27, 0x65, 0x3E, 0xE4, 0x3D,
+0x62, 0x3D, 0x82, 0x14, 0x63, 0x3C, 0x81, 0x3F, 0x08, 0xC0, 0xE1, 0x0A,
+0x00, 0x04, 0x00, 0x08, 0x00, 0x1D, 0xB4, 0x58, 0x00, 0x35, 0x01, 0xE0,
+0x8C, 0x56, 0x00, 0x13, 0x23, 0x56, 0x00, 0x1F, 0x2E, 0x56, 0x00, 0x04,
+0x20, 0x00, 0x16, 0x56, 0x00, 0x13, 0x83, 0x56, 0x00, 0x13, 0x61, 0x56,
+0x00, 0xE0, 0x61, 0x0A, 0xB6, 0x08, 0x50, 0xC0, 0xEA, 0x39, 0xE8, 0x3A,
+0x69, 0x3A, 0x06, 0x15, 0x22, 0x03, 0xF0, 0x39, 0x18, 0x7C, 0x6B, 0x39,
+0x01, 0xE0, 0x60, 0xD5, 0xE3, 0x3F, 0xFE, 0xC7, 0x00, 0xE2, 0x81, 0xCF,
+0x00, 0xE0, 0xD2, 0x02, 0x00, 0xE0, 0x5B, 0x21, 0x82, 0x9F, 0x00, 0xE0,
+0xD0, 0x27, 0x22, 0xA4, 0x00, 0xE0, 0x4D, 0x24, 0x92, 0x9F, 0x00, 0xE2,
+0x85, 0xCF, 0x00, 0xE0, 0xC8, 0x05, 0x00, 0xE2, 0x98, 0x7C, 0x00, 0xE0,
+0xE5, 0xDD, 0xE0, 0x3C, 0x9C, 0xC4, 0x00, 0xE0, 0xF0, 0xDD, 0x00, 0xE2,
+0x83, 0xC9, 0x00, 0xE0, 0x47, 0x01, 0x60, 0x3C, 0xFF, 0x01, 0xF0, 0x2F,
+0x14, 0x15, 0x80, 0x14, 0x20, 0xC4, 0x01, 0xE0, 0x3B, 0xD5, 0x00, 0xE0,
+0xA9, 0x1F, 0x60, 0x3D, 0xE0, 0x3C, 0xBF, 0xA7, 0x12, 0xC5, 0x94, 0xC4,
+0x65, 0x3C, 0x81, 0x3F, 0xE8, 0x39, 0x2F, 0x2C, 0x09, 0x5F, 0x8E, 0x5F,
+0xEE, 0x3E, 0xFE, 0xC6, 0xFF, 0x3E, 0x06, 0x02, 0xEE, 0x3F, 0xFD, 0xC7,
+0xFF, 0xE3, 0xFF, 0xC7, 0x8E, 0x77, 0x81, 0x16, 0x05, 0x67, 0x12, 0x9D,
+0xA2, 0xA4, 0xA6, 0x07, 0xF0, 0x23, 0xA0, 0x7D, 0x64, 0x3C, 0x90, 0x76,
+0x91, 0x77, 0x0A, 0x7F, 0x57, 0xDF, 0xE8, 0x39, 0x30, 0x24, 0x80, 0x17,
+0x82, 0xBF, 0xA2, 0xBF, 0x00, 0xE2, 0x80, 0xC9, 0x01, 0xE0, 0x86, 0x17,
+0x6F, 0xE0, 0x23, 0x39, 0xEF, 0x39, 0x63, 0x3C, 0x30, 0xC0, 0x61, 0x0B,
+0x01, 0xE0, 0x80, 0x11, 0x06, 0x21, 0x80, 0x17, 0x08, 0x00, 0x00, 0x24,
+0x00, 0x06, 0x16, 0x00, 0xF0, 0x0F, 0xFB, 0x00, 0x8E, 0x59, 0x22, 0xA4,
+0x86, 0xC1, 0xFF, 0xE3, 0xFF, 0xC1, 0xE3, 0x3C, 0x00, 0xE0, 0xBE, 0xDD,
+0xA2, 0xA4, 0x23, 0xE0, 0xF9, 0x8F, 0xF8, 0x3F, 0x00, 0xE0, 0x6F, 0x01,
+0x32, 0x00, 0x11, 0x86, 0x32, 0x00, 0xF0, 0xCB, 0xE7, 0x00, 0x89, 0x5E,
+0x85, 0x65, 0x10, 0x5E, 0x82, 0x7D, 0x83, 0x14, 0x83, 0x7E, 0x0C, 0x26,
+0xE0, 0x3E, 0xA2, 0xC6, 0x68, 0x3F, 0x80, 0xE1, 0x9D, 0x9F, 0x01, 0xC7,
+0x7E, 0x3E, 0x9F, 0x3C, 0xFF, 0xE3, 0xFF, 0xC4, 0x79, 0x02, 0x02, 0x67,
+0x8A, 0x67, 0x7F, 0x3F, 0x9E, 0x05, 0x00, 0xE2, 0x01, 0xCE, 0x00, 0xE0,
+0xFD, 0x05, 0x00, 0x13, 0x60, 0x3D, 0x60, 0x3A, 0x28, 0xC5, 0x22, 0xC2,
+0xE6, 0x3A, 0x80, 0xE1, 0x1A, 0xA4, 0x80, 0xE1, 0x94, 0x9C, 0x01, 0x7D,
+0x00, 0xE0, 0x8B, 0xDD, 0x10, 0x5E, 0x65, 0x3F, 0x01, 0xC7, 0x7C, 0x3F,
+0x18, 0x3B, 0x01, 0xE2, 0x7F, 0xC3, 0x01, 0x65, 0x00, 0xE0, 0xC1, 0x03,
+0xEE, 0x3A, 0xEE, 0x00, 0x83, 0x65, 0x1B, 0x3F, 0xFE, 0x3F, 0xE0, 0x03,
+0x11, 0x5F, 0xFE, 0xC7, 0x02, 0xC7, 0x6F, 0x3C, 0x8A, 0x7F, 0x11, 0x77,
+0x00, 0xE0, 0x6C, 0xDD, 0x89, 0x5E, 0x05, 0x66, 0x90, 0x5F, 0x02, 0x7E,
+0x83, 0x7E, 0xD6, 0x2F, 0x02, 0x66, 0x89, 0x65, 0xFC, 0x3D, 0x93, 0x04,
+0x83, 0x66, 0x6C, 0x3A, 0x1D, 0x3A, 0xF4, 0x3D, 0x8E, 0x03, 0x6F, 0x3B,
+0xFF, 0x12, 0x0E, 0xE0, 0xA1, 0x32, 0x00, 0xE2, 0xA0, 0x7F, 0x1F, 0x3F,
+0x9E, 0x9E, 0x6D, 0x3E, 0x01, 0xC6, 0x1E, 0xB6, 0x2D, 0xE0, 0x7B, 0xAB,
+0xE0, 0x3F, 0xA0, 0xC7, 0x0F, 0xE0, 0xCE, 0x0D, 0x02, 0xE0, 0xDE, 0x0D,
+0x80, 0xE1, 0x9F, 0xA5, 0x80, 0xE1, 0x92, 0xBD, 0xFF, 0xE7, 0x81, 0x00,
+0x12, 0x9D, 0x64, 0x3C, 0xE8, 0xDE, 0x80, 0x17, 0xE8, 0x39, 0xDE, 0x00,
+0xF0, 0x61, 0xFE, 0xE7, 0xE6, 0x00, 0xE5, 0x3D, 0x82, 0xC5, 0x00, 0xE2,
+0xA0, 0x7E, 0x2B, 0xE0, 0xFD, 0xA5, 0x82, 0x67, 0xFF, 0x3D, 0x86, 0x04,
+0x83, 0x66, 0x6F, 0x3D, 0x1D, 0x3D, 0xFA, 0x3D, 0xD3, 0x04, 0x00, 0xE2,
+0x82, 0xCA, 0x5B, 0x01, 0x83, 0x67, 0x02, 0x65, 0xFF, 0xC7, 0xE0, 0x3D,
+0xA0, 0xC5, 0x0D, 0xE0, 0x21, 0x37, 0x1F, 0x3D, 0x02, 0xC7, 0x2E, 0xE0,
+0x7B, 0xBD, 0x9B, 0x3E, 0x01, 0xC6, 0x01, 0x17, 0x82, 0x65, 0x10, 0x76,
+0x1D, 0xB7, 0x2F, 0xE0, 0x7B, 0xAB, 0xC7, 0x00, 0x11, 0x5F, 0x92, 0x5E,
+0x0B, 0x66, 0x02, 0x64, 0x8B, 0x7F, 0x82, 0x17, 0x12, 0x77, 0x91, 0x77,
+0x93, 0x76, 0x0A, 0x7C, 0x0C, 0x7E, 0x00, 0xE0, 0x09, 0xDD, 0x90, 0x5F,
+0x89, 0x5D, 0x81, 0xC7, 0x05, 0x67, 0xCC, 0x01, 0x80, 0x02, 0x7F, 0x83,
+0x7D, 0x90, 0x77, 0xFF, 0xE7, 0x74, 0x01, 0x20, 0x99, 0x00, 0xB8, 0x02,
+0x31, 0x06, 0x15, 0x69, 0xB4, 0x02, 0xA0, 0x80, 0x14, 0x6C, 0x39, 0xEB,
+0x39, 0x01, 0xE0, 0x30, 0xD4, 0xB8, 0x02, 0x62, 0x64, 0x3C, 0x00, 0xE0,
+0xC7, 0xDC, 0xB8, 0x02, 0xE0, 0xD2, 0xDC, 0x82, 0x9C, 0x01, 0x64, 0x63,
+0x3D, 0x7E, 0xD8, 0x00, 0xE2, 0x00, 0xCC, 0x9A, 0x01, 0x60, 0x01, 0x14,
+0x68, 0xE0, 0xAF, 0x39, 0xA4, 0x02, 0x12, 0xB2, 0x42, 0x00, 0x12, 0x39,
+0x42, 0x00, 0x44, 0x01, 0xE0, 0x11, 0xD4, 0xF6, 0x02, 0x13, 0xA8, 0x3E,
+0x00, 0x9E, 0xB3, 0xDC, 0x68, 0x3D, 0x84, 0x5C, 0x01, 0x64, 0x69, 0x3E,
+0x00, 0x49, 0x09, 0xB5, 0x08, 0x70, 0xE2, 0x02, 0x11, 0x0C, 0xE2, 0x02,
+0x26, 0xEF, 0xD3, 0xE2, 0x02, 0x51, 0xC2, 0x02, 0x00, 0xE0, 0x4B, 0xE2,
+0x02, 0x53, 0xC0, 0x27, 0x22, 0xA4, 0x3D, 0xE0, 0x02, 0xF0, 0x03, 0xB9,
+0x05, 0x00, 0xE2, 0x8C, 0x7C, 0x00, 0xE0, 0x76, 0xDC, 0x00, 0xE2, 0x90,
+0x7C, 0x00, 0xE0, 0x81, 0xDC, 0xDE, 0x02, 0x26, 0x39, 0x01, 0xD0, 0x02,
+0x33, 0x06, 0xC5, 0x88, 0xD0, 0x02, 0xF0, 0x09, 0x28, 0x2C, 0x83, 0x5F,
+0x08, 0x5F, 0xEF, 0x3E, 0xFE, 0xC6, 0xFE, 0x3E, 0x03, 0x02, 0xFD, 0xC7,
+0x88, 0x77, 0x00, 0xE2, 0x10, 0x7E, 0x82, 0x65, 0xCC, 0x02, 0x9F, 0x64,
+0x3C, 0x82, 0xC5, 0x7E, 0xDF, 0xE8, 0x39, 0x2F, 0xC2, 0x02, 0x04, 0x11,
+0x10, 0xE4, 0x03, 0x0C, 0xC2, 0x02, 0x04, 0x16, 0x00, 0x39, 0xFB, 0x00,
+0x88, 0xC2, 0x02, 0x24, 0x5D, 0xDC, 0xC2, 0x02, 0x17, 0x22, 0xC0, 0x02,
+0x71, 0xE8, 0x00, 0x88, 0x5F, 0x02, 0x64, 0x83, 0x46, 0x03, 0xF1, 0x02,
+0xEF, 0x3C, 0x83, 0x77, 0x00, 0xE0, 0x42, 0xDC, 0x88, 0x5A, 0x02, 0x62,
+0xE5, 0x3C, 0x82, 0xC4, 0x64, 0xBE, 0x02, 0xF1, 0x06, 0x00, 0xE0, 0x40,
+0xDC, 0x15, 0x3A, 0x24, 0xAC, 0x01, 0x17, 0x02, 0xB7, 0x83, 0x5F, 0x02,
+0x67, 0x92, 0xB7, 0x22, 0xBF, 0xCD, 0x28, 0x02, 0x24, 0x51, 0xDF, 0x28,
+0x02, 0xF0, 0x0A, 0xFF, 0xE7, 0xB3, 0x00, 0xB6, 0x08, 0x4C, 0xC0, 0xE8,
+0x39, 0x69, 0x3B, 0xEA, 0x3A, 0x6B, 0x39, 0x00, 0xE0, 0xB3, 0xDD, 0x01,
+0xE0, 0x6A, 0x24, 0x80, 0x5A, 0x08, 0x40, 0x39, 0x01, 0xE0, 0xAE, 0x28,
+0x06, 0x50, 0x39, 0x01, 0xE0, 0xAA, 0x2F, 0x32, 0x02, 0xF0, 0x05, 0x68,
+0x3A, 0x09, 0x01, 0x00, 0xE2, 0x83, 0xCA, 0xEF, 0x39, 0x01, 0xE0, 0x26,
+0x01, 0x63, 0x3C, 0x34, 0xC0, 0x61, 0x0B, 0x1C, 0x01, 0xC0, 0x62, 0x3D,
+0xE2, 0x3C, 0xBF, 0xA7, 0x63, 0x3C, 0x02, 0xC5, 0x88, 0xC4, 0x1C, 0x01,
+0x60, 0x73, 0x2C, 0x92, 0x9F, 0x81, 0x10, 0xF8, 0x01, 0xF0, 0xAB, 0x04,
+0xE2, 0x94, 0xCF, 0x82, 0xB0, 0x01, 0xE0, 0xCB, 0x05, 0x94, 0xA7, 0x22,
+0xA7, 0x87, 0x7F, 0xDA, 0xE0, 0xC9, 0x16, 0xA4, 0xA7, 0x85, 0xEB, 0x30,
+0x7E, 0x88, 0x7F, 0x04, 0xE0, 0x95, 0x17, 0x92, 0xB7, 0x95, 0x17, 0x8E,
+0xAF, 0x87, 0x17, 0xAE, 0xAF, 0xEE, 0x3F, 0x9E, 0xAA, 0x83, 0xC7, 0xA3,
+0x48, 0x8E, 0x76, 0x00, 0xE8, 0x02, 0xC6, 0xA2, 0x4D, 0x9E, 0x4A, 0x1F,
+0x4C, 0xA0, 0x4C, 0x21, 0x4D, 0x84, 0x78, 0x00, 0xE0, 0xED, 0x10, 0xBE,
+0xAE, 0xEF, 0xAD, 0x84, 0x65, 0x8C, 0x8E, 0xAF, 0xAA, 0x3F, 0xAC, 0xCF,
+0xAC, 0x5F, 0xAD, 0x9F, 0xA8, 0xFF, 0xAD, 0xC2, 0x26, 0x14, 0x15, 0xE3,
+0x3C, 0x00, 0xE2, 0x24, 0x7C, 0x82, 0x7F, 0x01, 0x7F, 0x03, 0x7E, 0x01,
+0xE0, 0x00, 0xD3, 0x03, 0x66, 0x01, 0x67, 0x8B, 0x16, 0x8C, 0xA9, 0x9E,
+0x3E, 0x9C, 0xA4, 0x6D, 0x3C, 0x84, 0x7E, 0x03, 0x7E, 0x00, 0xE0, 0xAB,
+0xDB, 0x03, 0x66, 0xCC, 0x9C, 0x00, 0xE0, 0xB4, 0xDB, 0x03, 0x66, 0x84,
+0x64, 0x4C, 0x9E, 0xE8, 0x3A, 0x81, 0x10, 0x66, 0x3C, 0x00, 0xE2, 0xA4,
+0x7D, 0x06, 0x15, 0x22, 0xA1, 0x92, 0x70, 0x13, 0x76, 0x8B, 0x7A, 0x21,
+0xDD, 0x68, 0x3B, 0x01, 0x67, 0x82, 0x67, 0x01, 0xE0, 0x38, 0x2C, 0x13,
+0x5E, 0x0F, 0xE0, 0xA2, 0x3A, 0x54, 0x01, 0xA0, 0x94, 0x5D, 0x9C, 0x3F,
+0x9B, 0x3F, 0x04, 0xE2, 0x95, 0xCF, 0x94, 0x01, 0xF0, 0x31, 0xFF, 0xE7,
+0x0A, 0x02, 0x92, 0x5F, 0x01, 0xE0, 0x95, 0x27, 0xE0, 0x3D, 0x01, 0x11,
+0xAC, 0xC5, 0x05, 0x7A, 0x62, 0x3A, 0x6B, 0x39, 0x80, 0xE1, 0x92, 0xA4,
+0xE0, 0x39, 0xF5, 0x3C, 0x06, 0x7F, 0xA4, 0xC1, 0x6C, 0x3D, 0x65, 0x3C,
+0x05, 0x01, 0x01, 0xE0, 0x82, 0xD2, 0x24, 0xE0, 0x73, 0x9E, 0x83, 0x9E,
+0x64, 0x3F, 0xF4, 0x3E, 0x01, 0xC7, 0x9C, 0x3A, 0x6E, 0x3A, 0x00, 0xE0,
+0xF8, 0x05, 0x2A, 0x00, 0x60, 0x2E, 0xE0, 0x73, 0x9E, 0xF5, 0x3C, 0x28,
+0x00, 0x30, 0xED, 0x01, 0xF0, 0x14, 0x07, 0x12, 0x11, 0x42, 0x01, 0xF0,
+0x35, 0xA2, 0xA1, 0x33, 0x8F, 0x00, 0xE2, 0x06, 0xCF, 0x3D, 0x01, 0xA3,
+0x05, 0x00, 0xE2, 0x07, 0xCF, 0x3C, 0x01, 0x00, 0xE2, 0x08, 0xCF, 0xB3,
+0x01, 0x85, 0xEB, 0xB4, 0x7A, 0x00, 0xE8, 0x82, 0xC2, 0x63, 0x3C, 0xE5,
+0x3C, 0xF4, 0xAF, 0x04, 0xC4, 0x00, 0xE0, 0x2A, 0xDB, 0xE5, 0x3C, 0x84,
+0xC4, 0x00, 0xE0, 0x35, 0xDB, 0xFC, 0xC2, 0xC5, 0x9F, 0x04, 0xE2, 0x82,
+0xCF, 0x99, 0x05, 0x83, 0x17, 0xF4, 0xAF, 0x80, 0x17, 0x56, 0x02, 0x00,
+0xD0, 0x01, 0x01, 0x92, 0x01, 0xF0, 0x02, 0xE2, 0x03, 0xCF, 0x94, 0x01,
+0x85, 0xEB, 0x30, 0x7F, 0x00, 0xE8, 0x02, 0xC7, 0xF8, 0xAF, 0x8E, 0xAF,
+0x6E, 0x00, 0x13, 0x81, 0x6E, 0x00, 0xF2, 0x11, 0x81, 0x10, 0x85, 0xA8,
+0xE8, 0x00, 0x01, 0xE0, 0x85, 0x11, 0xFE, 0xE7, 0xA0, 0x00, 0x8B, 0x17,
+0xF4, 0xAF, 0xE1, 0x00, 0xE8, 0xA7, 0x81, 0x3F, 0xDE, 0x00, 0xE0, 0x3C,
+0x63, 0x3C, 0xA4, 0xC4, 0x6A, 0x00, 0x22, 0xF5, 0xDA, 0xE0, 0x05, 0xF0,
+0x35, 0x00, 0xDB, 0x8E, 0x5C, 0x04, 0xE2, 0x89, 0xCC, 0x83, 0x05, 0xF4,
+0xAA, 0xCD, 0x00, 0x0F, 0xE0, 0x19, 0x3C, 0x9F, 0x8F, 0x29, 0xE0, 0x78,
+0x8F, 0x63, 0x3C, 0xA8, 0x37, 0x87, 0xC4, 0x03, 0xC4, 0x03, 0xE0, 0xCE,
+0x3F, 0x00, 0xE0, 0x5D, 0xDB, 0x73, 0x3C, 0x2C, 0x01, 0x8C, 0x17, 0xF4,
+0xAF, 0xFF, 0xE7, 0xBB, 0x00, 0x05, 0x62, 0x06, 0x67, 0x84, 0x66, 0x01,
+0x7F, 0x09, 0xE0, 0xAD, 0x3A, 0x6D, 0x3C, 0x00, 0xE0, 0xEF, 0x01, 0xF3,
+0x22, 0x4E, 0xDB, 0xE8, 0x3C, 0x65, 0x3C, 0x00, 0xE0, 0xF2, 0xDA, 0x01,
+0x67, 0x80, 0x17, 0xEE, 0xAF, 0xE6, 0x39, 0xF4, 0xAF, 0xFD, 0xE7, 0xE2,
+0x00, 0x03, 0x17, 0x3F, 0xAF, 0x84, 0x67, 0x74, 0xAF, 0x09, 0xE0, 0xAF,
+0x3A, 0x40, 0xE0, 0xA5, 0xA9, 0x6F, 0x3C, 0x40, 0xE0, 0x95, 0xA9, 0x00,
+0xE0, 0x36, 0x30, 0x00, 0xF1, 0x0C, 0xDA, 0xDA, 0xFD, 0xE7, 0xCF, 0x00,
+0x0E, 0x5D, 0xA2, 0xA4, 0x06, 0xC5, 0xFF, 0xE3, 0x7F, 0xC5, 0x66, 0x3C,
+0x84, 0xC4, 0x77, 0xDC, 0xFF, 0xE7, 0x0A, 0x24, 0x88, 0x6A, 0x00, 0xF0,
+0x17, 0x86, 0x00, 0x00, 0xE0, 0x50, 0xC4, 0xF2, 0xE7, 0xE7, 0x00, 0xB6,
+0x08, 0x7C, 0xC0, 0x68, 0x39, 0xE9, 0x39, 0x35, 0x2D, 0x01, 0xE0, 0xC8,
+0xA4, 0xE8, 0x3A, 0xB4, 0xC2, 0x8B, 0x24, 0xF5, 0x3C, 0x09, 0x01, 0x02,
+0xE0, 0x38, 0xA4, 0x9E, 0x05, 0xF0, 0x18, 0x03, 0xDC, 0x01, 0x65, 0x01,
+0xE0, 0x42, 0xBD, 0x63, 0x3F, 0x0E, 0xE0, 0x4D, 0x0D, 0xE2, 0x3F, 0xB8,
+0xC7, 0x0F, 0xE0, 0x5D, 0x0D, 0x80, 0xE1, 0x1E, 0xA5, 0x80, 0xE1, 0x1F,
+0xBD, 0x83, 0x9F, 0x00, 0xE2, 0x82, 0xCF, 0x00, 0xE0, 0x55, 0xDC, 0x02,
+0x52, 0xCF, 0x00, 0xE0, 0x43, 0x01, 0x24, 0x04, 0xF0, 0x08, 0x48, 0x01,
+0x80, 0x17, 0x03, 0xE0, 0xA2, 0xB7, 0xE2, 0x3F, 0xB4, 0xC7, 0x00, 0x17,
+0x1F, 0xB7, 0x00, 0x12, 0x01, 0xE0, 0xC2, 0xBA, 0x64, 0xC8, 0x08, 0x10,
+0x0B, 0x5A, 0x00, 0xF0, 0x57, 0x80, 0x14, 0x00, 0xE0, 0xB6, 0xDB, 0x01,
+0xE0, 0x05, 0x12, 0xE8, 0x3A, 0x75, 0x24, 0xFF, 0xEF, 0x93, 0xD7, 0xE2,
+0x3F, 0x00, 0xE0, 0xD0, 0xC7, 0x68, 0x3B, 0x6F, 0x3C, 0x81, 0x7F, 0x1B,
+0xD9, 0x13, 0x9D, 0x81, 0x67, 0x7A, 0x3C, 0xB0, 0x04, 0xA3, 0xA4, 0x6F,
+0x3C, 0x1F, 0xD9, 0x13, 0x9F, 0x80, 0x17, 0x02, 0xE0, 0x32, 0xA4, 0xE5,
+0x3C, 0x95, 0xB7, 0xB5, 0xBF, 0x05, 0xB7, 0x00, 0xE0, 0x9B, 0xDB, 0x05,
+0xE0, 0xC2, 0x8F, 0x86, 0x2F, 0x00, 0xE0, 0x8F, 0x1F, 0x8F, 0xA7, 0xAF,
+0xA7, 0x81, 0x3F, 0x66, 0x3C, 0xFF, 0xEF, 0x72, 0xD7, 0x00, 0x12, 0xCE,
+0x00, 0x93, 0x9F, 0xA3, 0x9E, 0x33, 0x9F, 0x9D, 0x3F, 0x9E, 0x3F, 0x82,
+0x00, 0x62, 0xFF, 0xE7, 0xBF, 0x00, 0x93, 0x9F, 0x0A, 0x00, 0x64, 0xBA,
+0x00, 0x93, 0x9F, 0x23, 0x9F, 0x18, 0x00, 0x22, 0xB3, 0x00, 0x54, 0x00,
+0x40, 0x00, 0xE0, 0xC4, 0xDB, 0x3E, 0x00, 0xF2, 0x11, 0x53, 0xD7, 0xFF,
+0xE7, 0xB0, 0x00, 0xB4, 0x08, 0x6C, 0xC0, 0x68, 0x3A, 0x60, 0x3C, 0xE9,
+0x39, 0x6A, 0x39, 0x80, 0x14, 0x10, 0x15, 0x08, 0xC4, 0x01, 0xE0, 0x70,
+0xD1, 0x81, 0x17, 0x01, 0x15, 0x84, 0x05, 0xF0, 0x17, 0x82, 0x77, 0x83,
+0x71, 0x03, 0x79, 0x65, 0xDF, 0x14, 0xC0, 0x61, 0x0A, 0x05, 0x24, 0x28,
+0xA4, 0x03, 0x24, 0xE9, 0xE7, 0x8C, 0x00, 0x82, 0x38, 0xB6, 0x08, 0x74,
+0xC0, 0x01, 0x17, 0x01, 0xE0, 0xC8, 0xA7, 0x05, 0xE0, 0x48, 0xAF, 0x52,
+0x01, 0x82, 0x6A, 0x3A, 0xEB, 0x3A, 0x00, 0xE0, 0xCC, 0x27, 0xA4, 0x00,
+0x10, 0xBF, 0x76, 0x09, 0xF0, 0x08, 0xE0, 0xC2, 0xA7, 0xB4, 0x27, 0x62,
+0x3F, 0x34, 0xC7, 0xFE, 0x3F, 0x9F, 0x9C, 0x19, 0x01, 0x60, 0x3D, 0x62,
+0x3C, 0x00, 0x13, 0x04, 0xC5, 0x8C, 0x01, 0x40, 0x01, 0x7B, 0xCF, 0xD8,
+0x20, 0x00, 0xF0, 0x07, 0x81, 0x64, 0x0F, 0x9F, 0x9F, 0x9E, 0x03, 0xBC,
+0x2D, 0x3F, 0x79, 0x3F, 0xA8, 0x05, 0x01, 0x17, 0x05, 0xAF, 0x69, 0x3F,
+0xFF, 0xE3, 0xE7, 0x01, 0xD1, 0x7F, 0xC7, 0x04, 0xB7, 0x91, 0x00, 0x3F,
+0x9F, 0x00, 0xE0, 0xC5, 0x24, 0xAE, 0xA2, 0x04, 0xF0, 0x0E, 0x4F, 0x9F,
+0xAD, 0x24, 0x79, 0x3F, 0xDF, 0x9E, 0x35, 0x01, 0x80, 0x16, 0x84, 0xB6,
+0x00, 0x17, 0x03, 0xBF, 0x85, 0xAE, 0x00, 0x14, 0x9F, 0x9C, 0x19, 0x3F,
+0x1F, 0xB7, 0x0C, 0x66, 0x01, 0xF0, 0x00, 0x17, 0xFA, 0xEB, 0xB4, 0x7F,
+0x00, 0xE8, 0x80, 0xC7, 0x04, 0xB7, 0x00, 0x14, 0x83, 0xBF, 0x14, 0x00,
+0x00, 0x48, 0x00, 0xC0, 0x05, 0xAB, 0x04, 0xB7, 0xEC, 0x00, 0x02, 0xE0,
+0xB2, 0xA4, 0x6F, 0x3D, 0x22, 0x06, 0x00, 0x34, 0x02, 0x60, 0x81, 0x67,
+0xFF, 0xE7, 0xAE, 0x2F, 0xC6, 0x03, 0xF0, 0x51, 0xC2, 0xBF, 0xFF, 0xE7,
+0xA9, 0x00, 0x4F, 0xA6, 0x04, 0xB7, 0x82, 0x16, 0x03, 0xBE, 0x83, 0xC6,
+0x2D, 0xE0, 0xFF, 0xA6, 0x88, 0x26, 0x81, 0x16, 0x85, 0xAE, 0xD2, 0x00,
+0x5F, 0xA6, 0x84, 0xB6, 0x6D, 0x3F, 0x03, 0xBE, 0x80, 0x16, 0x85, 0xAE,
+0xCB, 0x00, 0x3F, 0xA6, 0x04, 0xB7, 0x81, 0x16, 0x03, 0xBE, 0xEE, 0x00,
+0xB6, 0x08, 0x5C, 0xC0, 0x80, 0x17, 0x00, 0xE2, 0x01, 0xCD, 0x89, 0x77,
+0x00, 0xE0, 0xF2, 0x05, 0xE9, 0x3A, 0xE0, 0x3C, 0x68, 0x3A, 0x90, 0xC4,
+0x65, 0x3C, 0x6A, 0x3B, 0x00, 0xE0, 0x7D, 0xD9, 0x08, 0x59, 0xE6, 0x39,
+0x00, 0xE2, 0x05, 0xC9, 0xFE, 0xC1, 0xE8, 0x3F, 0x98, 0x05, 0xF1, 0x0E,
+0x39, 0x01, 0x00, 0xE2, 0x06, 0xC9, 0x00, 0xE0, 0x70, 0x01, 0x00, 0xE2,
+0x04, 0xC9, 0x01, 0xE0, 0x27, 0x01, 0x02, 0xE0, 0x54, 0x9F, 0x72, 0x3F,
+0x01, 0xE0, 0x36, 0x01, 0x14, 0x74, 0x06, 0xF1, 0x3E, 0x14, 0x7C, 0x81,
+0x7F, 0x01, 0xE0, 0xB5, 0xD0, 0x12, 0xE2, 0x00, 0xC9, 0x81, 0x67, 0x01,
+0xE0, 0x6E, 0x01, 0x00, 0xE0, 0xF0, 0x05, 0x12, 0xE2, 0x02, 0xC9, 0x01,
+0xE0, 0x38, 0x01, 0x01, 0xE0, 0xD8, 0x04, 0x12, 0xE2, 0x03, 0xC9, 0x92,
+0x01, 0x00, 0xE2, 0x85, 0xC9, 0xB9, 0x05, 0x81, 0x16, 0x04, 0xA4, 0x14,
+0xA7, 0x00, 0xE2, 0x14, 0x7E, 0xB3, 0x15, 0x8A, 0x76, 0x87, 0x7F, 0x03,
+0x15, 0x82, 0x14, 0x8B, 0x71, 0x01, 0x3F, 0x00, 0xE0, 0x6C, 0x24, 0x00,
+0x14, 0x24, 0xD6, 0x03, 0x70, 0x81, 0xC9, 0xA5, 0x05, 0xE0, 0x3C, 0x8C,
+0x00, 0x04, 0x30, 0xD9, 0x06, 0x5F, 0x90, 0x00, 0x73, 0x0F, 0xC7, 0x00,
+0xE2, 0x0F, 0xCF, 0xFC, 0x94, 0x00, 0x60, 0x02, 0xE0, 0x07, 0x01, 0x03,
+0x67, 0x16, 0x00, 0xF1, 0x0C, 0x0B, 0x6F, 0x94, 0x29, 0x06, 0x5F, 0x02,
+0xE0, 0x80, 0x16, 0x1E, 0xE2, 0x00, 0xC7, 0x2D, 0xE0, 0x0D, 0x3F, 0x00,
+0xE0, 0xE4, 0x2E, 0x10, 0xE0, 0x80, 0x16, 0x2E, 0x0C, 0x00, 0x46, 0x5E,
+0x2F, 0x01, 0xE0, 0x56, 0x00, 0xA0, 0x7A, 0x01, 0x1F, 0x8F, 0x8F, 0x8E,
+0x28, 0x37, 0x4D, 0x3F, 0x86, 0x04, 0x70, 0x00, 0xE0, 0xCF, 0x01, 0xFE,
+0xC1, 0x82, 0x58, 0x06, 0xF3, 0x09, 0xC1, 0x06, 0x5F, 0x0A, 0xE0, 0x00,
+0x16, 0xEE, 0x3E, 0x1E, 0xE2, 0x80, 0xC6, 0x2D, 0xE0, 0x8C, 0x3E, 0x88,
+0x2E, 0x16, 0xE2, 0x00, 0xC7, 0x06, 0x48, 0x00, 0x20, 0x3A, 0x27, 0x3E,
+0x00, 0xA2, 0xDB, 0x05, 0xE0, 0x3C, 0x92, 0xC4, 0x6F, 0x3C, 0xAB, 0x00,
+0x0A, 0x01, 0x20, 0x34, 0x01, 0x28, 0x01, 0xF1, 0x00, 0x01, 0xE0, 0x18,
+0x01, 0x00, 0xE2, 0x02, 0xC9, 0xFF, 0xE7, 0xA2, 0x01, 0x04, 0xA4, 0x94,
+0xDA, 0x00, 0x80, 0x95, 0x15, 0x03, 0x15, 0x8E, 0x14, 0x81, 0x3F, 0xA2,
+0x01, 0xF0, 0x11, 0xFF, 0xE7, 0x18, 0x2C, 0x8A, 0x5F, 0xFF, 0xE7, 0x95,
+0x27, 0x8B, 0x5F, 0xFF, 0xE7, 0x92, 0x27, 0xE0, 0x3C, 0x00, 0x15, 0x94,
+0xC4, 0x64, 0x3C, 0x1D, 0xDE, 0x00, 0x14, 0xFF, 0xE7, 0x8B, 0x00, 0x56,
+0x00, 0x31, 0xFF, 0xE7, 0xB0, 0x58, 0x00, 0xF2, 0x03, 0x81, 0x7F, 0x00,
+0xE0, 0xBE, 0xD8, 0x09, 0x5F, 0x81, 0x67, 0x73, 0x3F, 0xFF, 0xE7, 0xA6,
+0x02, 0x08, 0x59, 0x68, 0x01, 0xF4, 0x17, 0xFE, 0xE7, 0xCE, 0x01, 0x60,
+0x3C, 0x10, 0x15, 0x80, 0x14, 0x18, 0xC4, 0x01, 0xE0, 0x02, 0xD0, 0x00,
+0xE0, 0x4B, 0x1F, 0xE4, 0x3F, 0x8C, 0xC7, 0x00, 0x15, 0x00, 0xE2, 0x94,
+0x7C, 0x64, 0x3C, 0x05, 0x7F, 0x87, 0x7F, 0xF5, 0xDD, 0xE4, 0x00, 0x91,
+0x85, 0xC9, 0xFF, 0xE7, 0x88, 0x05, 0x5F, 0x8F, 0xCF, 0xE6, 0x00, 0x20,
+0x06, 0xC7, 0x4C, 0x00, 0xF6, 0x05, 0x00, 0x03, 0x66, 0x3D, 0x7F, 0xC5,
+0x2A, 0xE0, 0x75, 0x8F, 0x81, 0x16, 0x75, 0xC7, 0x2A, 0xE0, 0x75, 0xAF,
+0x03, 0x15, 0x84, 0x01, 0xF0, 0x01, 0xEA, 0x3C, 0x8A, 0x76, 0x8B, 0x71,
+0x87, 0x7F, 0x01, 0x3F, 0x00, 0x14, 0xFE, 0xE7, 0xC1, 0x00, 0x44, 0x00,
+0x60, 0xFE, 0xE7, 0xE6, 0x05, 0x81, 0x16, 0x20, 0x00, 0x11, 0xB2, 0x2A,
+0x00, 0x00, 0xA8, 0x01, 0x33, 0xFE, 0xE7, 0xAC, 0x1C, 0x00, 0x19, 0xD8,
+0x60, 0x00, 0x37, 0xFE, 0xE7, 0x50, 0x60, 0x00, 0x1B, 0x77, 0x60, 0x00,
+0x1B, 0xB2, 0x60, 0x00, 0xF0, 0x01, 0x91, 0x00, 0x83, 0x64, 0x89, 0x5E,
+0x01, 0x16, 0x0A, 0xE0, 0xC4, 0x34, 0x8B, 0x4D, 0xC8, 0x34, 0x28, 0x00,
+0xC0, 0x0A, 0x76, 0x00, 0xE2, 0x03, 0xC5, 0x00, 0xE2, 0x8F, 0xC4, 0x8B,
+0x76, 0x34, 0x00, 0x00, 0x2C, 0x00, 0xF1, 0x00, 0xFE, 0xE7, 0x65, 0x24,
+0x00, 0x14, 0xFD, 0xE7, 0xF9, 0x00, 0xAF, 0x8D, 0x89, 0x5E, 0x01, 0x50,
+0x00, 0x20, 0x0A, 0x75, 0x1E, 0x00, 0x82, 0x83, 0x14, 0x8B, 0x6D, 0x02,
+0x15, 0x8B, 0x76, 0x52, 0x00, 0xF3, 0x04, 0xFD, 0xE7, 0xE8, 0x00, 0xFE,
+0xE7, 0x8F, 0x21, 0xE0, 0x3C, 0x8B, 0xC4, 0xE6, 0x39, 0x00, 0xE0, 0x24,
+0xD8, 0xFB, 0x24, 0x02, 0x97, 0xFD, 0xE7, 0xF4, 0x00, 0xB2, 0x08, 0x74,
+0xC0, 0x00, 0xE6, 0x03, 0x31, 0x96, 0x27, 0x68, 0xCE, 0x03, 0xA0, 0x26,
+0x01, 0x0F, 0x9F, 0x79, 0x3F, 0xA9, 0x02, 0xEE, 0x3C, 0xCC, 0x03, 0x80,
+0xFF, 0xEF, 0x04, 0xD7, 0x01, 0xE0, 0xC2, 0xA4, 0x60, 0x04, 0x40, 0x00,
+0xE0, 0x95, 0xD9, 0x7A, 0x08, 0x40, 0xC2, 0xBF, 0x00, 0x15, 0x76, 0x03,
+0x02, 0x74, 0x03, 0x51, 0x7C, 0xD9, 0x81, 0x67, 0x89, 0xBE, 0x04, 0x20,
+0x02, 0x67, 0xC0, 0x04, 0xC0, 0x01, 0xE0, 0x42, 0xBF, 0x81, 0x3F, 0x00,
+0x14, 0x0C, 0xC0, 0x61, 0x09, 0x3A, 0x05, 0xF3, 0x04, 0xC8, 0xB7, 0x02,
+0xE0, 0x88, 0xBF, 0xE4, 0x00, 0x00, 0xE0, 0x0F, 0x1F, 0x80, 0x16, 0x0E,
+0xA7, 0x9F, 0xB6, 0xAE, 0x40, 0x04, 0x20, 0xDD, 0x27, 0x26, 0x00, 0xF3,
+0x01, 0xF1, 0x08, 0x61, 0x09, 0xFF, 0xFF, 0xB6, 0x08, 0x70, 0xC0, 0xE8,
+0x39, 0xFF, 0xEF, 0xF5, 0xD4, 0x01, 0xE0, 0xC3, 0xA7, 0x01, 0x7C, 0x87,
+0x27, 0x63, 0x8C, 0x00, 0xF7, 0x2B, 0x03, 0x01, 0x1F, 0x99, 0x25, 0x21,
+0x63, 0x3A, 0x0A, 0x11, 0x80, 0x12, 0x00, 0xE0, 0x50, 0xC2, 0x02, 0xE0,
+0xB3, 0xA4, 0x00, 0xE2, 0x08, 0x7C, 0x65, 0x3D, 0x00, 0xE0, 0x40, 0xD9,
+0x82, 0x67, 0x7F, 0xC1, 0x64, 0x3C, 0x8B, 0x2F, 0x03, 0x63, 0x86, 0x9C,
+0xFF, 0xEF, 0xB0, 0xD6, 0x02, 0xE0, 0x33, 0xA4, 0xE6, 0x3C, 0x00, 0xE0,
+0x42, 0xD9, 0x6C, 0x29, 0xAA, 0x04, 0xC3, 0x64, 0x10, 0xC0, 0x21, 0x0B,
+0xE9, 0xE7, 0xC9, 0x00, 0x8F, 0x9C, 0x63, 0xD4, 0x00, 0x60, 0x9A, 0xD6,
+0x01, 0xE0, 0xC3, 0xA4, 0x30, 0x00, 0xF0, 0x23, 0x00, 0xE0, 0x2B, 0xD9,
+0x01, 0xE0, 0x43, 0xB9, 0xCE, 0x00, 0x05, 0x24, 0xB1, 0x08, 0xBC, 0xDF,
+0x00, 0x14, 0xE1, 0x08, 0x00, 0x14, 0x82, 0x38, 0x00, 0x17, 0x2F, 0xE0,
+0x8E, 0x3C, 0x2E, 0xE0, 0x0E, 0x3D, 0xCE, 0x3F, 0x87, 0x2F, 0x2F, 0xE0,
+0x0F, 0x3C, 0x84, 0x2F, 0x28, 0xA4, 0xE4, 0xE7, 0x90, 0x00, 0x34, 0x03,
+0xF0, 0x29, 0x82, 0x38, 0xB3, 0x08, 0x68, 0xC0, 0x68, 0x39, 0xFF, 0xEF,
+0x9C, 0xD4, 0xE8, 0x39, 0x62, 0x3C, 0xA0, 0xDF, 0x05, 0xE0, 0xD2, 0x8F,
+0x86, 0x27, 0x63, 0x3C, 0xFF, 0xEF, 0x95, 0xD4, 0x18, 0xC0, 0xE1, 0x09,
+0x60, 0x3C, 0xEF, 0x3C, 0x10, 0x15, 0x0C, 0xC4, 0x82, 0x77, 0x00, 0xE0,
+0xB6, 0xDE, 0x00, 0xE0, 0x4C, 0x1F, 0xE0, 0x3F, 0x84, 0xC7, 0x7A, 0x05,
+0xA0, 0x88, 0x7C, 0x62, 0x3C, 0x02, 0x7F, 0x84, 0x7F, 0xA9, 0xDC, 0x2E,
+0x00, 0x11, 0x7E, 0x2E, 0x00, 0xF1, 0x04, 0x02, 0x24, 0xD8, 0x00, 0x82,
+0x38, 0xB4, 0x08, 0x4C, 0xC0, 0x8A, 0x17, 0x85, 0x7F, 0xE8, 0x39, 0x98,
+0x17, 0x1C, 0x3E, 0x04, 0xF0, 0x04, 0x1C, 0x7C, 0x86, 0x7F, 0x00, 0xE0,
+0x96, 0xDE, 0xB1, 0xEB, 0xD0, 0x7E, 0xAF, 0xEB, 0x56, 0x7F, 0xB7, 0xEB,
+0xBC, 0x08, 0x05, 0x50, 0xC6, 0x00, 0xE8, 0x00, 0xC7, 0x10, 0x05, 0xF3,
+0x18, 0x89, 0x7E, 0x0A, 0x7F, 0x8B, 0x7F, 0x01, 0xE0, 0x9D, 0x21, 0x93,
+0xA7, 0x01, 0xE0, 0x9A, 0x27, 0xA3, 0xA7, 0x0F, 0x9F, 0x01, 0xE0, 0x16,
+0x27, 0x01, 0xE0, 0x6F, 0x9F, 0x01, 0xE0, 0x12, 0x27, 0x01, 0xE0, 0xCF,
+0x9F, 0x01, 0xE0, 0x8E, 0xB8, 0x05, 0xF2, 0x31, 0x8F, 0xA7, 0x81, 0x3F,
+0x40, 0xEA, 0x00, 0xCC, 0x29, 0xD3, 0x01, 0xE0, 0x04, 0x24, 0xFF, 0xEF,
+0x42, 0xD4, 0x85, 0xEB, 0x3C, 0x79, 0x00, 0xE8, 0x02, 0xC1, 0x0F, 0xE4,
+0x40, 0x34, 0x68, 0x3F, 0x01, 0xE2, 0xFF, 0xC7, 0x0F, 0xE0, 0x68, 0x15,
+0x80, 0x14, 0x62, 0x3C, 0x03, 0x7F, 0x8F, 0x77, 0x00, 0xE0, 0x59, 0xDE,
+0xE2, 0x3C, 0x62, 0x3C, 0x0F, 0xE0, 0x05, 0x15, 0x00, 0xE0, 0xE0, 0xC4,
+0x3C, 0x01, 0xF0, 0x49, 0xB8, 0xD5, 0x13, 0xA7, 0x03, 0xA2, 0x12, 0xBF,
+0x62, 0x3C, 0x00, 0xE0, 0x4D, 0x1F, 0xA3, 0xA7, 0x32, 0xBF, 0x04, 0x15,
+0x00, 0xE0, 0x4E, 0x1F, 0x01, 0xE0, 0xEF, 0x98, 0x01, 0xE0, 0x3F, 0x9E,
+0x01, 0xE0, 0xAF, 0x9D, 0x72, 0xBF, 0x80, 0x14, 0x8F, 0x9E, 0x1F, 0x9F,
+0xAF, 0x9F, 0x01, 0xE0, 0x82, 0xB0, 0x82, 0x10, 0x01, 0xE0, 0xB2, 0xB5,
+0x26, 0xC4, 0x84, 0x15, 0x01, 0xE0, 0x92, 0xB0, 0x83, 0x10, 0x01, 0xE0,
+0x52, 0xB6, 0x02, 0xE0, 0x82, 0xB6, 0x02, 0xE0, 0x12, 0xB7, 0x01, 0xE0,
+0xC2, 0xB5, 0x01, 0xE0, 0xA2, 0xB0, 0x02, 0xE0, 0xEE, 0x01, 0xF2, 0x0D,
+0xA2, 0xB7, 0x02, 0xBA, 0x00, 0xE0, 0x20, 0xDE, 0xFF, 0xEF, 0xF6, 0xD3,
+0xA3, 0xA7, 0x04, 0x7C, 0x05, 0xE0, 0xCF, 0x8F, 0x02, 0xE0, 0x52, 0xB4,
+0x05, 0xE0, 0xD2, 0xAF, 0x76, 0x02, 0xF0, 0x07, 0x56, 0xD7, 0xAC, 0x17,
+0x82, 0x7F, 0xE8, 0x3C, 0x00, 0xE0, 0x9F, 0x1F, 0x00, 0xE0, 0x2A, 0x1E,
+0x00, 0xE0, 0x1D, 0x1D, 0x60, 0x3C, 0xE0, 0x04, 0xF0, 0x0D, 0x88, 0x15,
+0x14, 0xC4, 0x81, 0x7F, 0xAD, 0xD7, 0x02, 0xE0, 0x32, 0xBC, 0xE8, 0x39,
+0x18, 0x24, 0x95, 0xEB, 0xA4, 0x7F, 0x00, 0xE8, 0x82, 0xC7, 0x04, 0xE0,
+0x26, 0x17, 0x46, 0x01, 0xF0, 0x0B, 0x08, 0x79, 0x0C, 0x7F, 0x8D, 0x7F,
+0xFF, 0xEF, 0x9D, 0xD0, 0x22, 0xBC, 0x06, 0x24, 0x62, 0x3C, 0x21, 0xDF,
+0x62, 0x3C, 0x34, 0xC0, 0x61, 0x0A, 0x00, 0x14, 0x06, 0x00, 0x91, 0x22,
+0xA4, 0x7C, 0x24, 0xFF, 0xEF, 0x0F, 0xD1, 0x63, 0x14, 0x00, 0xF0, 0x43,
+0xB5, 0x08, 0x68, 0xC0, 0xE9, 0x3E, 0xFE, 0xC6, 0x00, 0xE2, 0x81, 0xCE,
+0x01, 0xE0, 0x00, 0x11, 0xBE, 0x02, 0x01, 0xE0, 0x01, 0x25, 0x05, 0x17,
+0x2E, 0xE1, 0x2B, 0x3F, 0x00, 0xE0, 0x7C, 0x2F, 0x00, 0xE2, 0x82, 0xCC,
+0x84, 0x01, 0x33, 0x26, 0x0C, 0x9F, 0x31, 0x27, 0xE9, 0x39, 0xE0, 0x3C,
+0x88, 0xC4, 0x6A, 0x3C, 0x6A, 0x39, 0x6C, 0x3A, 0x5E, 0xD6, 0x62, 0x3C,
+0xE0, 0x3C, 0x86, 0xC4, 0x04, 0xC4, 0x68, 0xD6, 0x02, 0x61, 0x00, 0xE0,
+0xCF, 0x1A, 0x0F, 0xE4, 0x48, 0x31, 0x00, 0xE2, 0x8F, 0xC7, 0x58, 0x08,
+0x82, 0xD2, 0x3A, 0x00, 0xE0, 0x69, 0x01, 0x9B, 0x05, 0x5C, 0x08, 0xF0,
+0x07, 0x5E, 0x01, 0x00, 0xE2, 0x84, 0xCF, 0x9C, 0x01, 0x00, 0xE0, 0xA0,
+0x1F, 0x8F, 0xA7, 0x9F, 0x3A, 0x00, 0xE2, 0x82, 0xC9, 0x83, 0x5C, 0x74,
+0x08, 0xF0, 0x05, 0x68, 0x3D, 0x65, 0x3C, 0xFF, 0xEF, 0x03, 0xD2, 0x00,
+0x11, 0x00, 0xE0, 0x41, 0x24, 0x62, 0x3C, 0x18, 0xC0, 0xE1, 0x0A, 0x88,
+0x08, 0x51, 0x86, 0x01, 0x00, 0xE0, 0x94, 0x2C, 0x00, 0xF0, 0x07, 0xEA,
+0x00, 0x6F, 0x3F, 0x7F, 0xC7, 0x00, 0xE2, 0x03, 0xCF, 0xE5, 0x05, 0xAF,
+0x2F, 0x82, 0x14, 0x23, 0xE0, 0x89, 0x39, 0xAB, 0x21, 0x1E, 0x00, 0xF1,
+0x09, 0x00, 0xE2, 0x0C, 0x7C, 0x8F, 0xA4, 0x34, 0xD6, 0x00, 0xE0, 0xB2,
+0x1F, 0x8F, 0xA4, 0x30, 0xD6, 0x00, 0xE0, 0x8B, 0x1F, 0x8F, 0xA4, 0x2C,
+0xD6, 0x66, 0x00, 0xF0, 0x1C, 0xA4, 0x28, 0xD6, 0x00, 0xE0, 0xD0, 0x1F,
+0x5F, 0x39, 0x15, 0x29, 0x03, 0x5D, 0x90, 0x17, 0xA5, 0x3F, 0xFA, 0x3F,
+0x00, 0xE2, 0x8C, 0x7C, 0x24, 0xA4, 0x6A, 0xE0, 0xAF, 0x3D, 0x95, 0x3C,
+0x00, 0xE0, 0x29, 0xDD, 0x03, 0x5F, 0x14, 0xB7, 0xC7, 0x00, 0x24, 0xA5,
+0x82, 0x00, 0x82, 0xB8, 0xD1, 0x17, 0x2C, 0x01, 0xE0, 0x7F, 0x11, 0x82,
+0x00, 0x00, 0x08, 0x01, 0x03, 0x8C, 0x00, 0x00, 0x54, 0x00, 0x71, 0xA7,
+0x9F, 0x3A, 0xFF, 0xE7, 0xA7, 0x00, 0x68, 0x00, 0x01, 0x0C, 0x00, 0xF0,
+0x05, 0xA1, 0x00, 0x03, 0x5F, 0x00, 0x11, 0x14, 0xB7, 0xFF, 0xE7, 0xA8,
+0x00, 0x69, 0x3F, 0x7E, 0xC7, 0x00, 0xE2, 0x01, 0xCF, 0x28, 0x03, 0xF1,
+0x02, 0x00, 0xE0, 0xEF, 0x02, 0x00, 0xE0, 0x6E, 0x25, 0x85, 0x17, 0x2F,
+0xE1, 0xAB, 0x3F, 0x00, 0xE0, 0xE9, 0x3E, 0x01, 0x00, 0xCC, 0x00, 0x90,
+0x63, 0x26, 0x8C, 0x9F, 0x00, 0xE0, 0xE0, 0x27, 0xB6, 0x6E, 0x01, 0x70,
+0x39, 0xE0, 0x3C, 0x6A, 0x3C, 0x8C, 0xC4, 0x46, 0x01, 0x20, 0xBB, 0xD5,
+0xE7, 0x01, 0xF0, 0x3D, 0xE0, 0x3C, 0x62, 0x3C, 0x8A, 0xC4, 0x04, 0xC4,
+0xC5, 0xD5, 0x00, 0xE0, 0x88, 0x1F, 0x83, 0x62, 0x0F, 0xA5, 0x0C, 0xE4,
+0xC8, 0x32, 0x68, 0x3B, 0x00, 0xE2, 0x0F, 0xC6, 0x00, 0xE0, 0x43, 0x25,
+0x00, 0xE0, 0xBC, 0x1D, 0x00, 0x11, 0x6B, 0x3F, 0x84, 0x00, 0x01, 0xC1,
+0x7A, 0x39, 0x3A, 0x01, 0x80, 0xE1, 0x9E, 0xA7, 0x8F, 0xA6, 0xFC, 0x3E,
+0xF9, 0x01, 0x9F, 0xA6, 0xF7, 0x26, 0x2F, 0xA4, 0x75, 0x24, 0x09, 0xE4,
+0xC4, 0x32, 0x81, 0x7D, 0x00, 0xE2, 0x10, 0x7D, 0x38, 0x05, 0xC0, 0x81,
+0x3E, 0x81, 0x65, 0x27, 0x24, 0x0F, 0xE0, 0xCC, 0x32, 0x06, 0x67, 0xE2,
+0x02, 0xF0, 0x07, 0xBE, 0x3F, 0x1F, 0xE2, 0xFF, 0xC2, 0x85, 0x5C, 0x9F,
+0x3A, 0x85, 0x67, 0x0E, 0xE0, 0x99, 0x3A, 0x7F, 0x3F, 0x95, 0x02, 0x04,
+0x64, 0x82, 0x01, 0xF1, 0x1C, 0x15, 0x3C, 0x1B, 0x01, 0x66, 0x3D, 0x81,
+0x7D, 0xFF, 0xEF, 0x43, 0xD1, 0x81, 0x65, 0xE8, 0x39, 0x22, 0xE0, 0x7B,
+0xA7, 0xBE, 0xA7, 0x83, 0x27, 0x2E, 0xA4, 0x81, 0x3F, 0xFF, 0xEF, 0xA9,
+0xD4, 0x84, 0x21, 0x00, 0x14, 0x18, 0xC0, 0x61, 0x0B, 0x01, 0xE0, 0x7F,
+0x08, 0x00, 0x22, 0x82, 0x38, 0x0C, 0x04, 0xF0, 0x0D, 0x24, 0xA5, 0xFF,
+0xEF, 0x20, 0xD1, 0x75, 0x24, 0x85, 0x5F, 0x00, 0x14, 0x94, 0xB7, 0xF3,
+0x00, 0x99, 0xEB, 0x50, 0x7F, 0x99, 0xEB, 0xCC, 0x7F, 0x00, 0xE8, 0x02,
+0xC7, 0x86, 0x02, 0x68, 0x0E, 0xBC, 0x8F, 0xBC, 0x82, 0x38, 0x18, 0x01,
+0x73, 0x01, 0xE0, 0x9D, 0x02, 0x01, 0xE0, 0x1C, 0x18, 0x01, 0x33, 0x01,
+0xE0, 0x97, 0x18, 0x01, 0x51, 0x01, 0xE0, 0x11, 0x26, 0x8C, 0xB2, 0x03,
+0x00, 0x8A, 0x08, 0x11, 0x69, 0x18, 0x01, 0xF2, 0x03, 0x94, 0xC4, 0x6A,
+0x3A, 0xEC, 0x39, 0x2F, 0xD5, 0xE0, 0x3C, 0x64, 0x3C, 0x92, 0xC4, 0x04,
+0xC4, 0x39, 0xD5, 0x5C, 0x00, 0x74, 0x82, 0xC7, 0x85, 0x62, 0x8F, 0xA4,
+0x0A, 0x1C, 0x01, 0xF1, 0x27, 0xC5, 0x00, 0xE0, 0xEF, 0x24, 0x99, 0xEB,
+0x50, 0x7A, 0x00, 0xE8, 0x02, 0xC2, 0x84, 0xA6, 0x80, 0x17, 0xFC, 0xC6,
+0x84, 0x00, 0xFF, 0x3C, 0x00, 0xE0, 0x64, 0x01, 0x80, 0xE0, 0x1D, 0xA7,
+0x0B, 0xE0, 0xA2, 0x37, 0x0E, 0xA6, 0x81, 0xC7, 0x7A, 0x3E, 0xF6, 0x01,
+0x1E, 0xA6, 0x74, 0x26, 0x2E, 0xA4, 0x72, 0x24, 0x09, 0xE4, 0xC0, 0x28,
+0x01, 0xF0, 0x11, 0x18, 0x7D, 0x01, 0xE2, 0xFF, 0xC4, 0x01, 0x3E, 0x81,
+0x65, 0x00, 0xE0, 0x4D, 0x24, 0x89, 0x5C, 0xFF, 0xE3, 0xFF, 0xC2, 0x87,
+0x67, 0x0E, 0xE0, 0x95, 0x3C, 0x7F, 0x3F, 0x00, 0xE0, 0xC2, 0x02, 0xC2,
+0x07, 0xF0, 0x43, 0x89, 0x67, 0x00, 0xE0, 0x47, 0x01, 0xBD, 0x27, 0x88,
+0x67, 0x00, 0xE0, 0xE3, 0x27, 0xE5, 0x3F, 0xFF, 0xC7, 0x1F, 0x3B, 0x80,
+0x16, 0x00, 0xE2, 0x18, 0x79, 0x81, 0x11, 0xA9, 0x24, 0x02, 0xA4, 0x0E,
+0xE0, 0x95, 0x3E, 0x00, 0xE2, 0x11, 0x7D, 0xE3, 0x3C, 0x1E, 0x3C, 0x81,
+0x7D, 0x82, 0x7E, 0x03, 0x7F, 0xFF, 0xEF, 0x96, 0xD0, 0x03, 0x67, 0x22,
+0xA6, 0x91, 0x4F, 0x2E, 0xE0, 0x7C, 0x8D, 0x02, 0xA4, 0x0F, 0xE3, 0xDA,
+0x3F, 0x91, 0x6F, 0xE3, 0x3C, 0x2E, 0xE0, 0x7C, 0x8E, 0x80, 0xE0, 0x96,
+0x88, 0x2E, 0x00, 0xF0, 0x0D, 0x51, 0x3E, 0xCC, 0x3F, 0x1E, 0x3C, 0x91,
+0x6F, 0xFF, 0xEF, 0x8A, 0xD0, 0x82, 0x66, 0x89, 0x5F, 0x81, 0xC6, 0xFD,
+0x3F, 0x81, 0x65, 0xD9, 0x02, 0x84, 0xA7, 0x9F, 0x3D, 0x9B, 0x01, 0x15,
+0x0B, 0x7C, 0x01, 0x40, 0x00, 0x14, 0x83, 0x00, 0x74, 0x01, 0x17, 0x24,
+0x74, 0x01, 0x00, 0x14, 0x03, 0xF0, 0x1C, 0x76, 0x01, 0x06, 0x64, 0x23,
+0xA5, 0x15, 0x3C, 0xFF, 0xEF, 0x61, 0xD0, 0x70, 0x24, 0x89, 0x5F, 0x08,
+0x67, 0x93, 0xB7, 0x6A, 0x27, 0xE9, 0x27, 0x80, 0x17, 0x82, 0x00, 0x08,
+0x67, 0xA3, 0xA6, 0x1F, 0x3F, 0x2F, 0xE0, 0x7D, 0x8E, 0x25, 0xE0, 0x7E,
+0x8F, 0x5C, 0x0A, 0x00, 0xF0, 0x04, 0xAF, 0x81, 0xC7, 0x09, 0x5F, 0x7F,
+0x3F, 0xF3, 0x02, 0x00, 0x14, 0xDB, 0x00, 0x06, 0x64, 0x66, 0x3D, 0x15,
+0x3C, 0xEC, 0x01, 0xF0, 0x02, 0x4D, 0xD0, 0x81, 0x65, 0xC8, 0x00, 0x00,
+0xE2, 0x88, 0xCC, 0x00, 0xE0, 0xC6, 0x02, 0xFA, 0xEB, 0xD4, 0x62, 0x05,
+0xF9, 0x09, 0xC7, 0x29, 0xE0, 0xFF, 0xA7, 0x82, 0x3F, 0x00, 0xE0, 0x70,
+0xC4, 0x08, 0xE0, 0x0F, 0x0E, 0x01, 0x14, 0x0A, 0xE0, 0x1F, 0x0E, 0x82,
+0x38, 0x10, 0x0E, 0x00, 0x19, 0x20, 0x0E, 0x00, 0x19, 0x30, 0x0E, 0x00,
+0x3B, 0x00, 0xE0, 0x40, 0x10, 0x00, 0x1B, 0x50, 0x10, 0x00, 0x19, 0x60,
+0x10, 0x00, 0x3A, 0x01, 0xE0, 0x00, 0x20, 0x00, 0x91, 0x14, 0x82, 0x38,
+0x81, 0x17, 0x12, 0xE0, 0x88, 0xAF, 0x6C, 0x06, 0xF0, 0x0A, 0x39, 0xFF,
+0xEF, 0x67, 0xD1, 0x80, 0x17, 0x12, 0xE0, 0x82, 0x89, 0x12, 0xE0, 0x82,
+0xAF, 0xFF, 0xEF, 0x62, 0xD1, 0x63, 0x3C, 0xE1, 0x09, 0x83, 0x24, 0x28,
+0x00, 0xF7, 0x14, 0xB4, 0x08, 0x08, 0xA2, 0xEA, 0x39, 0x68, 0x39, 0xFE,
+0xEF, 0x26, 0xDE, 0x0F, 0xE0, 0x48, 0x34, 0x94, 0xAF, 0x02, 0xE0, 0x0F,
+0x0E, 0x04, 0xAC, 0x01, 0x14, 0x03, 0xE0, 0x1F, 0x0E, 0x61, 0x0A, 0x81,
+0x17, 0x02, 0x48, 0x00, 0x91, 0x43, 0xD1, 0x80, 0x17, 0x02, 0xE0, 0x82,
+0x89, 0x02, 0x48, 0x00, 0x11, 0x3E, 0x48, 0x00, 0xF1, 0x04, 0xB2, 0x08,
+0x00, 0xE0, 0x87, 0x1F, 0x00, 0xE0, 0x51, 0x1C, 0x8F, 0xA7, 0x9F, 0xA7,
+0x81, 0x3F, 0x99, 0xEB, 0xE4, 0x62, 0x02, 0xF0, 0x15, 0x0F, 0xA7, 0x80,
+0x17, 0x22, 0xE1, 0x0F, 0x3C, 0x2F, 0xE1, 0x0F, 0x3F, 0x5F, 0x39, 0x03,
+0x29, 0x62, 0x3C, 0x61, 0x09, 0xD8, 0x8F, 0x48, 0x8D, 0xA8, 0x37, 0xE8,
+0x3C, 0x4F, 0x3D, 0x6E, 0x3C, 0x00, 0xE0, 0x0E, 0xDB, 0x14, 0x00, 0x31,
+0x99, 0xEB, 0xE8, 0x30, 0x00, 0xF4, 0x3B, 0x8F, 0xA6, 0xE0, 0xE7, 0x80,
+0x14, 0xD8, 0x3C, 0xBC, 0x26, 0x5D, 0x8D, 0xCD, 0x8F, 0x28, 0x35, 0x4F,
+0x3D, 0xED, 0x3F, 0x88, 0xC7, 0x1D, 0x3D, 0xFA, 0x3F, 0x6F, 0x3C, 0xB2,
+0x03, 0x5F, 0x8F, 0x4F, 0x8E, 0x28, 0x37, 0x4C, 0x3F, 0x2D, 0x27, 0xB1,
+0x08, 0x9F, 0x8D, 0x01, 0xE0, 0x8D, 0x88, 0x2F, 0x8E, 0xA8, 0x35, 0xBF,
+0x8E, 0xC1, 0x3D, 0x0C, 0xE4, 0x20, 0x36, 0x4B, 0x3E, 0x0D, 0xE4, 0xA8,
+0x36, 0xCC, 0x3E, 0xFD, 0x3C, 0x95, 0x01, 0x99, 0x00, 0x46, 0x09, 0x20,
+0x15, 0x27, 0x9D, 0x01, 0x3F, 0x9F, 0x8D, 0x8F, 0x28, 0x00, 0x02, 0x60,
+0xF9, 0x3E, 0x06, 0x01, 0x9E, 0x3F, 0x5A, 0x00, 0x20, 0xEA, 0x04, 0xB6,
+0x07, 0x22, 0x6E, 0x3C, 0xBA, 0x07, 0x06, 0xBC, 0x00, 0x72, 0x00, 0x14,
+0x07, 0x27, 0x99, 0xEB, 0xE0, 0x9A, 0x00, 0xD2, 0xA4, 0x82, 0x2C, 0x82,
+0x38, 0xB1, 0x08, 0xD9, 0x8F, 0x49, 0x8D, 0xA8, 0x37, 0xBC, 0x00, 0x30,
+0xB0, 0xDA, 0x01, 0xEE, 0x07, 0xF0, 0x0A, 0xE0, 0x44, 0x24, 0xE8, 0x3F,
+0x18, 0x8E, 0xAF, 0x8E, 0x08, 0x8C, 0x28, 0x36, 0x3F, 0x8F, 0x48, 0x3E,
+0x0D, 0xE4, 0xA0, 0x36, 0xCC, 0x3E, 0x0E, 0xE4, 0x80, 0x00, 0x40, 0x00,
+0xE0, 0xD2, 0x1E, 0x72, 0x02, 0x40, 0x7D, 0x3F, 0x02, 0x01, 0x40, 0x00,
+0xB0, 0x99, 0xEB, 0x68, 0x7E, 0x99, 0xEB, 0xE4, 0x7E, 0x99, 0xEB, 0x60,
+0xE0, 0x03, 0x50, 0xC6, 0x00, 0xE8, 0x82, 0xC6, 0xE8, 0x03, 0xF0, 0x09,
+0x8C, 0xBF, 0x8D, 0xBC, 0x0E, 0xBD, 0x96, 0x25, 0x02, 0xE0, 0x9B, 0x8E,
+0x02, 0xE0, 0x0B, 0x8E, 0x02, 0xE0, 0x2B, 0x8F, 0x02, 0xE0, 0xBB, 0x8F,
+0xAA, 0x00, 0xE0, 0x0E, 0xE4, 0x20, 0x37, 0x99, 0xEB, 0x5C, 0x7E, 0x4D,
+0x3F, 0x0F, 0xE4, 0xA8, 0x37, 0x36, 0x00, 0xA0, 0xCE, 0x3F, 0x8C, 0xBF,
+0x85, 0x24, 0x45, 0xDF, 0x03, 0x24, 0xBA, 0x00, 0x11, 0xA7, 0x76, 0x08,
+0x02, 0xD8, 0x02, 0xF4, 0x09, 0xFF, 0xFF, 0xB3, 0x08, 0x99, 0xEB, 0xDC,
+0x79, 0x00, 0xE8, 0x82, 0xC1, 0x83, 0xA7, 0x0F, 0x89, 0xE2, 0x3F, 0x00,
+0xE2, 0x81, 0xC7, 0x95, 0x27, 0xD6, 0x00, 0xF0, 0x03, 0x8F, 0xA5, 0xA4,
+0x25, 0x00, 0xE0, 0x07, 0x1F, 0xDB, 0x8F, 0x0E, 0xA7, 0x4B, 0x8E, 0xA8,
+0x37, 0x00, 0x15, 0xB6, 0x01, 0xA0, 0x0E, 0xA7, 0x4F, 0x3E, 0xEA, 0x3C,
+0x01, 0x3F, 0x16, 0x2C, 0x30, 0x00, 0x36, 0x82, 0xC7, 0x89, 0x30, 0x00,
+0x70, 0xA7, 0x91, 0x27, 0x11, 0xDF, 0x0F, 0x24, 0x18, 0x00, 0xF4, 0x09,
+0x84, 0xC7, 0x93, 0x2F, 0x78, 0x17, 0x83, 0xA7, 0x5E, 0x39, 0x0F, 0xA9,
+0xE1, 0x09, 0x01, 0xE2, 0x7F, 0xC1, 0x01, 0xE0, 0x00, 0xC9, 0xE7, 0x00,
+0x0A, 0x00, 0x02, 0x24, 0x00, 0x60, 0xEF, 0x27, 0x5F, 0xDF, 0x6D, 0x2C,
+0x14, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x18, 0x00, 0x02, 0x30, 0x00, 0x01,
+0x92, 0x04, 0x06, 0xC4, 0x04, 0x85, 0x11, 0x01, 0xE0, 0xA8, 0x02, 0x01,
+0xE0, 0x29, 0xC4, 0x04, 0x15, 0xA4, 0xC4, 0x04, 0x11, 0x1C, 0xC4, 0x04,
+0x11, 0x99, 0x1E, 0x07, 0x13, 0x9C, 0x1E, 0x07, 0x20, 0xCF, 0xD2, 0xD8,
+0x05, 0x64, 0x9A, 0xC4, 0x04, 0xC4, 0xD9, 0xD2, 0x2E, 0x02, 0x40, 0x87,
+0x62, 0x8F, 0xA7, 0x30, 0x02, 0xF0, 0x17, 0xD5, 0x3C, 0x01, 0xE0, 0x8A,
+0x27, 0x5F, 0x8D, 0x4F, 0x8F, 0x28, 0x35, 0x4E, 0x3D, 0x6F, 0x39, 0x08,
+0xC1, 0x1F, 0x3D, 0x7A, 0x39, 0x01, 0xE0, 0x80, 0x03, 0x52, 0x8E, 0xC2,
+0x8D, 0x0D, 0xE0, 0x28, 0x36, 0xCB, 0x3E, 0x00, 0xE0, 0xD8, 0x01, 0xF8,
+0x03, 0xF9, 0x26, 0x92, 0x88, 0x01, 0xE0, 0x0F, 0x8B, 0x8E, 0x00, 0x1D,
+0x39, 0x72, 0x3D, 0x00, 0xE0, 0xF1, 0x05, 0x1E, 0x00, 0xE0, 0xEA, 0x26,
+0x92, 0x88, 0x02, 0x8B, 0x22, 0x8F, 0xA8, 0x30, 0xB2, 0x8F, 0xC6, 0x38,
+0x72, 0x01, 0x11, 0x41, 0x6E, 0x01, 0xA0, 0xCE, 0x3F, 0xFF, 0x3C, 0xE8,
+0x01, 0x65, 0x3F, 0xFF, 0xE3, 0x34, 0x07, 0xF2, 0x15, 0x82, 0xC9, 0xEE,
+0x3F, 0x65, 0x3B, 0x0D, 0x5D, 0x07, 0xE2, 0xFF, 0xC7, 0x18, 0xE2, 0x00,
+0xC3, 0x00, 0xE0, 0x62, 0x01, 0x00, 0xE0, 0x51, 0x23, 0x08, 0xE2, 0x00,
+0xCB, 0x00, 0xE0, 0xC3, 0x01, 0x02, 0xE0, 0x92, 0x8D, 0x1C, 0x03, 0xF1,
+0x02, 0x22, 0x8E, 0x01, 0xE0, 0xB2, 0x8E, 0x02, 0xE0, 0xB2, 0x8C, 0x01,
+0xE0, 0xA2, 0x88, 0xA8, 0x35, 0xC3, 0x7C, 0x02, 0xF3, 0x34, 0xEE, 0x39,
+0xA8, 0x36, 0x4B, 0x3E, 0x09, 0xE4, 0xA8, 0x34, 0x07, 0xE2, 0xF8, 0xC1,
+0xC1, 0x3E, 0x49, 0x3E, 0x00, 0xE0, 0xD0, 0x21, 0xF8, 0xC7, 0xFF, 0xE3,
+0xFF, 0xC7, 0xEA, 0x39, 0x8F, 0x21, 0x2E, 0xE1, 0x9F, 0x3E, 0x0C, 0x27,
+0x0E, 0xE0, 0x93, 0x3F, 0x7D, 0x3F, 0x00, 0xE0, 0x51, 0x02, 0xE8, 0x3C,
+0x63, 0x3D, 0x08, 0xE0, 0x1F, 0x3E, 0x00, 0xE0, 0x7A, 0xD9, 0x00, 0x11,
+0x0F, 0x2B, 0x99, 0xEB, 0xD8, 0x9C, 0x02, 0x31, 0x09, 0x27, 0x99, 0x6A,
+0x04, 0xC0, 0x82, 0xC7, 0x0F, 0xA4, 0x63, 0x3D, 0xE5, 0x3C, 0x01, 0x3F,
+0x62, 0x3C, 0xE0, 0x04, 0x02, 0x6A, 0x07, 0x02, 0x0A, 0x00, 0x15, 0x06,
+0x0A, 0x00, 0xF0, 0x0D, 0xD2, 0x8D, 0x01, 0xE0, 0xC2, 0x89, 0x01, 0xE0,
+0x62, 0x8E, 0x01, 0xE0, 0x92, 0x8E, 0xA8, 0x35, 0x01, 0xE0, 0xF2, 0x8C,
+0x01, 0xE0, 0x82, 0x88, 0xFF, 0xE7, 0xB5, 0x00, 0xBC, 0x00, 0xF4, 0x03,
+0x22, 0x01, 0x10, 0xE2, 0x00, 0xCB, 0x01, 0xE0, 0x21, 0x01, 0x01, 0xE0,
+0x0F, 0x23, 0x80, 0x17, 0x94, 0xB7, 0x46, 0x00, 0xF2, 0x13, 0x08, 0x17,
+0x2F, 0x3F, 0x7E, 0x3D, 0xC2, 0x04, 0xEA, 0x3D, 0xF8, 0xC5, 0x9F, 0x3D,
+0xE3, 0x3F, 0xEB, 0x39, 0x1E, 0x3C, 0xFF, 0xE3, 0xFF, 0xC1, 0xFF, 0xE7,
+0xAA, 0x00, 0x0E, 0xE0, 0xAF, 0x3E, 0xEE, 0x39, 0x0E, 0x00, 0x22, 0xAC,
+0x00, 0xF0, 0x00, 0x20, 0x92, 0x8D, 0xF0, 0x00, 0x40, 0x02, 0xE0, 0x02,
+0x8C, 0x04, 0x01, 0x00, 0x00, 0x01, 0x71, 0xA8, 0x36, 0xA8, 0x35, 0xC1,
+0x3E, 0xC8, 0x00, 0x01, 0x22, 0x88, 0xC6, 0xFE, 0x00, 0xF0, 0x00, 0xFF,
+0xE3, 0xFF, 0xC6, 0x06, 0xE0, 0xCC, 0x3C, 0xFF, 0x3E, 0xCA, 0x05, 0x14,
+0x9C, 0xEA, 0x52, 0x00, 0xF0, 0x12, 0xC4, 0x24, 0xA6, 0x79, 0x3C, 0x05,
+0x7E, 0xE8, 0x3D, 0x82, 0x05, 0xEA, 0x3D, 0x03, 0xE0, 0xAF, 0x3E, 0xFF,
+0xE3, 0xFF, 0xC5, 0xF3, 0x3D, 0xF8, 0xE7, 0x80, 0x14, 0x63, 0xE0, 0x2B,
+0x3D, 0xE3, 0x3D, 0x10, 0x00, 0xF0, 0x35, 0x94, 0xB5, 0xD5, 0x3C, 0x00,
+0xE2, 0x20, 0x7C, 0x03, 0x7F, 0x82, 0x7D, 0x81, 0x7F, 0x84, 0x7E, 0xDE,
+0xD1, 0x84, 0x66, 0xED, 0x3C, 0xE8, 0xD1, 0xF2, 0x8E, 0xE2, 0x8C, 0xA8,
+0x36, 0xCD, 0x3C, 0xE3, 0xD1, 0x03, 0x67, 0x81, 0x67, 0x07, 0xE2, 0x78,
+0xC7, 0x82, 0x65, 0x1C, 0x2F, 0x08, 0x12, 0x63, 0x3D, 0xFF, 0xE3, 0x7F,
+0xC5, 0x02, 0xE0, 0x2F, 0x3A, 0x72, 0x3D, 0x00, 0xE2, 0xA0, 0x7C, 0x9F,
+0x3C, 0x05, 0x64, 0xD2, 0x01, 0xF0, 0x07, 0x99, 0x04, 0x62, 0x3D, 0x81,
+0x7F, 0x82, 0x7D, 0x00, 0xE0, 0xD0, 0xD8, 0x81, 0x67, 0x82, 0x65, 0xF8,
+0xC7, 0x9F, 0x3D, 0x85, 0x67, 0x5E, 0x00, 0xE0, 0x92, 0x3F, 0x85, 0x7F,
+0xE4, 0x3F, 0xFF, 0xE7, 0x83, 0x25, 0xEF, 0x3C, 0xF8, 0xC4, 0x94, 0x00,
+0xF0, 0x01, 0x05, 0x64, 0x6B, 0x3D, 0x96, 0x3C, 0x00, 0xE0, 0xBB, 0xD8,
+0x00, 0x11, 0xFE, 0xE7, 0xF8, 0x00, 0x3E, 0x01, 0x02, 0x4E, 0x01, 0x60,
+0x82, 0x88, 0x01, 0xE0, 0x42, 0x8C, 0x52, 0x01, 0x00, 0xE0, 0x00, 0x00,
+0x50, 0x01, 0x42, 0xFF, 0xE7, 0x8E, 0x00, 0x4E, 0x02, 0x40, 0xF4, 0xC6,
+0x62, 0x3B, 0xE2, 0x00, 0xF0, 0x31, 0x14, 0xC3, 0xFF, 0xE7, 0x90, 0x00,
+0xB4, 0x24, 0x00, 0xE2, 0x81, 0xCC, 0xAF, 0x01, 0xB4, 0x08, 0x00, 0xE0,
+0x2B, 0x1A, 0x00, 0xE0, 0xAE, 0x1F, 0x00, 0xE0, 0x53, 0x1F, 0x02, 0xE0,
+0xC4, 0xA1, 0x8F, 0xA7, 0x69, 0x39, 0xDE, 0x39, 0x81, 0x3F, 0x00, 0xE0,
+0x31, 0x1E, 0x08, 0xE0, 0x83, 0xC9, 0x02, 0xE0, 0xC4, 0xB9, 0x99, 0xEB,
+0xEC, 0x7E, 0x01, 0xE0, 0xFC, 0xA7, 0x00, 0xE0, 0xD4, 0x1D, 0x1C, 0x04,
+0xF0, 0x05, 0xDB, 0x3F, 0x00, 0xE8, 0x84, 0xCF, 0x01, 0xE0, 0xFC, 0xBF,
+0x99, 0xEB, 0x70, 0x7F, 0x06, 0xE0, 0xA4, 0xA7, 0x7C, 0x16, 0x30, 0x04,
+0xF0, 0x00, 0x0D, 0xBC, 0xDC, 0x3F, 0x02, 0x14, 0x0E, 0xB9, 0x06, 0xE0,
+0xA4, 0xBF, 0x61, 0x0A, 0x03, 0xD2, 0x06, 0x90, 0xE0, 0xAB, 0x1F, 0xFC,
+0x16, 0x02, 0xE0, 0x4F, 0xA7, 0x50, 0x00, 0xD5, 0x5D, 0x3F, 0x02, 0xE0,
+0x4F, 0xBF, 0x99, 0xEB, 0xF0, 0x7E, 0x01, 0xE0, 0x7C, 0x4E, 0x00, 0xF0,
+0x31, 0x5B, 0x3F, 0x01, 0xE0, 0x7C, 0xBF, 0x69, 0x3C, 0x06, 0xE0, 0x2F,
+0xA7, 0x8D, 0xBC, 0x03, 0xCF, 0x06, 0xE0, 0x2F, 0xBF, 0x82, 0x38, 0x80,
+0x17, 0x2F, 0xE0, 0x0F, 0x3C, 0x00, 0xE0, 0xF2, 0x2F, 0x2E, 0xE0, 0x8F,
+0x3C, 0x00, 0xE0, 0x6E, 0x2F, 0x01, 0xE0, 0x99, 0xA6, 0x01, 0xE0, 0x09,
+0xA6, 0x00, 0xE0, 0xB1, 0x1F, 0xB8, 0xBE, 0x89, 0xA6, 0x18, 0xBF, 0x28,
+0xBE, 0x29, 0xA7, 0xFF, 0xBE, 0x16, 0x00, 0xF0, 0x2D, 0x0F, 0xBF, 0x39,
+0xA7, 0x01, 0xE0, 0x9F, 0xBE, 0xC9, 0xA6, 0x01, 0xE0, 0x2F, 0xBF, 0x03,
+0xE0, 0x09, 0x8F, 0x01, 0xE0, 0xBF, 0xBE, 0xD9, 0xA6, 0x01, 0xE0, 0xCF,
+0xBE, 0x01, 0xE0, 0xA9, 0xA6, 0x20, 0x2F, 0x94, 0x26, 0x05, 0xE0, 0x59,
+0x8F, 0x05, 0xE0, 0x49, 0x8E, 0x7E, 0x3E, 0x00, 0xE0, 0xC7, 0x05, 0x2E,
+0xE0, 0x7D, 0x8F, 0x00, 0xE0, 0x55, 0x1E, 0xEF, 0xA6, 0x58, 0x03, 0xF1,
+0x20, 0x00, 0xEA, 0x1F, 0xC7, 0xDC, 0x3E, 0x4D, 0x3F, 0x6F, 0xBF, 0x01,
+0xE0, 0xFF, 0xA6, 0x00, 0xE0, 0x56, 0x1E, 0x01, 0x17, 0x08, 0xBF, 0xCC,
+0x3E, 0x01, 0xE0, 0xFF, 0xBE, 0x6E, 0x3C, 0x82, 0x38, 0x03, 0xE0, 0x39,
+0x8F, 0x00, 0xE0, 0xD7, 0x1D, 0x79, 0xA6, 0x42, 0x37, 0x7F, 0xC7, 0x5B,
+0x48, 0x05, 0xF4, 0x01, 0x4C, 0x3F, 0x01, 0xE0, 0x5F, 0xBF, 0x81, 0x15,
+0x03, 0xE0, 0x29, 0x8F, 0xDE, 0x3D, 0x9F, 0x2D, 0x14, 0x00, 0x37, 0x6F,
+0xBF, 0x93, 0x6C, 0x00, 0x1F, 0x91, 0x6A, 0x00, 0x0A, 0xF0, 0x01, 0x88,
+0xCE, 0xCA, 0x00, 0x04, 0x14, 0x82, 0x38, 0x01, 0xC7, 0x01, 0xE2, 0x7F,
+0xC7, 0xDF, 0x00, 0xD7, 0x01, 0x60, 0x03, 0x24, 0x08, 0xA4, 0x82, 0x38,
+0x12, 0x00, 0x33, 0x99, 0xEB, 0xF4, 0xEC, 0x04, 0xF0, 0x29, 0x00, 0xE0,
+0x31, 0x1F, 0x1F, 0xA6, 0x01, 0xE0, 0xFE, 0xA6, 0x01, 0x15, 0x01, 0xE0,
+0xFE, 0xBE, 0x80, 0x15, 0x1C, 0x3D, 0xAF, 0xA6, 0x8F, 0xBD, 0x1F, 0xBD,
+0x8C, 0x26, 0xB1, 0x08, 0x7E, 0xA7, 0x00, 0xE0, 0x58, 0x1D, 0x3F, 0xA4,
+0x2C, 0xE0, 0xFE, 0xA4, 0x81, 0x3E, 0xA1, 0x08, 0xDF, 0xE7, 0xBF, 0x00,
+0xDF, 0xE7, 0xBD, 0x00, 0xFF, 0xFF, 0x38, 0x00, 0xF4, 0x39, 0x88, 0xA5,
+0x98, 0xA7, 0x8E, 0xBD, 0xA8, 0xA5, 0x9E, 0xBF, 0xB8, 0xA7, 0xAE, 0xBD,
+0xC8, 0xA5, 0x01, 0xE0, 0xA8, 0x9E, 0xEE, 0xBF, 0x00, 0xEA, 0x8C, 0xCF,
+0xDE, 0xBD, 0x01, 0xE0, 0x7E, 0xA6, 0xCC, 0x3F, 0x01, 0xE0, 0xFE, 0xBF,
+0x80, 0x17, 0x0F, 0xE0, 0xFE, 0xBF, 0x8C, 0x26, 0xE8, 0xA7, 0xA2, 0x36,
+0xFC, 0xC7, 0x0D, 0xE0, 0x9F, 0x3E, 0x80, 0xE0, 0x9F, 0xA5, 0xFD, 0x3F,
+0x10, 0xE0, 0x8E, 0xBD, 0xFB, 0x01, 0x01, 0xE0, 0x7E, 0xBE, 0x90, 0x01,
+0xE0, 0x92, 0x2F, 0x2F, 0xE0, 0x8F, 0x3C, 0x8F, 0x2F, 0xB2, 0x08, 0x99,
+0xEB, 0xF4, 0x7E, 0xBE, 0x01, 0xF0, 0x03, 0x69, 0x39, 0x10, 0x15, 0xEF,
+0x3C, 0x0D, 0xBC, 0xAD, 0xD7, 0x62, 0x3C, 0xC7, 0xDF, 0x01, 0x14, 0x61,
+0x09, 0xF2, 0x05, 0x20, 0x08, 0xA7, 0xA6, 0x01, 0xF0, 0x03, 0x0F, 0xBF,
+0x18, 0xA7, 0x1F, 0xBF, 0x28, 0xA7, 0x2F, 0xBF, 0x38, 0xA7, 0x48, 0xA4,
+0x6F, 0xBF, 0x5F, 0xBC, 0x0C, 0x06, 0x40, 0x00, 0xE0, 0xB1, 0x1E, 0x82,
+0x00, 0xF0, 0x11, 0x01, 0xE0, 0x7D, 0xA6, 0x01, 0xE0, 0x28, 0x9F, 0xCC,
+0x3F, 0x80, 0x15, 0x01, 0xE0, 0xFD, 0xBF, 0x0F, 0xE0, 0xFD, 0xBD, 0x0C,
+0x27, 0xE8, 0xA7, 0x22, 0x37, 0xFC, 0xC7, 0x0E, 0xE0, 0x1F, 0x3F, 0x84,
+0x00, 0x51, 0xFE, 0x3F, 0x10, 0xE0, 0x8D, 0x84, 0x00, 0xB5, 0x7D, 0xBE,
+0x82, 0x38, 0x98, 0x8E, 0x08, 0x8E, 0x28, 0x8F, 0xB8, 0x80, 0x06, 0x00,
+0x54, 0x02, 0x02, 0x80, 0x06, 0x80, 0xCE, 0x3F, 0xBC, 0xBF, 0xD8, 0x8F,
+0x48, 0x8F, 0x0A, 0x00, 0x6E, 0x03, 0xE2, 0xFF, 0xC7, 0xCC, 0xBF, 0x2E,
+0x00, 0x04, 0x2A, 0x00, 0xF1, 0x24, 0x04, 0xC4, 0x89, 0xBF, 0x82, 0x38,
+0x18, 0x8F, 0x80, 0xE1, 0xA8, 0x8F, 0x28, 0x37, 0xCE, 0x3F, 0x89, 0xB7,
+0x82, 0x38, 0x80, 0xE1, 0x98, 0x8F, 0x89, 0xAF, 0x82, 0x38, 0xE8, 0x3F,
+0x0C, 0xE0, 0xC8, 0x34, 0x0D, 0xE4, 0xC0, 0x34, 0x0E, 0xE4, 0xC8, 0x34,
+0x04, 0xC4, 0x8F, 0xAC, 0x1F, 0xAE, 0xAF, 0xAE, 0x3F, 0x1A, 0x00, 0x50,
+0x0E, 0xE0, 0xC8, 0x34, 0x02, 0x12, 0x00, 0x90, 0xAF, 0x82, 0x38, 0x92,
+0x24, 0xFF, 0xC4, 0xE8, 0x3F, 0x8E, 0x03, 0xF0, 0x11, 0x0E, 0xE0, 0x19,
+0x3C, 0xFF, 0xC7, 0x00, 0xE0, 0x00, 0x14, 0x80, 0xE0, 0x9F, 0x8C, 0xFE,
+0x3F, 0x19, 0x3C, 0x01, 0xE2, 0x7F, 0xC4, 0xFA, 0x01, 0x82, 0x38, 0x69,
+0x3C, 0x82, 0x38, 0x6A, 0x3F, 0xD8, 0x01, 0xF1, 0x10, 0x0F, 0xE0, 0x48,
+0x35, 0xB2, 0x24, 0x00, 0xE0, 0x94, 0x15, 0x00, 0xE2, 0x94, 0xCC, 0x6B,
+0x3E, 0x6C, 0xE0, 0xA9, 0x3D, 0xAC, 0x3C, 0x0C, 0xE0, 0x18, 0x3E, 0x80,
+0xE1, 0x98, 0x8E, 0x1D, 0xC8, 0x05, 0x30, 0x7C, 0x3C, 0x9E, 0x50, 0x00,
+0x70, 0xC7, 0xF7, 0x01, 0x6E, 0x3E, 0xEF, 0x3E, 0xD0, 0x01, 0xF1, 0x00,
+0x01, 0xE2, 0x7F, 0xC6, 0x48, 0x37, 0x01, 0xE2, 0xFF, 0xC6, 0xC8, 0x37,
+0x1C, 0x3F, 0x9D, 0x22, 0x00, 0x00, 0x1E, 0x00, 0x2F, 0xE0, 0x2C, 0x1E,
+0x00, 0x09, 0x50, 0xA8, 0x37, 0x08, 0xE0, 0xCE, 0x0E, 0x00, 0xF0, 0x10,
+0xC4, 0x82, 0x38, 0xFF, 0xE1, 0x7F, 0x15, 0xC1, 0x00, 0xB5, 0x08, 0x69,
+0x39, 0xE8, 0x39, 0xFE, 0xEF, 0xB3, 0xDC, 0x92, 0x8F, 0x97, 0x27, 0x32,
+0x8F, 0x02, 0x8E, 0x01, 0xC7, 0xEE, 0x3E, 0x3A, 0x00, 0xF6, 0x1B, 0xFF,
+0xC7, 0xB2, 0xAE, 0x7D, 0x3E, 0x2E, 0xE0, 0x72, 0xA2, 0x92, 0xAF, 0x80,
+0x12, 0x82, 0x02, 0xB2, 0xAA, 0xFE, 0xEF, 0xA2, 0xDC, 0x63, 0x3C, 0x83,
+0xBA, 0x13, 0xBA, 0x23, 0xB9, 0xE1, 0x0A, 0x6F, 0x3A, 0xFE, 0xEF, 0x9A,
+0xDC, 0x01, 0xE0, 0xC1, 0x12, 0x14, 0x00, 0x00, 0xDA, 0x01, 0x22, 0xB4,
+0x08, 0x0A, 0x02, 0x80, 0x9F, 0x2F, 0x22, 0xE1, 0x8F, 0x3C, 0x1C, 0x29,
+0x5E, 0x00, 0xD1, 0x84, 0xDC, 0x23, 0xA6, 0x62, 0x3A, 0x12, 0x26, 0x83,
+0xA5, 0x90, 0x25, 0xEC, 0xDC, 0x07, 0xF0, 0x13, 0x9C, 0x2F, 0x01, 0x15,
+0x82, 0x00, 0x90, 0x2E, 0x81, 0xC7, 0xFF, 0x3D, 0x0E, 0xE0, 0x3F, 0x35,
+0x0D, 0xE0, 0x5C, 0x3F, 0xF9, 0x01, 0x00, 0x12, 0xFE, 0xEF, 0x70, 0xDC,
+0x64, 0x3C, 0x61, 0x0A, 0x00, 0x12, 0x06, 0x00, 0xF2, 0x09, 0x41, 0xE0,
+0x0E, 0x3F, 0x93, 0xA6, 0x33, 0xA2, 0xBD, 0x3F, 0x5C, 0x3F, 0x1F, 0x3A,
+0x23, 0xBF, 0xF1, 0x00, 0x7E, 0x17, 0xE2, 0x3F, 0xF7, 0x00, 0x62, 0x00,
+0x11, 0xAB, 0x6C, 0x02, 0xF0, 0x01, 0xA8, 0x2F, 0xB3, 0x08, 0x68, 0x39,
+0x02, 0xA6, 0x92, 0xA5, 0x32, 0xA7, 0x0D, 0xE0, 0x3B, 0x3E, 0x52, 0x08,
+0xF0, 0x11, 0x9E, 0x3E, 0xF9, 0x3E, 0x90, 0x04, 0x0F, 0x26, 0x79, 0x3F,
+0x1C, 0x01, 0x1B, 0x3F, 0x84, 0x00, 0xFE, 0x3C, 0x6D, 0x3F, 0x09, 0x01,
+0x81, 0xC7, 0x7F, 0x3E, 0x0D, 0xE0, 0x9E, 0x3D, 0xF9, 0x01, 0x24, 0x00,
+0xF0, 0x05, 0xE1, 0x09, 0x81, 0x11, 0xBF, 0x31, 0xFE, 0xEF, 0x36, 0xDC,
+0xA2, 0xA7, 0xC3, 0x3F, 0xA2, 0xBF, 0xFE, 0xEF, 0x33, 0xDC, 0x16, 0x00,
+0x02, 0x92, 0x08, 0xF0, 0x27, 0x81, 0x11, 0xF3, 0x00, 0xB2, 0x08, 0x83,
+0x65, 0x00, 0x17, 0x2F, 0xE0, 0x0E, 0x3E, 0x2E, 0xE0, 0x8E, 0x3D, 0x4F,
+0x3F, 0x27, 0x2F, 0x2F, 0xE0, 0x0E, 0x3D, 0xA4, 0x2F, 0x88, 0xA0, 0x00,
+0xE2, 0xA0, 0xC8, 0xA2, 0x02, 0x98, 0xA4, 0x61, 0x39, 0x41, 0xE0, 0x49,
+0x3F, 0x00, 0xE2, 0x03, 0xC7, 0x19, 0x3F, 0x09, 0xE0, 0xBE, 0x38, 0x40,
+0x08, 0xF0, 0x17, 0x90, 0xC4, 0xF9, 0x3E, 0x9B, 0x04, 0xFF, 0x16, 0xB1,
+0x36, 0xEC, 0x3C, 0x41, 0xE0, 0x8D, 0x3E, 0x90, 0xC4, 0x8C, 0xB8, 0x6A,
+0x3C, 0x1C, 0xBF, 0xAC, 0xBE, 0xBC, 0xBC, 0x0A, 0xBE, 0x0B, 0xA9, 0x9B,
+0xAF, 0x9B, 0xB7, 0x9A, 0xBD, 0x06, 0x03, 0xF6, 0x05, 0x61, 0x09, 0x01,
+0xE2, 0xFF, 0xC8, 0x8A, 0xBF, 0x8B, 0x05, 0x6F, 0x3C, 0x9A, 0xBF, 0x61,
+0x09, 0x8A, 0xBF, 0x6F, 0x3C, 0x20, 0x00, 0x44, 0x6F, 0x3C, 0x8B, 0xA8,
+0x0C, 0x00, 0xF0, 0x0B, 0x08, 0xA4, 0xFE, 0xE7, 0xD5, 0x00, 0xB4, 0x08,
+0x18, 0xA1, 0xE9, 0x39, 0xFE, 0xEF, 0xDD, 0xDB, 0x92, 0x8F, 0x02, 0x8F,
+0x01, 0xE0, 0x05, 0x12, 0xFE, 0x3F, 0xC4, 0x01, 0x91, 0x8F, 0x03, 0xA2,
+0x8E, 0x81, 0xC7, 0x81, 0xC6, 0x6D, 0xF4, 0x01, 0xF0, 0x05, 0x22, 0xAE,
+0x7C, 0x3F, 0x2D, 0xE0, 0xF2, 0xB9, 0x00, 0x12, 0x92, 0xAF, 0x82, 0x02,
+0x22, 0xAA, 0xFE, 0xEF, 0xC9, 0xDB, 0x48, 0x01, 0x13, 0xB3, 0x3A, 0x00,
+0xF0, 0x15, 0xC0, 0xDB, 0x12, 0x8F, 0x82, 0x8E, 0x7D, 0x3F, 0x91, 0x03,
+0xB2, 0x8F, 0x95, 0x27, 0xFF, 0xC7, 0x01, 0xE2, 0xFF, 0xC7, 0xB2, 0xAF,
+0x81, 0xC7, 0x2F, 0xE0, 0xF2, 0xB9, 0x01, 0xC7, 0x12, 0xAF, 0xFE, 0xEF,
+0xB1, 0xDB, 0x44, 0x07, 0x00, 0x06, 0x01, 0x60, 0x05, 0x11, 0xFE, 0xEF,
+0xAA, 0xDB, 0x0C, 0x00, 0x22, 0xED, 0x3F, 0x2A, 0x00, 0xF0, 0x0D, 0xEB,
+0x00, 0xB2, 0x08, 0x68, 0x39, 0x99, 0xA4, 0x09, 0x25, 0x01, 0xE0, 0x80,
+0x17, 0x88, 0xBF, 0x80, 0x17, 0xA8, 0xBC, 0x98, 0xBF, 0x62, 0x3C, 0x61,
+0x09, 0xDD, 0xDE, 0x06, 0x00, 0x00, 0xA6, 0x00, 0xF0, 0x0F, 0xB4, 0x00,
+0x0A, 0xE0, 0xF8, 0x00, 0x00, 0xE0, 0xA1, 0x1F, 0x8F, 0xA7, 0x89, 0x27,
+0xB1, 0x08, 0x99, 0xEB, 0x78, 0x7C, 0x00, 0xE8, 0x02, 0xC4, 0x81, 0x3F,
+0x01, 0x14, 0xE1, 0x08, 0x5A, 0x01, 0x04, 0x12, 0x00, 0xF8, 0x1B, 0x82,
+0x38, 0x7C, 0xC0, 0x00, 0xE0, 0xA4, 0x1F, 0x0F, 0x8F, 0x01, 0xE2, 0x7F,
+0xCF, 0x0B, 0x01, 0x0F, 0x8F, 0x9F, 0x8F, 0x04, 0x6F, 0x85, 0x6F, 0x85,
+0x4F, 0x04, 0x4C, 0xA8, 0x37, 0x4F, 0x3C, 0x04, 0xC0, 0x82, 0x38, 0x0A,
+0xE0, 0x84, 0x17, 0x82, 0x77, 0x12, 0x00, 0xF9, 0x14, 0x00, 0xE2, 0x85,
+0xCC, 0xAB, 0x02, 0xFA, 0xEB, 0xF8, 0x7F, 0x00, 0xE8, 0x80, 0xC7, 0x29,
+0xE0, 0xFF, 0xA7, 0x82, 0x3F, 0x30, 0xC4, 0x08, 0xE0, 0x8F, 0x0E, 0x01,
+0x14, 0x0A, 0xE0, 0x9F, 0x0E, 0x82, 0x38, 0x3C, 0x0E, 0x00, 0x19, 0x0C,
+0x0E, 0x00, 0x19, 0x18, 0x0E, 0x00, 0x19, 0x24, 0x0E, 0x00, 0x01, 0xF6,
+0x01, 0x70, 0x17, 0x09, 0xE0, 0x88, 0xAF, 0x82, 0x38, 0x52, 0x02, 0xF0,
+0x1D, 0xFE, 0xEF, 0x29, 0xDB, 0x80, 0x17, 0x09, 0xE0, 0x82, 0x89, 0x09,
+0xE0, 0x82, 0xAF, 0xFE, 0xEF, 0x24, 0xDB, 0x63, 0x3C, 0xE1, 0x09, 0x00,
+0xE0, 0xA9, 0x1F, 0xFD, 0xEB, 0xB4, 0x7C, 0x8F, 0xA7, 0x00, 0xE8, 0x80,
+0xC4, 0x82, 0x3F, 0x00, 0xE2, 0x01, 0xCC, 0x03, 0x01, 0x3C, 0x00, 0xF0,
+0x09, 0xB1, 0x08, 0xFE, 0xEF, 0xF3, 0xDC, 0x00, 0xE0, 0xD9, 0x1F, 0x77,
+0xE0, 0x44, 0x17, 0x00, 0x14, 0x0F, 0xBF, 0xE1, 0x08, 0xB1, 0x08, 0x3F,
+0x0C, 0xE8, 0x04, 0xF0, 0x0D, 0x01, 0xE0, 0x7F, 0xA7, 0x01, 0xE0, 0x7F,
+0xBF, 0x90, 0x17, 0x61, 0xE0, 0x91, 0x3F, 0x00, 0x3B, 0x22, 0xDD, 0xA8,
+0x0F, 0xA1, 0x08, 0x00, 0x38, 0xB1, 0x08, 0x05, 0x24, 0x42, 0x00, 0xF1,
+0x02, 0x07, 0x01, 0xE1, 0x08, 0xFE, 0xEF, 0x31, 0xDD, 0xA1, 0x08, 0xDA,
+0xE7, 0x96, 0x00, 0xFE, 0xEF, 0x35, 0x0A, 0x00, 0xF0, 0x0D, 0x89, 0x00,
+0x00, 0xE0, 0xDA, 0x1E, 0x00, 0xE0, 0x5B, 0x1F, 0x8D, 0xA7, 0x07, 0xE0,
+0x8E, 0xCF, 0x8D, 0xBF, 0xF8, 0xE7, 0xF1, 0x16, 0x8E, 0xA7, 0xDD, 0x3F,
+0x8E, 0xBF, 0x28, 0x05, 0x00, 0x9C, 0x07, 0x80, 0xDA, 0x1E, 0xFF, 0xE7,
+0x3F, 0x16, 0x0D, 0xA7, 0xD2, 0x01, 0xF0, 0x37, 0x00, 0xE0, 0xDF, 0x1F,
+0x5C, 0x3F, 0x0D, 0xBF, 0x86, 0xE1, 0x50, 0x11, 0x0F, 0xA7, 0x00, 0xE0,
+0xE0, 0x1E, 0x40, 0xCF, 0x0F, 0xBF, 0x8D, 0xA7, 0x00, 0xE0, 0x5C, 0x1F,
+0xDC, 0x3F, 0x8D, 0xBF, 0x8E, 0xA7, 0x00, 0xE0, 0xE1, 0x19, 0xC0, 0xCF,
+0x8E, 0xBF, 0x40, 0xDF, 0x68, 0x3A, 0x83, 0xA7, 0x7F, 0xC1, 0x00, 0xE2,
+0xC0, 0xC7, 0x8B, 0x2F, 0x00, 0xE2, 0x00, 0xC9, 0x79, 0x03, 0xE4, 0xA7,
+0x7F, 0xC1, 0x81, 0x3F, 0x83, 0xA7, 0x14, 0x00, 0xF2, 0x1F, 0xF7, 0x27,
+0x61, 0x0A, 0xB2, 0x08, 0x1F, 0xDF, 0x0B, 0x2C, 0x81, 0x17, 0x6A, 0xE0,
+0x94, 0x3F, 0x61, 0xE0, 0x82, 0x3F, 0x34, 0xE0, 0x91, 0xCF, 0x61, 0xE0,
+0x92, 0x3F, 0x61, 0x09, 0x21, 0xDF, 0x68, 0x39, 0x01, 0xE0, 0x82, 0xA7,
+0x00, 0xE0, 0x8A, 0x1C, 0x00, 0x14, 0x81, 0x3F, 0x0C, 0x00, 0x35, 0xA3,
+0x1C, 0x01, 0x0C, 0x00, 0x35, 0x96, 0x1C, 0x02, 0x0C, 0x00, 0x35, 0xAF,
+0x1C, 0x04, 0x0C, 0x00, 0x35, 0xC4, 0x1C, 0x09, 0x0C, 0x00, 0x35, 0x8E,
+0x1C, 0x0B, 0x0C, 0x00, 0x8F, 0xA7, 0x1C, 0x0C, 0x14, 0x81, 0x3F, 0x9A,
+0xDF, 0x6E, 0x00, 0x01, 0xF0, 0x1D, 0xB6, 0x08, 0x6C, 0xC0, 0x00, 0xE2,
+0xBB, 0xCC, 0x3B, 0x17, 0x6E, 0xE0, 0xA9, 0x3D, 0x00, 0xE4, 0x4E, 0xC7,
+0xC8, 0xA4, 0x01, 0xE0, 0x98, 0xA6, 0x02, 0xE0, 0x9E, 0x3C, 0x08, 0xE0,
+0xA2, 0x8F, 0x8D, 0xA5, 0x00, 0xE0, 0x62, 0x1D, 0xC6, 0x37, 0x01, 0xE0,
+0x08, 0xA6, 0x56, 0x04, 0x90, 0xDA, 0x3D, 0x0F, 0xE4, 0xA3, 0x37, 0xCB,
+0x3F, 0xDC, 0xC8, 0x06, 0xF0, 0x1C, 0xA1, 0x81, 0x7D, 0x1C, 0x15, 0x4C,
+0xA2, 0x8C, 0xA2, 0x3C, 0xA3, 0x9C, 0xA5, 0x2C, 0xA4, 0x8D, 0xBF, 0xC2,
+0x8F, 0x12, 0x8E, 0x2E, 0xE0, 0xF9, 0x88, 0x83, 0x7F, 0x28, 0x36, 0xB2,
+0x8F, 0x22, 0x8F, 0xD2, 0x8E, 0x82, 0x7F, 0x41, 0x3E, 0xE2, 0x8C, 0x83,
+0x60, 0xFE, 0x05, 0xE0, 0xF2, 0x8F, 0x4E, 0x3E, 0xA8, 0x36, 0x02, 0x67,
+0xC1, 0x3E, 0x09, 0xE4, 0xA0, 0x34, 0x0A, 0x06, 0x00, 0xB0, 0x07, 0xF1,
+0x34, 0xC9, 0x3E, 0xCF, 0x3E, 0x4E, 0x3E, 0xE2, 0x3C, 0x0B, 0xE0, 0x1D,
+0x0E, 0x88, 0xC4, 0x11, 0xD4, 0x04, 0xE0, 0x52, 0x8D, 0x05, 0xE0, 0x92,
+0x8D, 0x04, 0xE0, 0x42, 0x8C, 0x05, 0xE0, 0x82, 0x8C, 0x04, 0xE0, 0x62,
+0x8E, 0x05, 0xE0, 0xA2, 0x8E, 0x04, 0xE0, 0x72, 0x8F, 0x05, 0xE0, 0xB2,
+0x8F, 0x28, 0x35, 0xA8, 0x35, 0x48, 0x3D, 0xC9, 0x3D, 0x0C, 0xE4, 0x20,
+0x36, 0x0D, 0xE4, 0xA0, 0x36, 0x4A, 0x3E, 0xCB, 0x0C, 0x08, 0x00, 0x50,
+0x00, 0xF1, 0x20, 0x4C, 0x3F, 0xCD, 0x3F, 0x06, 0xE0, 0x1F, 0x0F, 0xF0,
+0x16, 0x05, 0xE0, 0x42, 0x8F, 0x84, 0xA7, 0x00, 0xE2, 0x0F, 0xC7, 0xDD,
+0x3F, 0xCE, 0x3F, 0x84, 0xBF, 0xFE, 0xE7, 0x0F, 0x17, 0x05, 0xE0, 0xC2,
+0x8E, 0xDE, 0x3F, 0x01, 0xE2, 0xF0, 0xC6, 0xCD, 0x3F, 0x84, 0xBF, 0x62,
+0x3F, 0x05, 0x5A, 0x00, 0xE0, 0xD2, 0x8D, 0x05, 0xE0, 0xF2, 0x8E, 0x06,
+0xE0, 0x82, 0x8F, 0x28, 0x36, 0x4B, 0x3E, 0x52, 0x00, 0x40, 0x81, 0x65,
+0xCC, 0x3E, 0x4E, 0x00, 0xF0, 0x07, 0xCD, 0x3F, 0x8B, 0xBF, 0x00, 0xE0,
+0x45, 0xC7, 0x09, 0xE0, 0xB2, 0x8F, 0x06, 0xE0, 0x62, 0x8E, 0x06, 0xE0,
+0x52, 0x8D, 0x06, 0xE0, 0xDA, 0x01, 0xF0, 0x09, 0xA2, 0x8E, 0xC4, 0x37,
+0x28, 0x36, 0x06, 0xE0, 0x92, 0x8D, 0x4A, 0x3E, 0xA8, 0x36, 0x0F, 0xE4,
+0xA0, 0x37, 0xCC, 0x3F, 0x0C, 0xE4, 0xA6, 0x36, 0x06, 0x00, 0xF0, 0x17,
+0xA4, 0x35, 0x0D, 0xE4, 0xA2, 0x36, 0xCC, 0x3F, 0x60, 0xEA, 0x00, 0xCE,
+0x5D, 0x3E, 0x09, 0xE0, 0xC2, 0x8E, 0xCC, 0x3F, 0x09, 0xE0, 0xC1, 0x36,
+0x09, 0xE0, 0x32, 0x8E, 0x83, 0xBF, 0xED, 0x3F, 0xE9, 0x3E, 0x06, 0xE0,
+0xC2, 0x8D, 0x48, 0x01, 0xF0, 0x0F, 0x00, 0xE2, 0x83, 0xC6, 0x06, 0xE0,
+0x32, 0x8D, 0x0D, 0xE4, 0xA4, 0x36, 0x0F, 0xE4, 0xA6, 0x37, 0xCD, 0x3F,
+0xA8, 0x35, 0xEC, 0x3E, 0xCA, 0x3D, 0x00, 0xE2, 0x8F, 0xC6, 0xCB, 0x3F,
+0x86, 0x00, 0xF5, 0x08, 0xCD, 0x3F, 0x93, 0xBF, 0x00, 0xE2, 0x10, 0x7C,
+0x06, 0xE0, 0xF2, 0x8D, 0x07, 0xE0, 0x02, 0x8E, 0x07, 0xE0, 0x92, 0x8E,
+0x07, 0xE0, 0xA2, 0xA6, 0x00, 0x04, 0xA4, 0x00, 0xFD, 0x02, 0xA3, 0xBF,
+0x07, 0xE0, 0x42, 0x8E, 0x07, 0xE0, 0xB2, 0x8D, 0x07, 0xE0, 0xD2, 0x8E,
+0x07, 0xE0, 0xE2, 0x22, 0x00, 0xF0, 0x03, 0xB3, 0xBF, 0x07, 0xE0, 0xF2,
+0x8F, 0x08, 0xE0, 0x02, 0x8E, 0x09, 0xE0, 0xD2, 0x8D, 0x08, 0xE0, 0x92,
+0x8E, 0x3C, 0x01, 0x40, 0xA8, 0x37, 0xCC, 0x3F, 0x6A, 0x00, 0xF0, 0x57,
+0xA8, 0x36, 0xCD, 0x3F, 0xC3, 0xBF, 0x85, 0xA7, 0x00, 0xE8, 0x84, 0xCF,
+0x85, 0xBF, 0x08, 0xE0, 0xD2, 0x8C, 0x1E, 0x8D, 0xAE, 0x8D, 0x3E, 0x8E,
+0xCE, 0x8E, 0xDE, 0x8F, 0x90, 0x6C, 0x11, 0x6D, 0x92, 0x6D, 0x13, 0x6E,
+0x94, 0x6E, 0x95, 0x6F, 0x03, 0xDC, 0x14, 0xC0, 0x61, 0x0B, 0xFF, 0xFF,
+0x88, 0xA7, 0x88, 0x27, 0x98, 0xA7, 0x00, 0xE2, 0xBB, 0xCF, 0x85, 0x05,
+0x82, 0x17, 0x88, 0xBF, 0x82, 0x38, 0x82, 0x38, 0xB2, 0x08, 0x68, 0xA7,
+0x01, 0xE0, 0x88, 0xA6, 0xA5, 0x37, 0x68, 0x39, 0x9E, 0x3F, 0x01, 0xE0,
+0x28, 0xA4, 0xFD, 0xBF, 0xC0, 0xDB, 0x01, 0xE0, 0x82, 0xA4, 0x72, 0xA4,
+0xDD, 0xDA, 0x92, 0xA4, 0x81, 0xC4, 0x64, 0x02, 0x40, 0x9B, 0x02, 0x69,
+0x3F, 0x62, 0x02, 0xF0, 0x17, 0xC2, 0xA7, 0x0D, 0xE0, 0x9E, 0x3F, 0x08,
+0xE0, 0xAD, 0x86, 0x00, 0xE2, 0x80, 0xCE, 0x12, 0x04, 0x00, 0xE0, 0x4E,
+0xC7, 0x9E, 0x3F, 0x88, 0x00, 0x08, 0xE0, 0x2F, 0x87, 0x00, 0xE0, 0xCE,
+0xC7, 0x00, 0xE2, 0x00, 0xCF, 0x07, 0x04, 0x34, 0x00, 0x80, 0xBC, 0xCC,
+0xF6, 0x01, 0x92, 0xBC, 0x61, 0x09, 0x48, 0x09, 0xF0, 0x1B, 0x00, 0xE0,
+0x92, 0xBC, 0x01, 0xE0, 0xFE, 0xA7, 0x02, 0xE2, 0x80, 0xC7, 0xFC, 0x2F,
+0x62, 0x3C, 0x21, 0x09, 0xFD, 0xE7, 0xA2, 0x00, 0xFF, 0xFF, 0xB3, 0x08,
+0x80, 0x14, 0xC8, 0xA7, 0x86, 0x00, 0x00, 0xE2, 0x3C, 0xC9, 0xE2, 0x3C,
+0x00, 0xE0, 0x56, 0x01, 0x48, 0x00, 0x20, 0x69, 0x39, 0x46, 0x00, 0x20,
+0x01, 0xC1, 0x50, 0x00, 0xF0, 0x0B, 0x73, 0x03, 0xE8, 0xA7, 0x0D, 0xE0,
+0xA5, 0x34, 0x9D, 0x3F, 0x01, 0xE0, 0x08, 0xA7, 0x81, 0x16, 0x88, 0xBE,
+0xE8, 0x39, 0x98, 0xBC, 0xFE, 0xBF, 0x82, 0xDE, 0x0C, 0x03, 0x40, 0x6F,
+0x17, 0xDE, 0x3F, 0x0C, 0x03, 0xE0, 0x01, 0xE0, 0x23, 0xA4, 0x66, 0xDB,
+0x73, 0xA4, 0x01, 0xE0, 0x83, 0xA4, 0x83, 0xDA, 0x4E, 0x00, 0x31, 0x1B,
+0x01, 0x62, 0xB0, 0x00, 0x19, 0xC3, 0xB0, 0x00, 0x13, 0x19, 0xB0, 0x00,
+0xEF, 0x01, 0x0A, 0xB0, 0x00, 0x40, 0x0E, 0x04, 0x01, 0xC1, 0x34, 0x00,
+0x60, 0xF6, 0x01, 0xBC, 0x17, 0x93, 0xBF, 0x58, 0x00, 0x11, 0x90, 0x62,
+0x03, 0x20, 0x01, 0x14, 0xD2, 0x04, 0x46, 0x31, 0x1F, 0x13, 0xB9, 0xBC,
+0x00, 0x80, 0xE2, 0x3C, 0x63, 0x3C, 0x44, 0xDE, 0xEE, 0x00, 0x0C, 0x07,
+0x20, 0x80, 0x17, 0x38, 0x01, 0xF0, 0x33, 0xE7, 0xEB, 0x1C, 0x7F, 0x88,
+0xBF, 0x00, 0xE8, 0x00, 0xC7, 0x01, 0xE0, 0x0D, 0xBF, 0x01, 0xE0, 0x1D,
+0xBC, 0x01, 0xE0, 0xF8, 0xBF, 0x05, 0xE0, 0xD8, 0xAF, 0x82, 0x38, 0xB8,
+0xA7, 0x0F, 0x8F, 0x21, 0x27, 0xB5, 0x08, 0x01, 0xE0, 0xF8, 0xA1, 0x68,
+0x39, 0x00, 0xE2, 0x81, 0xC9, 0x00, 0xE0, 0x54, 0x01, 0xA2, 0x21, 0x00,
+0xE2, 0x82, 0xC9, 0x94, 0x01, 0xFE, 0xEF, 0x91, 0xDA, 0x03, 0xE0, 0xC2,
+0x9C, 0x36, 0x05, 0xF0, 0x17, 0xA1, 0x34, 0x85, 0xC4, 0x00, 0xE0, 0x06,
+0x1D, 0x01, 0xE0, 0x52, 0xA4, 0xCF, 0xA7, 0xFF, 0xE3, 0xFF, 0xC4, 0x81,
+0x3F, 0x03, 0x2C, 0x01, 0xE0, 0x72, 0xBC, 0xE1, 0x0A, 0x05, 0xE0, 0xD8,
+0x8F, 0x83, 0x27, 0x05, 0xE0, 0x58, 0xAF, 0x58, 0x06, 0x00, 0x5E, 0x00,
+0xF0, 0x17, 0x82, 0x38, 0x3F, 0x8F, 0x00, 0xE0, 0x7D, 0x2F, 0xCF, 0x8F,
+0x00, 0xE0, 0xEC, 0x27, 0x05, 0xE0, 0xD2, 0x8F, 0x01, 0xE0, 0x8A, 0x27,
+0xB2, 0xA7, 0x2F, 0x8A, 0x1F, 0x8F, 0x00, 0xE0, 0xAE, 0x1F, 0x28, 0x32,
+0x8F, 0xA7, 0x4E, 0x3A, 0x44, 0x04, 0xF0, 0x82, 0xC2, 0xA1, 0x07, 0xE4,
+0x68, 0xC2, 0xF8, 0x39, 0xE8, 0x3A, 0x00, 0xE0, 0xF5, 0x05, 0xA8, 0x39,
+0x41, 0xE0, 0x83, 0x39, 0xF4, 0x39, 0xD6, 0x04, 0x82, 0xA7, 0x83, 0x2F,
+0x62, 0x3C, 0x40, 0xDF, 0xFE, 0xEF, 0x4F, 0xDA, 0x00, 0xE0, 0x5F, 0x2A,
+0x03, 0xE0, 0xA3, 0x3A, 0x01, 0xE0, 0xC2, 0xB9, 0x81, 0x17, 0x01, 0xE0,
+0xF2, 0xBF, 0xE1, 0x0A, 0x88, 0xA7, 0x00, 0xE2, 0x82, 0xCF, 0xC2, 0x01,
+0x00, 0xE0, 0x05, 0x1C, 0xFF, 0xE7, 0x85, 0x17, 0x98, 0xAF, 0x87, 0x17,
+0xA8, 0xAF, 0x8F, 0x17, 0x80, 0x15, 0xB8, 0xAF, 0x6B, 0x3E, 0x00, 0xE0,
+0x84, 0x1C, 0xC2, 0xA6, 0x88, 0x00, 0x01, 0xC6, 0x00, 0xE2, 0x3C, 0xCE,
+0x00, 0xE0, 0xCE, 0xC6, 0x00, 0xE0, 0x5C, 0x01, 0x08, 0xE0, 0xAD, 0x87,
+0x00, 0xE2, 0x80, 0xCF, 0x75, 0x03, 0x01, 0xE0, 0x82, 0x88, 0xF2, 0x20,
+0x0A, 0xE0, 0x25, 0x36, 0x00, 0x17, 0x08, 0xE0, 0xCD, 0x8F, 0x08, 0xE0,
+0xBD, 0x89, 0xA8, 0x37, 0xC3, 0x3F, 0x9E, 0x37, 0xEB, 0x06, 0x01, 0xF0,
+0x04, 0xC7, 0x81, 0xC1, 0x8C, 0x27, 0xE2, 0xA7, 0x9A, 0x3F, 0x2E, 0xE0,
+0xFF, 0x97, 0x2B, 0xE0, 0xF9, 0xB7, 0xE3, 0x3D, 0x32, 0x00, 0xC0, 0xFF,
+0xE3, 0xFF, 0xC5, 0x01, 0xC7, 0x71, 0x3F, 0xE7, 0x04, 0xD4, 0x00, 0x08,
+0x01, 0xF0, 0x09, 0xFE, 0xEF, 0x60, 0xDC, 0x00, 0xE0, 0xC5, 0x1F, 0x8F,
+0xA7, 0xEF, 0xA7, 0x81, 0x3F, 0x0F, 0xE2, 0x03, 0xCC, 0xFF, 0xE7, 0x8B,
+0x02, 0xE1, 0x0A, 0xA4, 0x02, 0xF0, 0x03, 0x7D, 0xDA, 0xB2, 0xA7, 0xBF,
+0xA9, 0xFF, 0xE7, 0x80, 0x00, 0xA4, 0x39, 0x73, 0x3A, 0xFF, 0xE7, 0xA1,
+0x02, 0x08, 0x00, 0xF0, 0x03, 0xFA, 0x05, 0xFF, 0xE7, 0x9C, 0x00, 0x03,
+0xE0, 0x23, 0x3C, 0xFF, 0xE7, 0x8E, 0x00, 0xFE, 0xEF, 0xE1, 0xD9, 0x0E,
+0x01, 0xF0, 0x0B, 0x01, 0x17, 0x8F, 0xA7, 0x05, 0xE0, 0x52, 0xAF, 0x81,
+0x3F, 0x82, 0xA7, 0x01, 0xE0, 0x42, 0xBC, 0xFF, 0xE7, 0x8E, 0x2F, 0x62,
+0x3C, 0xC2, 0xDE, 0xFF, 0xE7, 0x00, 0x02, 0xF0, 0x0D, 0x8A, 0x00, 0x0F,
+0xE4, 0xA1, 0x35, 0x0F, 0xE4, 0xC0, 0x37, 0x0E, 0xE0, 0xC8, 0x37, 0xC8,
+0xAF, 0x80, 0x17, 0x58, 0xAF, 0x82, 0xBF, 0x82, 0x17, 0x03, 0xE0, 0xC2,
+0xB5, 0x08, 0x01, 0xF1, 0x4F, 0xFE, 0xE7, 0xAF, 0x00, 0x00, 0xEA, 0x04,
+0xCC, 0x3C, 0xE0, 0x20, 0xCC, 0x80, 0x14, 0x00, 0xEA, 0x04, 0xCD, 0x75,
+0xE0, 0x10, 0xCD, 0x28, 0x3D, 0xD6, 0xD1, 0x00, 0xEA, 0x00, 0xCC, 0x00,
+0xE0, 0x00, 0xCC, 0x02, 0x24, 0x01, 0x3C, 0x00, 0x14, 0x80, 0x14, 0x05,
+0xD0, 0x80, 0x3A, 0x00, 0x00, 0x80, 0x3A, 0xFF, 0xFF, 0xB6, 0x08, 0xFF,
+0xE1, 0x2C, 0xC0, 0x00, 0xE0, 0x8F, 0x19, 0xEC, 0xDC, 0xFE, 0xEF, 0x82,
+0xD7, 0xAD, 0xDC, 0xFE, 0xEF, 0x06, 0xD4, 0xFE, 0xEF, 0xCA, 0xD2, 0xFE,
+0xEF, 0x9A, 0xD7, 0x83, 0xA7, 0x00, 0xE0, 0x0D, 0x19, 0x8F, 0xA7, 0x00,
+0xE0, 0x1B, 0x1A, 0x54, 0x06, 0xF0, 0x3E, 0xE0, 0x41, 0x14, 0x9F, 0xA7,
+0x81, 0x3F, 0x00, 0xE0, 0x9A, 0x1F, 0x00, 0xE0, 0x42, 0x1C, 0x8F, 0xA4,
+0xFF, 0xEF, 0xEB, 0xD4, 0x00, 0xE0, 0x8C, 0x1D, 0x00, 0xE0, 0x33, 0x1D,
+0x00, 0xE0, 0xB5, 0x1C, 0x62, 0x3C, 0xFF, 0xEF, 0xB9, 0xD6, 0x00, 0x14,
+0x52, 0xDC, 0x15, 0x7C, 0x00, 0x15, 0x00, 0xE0, 0x34, 0x1C, 0x81, 0x14,
+0xFE, 0xEF, 0x9B, 0xD9, 0x15, 0xE0, 0x12, 0x8F, 0x15, 0xE0, 0x82, 0x8E,
+0x15, 0xE0, 0xA2, 0x8F, 0x15, 0xE0, 0xB2, 0x8C, 0x28, 0x37, 0x4D, 0x3F,
+0xD2, 0x04, 0xF0, 0x21, 0xCE, 0x3F, 0x00, 0xE0, 0x63, 0x1C, 0x09, 0xE4,
+0xA8, 0x34, 0xCF, 0x3C, 0xFE, 0xEF, 0x42, 0xD9, 0x00, 0x14, 0xFE, 0xEF,
+0x64, 0xD9, 0x81, 0x14, 0x00, 0x14, 0xA5, 0xD8, 0x01, 0xE0, 0xA4, 0xA4,
+0x74, 0xA4, 0xBA, 0xD9, 0x74, 0xA4, 0x01, 0xE0, 0x84, 0xA4, 0xEE, 0xD8,
+0x74, 0xA4, 0x67, 0xD9, 0x62, 0x07, 0xF0, 0x44, 0x7C, 0x01, 0x00, 0xE0,
+0x26, 0x19, 0x00, 0xE0, 0xA8, 0x1A, 0x02, 0xA7, 0xB2, 0xA6, 0x0F, 0xE4,
+0x46, 0x37, 0x0A, 0xE4, 0x42, 0x37, 0xC2, 0xA5, 0x18, 0xE2, 0x00, 0xC5,
+0x0C, 0xE4, 0x44, 0x37, 0x06, 0xE2, 0x80, 0xC7, 0x92, 0xA0, 0x03, 0xE0,
+0xC8, 0x36, 0xCA, 0x3F, 0x01, 0xE2, 0x7F, 0xC6, 0xCC, 0x3F, 0x0A, 0xE4,
+0xC8, 0x35, 0x82, 0x79, 0x01, 0xE2, 0xFF, 0xC5, 0x03, 0xE4, 0xC0, 0x36,
+0x83, 0x79, 0x61, 0x3E, 0x88, 0x7D, 0xEF, 0x3D, 0x00, 0xE0, 0x99, 0x19,
+0xFF, 0xE3, 0x7F, 0xC6, 0xFF, 0xE3, 0x7F, 0x14, 0x09, 0xD0, 0xC5, 0xC8,
+0x37, 0x83, 0x89, 0x89, 0x7D, 0xEE, 0x3D, 0x8D, 0x7F, 0xEC, 0x3F, 0x24,
+0x09, 0x00, 0x14, 0x00, 0xF0, 0x1A, 0x48, 0x36, 0x48, 0x37, 0x85, 0x79,
+0x09, 0xE0, 0xCC, 0x30, 0x02, 0xE0, 0x92, 0x89, 0x8A, 0x7F, 0x08, 0xE4,
+0xC6, 0x30, 0x02, 0xE0, 0x22, 0x89, 0x82, 0x67, 0x8B, 0x7D, 0x01, 0xE4,
+0xC4, 0x30, 0x83, 0x65, 0x0E, 0x7E, 0x6D, 0x3E, 0x0F, 0x7F, 0x6A, 0xEE,
+0x05, 0x90, 0xC4, 0x00, 0xE2, 0x01, 0xC4, 0x00, 0xE2, 0x83, 0xC0, 0x76,
+0x00, 0x40, 0x0D, 0xE4, 0xC8, 0x36, 0x16, 0x06, 0x04, 0x4A, 0x00, 0xF0,
+0x3B, 0x86, 0x79, 0x07, 0x79, 0x00, 0xE0, 0x18, 0x1B, 0x00, 0xE0, 0x93,
+0x19, 0x44, 0xA1, 0x04, 0x7D, 0x10, 0x7C, 0x91, 0x78, 0x92, 0x7C, 0x82,
+0x7F, 0x83, 0x7D, 0x0C, 0x7E, 0x13, 0x7F, 0x94, 0x7E, 0x88, 0xC1, 0x41,
+0xE0, 0x83, 0x8F, 0xFF, 0xEB, 0x7C, 0x7E, 0x82, 0xAF, 0x00, 0xE8, 0x00,
+0xC6, 0x40, 0xE0, 0xF3, 0x8F, 0x62, 0x3C, 0x92, 0xAF, 0x1C, 0x15, 0x40,
+0xE0, 0xE3, 0x8F, 0x8C, 0xA4, 0xA2, 0xAF, 0x08, 0xC4, 0x40, 0xE0, 0xD3,
+0x8F, 0xB2, 0xAF, 0xF6, 0x01, 0xF0, 0x5F, 0x40, 0xE0, 0xC3, 0x8F, 0xC2,
+0xAF, 0x40, 0xE0, 0xB3, 0x8F, 0xD2, 0xAF, 0x40, 0xE0, 0xA3, 0x8F, 0xE2,
+0xAF, 0x40, 0xE0, 0x93, 0x8F, 0xF2, 0xAF, 0xA8, 0xD0, 0x05, 0xE0, 0x8E,
+0x0E, 0x86, 0xA7, 0x01, 0xE0, 0xC8, 0x36, 0x04, 0xE0, 0xD2, 0xA8, 0x0C,
+0xE4, 0x48, 0x37, 0x01, 0xE0, 0xC8, 0x37, 0x05, 0xE0, 0x32, 0xAE, 0x08,
+0xE4, 0xC0, 0x36, 0x09, 0xE4, 0xC8, 0x36, 0x05, 0x66, 0x81, 0x78, 0x0A,
+0xE0, 0x48, 0x37, 0x04, 0xE0, 0xC2, 0xAE, 0x0B, 0xE4, 0x40, 0x37, 0x04,
+0xE0, 0x62, 0xAC, 0xE2, 0x3E, 0x04, 0xE0, 0xF2, 0xAC, 0x08, 0xE4, 0xC0,
+0x37, 0x05, 0xE0, 0xD2, 0xAF, 0x09, 0xE4, 0xC8, 0x37, 0x81, 0x67, 0x05,
+0xE0, 0x02, 0xAF, 0xAD, 0xC6, 0x05, 0xE0, 0x12, 0xAD, 0xBE, 0x06, 0xF0,
+0x66, 0xA2, 0xAD, 0x00, 0xE0, 0x4E, 0xC1, 0x44, 0xE0, 0x22, 0xAE, 0x3B,
+0xC7, 0x9D, 0xAF, 0x7F, 0x16, 0x89, 0x67, 0x2D, 0xAC, 0xBD, 0xAC, 0x43,
+0xE0, 0xD2, 0xAF, 0x8D, 0x67, 0x92, 0x60, 0x43, 0xE0, 0xC2, 0xAF, 0x8A,
+0x67, 0x11, 0x65, 0x43, 0xE0, 0xB2, 0xAF, 0x21, 0x35, 0x8E, 0x67, 0x93,
+0x65, 0x43, 0xE0, 0xA2, 0xAF, 0xC1, 0x3D, 0x8B, 0x67, 0x80, 0x10, 0x43,
+0xE0, 0x92, 0xAF, 0x8F, 0x67, 0x43, 0xE0, 0x82, 0xAF, 0x8C, 0x67, 0x42,
+0xE0, 0xB2, 0xAF, 0x82, 0x67, 0x9E, 0xAF, 0x83, 0x67, 0xAE, 0xAF, 0x94,
+0x67, 0xBE, 0xAF, 0x06, 0x67, 0x40, 0xE0, 0xA2, 0x8F, 0x41, 0xE0, 0x72,
+0xAF, 0x01, 0xE2, 0xF8, 0xC7, 0x10, 0x67, 0x40, 0xE0, 0xB2, 0xAD, 0xCE,
+0x3F, 0x07, 0x67, 0xCA, 0x3F, 0x41, 0xE0, 0x62, 0xAF, 0x04, 0x1E, 0x00,
+0xF0, 0x3E, 0xAF, 0x88, 0x67, 0x00, 0xE0, 0x92, 0x1D, 0x40, 0xE0, 0x92,
+0xAF, 0xF3, 0x3D, 0x41, 0xE0, 0xC2, 0x8F, 0x41, 0xE0, 0x52, 0xAF, 0x00,
+0xE2, 0xBF, 0xC7, 0xFF, 0xE7, 0x00, 0x17, 0xCE, 0x3F, 0x40, 0xE0, 0xC2,
+0xA8, 0x40, 0xE0, 0xD2, 0xA8, 0x40, 0xE0, 0xE2, 0xA8, 0x40, 0xE0, 0xF2,
+0xA8, 0x41, 0xE0, 0x82, 0xA8, 0x41, 0xE0, 0x92, 0xA8, 0x41, 0xE0, 0x22,
+0xAE, 0x41, 0xE0, 0x32, 0xAE, 0x41, 0xE0, 0xC2, 0xAF, 0xFE, 0xE7, 0xD4,
+0x01, 0x00, 0xE0, 0x1B, 0x1C, 0x15, 0x66, 0xEE, 0x08, 0xF5, 0x0E, 0x54,
+0xBE, 0x7C, 0xDD, 0x62, 0x3C, 0x8B, 0xDD, 0xFF, 0xEF, 0xAE, 0xD5, 0xFE,
+0xEF, 0x9C, 0xD7, 0xFA, 0x00, 0x00, 0xE0, 0xB0, 0x1F, 0xE8, 0x3C, 0x0F,
+0xA4, 0x01, 0xE0, 0xD1, 0x0C, 0x00, 0xF0, 0x33, 0x00, 0xE0, 0xF8, 0x00,
+0xFF, 0xFF, 0xE8, 0x3D, 0x00, 0xE2, 0x03, 0xCD, 0xAD, 0x05, 0x0C, 0xE0,
+0x49, 0x3C, 0x00, 0xE2, 0x03, 0xC6, 0x28, 0x2E, 0x7C, 0xC5, 0x0C, 0xE0,
+0x21, 0x35, 0x00, 0xE2, 0x18, 0xC6, 0x80, 0xE1, 0x99, 0xA7, 0x08, 0x26,
+0x00, 0xEA, 0x82, 0xCE, 0xAD, 0xE0, 0xCC, 0xCE, 0xAC, 0x3E, 0x6F, 0x3F,
+0x82, 0x3E, 0x70, 0xC5, 0x93, 0x06, 0x80, 0xE1, 0x19, 0xA7, 0x80, 0xE1,
+0x9B, 0xBF, 0x20, 0x00, 0x48, 0x80, 0xE1, 0x1B, 0xBF, 0x10, 0x00, 0x20,
+0x70, 0xC5, 0x12, 0x00, 0x20, 0x6F, 0x06, 0x10, 0x00, 0x70, 0x00, 0xE2,
+0x03, 0xC5, 0x7F, 0xC5, 0x87, 0x30, 0x00, 0x20, 0x86, 0x7F, 0x18, 0x00,
+0x70, 0xAE, 0x7B, 0x06, 0x82, 0x38, 0xFF, 0xFF, 0x72, 0x00, 0xF0, 0x07,
+0xB1, 0x05, 0x01, 0xE2, 0xFF, 0xC4, 0x0C, 0xE0, 0xA8, 0x34, 0xCC, 0x3C,
+0x0C, 0xE4, 0xA0, 0x34, 0xCC, 0x3C, 0x41, 0xE0, 0x48, 0x3E, 0x82, 0x00,
+0xE0, 0x0B, 0xE0, 0x18, 0x3E, 0x0D, 0xE0, 0x2C, 0x3D, 0x6D, 0x3E, 0x00,
+0xE2, 0x0C, 0xC6, 0xFD, 0x01, 0x10, 0x07, 0x80, 0x00, 0xE0, 0xCF, 0xAE,
+0xE0, 0xBC, 0xCF, 0xAC, 0x3F, 0x82, 0x3F, 0xFF, 0xE1, 0xF0, 0xC6, 0x8B,
+0x5C, 0x00, 0x14, 0xBC, 0x04, 0x00, 0x20, 0xF0, 0xC6, 0x06, 0x00, 0xF0,
+0x0A, 0x77, 0x06, 0x18, 0x3D, 0xC0, 0xE0, 0xBA, 0xAC, 0x9A, 0xAC, 0xAA,
+0xAC, 0x88, 0xAC, 0x98, 0xAC, 0xA8, 0xAC, 0x82, 0x38, 0xE8, 0x3D, 0x7F,
+0xC5, 0x85, 0x2C, 0x00, 0xF0, 0x02, 0xAC, 0x7F, 0xC5, 0x7D, 0x06, 0x82,
+0x38, 0x00, 0xE0, 0xD2, 0x24, 0xB3, 0x08, 0x40, 0xE0, 0x99, 0xA7, 0xCE,
+0x06, 0xF0, 0x35, 0x80, 0xCF, 0x7C, 0xC1, 0x02, 0x03, 0x1F, 0x39, 0xE8,
+0x39, 0xB8, 0xD0, 0x00, 0xE0, 0x3F, 0x1F, 0x8E, 0xA7, 0x6E, 0x3E, 0x87,
+0x2F, 0x92, 0xBF, 0x0E, 0xB9, 0x63, 0x3C, 0xA1, 0x09, 0x01, 0xE0, 0xAF,
+0x00, 0xF2, 0x3F, 0x9B, 0x02, 0x80, 0x15, 0x1F, 0xA7, 0x2D, 0xE1, 0x0B,
+0x3F, 0x2C, 0xE1, 0x2E, 0x39, 0xDC, 0x3E, 0x9F, 0x2E, 0x8F, 0xA6, 0x0C,
+0xE0, 0x9D, 0x3F, 0x72, 0x3E, 0x9C, 0x01, 0x02, 0xA6, 0x9C, 0x3E, 0x0C,
+0x00, 0xF0, 0x65, 0x7C, 0x3F, 0x8F, 0xBE, 0xE7, 0x01, 0x0E, 0xA6, 0x1E,
+0xA7, 0x9C, 0x3E, 0x0F, 0xE0, 0x9E, 0x0E, 0xE1, 0x00, 0x82, 0xA6, 0x0E,
+0xE0, 0x1D, 0x39, 0xFE, 0x3F, 0x85, 0x01, 0x0F, 0xE0, 0x0F, 0x0F, 0x1D,
+0x3F, 0x02, 0xBF, 0x92, 0xBF, 0x0C, 0xB9, 0xD5, 0x00, 0xEE, 0x3F, 0xDA,
+0x00, 0x84, 0x05, 0x8C, 0x17, 0x83, 0xBF, 0xCF, 0x00, 0x02, 0xA6, 0x0D,
+0xE0, 0x1C, 0x39, 0x7D, 0x3F, 0x85, 0x01, 0x0E, 0xE0, 0x8E, 0x0E, 0x9C,
+0x3E, 0x82, 0xBE, 0x12, 0xBF, 0x1F, 0xB9, 0xC3, 0x00, 0x82, 0x38, 0xB5,
+0x08, 0xE9, 0x3F, 0x83, 0xC7, 0x7C, 0x17, 0xDE, 0x3F, 0x88, 0xC7, 0x00,
+0xE2, 0x8C, 0xCF, 0x0C, 0x12, 0x64, 0xE0, 0xAF, 0x3B, 0x0F, 0xE4, 0x4F,
+0x32, 0xE8, 0x39, 0x84, 0x2F, 0x29, 0xE1, 0x94, 0x3C, 0x85, 0x24, 0x44,
+0x00, 0xF1, 0x0A, 0x00, 0x14, 0xE1, 0x0A, 0x5B, 0xD0, 0x00, 0xE0, 0xBF,
+0x1F, 0x0F, 0xA7, 0xEF, 0x3E, 0x6E, 0x39, 0x14, 0x29, 0x00, 0xE0, 0xBD,
+0x1A, 0x85, 0xA7, 0x85, 0x10, 0x07, 0xF0, 0x0F, 0x3F, 0xD0, 0x05, 0xBC,
+0xE4, 0x3C, 0x63, 0x3C, 0x3B, 0xD0, 0xFF, 0xE3, 0x7F, 0xCC, 0xAA, 0x01,
+0x8C, 0x17, 0x63, 0x3C, 0x83, 0xBF, 0x44, 0xD0, 0xE5, 0x00, 0x82, 0xA7,
+0xA4, 0x3F, 0xFE, 0x00, 0x50, 0x1D, 0x04, 0x00, 0xE2, 0x8B, 0x74, 0x08,
+0xF1, 0x3B, 0xBF, 0x1F, 0x39, 0x02, 0xBA, 0x85, 0x00, 0x72, 0x3F, 0x92,
+0xA7, 0x91, 0x01, 0x8D, 0xBF, 0x63, 0x3C, 0x31, 0xD0, 0x62, 0x3C, 0xF8,
+0x17, 0x62, 0x3F, 0x0B, 0xC4, 0x04, 0xC7, 0x5F, 0x3C, 0x0F, 0xE0, 0x2E,
+0x3C, 0xCB, 0x27, 0x1F, 0x39, 0x28, 0x3F, 0x02, 0xBF, 0xC7, 0x00, 0x9E,
+0xBF, 0xF0, 0x00, 0x62, 0x3F, 0x12, 0xA1, 0xC9, 0x00, 0x68, 0x39, 0x03,
+0xC1, 0xFC, 0x17, 0x5F, 0x39, 0x72, 0x3C, 0x61, 0x01, 0x09, 0xE0, 0x28,
+0x39, 0x63, 0x3C, 0x05, 0x6C, 0x00, 0xF1, 0x04, 0xDA, 0x01, 0xCA, 0x00,
+0xB3, 0x08, 0x00, 0xE0, 0x09, 0x19, 0x80, 0x17, 0xE8, 0x39, 0x69, 0x3C,
+0x82, 0xBF, 0x0A, 0x18, 0x00, 0xA0, 0x84, 0x01, 0x82, 0xA7, 0x82, 0x27,
+0x83, 0xBF, 0xE1, 0x09, 0xE2, 0x08, 0xF0, 0x23, 0xB1, 0x08, 0x83, 0xEB,
+0x40, 0x7F, 0x03, 0xC4, 0xFC, 0x17, 0x00, 0xE8, 0x02, 0xC7, 0xD8, 0x3F,
+0x0E, 0xA4, 0xEF, 0x3E, 0x0C, 0xE0, 0x20, 0x3C, 0x02, 0xE0, 0x80, 0xC6,
+0x9C, 0x3E, 0xFC, 0x3E, 0x86, 0x03, 0x08, 0xD0, 0x8C, 0x17, 0x88, 0xBF,
+0x7F, 0x14, 0xE1, 0x08, 0x98, 0x3F, 0x8E, 0xBF, 0xFD, 0x00, 0xE3, 0x01,
+0x00, 0xB6, 0x02, 0xF2, 0x0C, 0x0F, 0xA4, 0x82, 0x38, 0x70, 0x19, 0x02,
+0x00, 0x9C, 0x19, 0x02, 0x00, 0xB4, 0x19, 0x02, 0x00, 0x5E, 0x19, 0x02,
+0x00, 0xC8, 0x19, 0x02, 0x00, 0x00, 0xB0, 0x04, 0x04, 0x00, 0xF2, 0x06,
+0xF0, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x98, 0x20, 0x02, 0x00, 0x4E,
+0x20, 0x02, 0x00, 0x20, 0x30, 0x05, 0x00, 0x6C, 0x1E, 0x1C, 0x00, 0xF8,
+0x9D, 0x80, 0x1E, 0x04, 0x00, 0xF8, 0x28, 0x02, 0x00, 0xC4, 0x29, 0x02,
+0x00, 0xD6, 0x27, 0x02, 0x00, 0xAC, 0x27, 0x02, 0x00, 0xC0, 0x27, 0x02,
+0x00, 0x32, 0x00, 0x00, 0x00, 0x18, 0x2C, 0x02, 0x00, 0x33, 0x00, 0x00,
+0x00, 0xFA, 0x2E, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00, 0x28, 0x30, 0x02,
+0x00, 0x02, 0x00, 0xFF, 0xFF, 0xAA, 0x39, 0x02, 0x00, 0x26, 0x34, 0x02,
+0x00, 0xA4, 0x39, 0x02, 0x00, 0xFA, 0x33, 0x02, 0x00, 0x36, 0x39, 0x02,
+0x00, 0x28, 0x39, 0x02, 0x00, 0xE2, 0x32, 0x02, 0x00, 0x40, 0x3F, 0x02,
+0x00, 0x4C, 0x3F, 0x02, 0x00, 0x5A, 0x3F, 0x02, 0x00, 0x68, 0x3F, 0x02,
+0x00, 0x76, 0x3F, 0x02, 0x00, 0x86, 0x3F, 0x02, 0x00, 0x96, 0x3F, 0x02,
+0x00, 0x3C, 0x3F, 0x02, 0x00, 0xA6, 0x3F, 0x02, 0x00, 0xEE, 0x4B, 0x02,
+0x00, 0x08, 0x4C, 0x02, 0x00, 0x16, 0x4C, 0x02, 0x00, 0x24, 0x4C, 0x02,
+0x00, 0xEC, 0x4B, 0x02, 0x00, 0xFA, 0x4B, 0x02, 0x00, 0x01, 0x00, 0xF0,
+0xDF, 0x06, 0x00, 0x2C, 0x00, 0x30, 0xD8, 0x00, 0x00, 0x00, 0x17, 0x00,
+0x00, 0xC0, 0xCC, 0xDB, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x04,
+0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x00, 0x20, 0xF0, 0xFF, 0x06, 0x00,
+0x22, 0xFF, 0x0F, 0x0E, 0x00, 0xF0, 0x09, 0xFF, 0xFF, 0x0D, 0x1A, 0x00,
+0x00, 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01, 0x10, 0x50, 0x00,
+0x00, 0x6A, 0x06, 0xFF, 0xEF, 0xC0, 0x3B, 0x08, 0x00, 0x40, 0xAF, 0xE9,
+0x80, 0x87, 0x08, 0x00, 0x40, 0xD7, 0xEC, 0x00, 0xFF, 0x08, 0x00, 0x40,
+0x6B, 0xE6, 0xF0, 0xF1, 0x08, 0x00, 0x40, 0xCA, 0xEC, 0xF0, 0x13, 0x08,
+0x00, 0x40, 0x65, 0xE6, 0xD0, 0xD7, 0x08, 0x00, 0x40, 0x32, 0xEB, 0xB0,
+0x5F, 0x08, 0x00, 0x40, 0x99, 0xE5, 0x50, 0x4F, 0x08, 0x00, 0x40, 0xCC,
+0xEA, 0xB0, 0x6E, 0x08, 0x00, 0x40, 0x66, 0xED, 0x70, 0x2D, 0x08, 0x00,
+0x40, 0xB3, 0xEE, 0xD0, 0xAA, 0x08, 0x00, 0x40, 0x59, 0xEF, 0x90, 0xA5,
+0x08, 0x00, 0x40, 0xAC, 0xE7, 0x30, 0xBB, 0x08, 0x00, 0x40, 0xD6, 0xE3,
+0x70, 0x86, 0x08, 0x00, 0x40, 0xEB, 0xE1, 0xD0, 0xFC, 0x08, 0x00, 0x40,
+0xF5, 0xE0, 0x60, 0xF6, 0x08, 0x00, 0x40, 0x85, 0xEF, 0x30, 0xE3, 0x08,
+0x00, 0x40, 0x3D, 0xE8, 0xA0, 0xC9, 0x08, 0x00, 0x40, 0xE1, 0xEB, 0xB0,
+0x9C, 0x08, 0x00, 0x40, 0x0F, 0xEA, 0xA0, 0x36, 0x08, 0x00, 0x40, 0xF8,
+0xEA, 0x60, 0x9D, 0x08, 0x00, 0x40, 0x7C, 0xED, 0xE0, 0xCA, 0x08, 0x00,
+0x40, 0xBE, 0xE6, 0xE0, 0x65, 0x08, 0x00, 0xF0, 0x27, 0x5F, 0xE3, 0x43,
+0x69, 0x72, 0x71, 0x75, 0x65, 0x00, 0x00, 0x53, 0x70, 0x69, 0x64, 0x65,
+0x72, 0x4D, 0x65, 0x61, 0x73, 0x00, 0x00, 0x30, 0x31, 0x32, 0x33, 0x41,
+0x42, 0x00, 0x00, 0x88, 0x04, 0x35, 0x12, 0x14, 0x00, 0x00, 0x00, 0xF4,
+0x5A, 0x02, 0x00, 0xFC, 0x5A, 0x02, 0x00, 0x08, 0x5B, 0x02, 0x00, 0x1E,
+0x00, 0x00, 0x00, 0xA7, 0x01, 0xB1, 0x7A, 0x00, 0x00, 0x00, 0x34, 0x00,
+0x00, 0x00, 0x58, 0x5B, 0x02, 0x12, 0x01, 0x13, 0x40, 0x08, 0x00, 0x22,
+0x00, 0x03, 0x14, 0x00, 0xF4, 0x22, 0x4C, 0x5B, 0x02, 0x00, 0x78, 0x59,
+0x02, 0x00, 0x80, 0x59, 0x02, 0x00, 0x88, 0x59, 0x02, 0x00, 0x06, 0x01,
+0xFF, 0x09, 0x02, 0xA1, 0x01, 0x09, 0x00, 0x85, 0x07, 0x15, 0x00, 0x26,
+0xFF, 0x00, 0x75, 0x08, 0x96, 0x12, 0x02, 0xB1, 0x02, 0xC0, 0x06, 0x00,
+0xFF, 0x09, 0x01, 0xA1, 0x01, 0x85, 0x0F, 0x16, 0x00, 0xB0, 0x82, 0x07,
+0x09, 0x01, 0x81, 0x02, 0x09, 0x01, 0x91, 0x02, 0xC0, 0x52, 0x00, 0x00,
+0x4A, 0x02, 0x51, 0x43, 0x72, 0x6F, 0x53, 0xAC, 0x0A, 0x00, 0x51, 0x00,
+0x20, 0x38, 0x00, 0x01, 0x02, 0x00, 0x93, 0xE8, 0x32, 0x04, 0x00, 0x8C,
+0x29, 0x04, 0x00, 0x0A, 0xA2, 0x00, 0x40, 0xED, 0x5F, 0xB8, 0x28, 0x21,
+0x00, 0x71, 0x94, 0x5B, 0x02, 0x00, 0xDC, 0x32, 0x04, 0x8B, 0x00, 0x15,
+0x80, 0xBE, 0x01, 0x32, 0x01, 0x20, 0x30, 0x40, 0x00, 0x0B, 0x01, 0x00,
+0x2F, 0x03, 0x00, 0x01, 0x00, 0x03, 0x50, 0x0E, 0x20, 0x14, 0x00, 0x01,
+0x06, 0x02, 0x23, 0x00, 0xE4, 0x4C, 0x00, 0x60, 0x00, 0x00, 0x16, 0x20,
+0x14, 0x00, 0x92, 0x00, 0x11, 0x1F, 0x0E, 0x00, 0x20, 0xFC, 0x1C, 0x18,
+0x00, 0x11, 0x0A, 0x28, 0x00, 0xF3, 0x02, 0x09, 0x00, 0x01, 0x00, 0xE9,
+0x32, 0x04, 0x00, 0x90, 0x29, 0x04, 0x00, 0x43, 0x72, 0x77, 0x53, 0x16,
+0x3C, 0x00, 0xF9, 0x00, 0x00, 0x64, 0x00, 0x2C, 0x01, 0xB0, 0x04, 0x88,
+0x13, 0x00, 0xFF, 0xFF, 0x18, 0x5A, 0x02, 0x62, 0x00, 0xF1, 0x18, 0x90,
+0x04, 0x04, 0x00, 0x0A, 0x33, 0x04, 0x00, 0x04, 0x33, 0x04, 0x00, 0x05,
+0x33, 0x04, 0x00, 0x24, 0x1D, 0x04, 0x00, 0x90, 0x5B, 0x02, 0x00, 0x8C,
+0x3A, 0x04, 0x00, 0x96, 0x23, 0x02, 0x00, 0x40, 0x59, 0x02, 0x00, 0x9C,
+0x5B, 0x02, 0xD0, 0x00, 0x51, 0xF6, 0x23, 0x02, 0x00, 0x80, 0x52, 0x00,
+0x51, 0x04, 0x00, 0x0C, 0x00, 0x05, 0x8C, 0x01, 0x50, 0x34, 0x5A, 0x02,
+0x00, 0x44, 0x24, 0x00, 0xF0, 0x11, 0x29, 0x04, 0x00, 0x2A, 0x19, 0x02,
+0x00, 0x24, 0x2A, 0x04, 0x00, 0x08, 0x5A, 0x02, 0x00, 0x0C, 0x5A, 0x02,
+0x00, 0x8C, 0x5B, 0x02, 0x00, 0xF0, 0x05, 0x04, 0x00, 0x8C, 0x00, 0x04,
+0x00, 0x28, 0x18, 0x00, 0xC1, 0x00, 0x05, 0x00, 0x30, 0x2A, 0x04, 0x00,
+0x3C, 0x59, 0x02, 0x00, 0x64, 0x48, 0x00, 0xF0, 0x18, 0x05, 0x00, 0xAA,
+0x23, 0x02, 0x00, 0xF5, 0x17, 0x02, 0x00, 0x84, 0x00, 0x04, 0x00, 0xEC,
+0x59, 0x02, 0x00, 0x96, 0x1D, 0x02, 0x00, 0x10, 0x5A, 0x02, 0x00, 0x64,
+0x59, 0x02, 0x00, 0x5C, 0x2A, 0x04, 0x00, 0x00, 0x08, 0x05, 0x00, 0x68,
+0xB4, 0x03, 0xF1, 0x0B, 0xD0, 0x04, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x86,
+0x4C, 0x02, 0x00, 0x28, 0x1D, 0x04, 0x00, 0x00, 0x10, 0x05, 0x00, 0x48,
+0x59, 0x02, 0x00, 0x40, 0x5C, 0x02, 0x1C, 0x01, 0x39, 0x01, 0x01, 0x6C,
+0x01, 0xF0, 0x2D, 0xC0, 0x04, 0x00, 0x78, 0x00, 0x04, 0x00, 0x50, 0x1E,
+0x04, 0x00, 0x54, 0x1E, 0x04, 0x00, 0x5A, 0x1E, 0x04, 0x00, 0x2C, 0x1E,
+0x04, 0x00, 0x8C, 0x05, 0x04, 0x00, 0x94, 0x29, 0x04, 0x00, 0x04, 0x00,
+0x05, 0x00, 0x98, 0x29, 0x04, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x1C, 0x1D,
+0x04, 0x00, 0xAC, 0x04, 0x04, 0x00, 0x00, 0x28, 0x05, 0x00, 0x88, 0x1B,
+0x02, 0x00, 0x20, 0x54, 0x00, 0xF1, 0x0A, 0x20, 0x05, 0x00, 0xC1, 0x62,
+0x9B, 0xD8, 0xFF, 0xFF, 0x00, 0xFF, 0x5A, 0x5A, 0xA5, 0xA5, 0xFF, 0xFF,
+0xFF, 0x00, 0x01, 0x00, 0x1E, 0x00, 0x01, 0x00, 0x6C, 0x02, 0x50, 0x01,
+0x05, 0x00, 0x06, 0x00, 0x14, 0x00, 0x80, 0xF0, 0xFF, 0xFF, 0x00, 0x43,
+0x66, 0x67, 0x20, 0x10, 0x02, 0xF1, 0x00, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
+0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x31, 0x00, 0x04, 0x20, 0x00,
+0xB1, 0x40, 0x10, 0x05, 0x00, 0x60, 0x08, 0x05, 0x00, 0x0C, 0x20, 0x05,
+0x54, 0x00, 0x10, 0x14, 0x08, 0x00, 0xF0, 0x15, 0x80, 0x03, 0x00, 0xFF,
+0x7F, 0xFC, 0xFF, 0x08, 0x20, 0x05, 0x00, 0x18, 0x20, 0x05, 0x00, 0x04,
+0x20, 0x05, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0x40, 0x0D, 0x03, 0x00, 0x70,
+0x18, 0x02, 0x00, 0xA0, 0x18, 0x02, 0x00, 0x28, 0xD0, 0x00, 0x01, 0xD6,
+0x03, 0x45, 0xFF, 0xFF, 0x08, 0x18, 0xA8, 0x01, 0x16, 0x01, 0x06, 0x00,
+0x12, 0x01, 0x08, 0x00, 0x16, 0x01, 0x03, 0x00, 0x03, 0x05, 0x00, 0x04,
+0x07, 0x00, 0x17, 0x01, 0x07, 0x00, 0x00, 0x03, 0x00, 0x04, 0x07, 0x00,
+0x02, 0x05, 0x00, 0x03, 0x06, 0x00, 0x09, 0x01, 0x00, 0x15, 0x02, 0x06,
+0x00, 0x16, 0x02, 0x03, 0x00, 0x03, 0x05, 0x00, 0x14, 0x02, 0x05, 0x00,
+0x03, 0x03, 0x00, 0x03, 0x05, 0x00, 0x0A, 0x01, 0x00, 0x13, 0x03, 0x05,
+0x00, 0x04, 0x03, 0x00, 0x07, 0x02, 0x00, 0x03, 0x03, 0x00, 0x01, 0x04,
+0x00, 0x06, 0x07, 0x00, 0x00, 0x01, 0x00, 0x16, 0x04, 0x07, 0x00, 0x16,
+0x04, 0x03, 0x00, 0x09, 0x02, 0x00, 0x06, 0x03, 0x00, 0x05, 0x04, 0x00,
+0x04, 0x06, 0x00, 0x06, 0x01, 0x00, 0x2B, 0x03, 0x05, 0x11, 0x00, 0x7E,
+0x00, 0x4F, 0x04, 0x04, 0x04, 0x05, 0x0A, 0x00, 0x0A, 0x0A, 0x0F, 0x00,
+0x07, 0x50, 0x00, 0x06, 0x61, 0x00, 0x07, 0x7C, 0x00, 0x02, 0x89, 0x00,
+0x01, 0x08, 0x00, 0x03, 0x03, 0x00, 0x04, 0xBB, 0x00, 0x07, 0x01, 0x00,
+0x03, 0xE3, 0x00, 0x05, 0xF8, 0x00, 0x03, 0x03, 0x00, 0x09, 0x01, 0x00,
+0x04, 0x44, 0x01, 0x04, 0x5D, 0x01, 0x05, 0x7A, 0x01, 0x17, 0x01, 0xA8,
+0x01, 0x04, 0xC9, 0x01, 0x1F, 0x00, 0x25, 0x04, 0x02, 0x0F, 0x01, 0x00,
+0xDE, 0xF7, 0x20, 0x11, 0x90, 0x21, 0x08, 0xA4, 0x90, 0x00, 0x00, 0x04,
+0xD0, 0x40, 0x00, 0x0E, 0xD0, 0x20, 0x00, 0x47, 0xC1, 0xC0, 0xFF, 0x42,
+0xCA, 0x00, 0x00, 0x40, 0xA0, 0x40, 0x00, 0x48, 0xA0, 0x00, 0x00, 0x11,
+0x84, 0x00, 0x00, 0xA4, 0x84, 0x00, 0x00, 0x04, 0xE4, 0x40, 0x00, 0x0C,
+0xE4, 0x20, 0x30, 0x00, 0x20, 0xC0, 0x02, 0x23, 0x01, 0x3B, 0x0C, 0xD0,
+0x00, 0x34, 0x00, 0x20, 0xC0, 0x02, 0x34, 0x00, 0x28, 0x48, 0x80, 0x38,
+0x00, 0x89, 0xC0, 0x02, 0x0C, 0xE4, 0x00, 0x00, 0x0C, 0xC4, 0x3C, 0x00,
+0x10, 0x09, 0x3C, 0x00, 0x04, 0x04, 0x00, 0x0B, 0x44, 0x00, 0x10, 0x09,
+0x40, 0x00, 0x08, 0x04, 0x00, 0x07, 0x4C, 0x00, 0x30, 0x09, 0x0C, 0xC4,
+0x4C, 0x00, 0x04, 0x04, 0x00, 0x08, 0x54, 0x00, 0x11, 0x00, 0x90, 0x00,
+0xE1, 0x44, 0xC0, 0x80, 0x00, 0x46, 0xC0, 0x20, 0x00, 0x07, 0xC1, 0xC0,
+0xFF, 0x02, 0xCA, 0x19, 0x06, 0x82, 0x02, 0x08, 0x80, 0x00, 0x00, 0x40,
+0x84, 0xC0, 0x48, 0x00, 0xE5, 0x80, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x02,
+0x0C, 0xC0, 0x00, 0x00, 0x04, 0xC0, 0xE0, 0x08, 0x01, 0x22, 0x48, 0x42,
+0x0C, 0x04, 0xF1, 0x04, 0x30, 0x3B, 0x02, 0x00, 0x70, 0x3C, 0x02, 0x00,
+0x88, 0x3D, 0x02, 0x00, 0xDC, 0x04, 0x04, 0x00, 0xB4, 0x04, 0x04, 0x29,
+0x02, 0xFF, 0x06, 0xDC, 0x3F, 0x02, 0x00, 0xC8, 0x04, 0x04, 0x00, 0x02,
+0x40, 0x02, 0x00, 0x0A, 0x40, 0x02, 0x00, 0x80, 0x29, 0x04, 0x00, 0x02,
+0x50, 0x01, 0x00, 0xFA, 0x03, 0x26, 0x3F, 0x02, 0x00, 0xF0, 0x04, 0x04,
+0x00, 0xBA, 0x3F, 0x02, 0x00, 0xC2, 0x3F, 0x02, 0x00, 0x88, 0x05, 0x28,
+0x00, 0x44, 0x84, 0x05, 0x04, 0x00, 0x66, 0x06, 0x01, 0x18, 0x00, 0x00,
+0xA8, 0x04, 0x03, 0x18, 0x00, 0x00, 0x10, 0x00, 0x1B, 0x04, 0x10, 0x00,
+0x1B, 0x08, 0x10, 0x00, 0x1B, 0x0C, 0x10, 0x00, 0x1B, 0x10, 0x10, 0x00,
+0x1B, 0x14, 0x10, 0x00, 0x1B, 0x18, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10,
+0x9E, 0xF8, 0x01, 0x43, 0x04, 0x00, 0x00, 0x90, 0x14, 0x00, 0xF0, 0x03,
+0xD8, 0x4B, 0x02, 0x00, 0xA4, 0x05, 0x04, 0x00, 0x36, 0x4C, 0x02, 0x00,
+0x3E, 0x4C, 0x02, 0x00, 0xF4, 0x1C, 0xC6, 0x05, 0x00, 0x3A, 0x06, 0xB0,
+0x00, 0x00, 0xAC, 0x0A, 0x04, 0x00, 0x48, 0x12, 0x00, 0x00, 0x4E, 0x4B,
+0x01, 0x20, 0x06, 0x04, 0x97, 0x06, 0x01, 0x50, 0x00, 0x08, 0x0C, 0x00,
+0x6F, 0x00, 0x9B, 0x5C, 0x2B, 0x04, 0x00, 0x80, 0x07, 0x00, 0x00, 0x20,
+0x18, 0x00, 0x08, 0x01, 0x00, 0x31, 0x10, 0x00, 0x00, 0x58, 0x00, 0x00,
+0x50, 0x00, 0x13, 0x3C, 0x34, 0x00, 0xFF, 0x00, 0xF4, 0x32, 0x04, 0x00,
+0x30, 0x06, 0x04, 0x00, 0x60, 0x06, 0x04, 0x00, 0x64, 0x06, 0x04, 0x91,
+0x03, 0x02, 0x00, 0x1C, 0x00, 0xFF, 0x04, 0xA4, 0x0A, 0x04, 0x00, 0x88,
+0x0A, 0x04, 0x00, 0x84, 0x29, 0x04, 0x00, 0x84, 0x0A, 0x04, 0x00, 0x80,
+0x0A, 0x04, 0xBD, 0x03, 0x06, 0xF0, 0x09, 0xC0, 0x00, 0x00, 0xC0, 0x01,
+0x00, 0xF0, 0xDF, 0x06, 0x00, 0x2C, 0x00, 0x30, 0xD8, 0x00, 0x00, 0x00,
+0x17, 0x00, 0x00, 0xC0, 0xCC, 0xDB, 0xF0, 0x31, 0x00, 0x01, 0x9C, 0x00,
+0x0F, 0xF0, 0x05, 0xFF, 0x49, 0x05, 0x00, 0x0F, 0xF0, 0x05, 0xFF, 0xF6,
+0x4B, 0x00, 0x0F, 0xF0, 0x05, 0x89, 0x5F, 0x20, 0x01, 0x01, 0x00, 0xFF,
+0x19, 0x01, 0x01, 0xB0, 0x6E, 0x00, 0x00, 0x10, 0x32, 0x54, 0x76, 0x98,
+0xBA, 0xDC, 0xFE, 0x0F, 0x00, 0x35, 0x40, 0x07, 0x00, 0x1D, 0x06, 0x4F,
+0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x09, 0x01, 0x24, 0x00, 0x01, 0x59,
+0x00, 0x41, 0x03, 0x12, 0x80, 0x00, 0x77, 0x04, 0xE1, 0xC3, 0x17, 0x00,
+0x00, 0x0C, 0x1B, 0x30, 0x80, 0xFF, 0xFF, 0x55, 0x00, 0x00, 0xE0, 0x7D,
+0x04, 0x0F, 0x6C, 0x02, 0xDF, 0x05, 0x00, 0x0F, 0x01, 0x00, 0xFF, 0xF6,
+0x05, 0x00, 0x0F, 0x01, 0x00, 0xFF, 0xF6, 0x05, 0x00, 0x0F, 0x01, 0x00,
+0xFF, 0xF6, 0x05, 0x00, 0x0F, 0x01, 0x00, 0xFF, 0xF6, 0x05, 0x00, 0x0F,
+0x01, 0x00, 0xFF, 0xF6, 0x05, 0x00, 0x0F, 0x01, 0x00, 0xFF, 0xF6, 0x05,
+0x00, 0x0F, 0x01, 0x00, 0xFF, 0xF6, 0x05, 0x00, 0x0F, 0x01, 0x00, 0xFF,
+0xF6, 0x26, 0x00, 0x0F, 0x01, 0x00, 0xB5, 0x1F, 0x01, 0x1C, 0x00, 0x08,
+0x17, 0x80, 0x0C, 0x00, 0xFF, 0x00, 0x68, 0x4C, 0x02, 0x00, 0x94, 0x59,
+0x02, 0x00, 0x4C, 0x59, 0x02, 0x00, 0x2C, 0x1D, 0x04, 0x28, 0x01, 0xDE,
+0x40, 0x90, 0x3A, 0x04, 0x00, 
+};
+const unsigned long Cirque_Oly1p2_SpiderMeas_BL_Z_start       = 0x00021820;
+const unsigned long Cirque_Oly1p2_SpiderMeas_BL_Z_length      = 0x00006374;
+const unsigned long Cirque_Oly1p2_SpiderMeas_BL_Z_checksum    = 0xE2374C82;
+
+#endif // FIRMWARE_Cirque_Oly1p2_SpiderMeas_BL_Z
@@ -0,0 +1,138 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <string.h>
+
+#include "Fletcher32.h"
+#include "FirmwareImage.h"
+
+static uint16_t get16(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void put16(uint8_t *data, uint16_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+}
+
+static void put32(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//Public Functions
+///////////////////////////////////////////////////////////////////////////////
+
+bool FWImage_open(fwimage *image, const uint8_t *data, uint32_t size)
+{
+    const uint8_t *entry;
+    uint32_t headerSize;
+    uint32_t address;
+    uint32_t regionSize;
+    uint32_t offset;
+    uint32_t end = 0;
+    uint8_t i;
+
+    if ((size < FWIMAGE_HEADER_SIZE(1)) || (get32(data) != FWIMAGE_MAGIC) || (data[4] != FWIMAGE_VERSION) ||
+        (data[5] == 0) || (data[5] > FWIMAGE_MAX_REGIONS))
+    {
+        return false;
+    }
+    headerSize = FWIMAGE_HEADER_SIZE(data[5]);
+    if ((get16(&data[6]) != headerSize) || (size < headerSize) ||
+        (Fletcher32(data, headerSize - 4) != get32(&data[headerSize - 4])))
+    {
+        return false;
+    }
+
+    // each region's data is in the container, and they're in order
+    for (i = 0; i < data[5]; i++)
+    {
+        entry = &data[20 + (i * FWIMAGE_REGION_SIZE)];
+        address = get32(&entry[0]);
+        regionSize = get32(&entry[4]);
+        offset = get32(&entry[8]);
+        if ((regionSize == 0) || (regionSize & 1) || (offset < headerSize) || (offset > size) ||
+            (regionSize > size - offset) || ((i > 0) && (address < end)) || (address + regionSize < address))
+        {
+            return false;
+        }
+        end = address + regionSize;
+    }
+
+    image->data = data;
+    image->size = size;
+    image->regionCount = data[5];
+    image->vendorId = get16(&data[8]);
+    image->productId = get16(&data[10]);
+    image->revision = get16(&data[12]);
+    image->entryPoint = get32(&data[16]);
+    return true;
+}
+
+
+bool FWImage_region(const fwimage *image, uint8_t index, fwimage_region *region)
+{
+    const uint8_t *entry;
+
+    if (index >= image->regionCount)
+    {
+        return false;
+    }
+    entry = &image->data[20 + (index * FWIMAGE_REGION_SIZE)];
+    region->address = get32(&entry[0]);
+    region->size = get32(&entry[4]);
+    region->checksum = get32(&entry[12]);
+    region->data = &image->data[get32(&entry[8])];
+    return true;
+}
+
+
+uint32_t FWImage_build(uint8_t *out, uint32_t outSize, const fwimage *image, const fwimage_region *regions)
+{
+    uint32_t headerSize = FWIMAGE_HEADER_SIZE(image->regionCount);
+    uint32_t offset = headerSize;
+    uint8_t *entry;
+    uint8_t i;
+
+    if ((image->regionCount == 0) || (image->regionCount > FWIMAGE_MAX_REGIONS) || (outSize < headerSize))
+    {
+        return 0;
+    }
+    memset(out, 0, headerSize);
+    put32(&out[0], FWIMAGE_MAGIC);
+    out[4] = FWIMAGE_VERSION;
+    out[5] = image->regionCount;
+    put16(&out[6], (uint16_t)headerSize);
+    put16(&out[8], image->vendorId);
+    put16(&out[10], image->productId);
+    put16(&out[12], image->revision);
+    put32(&out[16], image->entryPoint);
+
+    for (i = 0; i < image->regionCount; i++)
+    {
+        if ((regions[i].size == 0) || (regions[i].size & 1) || (regions[i].size > outSize - offset))
+        {
+            return 0;
+        }
+        entry = &out[20 + (i * FWIMAGE_REGION_SIZE)];
+        put32(&entry[0], regions[i].address);
+        put32(&entry[4], regions[i].size);
+        put32(&entry[8], offset);
+        put32(&entry[12], Fletcher32(regions[i].data, regions[i].size));
+        memcpy(&out[offset], regions[i].data, regions[i].size);
+        offset += regions[i].size;
+    }
+    put32(&out[headerSize - 4], Fletcher32(out, headerSize - 4));
+    return offset;
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#ifndef FIRMWARE_IMAGE_H
+#define FIRMWARE_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* A firmware image with what's needed to program it (ImagePackager makes them), for
+ * BL_program_container: the hardware it's for, its entry point, and its regions, each with
+ * the Fletcher32 FormatRegion wants. A sparse build is a region for each piece of it, so the
+ * gaps aren't written.
+ *
+ * Everything is little endian. The header:
+ *    0  magic, FWIMAGE_MAGIC ("CQFW")
+ *    4  version, FWIMAGE_VERSION
+ *    5  regionCount, FWIMAGE_MAX_REGIONS at most
+ *    6  headerSize (uint16), FWIMAGE_HEADER_SIZE(regionCount)
+ *    8  vendorId, productId, revision (uint16 each): the part's HWID, 0 matches any
+ *   14  reserved (uint16)
+ *   16  entryPoint (uint32)
+ *   20  the regions, in address order without overlapping, FWIMAGE_REGION_SIZE each:
+ *          address (uint32), where it goes
+ *          size (uint32), even
+ *          offset (uint32), of its data from the start of the container
+ *          checksum (uint32), Fletcher32 of its data
+ * then the Fletcher32 of all that (uint32), and the regions' data.
+ */
+
+#define FWIMAGE_MAGIC (0x57465143)  // "CQFW"
+#define FWIMAGE_VERSION (1)
+#define FWIMAGE_MAX_REGIONS (8)
+#define FWIMAGE_REGION_SIZE (16)
+#define FWIMAGE_HEADER_SIZE(regionCount) (24 + ((regionCount) * FWIMAGE_REGION_SIZE))
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t size;
+    uint32_t checksum;
+    const uint8_t *data;    // in the container
+} fwimage_region;
+
+// A container as FWImage_open found it. Nothing is copied out of it: the regions' data is
+// programmed from where it is.
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+    uint8_t regionCount;
+    uint16_t vendorId;
+    uint16_t productId;
+    uint16_t revision;
+    uint32_t entryPoint;
+} fwimage;
+
+// returns false if it isn't a container, its header is corrupt, or its regions don't fit in it
+bool FWImage_open(fwimage *image, const uint8_t *data, uint32_t size);
+// region index (0..regionCount - 1), returns false if there isn't one
+bool FWImage_region(const fwimage *image, uint8_t index, fwimage_region *region);
+// Puts a container in out: image's hardware and entry point (its regionCount of them), and
+// each region's address, size and data, the checksums are worked out.
+// returns its size, 0 if it doesn't fit in outSize or the regions can't be put in one
+uint32_t FWImage_build(uint8_t *out, uint32_t outSize, const fwimage *image, const fwimage_region *regions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FIRMWARE_IMAGE_H
@@ -1,24 +1,61 @@
+#include <string.h>
+
 #include "Fletcher16.h"
 
+// bytes between reductions, the most that can't overflow sum2 starting from twice folded sums
+#define FLETCHER16_BLOCK_BYTES (5551)
+
+/*
+ * Reads the data a 32 bit word at a time from a 4 byte boundary, and only reduces the sums
+ * every FLETCHER16_BLOCK_BYTES. The result is the same as reducing them more often.
+ */
 uint16_t Fletcher16_Continue(uint8_t const* data, uint32_t bytes, uint16_t previousChecksum)
 {
-    uint16_t sum1 = previousChecksum & 0xff, sum2 = (previousChecksum >> 8) & 0xff;
+    uint32_t sum1 = previousChecksum & 0xff, sum2 = (previousChecksum >> 8) & 0xff;
+    uint32_t tlen;
+    uint32_t word;
+    uint32_t b0, b1, b2, b3;
 
     while (bytes)
     {
-        uint32_t tlen = bytes > 20 ? 20 : bytes;
+        tlen = bytes > FLETCHER16_BLOCK_BYTES ? FLETCHER16_BLOCK_BYTES : bytes;
         bytes -= tlen;
-        do
+
+        for (; ((uintptr_t)data & 3) && tlen; tlen--)
         {
             sum2 += sum1 += *data++;
-        } while (--tlen);
+        }
+        for (; tlen >= 4; tlen -= 4)
+        {
+            // four steps at once: sum2 gains 4 sum1 + 4 b0 + 3 b1 + 2 b2 + b3 (little endian words)
+            memcpy(&word, data, sizeof(word));
+            b0 = word & 0xff;
+            b1 = (word >> 8) & 0xff;
+            b2 = (word >> 16) & 0xff;
+            b3 = word >> 24;
+            sum2 += (sum1 << 2) + (b0 << 2) + (b1 * 3) + (b2 << 1) + b3;
+            sum1 += b0 + b1 + b2 + b3;
+            data += 4;
+        }
+        for (; tlen; tlen--)
+        {
+            sum2 += sum1 += *data++;
+        }
+        sum1 = (sum1 & 0xff) + (sum1 >> 8);
+        sum2 = (sum2 & 0xff) + (sum2 >> 8);
         sum1 = (sum1 & 0xff) + (sum1 >> 8);
         sum2 = (sum2 & 0xff) + (sum2 >> 8);
     }
 
-    // Second reduction step to reduce sums to 8 bits
-    sum1 = (sum1 & 0xff) + (sum1 >> 8);
-    sum2 = (sum2 & 0xff) + (sum2 >> 8);
+    // Reduce sums to 8 bits
+    while (sum1 > 0xff)
+    {
+        sum1 = (sum1 & 0xff) + (sum1 >> 8);
+    }
+    while (sum2 > 0xff)
+    {
+        sum2 = (sum2 & 0xff) + (sum2 >> 8);
+    }
     return sum2 << 8 | sum1;
 }
 
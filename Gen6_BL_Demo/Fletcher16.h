@@ -1,6 +1,11 @@
 #ifndef __FLETCHER16_H_INCL__
 #define __FLETCHER16_H_INCL__
 
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
 #include <stdint.h>
 
 /**
@@ -26,4 +31,8 @@ uint16_t Fletcher16(uint8_t const* data, uint32_t bytes);
  */
 uint16_t Fletcher16_Continue(uint8_t const* data, uint32_t bytes, uint16_t previousChecksum);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // __FLETCHER16_H_INCL__
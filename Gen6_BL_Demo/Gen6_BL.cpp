@@ -5,25 +5,54 @@
 #include <stdint.h>
 
 #include "API_C3_BL.h"
+#include "I2C.h"
 
 // --------------------
 // The tests
 
+// Carry the firmware compressed (FW_*_Z.h), it takes less of the Teensy's flash and programs
+// as quickly. Comment this out for the uncompressed arrays.
+#define FW_COMPRESSED
+
+#ifdef FW_COMPRESSED
+#include "FW_CustomMeas_Z.h"  // Firmware #1
+#include "FW_SpiderMeas_Z.h"  // Firmware #0
+#else
 #include "FW_CustomMeas.h"  // Firmware #1
 #include "FW_SpiderMeas.h"  // Firmware #0
+#endif
 
 // FW1 and FW0 are const arrays that are created using the open source SRecord project
 // srec_cat inputfile.hex -intel -o header.h -C-Array arrayname
+// with the image's Fletcher32 added after arrayname_length, so it isn't computed on the Teensy
+// each time; ImageCompressor -c -n arrayname header.h prints that line (or use 0 to compute it)
+// The compressed ones are made from the same hex file (or those arrays) by ImageCompressor
+// ImageCompressor -n arrayname inputfile.hex header.h
 // You can direct this code to use some other hex file by changing these defines
 #define FW1_NAME "CustomMeas"
+#define FW0_NAME "SpiderMeas"
+
+#ifdef FW_COMPRESSED
+#define FW1_BIN Oly1p3_CustomMeas_BL_Z
+#define FW1_BIN_SIZE sizeof(Oly1p3_CustomMeas_BL_Z)
+#define FW1_BASEADDRESS Oly1p3_CustomMeas_BL_Z_start
+#define FW1_CHECKSUM Oly1p3_CustomMeas_BL_Z_checksum
+
+#define FW0_BIN Cirque_Oly1p2_SpiderMeas_BL_Z
+#define FW0_BIN_SIZE sizeof(Cirque_Oly1p2_SpiderMeas_BL_Z)
+#define FW0_BASEADDRESS Cirque_Oly1p2_SpiderMeas_BL_Z_start
+#define FW0_CHECKSUM Cirque_Oly1p2_SpiderMeas_BL_Z_checksum
+#else
 #define FW1_BIN Oly1p3_CustomMeas_BL
 #define FW1_BIN_SIZE sizeof(Oly1p3_CustomMeas_BL)
 #define FW1_BASEADDRESS Oly1p3_CustomMeas_BL_start
+#define FW1_CHECKSUM Oly1p3_CustomMeas_BL_checksum
 
-#define FW0_NAME "SpiderMeas"
 #define FW0_BIN Cirque_Oly1p2_SpiderMeas_BL
 #define FW0_BIN_SIZE sizeof(Cirque_Oly1p2_SpiderMeas_BL)
 #define FW0_BASEADDRESS Cirque_Oly1p2_SpiderMeas_BL_start
+#define FW0_CHECKSUM Cirque_Oly1p2_SpiderMeas_BL_checksum
+#endif
 
 static void PrintProgramErrors(uint16_t error)
 {
@@ -53,6 +82,18 @@ static void PrintProgramErrors(uint16_t error)
         case BLProgErr_Reset:
             Serial.println("Error during Reset\n");
             break;
+        case BLProgErr_BadImage:
+            Serial.println("Not a compressed image\n");
+            break;
+        case BLProgErr_Stream:
+            Serial.println("The PC stopped sending the image\n");
+            break;
+        case BLProgErr_Switch:
+            Serial.println("Programmed, but the part didn't switch to the new image\n");
+            break;
+        case BLProgErr_Hardware:
+            Serial.println("The firmware is for other hardware\n");
+            break;
         default:
             Serial.println((String)"Error code: " + error + "\n");
             break;
@@ -60,26 +101,151 @@ static void PrintProgramErrors(uint16_t error)
 }
 
 
-void Test_Gen6_Program_FW1()
+static void ProgramFirmware(const char * name, const uint8_t * bin, uint32_t size, uint32_t address, uint32_t checksum,
+                            bool differential)
 {
+    // an update that was cut off carries on where it got to the next time (not if the Teensy
+    // has been reset, this is kept in RAM)
+    static bl_checkpoint checkpoint;
+    bool resuming = checkpoint.formatted && !differential;
     uint16_t error;
+    uint32_t start;
+    uint32_t bytesWritten;
 
-    Serial.print("\nProgramming ");
-    Serial.print(FW1_NAME);
-    Serial.println(", will take about 15 seconds.\nPlease wait...");
-    error = BL_program(FW1_BIN, FW1_BIN_SIZE, FW1_BASEADDRESS);
+    BL_set_checkpoint(&checkpoint);
+    Serial.print(differential ? "\nUpdating " : "\nProgramming ");
+    Serial.print(name);
+    Serial.println(", please wait...");
+    start = millis();
+#ifdef FW_COMPRESSED
+    // the image holds its own address and checksum
+    (void)address;
+    (void)checksum;
+    error = BL_program_compressed(bin, size, differential, &bytesWritten);
+#else
+    error = BL_program_image(bin, size, address, checksum, differential, &bytesWritten);
+#endif
+    Serial.printf("%lu ms", millis() - start);
+    if (differential || resuming)
+    {
+        Serial.printf(", %lu bytes written", bytesWritten);
+    }
+    Serial.printf("\n");
     PrintProgramErrors(error);
 }
 
 
+void Test_Gen6_Program_FW1()
+{
+    ProgramFirmware(FW1_NAME, FW1_BIN, FW1_BIN_SIZE, FW1_BASEADDRESS, FW1_CHECKSUM, false);
+}
+
+
 void Test_Gen6_Program_FW0()
 {
-    uint16_t error;
+    ProgramFirmware(FW0_NAME, FW0_BIN, FW0_BIN_SIZE, FW0_BASEADDRESS, FW0_CHECKSUM, false);
+}
+
+
+// only writes what differs from the firmware in the part
+void Test_Gen6_Update_FW1()
+{
+    ProgramFirmware(FW1_NAME, FW1_BIN, FW1_BIN_SIZE, FW1_BASEADDRESS, FW1_CHECKSUM, true);
+}
+
+
+void Test_Gen6_Update_FW0()
+{
+    ProgramFirmware(FW0_NAME, FW0_BIN, FW0_BIN_SIZE, FW0_BASEADDRESS, FW0_CHECKSUM, true);
+}
+
+
+// The parts on Wire, Wire1 and Wire2 (each at I2C_SLAVE_ADDR) programmed with FW1 at once, as
+// an end of line station would. A bus with no part on it fails at InvokeBootloader.
+void Test_Gen6_Program_All()
+{
+    static const char * const buses[I2C_BUS_COUNT] = { "Wire", "Wire1", "Wire2" };
+    static bl_device devices[I2C_BUS_COUNT];
+    static bool busesInitialized = false;
+    uint8_t failed;
+    uint32_t start;
+    uint8_t i;
+
+    if (!busesInitialized)
+    {
+        // Wire is set up by I2C_init
+        I2C_bus_init(I2C_BUS_WIRE1, 400000);
+        I2C_bus_init(I2C_BUS_WIRE2, 400000);
+        busesInitialized = true;
+    }
 
     Serial.print("\nProgramming ");
-    Serial.print(FW0_NAME);
-    Serial.println(", will take about 15 seconds.\nPlease wait...");
-    error = BL_program(FW0_BIN, FW0_BIN_SIZE, FW0_BASEADDRESS);
+    Serial.print(FW1_NAME);
+    Serial.println(" on Wire, Wire1 and Wire2, please wait...");
+    for (i = 0; i < I2C_BUS_COUNT; i++)
+    {
+        // what was learned of each part's timing is kept from one run to the next
+        if (devices[i].target.address == 0)
+        {
+            BL_device_init(&devices[i], i, I2C_SLAVE_ADDR);
+        }
+#ifdef FW_COMPRESSED
+        BL_device_start_compressed(&devices[i], FW1_BIN, FW1_BIN_SIZE, false);
+#else
+        BL_device_start(&devices[i], FW1_BIN, FW1_BIN_SIZE, FW1_BASEADDRESS, FW1_CHECKSUM, false);
+#endif
+    }
+    start = millis();
+    failed = BL_program_devices(devices, I2C_BUS_COUNT);
+    Serial.printf("%lu ms, %u of %u failed\n", millis() - start, failed, I2C_BUS_COUNT);
+    for (i = 0; i < I2C_BUS_COUNT; i++)
+    {
+        Serial.printf("%s: ", buses[i]);
+        PrintProgramErrors(devices[i].error);
+    }
+}
+
+
+static void SendToHost(const uint8_t * data, uint16_t count)
+{
+    Serial.write(data, count);
+    Serial.send_now();
+}
+
+
+// USB keeps receiving while the Teensy is busy on I2C, so this only has to pass it on
+static void ReceiveFromHost(istream * stream, uint32_t wait_us)
+{
+    uint8_t buffer[64];
+    uint32_t start = micros();
+    int count;
+
+    do
+    {
+        count = Serial.available();
+        if (count > 0)
+        {
+            count = Serial.readBytes(buffer, (count < (int)sizeof(buffer)) ? count : sizeof(buffer));
+            IStream_receive(stream, buffer, count);
+        }
+    } while (micros() - start < wait_us);
+}
+
+
+// An image sent by ImageSender on the PC (see ImageStream.h), rather than one built in. The
+// loop hands over the first byte of its ISTREAM_START. Nothing else is printed until the
+// result has been sent, ImageSender would have to skip it.
+void Test_Gen6_Program_Stream(uint8_t first)
+{
+    static istream stream;
+    uint16_t error;
+    uint32_t start;
+
+    IStream_init(&stream, SendToHost);
+    IStream_receive(&stream, &first, 1);
+    start = millis();
+    error = BL_program_stream(&stream, ReceiveFromHost);
+    Serial.printf("\nProgrammed %lu bytes from the PC, %lu ms\n", stream.numBytes, millis() - start);
     PrintProgramErrors(error);
 }
 
@@ -105,16 +271,43 @@ void Test_Gen6_get_status()
     }
     Serial.printf("Version: 0x%02X\n", status.Version);
     Serial.printf("Error: 0x%02X\n", status.LastError);
+    if (status.Flags & STATUS_DUAL_IMAGE)
+    {
+        // it's updated in the background, see BL_program
+        Serial.printf("Dual image, running image %u\n",
+                      (status.Flags & STATUS_ACTIVE_IMAGE) >> STATUS_ACTIVE_IMAGE_SHIFT);
+    }
 }
 
 
 void Test_Gen6_get_hwid()
 {
-    uint8_t buffer[6];
-    BL_cmd_read_memory(0x2000080A, 6, buffer);
+    uint8_t buffer[BL_HWID_SIZE];
+    BL_cmd_read_memory(BL_HWID_ADDRESS, BL_HWID_SIZE, buffer);
 
     Serial.printf("\nHardware info:\n");
     Serial.printf("VID: 0x%04X\n", buffer[0] | (buffer[1]<<8));
     Serial.printf("PID: 0x%04X\n", buffer[2] | (buffer[3]<<8));
     Serial.printf("REV: 0x%04X\n", buffer[4] | (buffer[5]<<8));
 }
+
+
+void Test_Gen6_print_timing()
+{
+    static const char * const names[BLOp_Count] =
+    {
+        "InvokeBootloader", "FormatImage", "FormatRegion", "Write", "Flush", "Validate", "Reset",
+    };
+    static const char * const units[BLOp_Count] = { "", "", "/KB", "/byte", "", "", "" };
+    bl_op_timing timing;
+    uint8_t i;
+
+    Serial.printf("\nBootloader timing (waits polled on the busy bit, and the fixed delays they replace):\n");
+    for (i = 0; i < BLOp_Count; i++)
+    {
+        BL_get_timing(i, &timing);
+        Serial.printf("%-16s x%-4u learned %lu us%s  total %lu us  fixed %lu us  polls %u\n", names[i], timing.count,
+            timing.learned_us, units[i], timing.total_us, timing.fixedDelay_us, timing.polls);
+    }
+    BL_reset_timing(false);
+}
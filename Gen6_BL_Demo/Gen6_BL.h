@@ -3,9 +3,16 @@
 #ifndef __GEN6_BL_H__
 #define __GEN6_BL_H__
 
+#include <stdint.h>
+
 void Test_Gen6_Program_FW0();
 void Test_Gen6_Program_FW1();
+void Test_Gen6_Update_FW0();
+void Test_Gen6_Update_FW1();
+void Test_Gen6_Program_All();
+void Test_Gen6_Program_Stream(uint8_t first);
 void Test_Gen6_get_status();
 void Test_Gen6_get_hwid();
+void Test_Gen6_print_timing();
 
 #endif // __GEN6_BL_H__
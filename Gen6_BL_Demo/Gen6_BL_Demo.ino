@@ -50,6 +50,21 @@ void loop()
             case 'r':
                 Test_Gen6_Program_FW1();
                 break;
+            case 'P':
+                Test_Gen6_Update_FW0();
+                break;
+            case 'R':
+                Test_Gen6_Update_FW1();
+                break;
+            case 'm':
+                Test_Gen6_Program_All();
+                break;
+            case 't':
+                Test_Gen6_print_timing();
+                break;
+            case (char)ISTREAM_SYNC:
+                Test_Gen6_Program_Stream(rxChar);  // ImageSender on the PC
+                break;
             case '\r':
                 break;  // ignore carriage-return
             case '\n':
@@ -70,5 +85,10 @@ static void PrintCommands()
     Serial.println(F("'s' - Get bootloader status"));
     Serial.println(F("'p' - Program firmware FW0"));
     Serial.println(F("'r' - Program firmware FW1"));
+    Serial.println(F("'P' - Update firmware FW0, writing only what has changed"));
+    Serial.println(F("'R' - Update firmware FW1, writing only what has changed"));
+    Serial.println(F("'m' - Program firmware FW1 on the parts on Wire, Wire1 and Wire2 at once"));
+    Serial.println(F("'t' - Show (and clear) the bootloader timing"));
+    Serial.println(F("ImageSender on the PC programs the image it's given, see ImageSender/README.md"));
     Serial.println(F("'l' - list commands\n"));
 }
@@ -17,11 +17,18 @@
 /************************************************************/
 /********************  PUBLIC FUNCTIONS *********************/
 
+// I2C_BUS_WIRE, I2C_BUS_WIRE1, I2C_BUS_WIRE2
+static I2CDriverWire * const buses[I2C_BUS_COUNT] = { &Wire, &Wire1, &Wire2 };
+
+static I2CDriverWire & bus_wire(uint8_t bus)
+{
+  return *buses[(bus < I2C_BUS_COUNT) ? bus : I2C_BUS_WIRE];
+}
+
 /** Set the Arduino as a master if no address is given and sets clock frequency. */
 void I2C_init(uint32_t clockFrequency)
 {
-  Wire.begin();                   // Set the arduino as master.
-  Wire.setClock(clockFrequency);  // call .setClock after .begin
+  I2C_bus_init(I2C_BUS_WIRE, clockFrequency);
 }
 
 /** request the number of bytes specified by "count" from the given slave address
@@ -29,33 +36,33 @@ void I2C_init(uint32_t clockFrequency)
  * release the line. false will keep the line busy to send a restart. */
 void I2C_request(int16_t address, int16_t count, bool stop)
 {
-  Wire.requestFrom(address, count, stop); // (i2c_stop)stop);
+  I2C_bus_request(I2C_BUS_WIRE, address, count, stop);
 }
 
 /** Returns the number of bytes available for reading. */
 uint16_t I2C_available()
 {
-  return Wire.available();
+  return I2C_bus_available(I2C_BUS_WIRE);
 }
 
 /** returns the next byte. (Reads a byte that was transmitted from slave 
 	device to a master). */
 uint8_t I2C_read()
 {
-  return Wire.read();
+  return I2C_bus_read(I2C_BUS_WIRE);
 }
 
 /** returns the number of bytes written. Writes data from a slave device 
 	from a request form a master. */
 void I2C_write(uint8_t data)
 {
-  Wire.write(data);
+  I2C_bus_write(I2C_BUS_WIRE, data);
 }
 
 /** Begins the transmission to a I2C slave device with the given address. */
 void I2C_beginTransmission(uint8_t address)
 {
-  Wire.beginTransmission(address);
+  I2C_bus_beginTransmission(I2C_BUS_WIRE, address);
 }
 
 /** Ends the transmission to a slave deivce that was begun by the begin transmission. 
@@ -63,5 +70,42 @@ void I2C_beginTransmission(uint8_t address)
 	sends a restart request, keeping the connection active. */
 void I2C_endTransmission(bool stop)
 {
-  Wire.endTransmission(stop);
+  I2C_bus_endTransmission(I2C_BUS_WIRE, stop);
+}
+
+/** The same on a given bus. Each bus is set up on its own, by I2C_bus_init. */
+void I2C_bus_init(uint8_t bus, uint32_t clockFrequency)
+{
+  bus_wire(bus).begin();                   // Set the arduino as master.
+  bus_wire(bus).setClock(clockFrequency);  // call .setClock after .begin
+}
+
+void I2C_bus_request(uint8_t bus, int16_t address, int16_t count, bool stop)
+{
+  bus_wire(bus).requestFrom(address, count, stop);
+}
+
+uint16_t I2C_bus_available(uint8_t bus)
+{
+  return bus_wire(bus).available();
+}
+
+uint8_t I2C_bus_read(uint8_t bus)
+{
+  return bus_wire(bus).read();
+}
+
+void I2C_bus_write(uint8_t bus, uint8_t data)
+{
+  bus_wire(bus).write(data);
+}
+
+void I2C_bus_beginTransmission(uint8_t bus, uint8_t address)
+{
+  bus_wire(bus).beginTransmission(address);
+}
+
+void I2C_bus_endTransmission(uint8_t bus, bool stop)
+{
+  bus_wire(bus).endTransmission(stop);
 }
@@ -31,6 +31,26 @@ void I2C_beginTransmission(uint8_t address);
 
 void I2C_endTransmission(bool stop);
 
+/** The same on one of the Teensy's I2C buses, the functions above are bus 0. */
+#define I2C_BUS_WIRE  (0)   // pins 19 and 18
+#define I2C_BUS_WIRE1 (1)   // pins 16 and 17
+#define I2C_BUS_WIRE2 (2)   // pins 24 and 25
+#define I2C_BUS_COUNT (3)
+
+void I2C_bus_init(uint8_t bus, uint32_t clockFrequency);
+
+void I2C_bus_request(uint8_t bus, int16_t address, int16_t count, bool stop);
+
+uint16_t I2C_bus_available(uint8_t bus);
+
+uint8_t I2C_bus_read(uint8_t bus);
+
+void I2C_bus_write(uint8_t bus, uint8_t data);
+
+void I2C_bus_beginTransmission(uint8_t bus, uint8_t address);
+
+void I2C_bus_endTransmission(uint8_t bus, bool stop);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,499 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// Makes a compressed firmware image (see CompressedImage.h) from a hex file, for
+// BL_program_compressed. It checks what it made by decompressing it again.
+//
+// usage: ImageCompressor [-w windowBits] [-n arrayName] input output
+//        ImageCompressor -c [-n arrayName] input
+//   input   Intel hex, S-records, or a C array from srec_cat (-C-Array, like FW_CustomMeas.h)
+//   output  a C header with the array (.h), or the image itself (anything else)
+//   -c      prints the image's Fletcher32 as a <arrayName>_checksum line for a srec_cat header,
+//           for BL_program_image
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../CompressedImage.h"
+#include "../Fletcher32.h"
+
+#define HASH_BITS (14)
+#define MAX_CHAIN (4096)
+#define MAX_BLOCK_SIZE (CIMAGE_MAX_BLOCK_SIZE)
+
+typedef std::vector<uint8_t> Bytes;
+
+static bool readFile(const char * path, std::string & text)
+{
+    FILE * file = fopen(path, "rb");
+    if (!file) return false;
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) text.append(buffer, count);
+    fclose(file);
+    return true;
+}
+
+static int hexByte(const char * text)
+{
+    int value = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        char c = (char)toupper((unsigned char)text[i]);
+        if ((c >= '0') && (c <= '9')) value = value * 16 + (c - '0');
+        else if ((c >= 'A') && (c <= 'F')) value = value * 16 + (c - 'A' + 10);
+        else return -1;
+    }
+    return value;
+}
+
+// one line of hex digits as bytes
+static bool hexBytes(const std::string & line, size_t first, Bytes & bytes)
+{
+    bytes.clear();
+    for (size_t i = first; i + 1 < line.size(); i += 2)
+    {
+        int value = hexByte(&line[i]);
+        if (value < 0) return false;
+        bytes.push_back((uint8_t)value);
+    }
+    return !bytes.empty();
+}
+
+static bool parseIntelHex(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    uint32_t base = 0;
+    size_t start = 0;
+    Bytes record;
+
+    while (start < text.size())
+    {
+        size_t end = text.find_first_of("\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.empty()) continue;
+        if ((line[0] != ':') || !hexBytes(line, 1, record) || (record.size() < 5) || (record.size() != record[0] + 5u))
+        {
+            fprintf(stderr, "bad hex record: %s\n", line.c_str());
+            return false;
+        }
+        uint8_t sum = 0;
+        for (uint8_t b : record) sum += b;
+        if (sum != 0)
+        {
+            fprintf(stderr, "hex record checksum: %s\n", line.c_str());
+            return false;
+        }
+
+        uint32_t address = (record[1] << 8) | record[2];
+        switch (record[3])
+        {
+            case 0x00:
+                for (uint8_t i = 0; i < record[0]; i++) memory[base + address + i] = record[4 + i];
+                break;
+            case 0x01:
+                return true;
+            case 0x02:
+                base = ((record[4] << 8) | record[5]) << 4;
+                break;
+            case 0x04:
+                base = (uint32_t)((record[4] << 8) | record[5]) << 16;
+                break;
+            default:
+                break;  // start addresses
+        }
+    }
+    return true;
+}
+
+static bool parseSRecords(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    size_t start = 0;
+    Bytes record;
+
+    while (start < text.size())
+    {
+        size_t end = text.find_first_of("\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.empty()) continue;
+        if ((line.size() < 4) || (line[0] != 'S') || !hexBytes(line, 2, record) || (record.size() != record[0] + 1u))
+        {
+            fprintf(stderr, "bad S-record: %s\n", line.c_str());
+            return false;
+        }
+        uint8_t sum = 0;
+        for (uint8_t b : record) sum += b;
+        if (sum != 0xFF)
+        {
+            fprintf(stderr, "S-record checksum: %s\n", line.c_str());
+            return false;
+        }
+
+        int addressBytes = 0;
+        switch (line[1])
+        {
+            case '1': addressBytes = 2; break;
+            case '2': addressBytes = 3; break;
+            case '3': addressBytes = 4; break;
+            default: continue;  // header, counts, start addresses
+        }
+        uint32_t address = 0;
+        for (int i = 0; i < addressBytes; i++) address = (address << 8) | record[1 + i];
+        for (size_t i = 1 + addressBytes; i + 1 < record.size(); i++) memory[address++] = record[i];
+    }
+    return true;
+}
+
+// srec_cat -C-Array output: the first array's bytes, and <name>_start
+static bool parseCArray(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    size_t open = text.find('{');
+    size_t close = text.find('}', open);
+    size_t startName = text.find("_start");
+    if ((open == std::string::npos) || (close == std::string::npos) || (startName == std::string::npos))
+    {
+        fprintf(stderr, "no array, or no _start address\n");
+        return false;
+    }
+    size_t equals = text.find('=', startName);
+    uint32_t address = (uint32_t)strtoul(text.c_str() + equals + 1, 0, 0);
+
+    const char * p = text.c_str() + open + 1;
+    const char * end = text.c_str() + close;
+    while (p < end)
+    {
+        char * next;
+        unsigned long value = strtoul(p, &next, 0);
+        if (next == p)
+        {
+            p++;
+            continue;
+        }
+        memory[address++] = (uint8_t)value;
+        p = next;
+    }
+    return true;
+}
+
+// ----------------------------------------
+// Compression
+
+typedef struct {
+    const Bytes * image;
+    uint32_t window;
+    std::vector<int32_t> head;
+    std::vector<int32_t> previous;
+    uint32_t hashed;  // positions before this are in the chains
+} MatchFinder_t;
+
+static uint32_t hash4(const uint8_t * p)
+{
+    uint32_t value = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static void hashUpTo(MatchFinder_t & finder, uint32_t position)
+{
+    const Bytes & image = *finder.image;
+    for (; (finder.hashed < position) && (finder.hashed + CIMAGE_MIN_MATCH <= image.size()); finder.hashed++)
+    {
+        uint32_t h = hash4(&image[finder.hashed]);
+        finder.previous[finder.hashed] = finder.head[h];
+        finder.head[h] = (int32_t)finder.hashed;
+    }
+}
+
+// the longest match for position that starts no earlier than lowest and ends by limit
+static uint32_t findMatch(MatchFinder_t & finder, uint32_t position, uint32_t lowest, uint32_t limit, uint32_t & offset)
+{
+    const Bytes & image = *finder.image;
+    uint32_t best = 0;
+    if (position + CIMAGE_MIN_MATCH > limit) return 0;
+
+    hashUpTo(finder, position);
+    int32_t candidate = finder.head[hash4(&image[position])];
+    for (int chain = 0; (candidate >= (int32_t)lowest) && (chain < MAX_CHAIN); chain++)
+    {
+        uint32_t length = 0;
+        while ((position + length < limit) && (image[candidate + length] == image[position + length])) length++;
+        if (length > best)
+        {
+            best = length;
+            offset = position - candidate;
+            if (position + best == limit) break;
+        }
+        candidate = finder.previous[candidate];
+    }
+    return (best >= CIMAGE_MIN_MATCH) ? best : 0;
+}
+
+static void putLength(Bytes & out, uint32_t length)
+{
+    for (; length >= 255; length -= 255) out.push_back(255);
+    out.push_back((uint8_t)length);
+}
+
+static void putSequence(Bytes & out, const uint8_t * literals, uint32_t literalCount, uint32_t match, uint32_t offset)
+{
+    uint32_t matchCode = match ? (match - CIMAGE_MIN_MATCH) : 0;
+    out.push_back((uint8_t)(((literalCount < 15) ? literalCount : 15) << 4 | ((matchCode < 15) ? matchCode : 15)));
+    if (literalCount >= 15) putLength(out, literalCount - 15);
+    out.insert(out.end(), literals, literals + literalCount);
+    if (match)
+    {
+        out.push_back((uint8_t)offset);
+        out.push_back((uint8_t)(offset >> 8));
+        if (matchCode >= 15) putLength(out, matchCode - 15);
+    }
+}
+
+// greedy, with one step of lazy matching
+static Bytes compressBlock(MatchFinder_t & finder, uint32_t start, uint32_t end)
+{
+    const Bytes & image = *finder.image;
+    uint32_t lowest = (start > finder.window) ? (start - finder.window) : 0;
+    uint32_t literalStart = start;
+    uint32_t position = start;
+    Bytes out;
+
+    while (position < end)
+    {
+        uint32_t offset = 0;
+        uint32_t match = findMatch(finder, position, lowest, end, offset);
+        if (match)
+        {
+            uint32_t laterOffset = 0;
+            uint32_t later = findMatch(finder, position + 1, lowest, end, laterOffset);
+            if (later > match + 1)
+            {
+                position++;
+                continue;
+            }
+        }
+        if (!match)
+        {
+            position++;
+            continue;
+        }
+        putSequence(out, &image[literalStart], position - literalStart, match, offset);
+        position += match;
+        literalStart = position;
+    }
+    if (literalStart < end)
+    {
+        putSequence(out, &image[literalStart], end - literalStart, 0, 0);
+    }
+    return out;
+}
+
+static void put16(Bytes & out, uint16_t value)
+{
+    out.push_back((uint8_t)value);
+    out.push_back((uint8_t)(value >> 8));
+}
+
+static void put32(Bytes & out, uint32_t value)
+{
+    put16(out, (uint16_t)value);
+    put16(out, (uint16_t)(value >> 16));
+}
+
+static Bytes compressImage(const Bytes & image, uint32_t address, uint8_t windowBits, uint16_t blockSize)
+{
+    uint16_t blockCount = (uint16_t)((image.size() + blockSize - 1) / blockSize);
+    Bytes out;
+
+    put32(out, CIMAGE_MAGIC);
+    out.push_back(CIMAGE_VERSION);
+    out.push_back(windowBits);
+    put16(out, blockSize);
+    put32(out, (uint32_t)image.size());
+    put32(out, address);
+    put32(out, image[4] | (image[5] << 8) | (image[6] << 16) | ((uint32_t)image[7] << 24));  // as BL_program
+    put32(out, Fletcher32(image.data(), (uint32_t)image.size()));
+    put16(out, blockCount);
+    put16(out, 0);
+
+    MatchFinder_t finder;
+    finder.image = &image;
+    finder.window = 1u << windowBits;
+    finder.head.assign(1 << HASH_BITS, -1);
+    finder.previous.assign(image.size(), -1);
+    finder.hashed = 0;
+
+    for (uint32_t start = 0; start < image.size(); start += blockSize)
+    {
+        uint32_t end = (start + blockSize < image.size()) ? (start + blockSize) : (uint32_t)image.size();
+        Bytes block = compressBlock(finder, start, end);
+        if (block.size() >= end - start)
+        {
+            put16(out, (uint16_t)((end - start) | CIMAGE_STORED));
+            out.insert(out.end(), image.begin() + start, image.begin() + end);
+        }
+        else
+        {
+            put16(out, (uint16_t)block.size());
+            out.insert(out.end(), block.begin(), block.end());
+        }
+    }
+    return out;
+}
+
+// decompresses it the way the Arduino will, a few bytes at a time
+static bool check(const Bytes & compressed, const Bytes & image)
+{
+    static cimage_reader reader;
+    Bytes out(image.size() + 16);
+    uint32_t total = 0;
+    uint32_t count = 1;
+
+    if (!CImage_open(&reader, compressed.data(), (uint32_t)compressed.size())) return false;
+    while (total < out.size())
+    {
+        uint32_t copied = CImage_read(&reader, &out[total], count);
+        total += copied;
+        if (copied < count) break;
+        count = (count * 7 + 3) % 600 + 1;
+    }
+    return !reader.error && (total == image.size()) && (memcmp(out.data(), image.data(), image.size()) == 0);
+}
+
+static bool writeHeader(const char * path, const char * name, const char * input, const Bytes & data, size_t imageSize,
+    uint32_t address, uint32_t checksum)
+{
+    FILE * file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "#ifndef FIRMWARE_%s\n#define FIRMWARE_%s\n\n", name, name);
+    fprintf(file, "// File: %s, compressed by ImageCompressor. %zu bytes from %zu, see CompressedImage.h\n\n", input,
+        data.size(), imageSize);
+    fprintf(file, "const unsigned char %s[] =\n{\n", name);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        fprintf(file, "0x%02X,%s", data[i], ((i % 12) == 11) ? "\n" : " ");
+    }
+    if (data.size() % 12) fprintf(file, "\n");
+    fprintf(file, "};\n");
+    fprintf(file, "const unsigned long %s_start       = 0x%08lX;\n", name, (unsigned long)address);
+    fprintf(file, "const unsigned long %s_length      = 0x%08lX;\n", name, (unsigned long)imageSize);
+    fprintf(file, "const unsigned long %s_checksum    = 0x%08lX;\n", name, (unsigned long)checksum);
+    fprintf(file, "\n#endif // FIRMWARE_%s\n", name);
+    fclose(file);
+    return true;
+}
+
+static std::string baseName(const char * path)
+{
+    std::string name = path;
+    size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos) name = name.substr(slash + 1);
+    return name;
+}
+
+int main(int argc, char ** argv)
+{
+    uint8_t windowBits = CIMAGE_MAX_WINDOW_BITS;
+    std::string name;
+    bool checksumOnly = false;
+    int arg = 1;
+
+    for (; (arg < argc) && (argv[arg][0] == '-'); arg++)
+    {
+        if ((strcmp(argv[arg], "-w") == 0) && (arg + 1 < argc)) windowBits = (uint8_t)atoi(argv[++arg]);
+        else if ((strcmp(argv[arg], "-n") == 0) && (arg + 1 < argc)) name = argv[++arg];
+        else if (strcmp(argv[arg], "-c") == 0) checksumOnly = true;
+        else break;
+    }
+    if ((arg + (checksumOnly ? 1 : 2) != argc) || (windowBits < 8) || (windowBits > CIMAGE_MAX_WINDOW_BITS))
+    {
+        fprintf(stderr, "usage: ImageCompressor [-w windowBits] [-n arrayName] input output\n"
+            "       ImageCompressor -c [-n arrayName] input\n"
+            "  windowBits 8..%d (default %d)\n"
+            "  input: Intel hex, S-records, or a srec_cat C array\n"
+            "  output: a C header (.h) or the compressed image\n"
+            "  -c: print the image's Fletcher32 as a C constant\n", CIMAGE_MAX_WINDOW_BITS, CIMAGE_MAX_WINDOW_BITS);
+        return 2;
+    }
+    const char * input = argv[arg];
+    const char * output = checksumOnly ? input : argv[arg + 1];
+
+    std::string text;
+    if (!readFile(input, text))
+    {
+        fprintf(stderr, "can't read %s\n", input);
+        return 1;
+    }
+    size_t first = text.find_first_not_of(" \t\r\n");
+    std::map<uint32_t, uint8_t> memory;
+    bool parsed;
+    if ((first != std::string::npos) && (text[first] == ':')) parsed = parseIntelHex(text, memory);
+    else if ((first != std::string::npos) && (text[first] == 'S')) parsed = parseSRecords(text, memory);
+    else parsed = parseCArray(text, memory);
+    if (!parsed || (memory.size() < 8))
+    {
+        fprintf(stderr, "no image in %s\n", input);
+        return 1;
+    }
+
+    // one piece, gaps erased; Fletcher32 works on 16 bit words, so an odd end gets an erased byte
+    uint32_t address = memory.begin()->first;
+    Bytes image(memory.rbegin()->first + 1 - address, 0xFF);
+    for (auto & byte : memory) image[byte.first - address] = byte.second;
+
+    std::string outputName = output;
+    bool header = (outputName.size() > 2) && (outputName.compare(outputName.size() - 2, 2, ".h") == 0);
+    if (name.empty())
+    {
+        name = baseName(output);
+        name = name.substr(0, name.find('.'));
+        for (char & c : name) if (!isalnum((unsigned char)c)) c = '_';
+    }
+
+    // what BL_program_image is given, the array as it is
+    if (checksumOnly)
+    {
+        printf("const unsigned long %s_checksum    = 0x%08lX;\n", name.c_str(),
+            (unsigned long)Fletcher32(image.data(), (uint32_t)image.size()));
+        return 0;
+    }
+
+    if (image.size() & 1) image.push_back(0xFF);
+    uint32_t checksum = Fletcher32(image.data(), (uint32_t)image.size());
+
+    Bytes compressed = compressImage(image, address, windowBits, MAX_BLOCK_SIZE);
+    if (!check(compressed, image))
+    {
+        fprintf(stderr, "the compressed image doesn't decompress to the image\n");
+        return 1;
+    }
+
+    bool written;
+    if (header)
+    {
+        written = writeHeader(output, name.c_str(), baseName(input).c_str(), compressed, image.size(), address,
+            checksum);
+    }
+    else
+    {
+        FILE * file = fopen(output, "wb");
+        written = file && (fwrite(compressed.data(), 1, compressed.size(), file) == compressed.size());
+        if (file) fclose(file);
+    }
+    if (!written)
+    {
+        fprintf(stderr, "can't write %s\n", output);
+        return 1;
+    }
+
+    printf("%s: %zu bytes at 0x%08lX, Fletcher32 0x%08lX, compressed to %zu (%.1f%%), %u byte window\n", input,
+        image.size(), (unsigned long)address, (unsigned long)checksum, compressed.size(),
+        100.0 * compressed.size() / image.size(), 1u << windowBits);
+    return 0;
+}
@@ -0,0 +1,422 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// Packages a firmware build as a container (see FirmwareImage.h) for BL_program_container: the
+// hardware it's for, its entry point, and a region for each piece of it, so a sparse build's
+// gaps aren't written.
+//
+// usage: ImagePackager [-g gap] [-i vid:pid:rev] [-e entry] [-n arrayName] input... output
+//   input   Intel hex, S-records, or a C array from srec_cat (-C-Array, like FW_CustomMeas.h)
+//   output  a C header (.h) or the container
+//   -g      gaps of more than this many bytes start a new region, smaller ones are filled with 0xFF
+//   -i      the hardware ID it's for, in hex (0 matches any, the default)
+//   -e      the entry point, if it isn't the word at bytes 4..7 of the first region
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../FirmwareImage.h"
+
+// regions start and end on the part's write units
+#define REGION_ALIGN (4)
+#define DEFAULT_GAP (64)
+
+typedef std::vector<uint8_t> Bytes;
+
+static bool readFile(const char * path, std::string & text)
+{
+    FILE * file = fopen(path, "rb");
+    if (!file) return false;
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) text.append(buffer, count);
+    fclose(file);
+    return true;
+}
+
+static int hexByte(const char * text)
+{
+    int value = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        char c = (char)toupper((unsigned char)text[i]);
+        if ((c >= '0') && (c <= '9')) value = value * 16 + (c - '0');
+        else if ((c >= 'A') && (c <= 'F')) value = value * 16 + (c - 'A' + 10);
+        else return -1;
+    }
+    return value;
+}
+
+// one line of hex digits as bytes
+static bool hexBytes(const std::string & line, size_t first, Bytes & bytes)
+{
+    bytes.clear();
+    for (size_t i = first; i + 1 < line.size(); i += 2)
+    {
+        int value = hexByte(&line[i]);
+        if (value < 0) return false;
+        bytes.push_back((uint8_t)value);
+    }
+    return !bytes.empty();
+}
+
+static bool parseIntelHex(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    uint32_t base = 0;
+    size_t start = 0;
+    Bytes record;
+
+    while (start < text.size())
+    {
+        size_t end = text.find_first_of("\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.empty()) continue;
+        if ((line[0] != ':') || !hexBytes(line, 1, record) || (record.size() < 5) || (record.size() != record[0] + 5u))
+        {
+            fprintf(stderr, "bad hex record: %s\n", line.c_str());
+            return false;
+        }
+        uint8_t sum = 0;
+        for (uint8_t b : record) sum += b;
+        if (sum != 0)
+        {
+            fprintf(stderr, "hex record checksum: %s\n", line.c_str());
+            return false;
+        }
+
+        uint32_t address = (record[1] << 8) | record[2];
+        switch (record[3])
+        {
+            case 0x00:
+                for (uint8_t i = 0; i < record[0]; i++) memory[base + address + i] = record[4 + i];
+                break;
+            case 0x01:
+                return true;
+            case 0x02:
+                base = ((record[4] << 8) | record[5]) << 4;
+                break;
+            case 0x04:
+                base = (uint32_t)((record[4] << 8) | record[5]) << 16;
+                break;
+            default:
+                break;  // start addresses
+        }
+    }
+    return true;
+}
+
+static bool parseSRecords(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    size_t start = 0;
+    Bytes record;
+
+    while (start < text.size())
+    {
+        size_t end = text.find_first_of("\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.empty()) continue;
+        if ((line.size() < 4) || (line[0] != 'S') || !hexBytes(line, 2, record) || (record.size() != record[0] + 1u))
+        {
+            fprintf(stderr, "bad S-record: %s\n", line.c_str());
+            return false;
+        }
+        uint8_t sum = 0;
+        for (uint8_t b : record) sum += b;
+        if (sum != 0xFF)
+        {
+            fprintf(stderr, "S-record checksum: %s\n", line.c_str());
+            return false;
+        }
+
+        int addressBytes = 0;
+        switch (line[1])
+        {
+            case '1': addressBytes = 2; break;
+            case '2': addressBytes = 3; break;
+            case '3': addressBytes = 4; break;
+            default: continue;  // header, counts, start addresses
+        }
+        uint32_t address = 0;
+        for (int i = 0; i < addressBytes; i++) address = (address << 8) | record[1 + i];
+        for (size_t i = 1 + addressBytes; i + 1 < record.size(); i++) memory[address++] = record[i];
+    }
+    return true;
+}
+
+// srec_cat -C-Array output: the first array's bytes, and <name>_start
+static bool parseCArray(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    size_t open = text.find('{');
+    size_t close = text.find('}', open);
+    size_t startName = text.find("_start");
+    if ((open == std::string::npos) || (close == std::string::npos) || (startName == std::string::npos))
+    {
+        fprintf(stderr, "no array, or no _start address\n");
+        return false;
+    }
+    size_t equals = text.find('=', startName);
+    uint32_t address = (uint32_t)strtoul(text.c_str() + equals + 1, 0, 0);
+
+    const char * p = text.c_str() + open + 1;
+    const char * end = text.c_str() + close;
+    while (p < end)
+    {
+        char * next;
+        unsigned long value = strtoul(p, &next, 0);
+        if (next == p)
+        {
+            p++;
+            continue;
+        }
+        memory[address++] = (uint8_t)value;
+        p = next;
+    }
+    return true;
+}
+
+static bool readImage(const char * input, std::map<uint32_t, uint8_t> & memory)
+{
+    std::string text;
+    if (!readFile(input, text))
+    {
+        fprintf(stderr, "can't read %s\n", input);
+        return false;
+    }
+    size_t first = text.find_first_not_of(" \t\r\n");
+    std::map<uint32_t, uint8_t> image;
+    bool parsed;
+    if ((first != std::string::npos) && (text[first] == ':')) parsed = parseIntelHex(text, image);
+    else if ((first != std::string::npos) && (text[first] == 'S')) parsed = parseSRecords(text, image);
+    else parsed = parseCArray(text, image);
+    if (!parsed || image.empty())
+    {
+        fprintf(stderr, "no image in %s\n", input);
+        return false;
+    }
+
+    // the inputs can overlap, as long as they agree
+    for (auto & byte : image)
+    {
+        auto found = memory.find(byte.first);
+        if ((found != memory.end()) && (found->second != byte.second))
+        {
+            fprintf(stderr, "%s: 0x%08lX is 0x%02X, another input has 0x%02X\n", input, (unsigned long)byte.first,
+                byte.second, found->second);
+            return false;
+        }
+        memory[byte.first] = byte.second;
+    }
+    return true;
+}
+
+// A region for each piece of memory, split where there's more than gap bytes between them.
+// Each is aligned to REGION_ALIGN, the bytes that takes and the smaller gaps are erased (0xFF).
+static void makeRegions(const std::map<uint32_t, uint8_t> & memory, uint32_t gap, std::vector<uint32_t> & addresses,
+    std::vector<Bytes> & regions)
+{
+    for (auto & byte : memory)
+    {
+        if (regions.empty() || (byte.first - (addresses.back() + regions.back().size()) > gap))
+        {
+            addresses.push_back(byte.first - (byte.first % REGION_ALIGN));
+            regions.push_back(Bytes());
+        }
+        regions.back().resize(byte.first + 1 - addresses.back(), 0xFF);
+        regions.back().back() = byte.second;
+    }
+    for (Bytes & region : regions)
+    {
+        region.resize((region.size() + REGION_ALIGN - 1) / REGION_ALIGN * REGION_ALIGN, 0xFF);
+    }
+}
+
+// the container opens, and holds the regions
+static bool check(const Bytes & container, const std::vector<uint32_t> & addresses, const std::vector<Bytes> & regions)
+{
+    fwimage image;
+    fwimage_region region;
+
+    if (!FWImage_open(&image, container.data(), (uint32_t)container.size()) || (image.regionCount != regions.size()))
+    {
+        return false;
+    }
+    for (uint8_t i = 0; i < image.regionCount; i++)
+    {
+        if (!FWImage_region(&image, i, &region) || (region.address != addresses[i]) ||
+            (region.size != regions[i].size()) || (memcmp(region.data, regions[i].data(), region.size) != 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool writeHeader(const char * path, const char * name, const std::string & inputs, const Bytes & data,
+    uint8_t regionCount, size_t written)
+{
+    FILE * file = fopen(path, "w");
+    if (!file) return false;
+
+    fprintf(file, "#ifndef FIRMWARE_%s\n#define FIRMWARE_%s\n\n", name, name);
+    fprintf(file, "// File: %s, packaged by ImagePackager. %u regions, %zu bytes to write, see FirmwareImage.h\n\n",
+        inputs.c_str(), regionCount, written);
+    fprintf(file, "const unsigned char %s[] =\n{\n", name);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        fprintf(file, "0x%02X,%s", data[i], ((i % 12) == 11) ? "\n" : " ");
+    }
+    if (data.size() % 12) fprintf(file, "\n");
+    fprintf(file, "};\n");
+    fprintf(file, "const unsigned long %s_length      = 0x%08lX;\n", name, (unsigned long)data.size());
+    fprintf(file, "\n#endif // FIRMWARE_%s\n", name);
+    fclose(file);
+    return true;
+}
+
+static std::string baseName(const char * path)
+{
+    std::string name = path;
+    size_t slash = name.find_last_of("/\\");
+    if (slash != std::string::npos) name = name.substr(slash + 1);
+    return name;
+}
+
+int main(int argc, char ** argv)
+{
+    fwimage header;
+    uint32_t gap = DEFAULT_GAP;
+    bool entryGiven = false;
+    bool usage = false;
+    std::string name;
+    int arg = 1;
+
+    memset(&header, 0, sizeof(header));
+    for (; (arg < argc) && (argv[arg][0] == '-'); arg++)
+    {
+        unsigned vendorId, productId, revision;
+        if ((strcmp(argv[arg], "-g") == 0) && (arg + 1 < argc)) gap = (uint32_t)strtoul(argv[++arg], 0, 0);
+        else if ((strcmp(argv[arg], "-n") == 0) && (arg + 1 < argc)) name = argv[++arg];
+        else if ((strcmp(argv[arg], "-e") == 0) && (arg + 1 < argc))
+        {
+            header.entryPoint = (uint32_t)strtoul(argv[++arg], 0, 0);
+            entryGiven = true;
+        }
+        else if ((strcmp(argv[arg], "-i") == 0) && (arg + 1 < argc) &&
+            (sscanf(argv[++arg], "%x:%x:%x", &vendorId, &productId, &revision) == 3))
+        {
+            header.vendorId = (uint16_t)vendorId;
+            header.productId = (uint16_t)productId;
+            header.revision = (uint16_t)revision;
+        }
+        else
+        {
+            usage = true;
+            break;
+        }
+    }
+    if (usage || (arg + 2 > argc))
+    {
+        fprintf(stderr, "usage: ImagePackager [-g gap] [-i vid:pid:rev] [-e entry] [-n arrayName] input... output\n"
+            "  input: Intel hex, S-records, or a srec_cat C array, as many as make up the build\n"
+            "  output: a C header (.h) or the container\n"
+            "  -g: gaps of more than this many bytes start a new region (default %d)\n"
+            "  -i: the hardware ID it's for, in hex, like 0488:0100:0103 (default any)\n"
+            "  -e: the entry point (default the word at bytes 4..7 of the first region)\n", DEFAULT_GAP);
+        return 2;
+    }
+    const char * output = argv[argc - 1];
+
+    std::map<uint32_t, uint8_t> memory;
+    std::string inputs;
+    for (; arg < argc - 1; arg++)
+    {
+        if (!readImage(argv[arg], memory)) return 1;
+        inputs += (inputs.empty() ? "" : ", ") + baseName(argv[arg]);
+    }
+
+    std::vector<uint32_t> addresses;
+    std::vector<Bytes> regions;
+    makeRegions(memory, gap, addresses, regions);
+    if (regions.size() > FWIMAGE_MAX_REGIONS)
+    {
+        fprintf(stderr, "%zu regions, a container holds %d: make -g larger\n", regions.size(), FWIMAGE_MAX_REGIONS);
+        return 1;
+    }
+    if (!entryGiven && (regions[0].size() < 8))
+    {
+        fprintf(stderr, "the first region has no entry point, give one with -e\n");
+        return 1;
+    }
+
+    std::vector<fwimage_region> table(regions.size());
+    size_t written = 0;
+    for (size_t i = 0; i < regions.size(); i++)
+    {
+        table[i].address = addresses[i];
+        table[i].size = (uint32_t)regions[i].size();
+        table[i].data = regions[i].data();
+        written += regions[i].size();
+    }
+    header.regionCount = (uint8_t)regions.size();
+    if (!entryGiven)
+    {
+        const uint8_t * vector = &regions[0][4];
+        header.entryPoint = vector[0] | (vector[1] << 8) | (vector[2] << 16) | ((uint32_t)vector[3] << 24);
+    }
+
+    Bytes container(FWIMAGE_HEADER_SIZE(header.regionCount) + written);
+    if ((FWImage_build(container.data(), (uint32_t)container.size(), &header, table.data()) != container.size()) ||
+        !check(container, addresses, regions))
+    {
+        fprintf(stderr, "the container doesn't hold the regions\n");
+        return 1;
+    }
+
+    std::string outputName = output;
+    bool writeAsHeader = (outputName.size() > 2) && (outputName.compare(outputName.size() - 2, 2, ".h") == 0);
+    if (name.empty())
+    {
+        name = baseName(output);
+        name = name.substr(0, name.find('.'));
+        for (char & c : name) if (!isalnum((unsigned char)c)) c = '_';
+    }
+
+    bool saved;
+    if (writeAsHeader)
+    {
+        saved = writeHeader(output, name.c_str(), inputs, container, header.regionCount, written);
+    }
+    else
+    {
+        FILE * file = fopen(output, "wb");
+        saved = file && (fwrite(container.data(), 1, container.size(), file) == container.size());
+        if (file) fclose(file);
+    }
+    if (!saved)
+    {
+        fprintf(stderr, "can't write %s\n", output);
+        return 1;
+    }
+
+    uint32_t span = addresses.back() + (uint32_t)regions.back().size() - addresses[0];
+    printf("%s: %u regions, %zu bytes to write of %lu, entry point 0x%08lX, for %04X:%04X:%04X\n", inputs.c_str(),
+        header.regionCount, written, (unsigned long)span, (unsigned long)header.entryPoint, header.vendorId,
+        header.productId, header.revision);
+    fwimage image;
+    fwimage_region region;
+    FWImage_open(&image, container.data(), (uint32_t)container.size());
+    for (uint8_t i = 0; FWImage_region(&image, i, &region); i++)
+    {
+        printf("  0x%08lX  %7lu bytes  Fletcher32 0x%08lX\n", (unsigned long)region.address,
+            (unsigned long)region.size, (unsigned long)region.checksum);
+    }
+    return 0;
+}
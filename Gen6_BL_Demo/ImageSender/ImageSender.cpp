@@ -0,0 +1,406 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+// Sends a firmware image to the demo over its USB serial port, which programs it into the part
+// as it arrives (see ImageStream.h), so a new build doesn't need the demo rebuilt.
+//
+// usage: ImageSender [-e every] port input
+//   port    the Teensy's serial port (/dev/ttyACM0), or the pty BLSimulator -p prints
+//   input   Intel hex, S-records, or a C array from srec_cat (-C-Array, like FW_CustomMeas.h)
+//   -e      spoils every nth chunk sent, to check they're sent again
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../ImageStream.h"
+#include "../Fletcher32.h"
+
+// how long the demo can go without answering: it's quiet while the part formats
+#define REPLY_TIMEOUT_MS (10000)
+// how many times a chunk is sent again before giving up
+#define MAX_RESENDS (8)
+
+typedef std::vector<uint8_t> Bytes;
+
+static bool readFile(const char * path, std::string & text)
+{
+    FILE * file = fopen(path, "rb");
+    if (!file) return false;
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) text.append(buffer, count);
+    fclose(file);
+    return true;
+}
+
+static int hexByte(const char * text)
+{
+    int value = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        char c = (char)toupper((unsigned char)text[i]);
+        if ((c >= '0') && (c <= '9')) value = value * 16 + (c - '0');
+        else if ((c >= 'A') && (c <= 'F')) value = value * 16 + (c - 'A' + 10);
+        else return -1;
+    }
+    return value;
+}
+
+// one line of hex digits as bytes
+static bool hexBytes(const std::string & line, size_t first, Bytes & bytes)
+{
+    bytes.clear();
+    for (size_t i = first; i + 1 < line.size(); i += 2)
+    {
+        int value = hexByte(&line[i]);
+        if (value < 0) return false;
+        bytes.push_back((uint8_t)value);
+    }
+    return !bytes.empty();
+}
+
+static bool parseIntelHex(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    uint32_t base = 0;
+    size_t start = 0;
+    Bytes record;
+
+    while (start < text.size())
+    {
+        size_t end = text.find_first_of("\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.empty()) continue;
+        if ((line[0] != ':') || !hexBytes(line, 1, record) || (record.size() < 5) || (record.size() != record[0] + 5u))
+        {
+            fprintf(stderr, "bad hex record: %s\n", line.c_str());
+            return false;
+        }
+        uint8_t sum = 0;
+        for (uint8_t b : record) sum += b;
+        if (sum != 0)
+        {
+            fprintf(stderr, "hex record checksum: %s\n", line.c_str());
+            return false;
+        }
+
+        uint32_t address = (record[1] << 8) | record[2];
+        switch (record[3])
+        {
+            case 0x00:
+                for (uint8_t i = 0; i < record[0]; i++) memory[base + address + i] = record[4 + i];
+                break;
+            case 0x01:
+                return true;
+            case 0x02:
+                base = ((record[4] << 8) | record[5]) << 4;
+                break;
+            case 0x04:
+                base = (uint32_t)((record[4] << 8) | record[5]) << 16;
+                break;
+            default:
+                break;  // start addresses
+        }
+    }
+    return true;
+}
+
+static bool parseSRecords(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    size_t start = 0;
+    Bytes record;
+
+    while (start < text.size())
+    {
+        size_t end = text.find_first_of("\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.empty()) continue;
+        if ((line.size() < 4) || (line[0] != 'S') || !hexBytes(line, 2, record) || (record.size() != record[0] + 1u))
+        {
+            fprintf(stderr, "bad S-record: %s\n", line.c_str());
+            return false;
+        }
+        uint8_t sum = 0;
+        for (uint8_t b : record) sum += b;
+        if (sum != 0xFF)
+        {
+            fprintf(stderr, "S-record checksum: %s\n", line.c_str());
+            return false;
+        }
+
+        int addressBytes = 0;
+        switch (line[1])
+        {
+            case '1': addressBytes = 2; break;
+            case '2': addressBytes = 3; break;
+            case '3': addressBytes = 4; break;
+            default: continue;  // header, counts, start addresses
+        }
+        uint32_t address = 0;
+        for (int i = 0; i < addressBytes; i++) address = (address << 8) | record[1 + i];
+        for (size_t i = 1 + addressBytes; i + 1 < record.size(); i++) memory[address++] = record[i];
+    }
+    return true;
+}
+
+// srec_cat -C-Array output: the first array's bytes, and <name>_start
+static bool parseCArray(const std::string & text, std::map<uint32_t, uint8_t> & memory)
+{
+    size_t open = text.find('{');
+    size_t close = text.find('}', open);
+    size_t startName = text.find("_start");
+    if ((open == std::string::npos) || (close == std::string::npos) || (startName == std::string::npos))
+    {
+        fprintf(stderr, "no array, or no _start address\n");
+        return false;
+    }
+    size_t equals = text.find('=', startName);
+    uint32_t address = (uint32_t)strtoul(text.c_str() + equals + 1, 0, 0);
+
+    const char * p = text.c_str() + open + 1;
+    const char * end = text.c_str() + close;
+    while (p < end)
+    {
+        char * next;
+        unsigned long value = strtoul(p, &next, 0);
+        if (next == p)
+        {
+            p++;
+            continue;
+        }
+        memory[address++] = (uint8_t)value;
+        p = next;
+    }
+    return true;
+}
+
+// ----------------------------------------
+// The serial port
+
+static int openPort(const char * path)
+{
+    int fd = open(path, O_RDWR | O_NOCTTY);
+    if (fd < 0) return -1;
+
+    // USB serial ignores the baud rate, a pty doesn't have one
+    struct termios options;
+    if (tcgetattr(fd, &options) == 0)
+    {
+        cfmakeraw(&options);
+        cfsetspeed(&options, B115200);
+        options.c_cc[VMIN] = 0;
+        options.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &options);
+        tcflush(fd, TCIFLUSH);
+    }
+    return fd;
+}
+
+static bool sendFrame(int fd, uint8_t type, const uint8_t * payload, uint16_t length, bool spoil = false)
+{
+    uint8_t frame[ISTREAM_HEADER_SIZE + ISTREAM_MAX_PAYLOAD + ISTREAM_CHECK_SIZE];
+    uint16_t size = IStream_encode(frame, type, payload, length);
+    if (spoil) frame[size - 1] ^= 0x5A;
+    for (uint16_t sent = 0; sent < size; )
+    {
+        ssize_t count = write(fd, frame + sent, size - sent);
+        if (count < 0) return false;
+        sent += (uint16_t)count;
+    }
+    return true;
+}
+
+static uint32_t now_ms(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static void put32(uint8_t * data, uint32_t value)
+{
+    for (int i = 0; i < 4; i++) data[i] = (uint8_t)(value >> (8 * i));
+}
+
+static uint32_t get32(const uint8_t * data)
+{
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+// BLProgramErrors
+static const char * errorName(uint16_t error)
+{
+    switch (error)
+    {
+        case 0: return "programmed";
+        case 101: return "error during InvokeBootloader";
+        case 102: return "error during FormatImage";
+        case 103: return "error during FormatRegion";
+        case 104: return "error during WriteImage";
+        case 105: return "error during Flush";
+        case 106: return "error during Validate";
+        case 107: return "error during Reset";
+        case 109: return "the demo stopped waiting for the image";
+        case 110: return "programmed, but the part didn't switch to it";
+        default: return "error";
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t spoilEvery = 0;
+    int arg = 1;
+
+    for (; (arg < argc) && (argv[arg][0] == '-'); arg++)
+    {
+        if ((strcmp(argv[arg], "-e") == 0) && (arg + 1 < argc)) spoilEvery = (uint32_t)atoi(argv[++arg]);
+        else break;
+    }
+    if (arg + 2 != argc)
+    {
+        fprintf(stderr, "usage: ImageSender [-e every] port input\n"
+            "  port: the demo's serial port, or the pty BLSimulator -p prints\n"
+            "  input: Intel hex, S-records, or a srec_cat C array\n"
+            "  -e: spoil every nth chunk, to check they're sent again\n");
+        return 2;
+    }
+    const char * port = argv[arg];
+    const char * input = argv[arg + 1];
+
+    std::string text;
+    if (!readFile(input, text))
+    {
+        fprintf(stderr, "can't read %s\n", input);
+        return 1;
+    }
+    size_t first = text.find_first_not_of(" \t\r\n");
+    std::map<uint32_t, uint8_t> memory;
+    bool parsed;
+    if ((first != std::string::npos) && (text[first] == ':')) parsed = parseIntelHex(text, memory);
+    else if ((first != std::string::npos) && (text[first] == 'S')) parsed = parseSRecords(text, memory);
+    else parsed = parseCArray(text, memory);
+    if (!parsed || (memory.size() < 8))
+    {
+        fprintf(stderr, "no image in %s\n", input);
+        return 1;
+    }
+
+    // one piece, gaps erased, as BL_program_image would be given it
+    uint32_t address = memory.begin()->first;
+    Bytes image(memory.rbegin()->first + 1 - address, 0xFF);
+    for (auto & byte : memory) image[byte.first - address] = byte.second;
+    uint32_t size = (uint32_t)image.size();
+
+    int fd = openPort(port);
+    if (fd < 0)
+    {
+        fprintf(stderr, "can't open %s\n", port);
+        return 1;
+    }
+
+    uint8_t start[16];
+    put32(&start[0], address);
+    put32(&start[4], size);
+    put32(&start[8], get32(&image[4]));  // the entry point
+    put32(&start[12], Fletcher32(image.data(), size));
+    printf("%s: %lu bytes at 0x%08lX, Fletcher32 0x%08lX\n", input, (unsigned long)size, (unsigned long)address,
+        (unsigned long)get32(&start[12]));
+    if (!sendFrame(fd, ISTREAM_START, start, sizeof(start)))
+    {
+        fprintf(stderr, "can't write to %s\n", port);
+        return 1;
+    }
+
+    istream_frame reply = {};
+    uint8_t chunk[ISTREAM_MAX_PAYLOAD];
+    uint32_t next = 0;          // the offset of the next chunk to send
+    uint32_t credits = 0;
+    uint32_t chunksSent = 0;
+    uint32_t resent = 0;
+    uint32_t nakOffset = 0;
+    uint32_t nakRepeats = 0;
+    uint32_t started_ms = now_ms();
+    uint32_t heard_ms = started_ms;
+    bool finished = false;
+    uint16_t error = 0;
+    uint32_t bytesWritten = 0;
+
+    while (!finished)
+    {
+        while ((credits > 0) && (next < size))
+        {
+            uint32_t length = size - next;
+            if (length > ISTREAM_CHUNK_SIZE) length = ISTREAM_CHUNK_SIZE;
+            put32(chunk, next);
+            memcpy(&chunk[4], &image[next], length);
+            chunksSent++;
+            if (!sendFrame(fd, ISTREAM_DATA, chunk, (uint16_t)(4 + length),
+                (spoilEvery > 0) && (chunksSent % spoilEvery == 0)))
+            {
+                fprintf(stderr, "can't write to %s\n", port);
+                return 1;
+            }
+            next += length;
+            credits--;
+        }
+
+        struct pollfd wait = { fd, POLLIN, 0 };
+        uint8_t buffer[256];
+        ssize_t count = 0;
+        if (poll(&wait, 1, 100) > 0) count = read(fd, buffer, sizeof(buffer));
+        for (ssize_t i = 0; i < count; i++)
+        {
+            if (IStream_parse(&reply, buffer[i]) != ISTREAM_FRAME_GOOD) continue;
+            heard_ms = now_ms();
+            if ((reply.type == ISTREAM_CREDIT) && (reply.length == 1))
+            {
+                credits += reply.payload[0];
+            }
+            else if ((reply.type == ISTREAM_NAK) && (reply.length == 4) && (get32(reply.payload) < next))
+            {
+                nakRepeats = (get32(reply.payload) == nakOffset) ? nakRepeats + 1 : 0;
+                nakOffset = get32(reply.payload);
+                if (nakRepeats >= MAX_RESENDS)
+                {
+                    sendFrame(fd, ISTREAM_ABORT, 0, 0);
+                    fprintf(stderr, "%s: the chunk at 0x%lX was spoiled %u times, giving up\n", port,
+                        (unsigned long)nakOffset, MAX_RESENDS);
+                    return 1;
+                }
+                resent += (next - nakOffset + ISTREAM_CHUNK_SIZE - 1) / ISTREAM_CHUNK_SIZE;
+                next = nakOffset;
+            }
+            else if ((reply.type == ISTREAM_RESULT) && (reply.length == 6))
+            {
+                error = reply.payload[0] | (reply.payload[1] << 8);
+                bytesWritten = get32(&reply.payload[2]);
+                finished = true;
+            }
+        }
+
+        if (!finished && (now_ms() - heard_ms > REPLY_TIMEOUT_MS))
+        {
+            sendFrame(fd, ISTREAM_ABORT, 0, 0);
+            fprintf(stderr, "%s: no answer for %u s, is the demo running (and not in the middle of something)?\n",
+                port, REPLY_TIMEOUT_MS / 1000);
+            return 1;
+        }
+    }
+    close(fd);
+
+    printf("%s, error %u: %lu bytes written in %lu ms, %lu chunks sent again\n", errorName(error), error,
+        (unsigned long)bytesWritten, (unsigned long)(now_ms() - started_ms), (unsigned long)resent);
+    return (error == 0) ? 0 : 1;
+}
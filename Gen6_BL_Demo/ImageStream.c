@@ -0,0 +1,289 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <string.h>
+
+#include "Fletcher16.h"
+#include "ImageStream.h"
+
+enum FrameStates
+{
+    FrameState_Sync = 0,
+    FrameState_Type = 1,
+    FrameState_LengthLow = 2,
+    FrameState_LengthHigh = 3,
+    FrameState_Payload = 4,     // and the check
+};
+
+static uint32_t get32(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void put32(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+//the Fletcher16 of type, length and payload
+static uint16_t FrameCheck(uint8_t type, const uint8_t *payload, uint16_t length)
+{
+    uint8_t header[3];
+
+    header[0] = type;
+    header[1] = (uint8_t)length;
+    header[2] = (uint8_t)(length >> 8);
+    return Fletcher16_Continue(payload, length, Fletcher16(header, sizeof(header)));
+}
+
+static void Send(istream *stream, uint8_t type, const uint8_t *payload, uint16_t length)
+{
+    uint8_t frame[ISTREAM_HEADER_SIZE + 8 + ISTREAM_CHECK_SIZE];
+
+    stream->send(frame, IStream_encode(frame, type, payload, length));
+}
+
+static void SendCredit(istream *stream, uint8_t count)
+{
+    Send(stream, ISTREAM_CREDIT, &count, 1);
+}
+
+//drops a chunk that can't be taken and gives its credit back, the first since the last one
+//that was taken says where to go on from
+static void Drop(istream *stream)
+{
+    uint8_t offset[4];
+
+    if (stream->nakSent == false)
+    {
+        put32(offset, stream->expected);
+        Send(stream, ISTREAM_NAK, offset, sizeof(offset));
+        stream->nakSent = true;
+    }
+    SendCredit(stream, 1);
+}
+
+static void Start(istream *stream, const uint8_t *payload, uint16_t length)
+{
+    if (stream->started || stream->aborted)
+    {
+        return;     // sent again, the first is the one going ahead
+    }
+    stream->address = get32(&payload[0]);
+    stream->numBytes = get32(&payload[4]);
+    stream->entryPoint = get32(&payload[8]);
+    stream->checksum = get32(&payload[12]);
+    if ((length != 16) || (stream->numBytes < 8))
+    {
+        stream->aborted = true;
+        return;
+    }
+    stream->started = true;
+    SendCredit(stream, ISTREAM_BUFFERS);
+}
+
+static void Data(istream *stream, const uint8_t *payload, uint16_t length)
+{
+    istream_buffer *buffer = NULL;
+    uint32_t expectedLength;
+    uint8_t i;
+
+    if ((stream->started == false) || stream->aborted || (length < 4))
+    {
+        return;
+    }
+    expectedLength = stream->numBytes - stream->expected;
+    if (expectedLength > ISTREAM_CHUNK_SIZE)
+    {
+        expectedLength = ISTREAM_CHUNK_SIZE;
+    }
+    for (i = 0; i < ISTREAM_BUFFERS; i++)
+    {
+        if (stream->buffers[i].full == false)
+        {
+            buffer = &stream->buffers[i];
+            break;
+        }
+    }
+    // out of order, past the end, or sent without a credit
+    if ((get32(payload) != stream->expected) || (length - 4u != expectedLength) || (buffer == NULL))
+    {
+        Drop(stream);
+        return;
+    }
+
+    memcpy(buffer->data, &payload[4], expectedLength);
+    buffer->offset = stream->expected;
+    buffer->length = (uint16_t)expectedLength;
+    buffer->full = true;
+    stream->expected += expectedLength;
+    stream->nakSent = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//Public Functions
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t IStream_parse(istream_frame *frame, uint8_t byte)
+{
+    uint16_t check;
+
+    switch (frame->state)
+    {
+        case FrameState_Sync:
+            if (byte == ISTREAM_SYNC)
+            {
+                frame->state = FrameState_Type;
+            }
+            return ISTREAM_FRAME_NONE;
+
+        case FrameState_Type:
+            frame->type = byte;
+            frame->state = FrameState_LengthLow;
+            return ISTREAM_FRAME_NONE;
+
+        case FrameState_LengthLow:
+            frame->length = byte;
+            frame->state = FrameState_LengthHigh;
+            return ISTREAM_FRAME_NONE;
+
+        case FrameState_LengthHigh:
+            frame->length |= byte << 8;
+            frame->count = 0;
+            frame->state = FrameState_Payload;
+            if (frame->length > ISTREAM_MAX_PAYLOAD)
+            {
+                frame->state = FrameState_Sync;
+                return ISTREAM_FRAME_BAD;
+            }
+            return ISTREAM_FRAME_NONE;
+
+        default:
+            frame->payload[frame->count++] = byte;
+            if (frame->count < frame->length + ISTREAM_CHECK_SIZE)
+            {
+                return ISTREAM_FRAME_NONE;
+            }
+            frame->state = FrameState_Sync;
+            check = frame->payload[frame->length] | (frame->payload[frame->length + 1] << 8);
+            return (check == FrameCheck(frame->type, frame->payload, frame->length)) ?
+                   ISTREAM_FRAME_GOOD : ISTREAM_FRAME_BAD;
+    }
+}
+
+
+uint16_t IStream_encode(uint8_t *out, uint8_t type, const uint8_t *payload, uint16_t length)
+{
+    uint16_t check = FrameCheck(type, payload, length);
+
+    out[0] = ISTREAM_SYNC;
+    out[1] = type;
+    out[2] = (uint8_t)length;
+    out[3] = (uint8_t)(length >> 8);
+    memcpy(&out[ISTREAM_HEADER_SIZE], payload, length);
+    out[ISTREAM_HEADER_SIZE + length] = (uint8_t)check;
+    out[ISTREAM_HEADER_SIZE + length + 1] = (uint8_t)(check >> 8);
+    return ISTREAM_HEADER_SIZE + length + ISTREAM_CHECK_SIZE;
+}
+
+
+void IStream_init(istream *stream, istream_send send)
+{
+    memset(stream, 0, sizeof(istream));
+    stream->send = send;
+}
+
+
+void IStream_receive(istream *stream, const uint8_t *data, uint32_t count)
+{
+    istream_frame *frame = &stream->frame;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        switch (IStream_parse(frame, data[i]))
+        {
+            case ISTREAM_FRAME_GOOD:
+                stream->frames++;
+                if (frame->type == ISTREAM_START)
+                {
+                    Start(stream, frame->payload, frame->length);
+                }
+                else if (frame->type == ISTREAM_DATA)
+                {
+                    Data(stream, frame->payload, frame->length);
+                }
+                else if (frame->type == ISTREAM_ABORT)
+                {
+                    stream->aborted = true;
+                }
+                break;
+
+            case ISTREAM_FRAME_BAD:
+                // most likely a chunk, which had a credit. It could be the one sent again
+                // after the last ISTREAM_NAK, so this one has its own
+                stream->frames++;
+                if (stream->started && !stream->aborted)
+                {
+                    stream->nakSent = false;
+                    Drop(stream);
+                }
+                break;
+        }
+    }
+}
+
+
+const uint8_t *IStream_chunk(istream *stream, uint32_t offset)
+{
+    uint8_t i;
+
+    for (i = 0; (i < ISTREAM_BUFFERS) && !stream->aborted; i++)
+    {
+        if (stream->buffers[i].full && (stream->buffers[i].offset == offset))
+        {
+            return stream->buffers[i].data;
+        }
+    }
+    return NULL;
+}
+
+
+void IStream_release(istream *stream, uint32_t offset)
+{
+    uint8_t i;
+
+    for (i = 0; i < ISTREAM_BUFFERS; i++)
+    {
+        if (stream->buffers[i].full && (stream->buffers[i].offset == offset))
+        {
+            stream->buffers[i].full = false;
+            if (stream->buffers[i].offset + stream->buffers[i].length < stream->numBytes)
+            {
+                SendCredit(stream, 1);
+            }
+        }
+    }
+}
+
+
+//the PC has stopped sending, or the update has failed: no more chunks are taken
+void IStream_abort(istream *stream)
+{
+    stream->aborted = true;
+}
+
+
+//tells the PC how the update went
+void IStream_finish(istream *stream, uint16_t error, uint32_t bytesWritten)
+{
+    uint8_t result[6];
+
+    result[0] = (uint8_t)error;
+    result[1] = (uint8_t)(error >> 8);
+    put32(&result[2], bytesWritten);
+    stream->aborted = true;
+    Send(stream, ISTREAM_RESULT, result, sizeof(result));
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#ifndef IMAGE_STREAM_H
+#define IMAGE_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* A firmware image sent by the PC over USB serial as it's programmed (ImageSender sends them),
+ * so a new build doesn't need the demo rebuilt.
+ *
+ * Both ways it's frames, everything little endian:
+ *    0  ISTREAM_SYNC
+ *    1  type
+ *    2  length (uint16) of the payload, ISTREAM_MAX_PAYLOAD at most
+ *    4  payload
+ * then the Fletcher16 of type, length and payload (uint16). Anything before a sync is skipped.
+ *
+ * The PC starts with ISTREAM_START. The Teensy answers with ISTREAM_CREDIT, and from then on
+ * the PC sends an ISTREAM_DATA frame for each credit it has: the chunk at offset, in order,
+ * ISTREAM_CHUNK_SIZE bytes (the last is the rest). Each chunk has a buffer to itself, and its
+ * credit comes back once it's been sent to the part, so while one is being written the next
+ * is arriving. A frame that's bad or out of order is dropped (its credit comes back), and an
+ * ISTREAM_NAK says where to go on from. ISTREAM_RESULT ends it.
+ */
+
+#define ISTREAM_SYNC (0xA5)
+#define ISTREAM_HEADER_SIZE (4)
+#define ISTREAM_CHECK_SIZE (2)
+#define ISTREAM_CHUNK_SIZE (520)  // MAX_DATA_PAYLOAD_SIZE, a chunk is a write
+#define ISTREAM_MAX_PAYLOAD (4 + ISTREAM_CHUNK_SIZE)
+#define ISTREAM_BUFFERS (2)
+
+// PC to Teensy
+#define ISTREAM_START ('S')   // address, numBytes, entryPoint, checksum (uint32 each)
+#define ISTREAM_DATA ('D')    // offset (uint32), then the chunk
+#define ISTREAM_ABORT ('A')
+// Teensy to PC
+#define ISTREAM_CREDIT ('C')  // count (uint8), that many more ISTREAM_DATA frames can be sent
+#define ISTREAM_NAK ('N')     // offset (uint32), go on from the chunk there
+#define ISTREAM_RESULT ('R')  // error (uint16, BLProgramErrors), bytesWritten (uint32)
+
+// what IStream_parse returns
+#define ISTREAM_FRAME_NONE (0)
+#define ISTREAM_FRAME_GOOD (1)
+#define ISTREAM_FRAME_BAD (2)
+
+// a frame as it arrives
+typedef struct
+{
+    uint8_t state;
+    uint8_t type;
+    uint16_t length;
+    uint16_t count;         // of the payload and check, so far
+    uint8_t payload[ISTREAM_MAX_PAYLOAD + ISTREAM_CHECK_SIZE];
+} istream_frame;
+
+typedef struct
+{
+    uint32_t offset;
+    uint16_t length;
+    bool full;
+    uint8_t data[ISTREAM_CHUNK_SIZE];
+} istream_buffer;
+
+// sends a frame to the PC
+typedef void (*istream_send)(const uint8_t *data, uint16_t count);
+
+// The Teensy's end: what ISTREAM_START said, and the chunks that have arrived.
+typedef struct
+{
+    istream_frame frame;
+    istream_buffer buffers[ISTREAM_BUFFERS];
+    istream_send send;
+    bool started;
+    bool aborted;           // by the PC, or given up on (IStream_abort)
+    bool nakSent;           // since the last chunk that was in order
+    uint32_t address;
+    uint32_t numBytes;
+    uint32_t entryPoint;
+    uint32_t checksum;
+    uint32_t expected;      // the offset of the next chunk
+    uint32_t frames;        // received, good or bad, to tell the PC is still sending
+} istream;
+
+// Feeds a byte to the frame. returns ISTREAM_FRAME_GOOD once a whole one has arrived with the
+// right check, ISTREAM_FRAME_BAD if it hasn't (either way the next byte starts another)
+uint8_t IStream_parse(istream_frame *frame, uint8_t byte);
+// puts a frame in out (ISTREAM_HEADER_SIZE + length + ISTREAM_CHECK_SIZE bytes), returns its size
+uint16_t IStream_encode(uint8_t *out, uint8_t type, const uint8_t *payload, uint16_t length);
+
+void IStream_init(istream *stream, istream_send send);
+void IStream_receive(istream *stream, const uint8_t *data, uint32_t count);
+// the chunk at offset, NULL if it hasn't arrived
+const uint8_t *IStream_chunk(istream *stream, uint32_t offset);
+// the chunk at offset has been sent to the part, its buffer can take another
+void IStream_release(istream *stream, uint32_t offset);
+void IStream_abort(istream *stream);
+void IStream_finish(istream *stream, uint16_t error, uint32_t bytesWritten);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMAGE_STREAM_H
@@ -1,10 +1,13 @@
 // Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
 
 #include "CirqueHid.h"
+#include "DataUtils.h"
+#include <string.h>
 
 CirqueHid::CirqueHid(uint8_t i2cAddress, uint16_t maxBufferLength) : I2cHidApi(i2cAddress, maxBufferLength)
 {
-
+    m_endianStateKnown = false;
+    m_endianState = 0;
 }
 
 CirqueHid::~CirqueHid()
@@ -51,3 +54,169 @@ uint8_t CirqueHid::isDR_AssertedViaI2C()
 {
     return readCirqueRegister(REG_DR_STATUS);
 }
+
+I2cHidApi::commandErrors CirqueHid::readSystemInfo(SystemInfo & systemInfo)
+{
+    uint8_t buffer[systemInfo.dataLength];
+    bool bigEndian = (endianState() != 0);
+    commandErrors status = readExtendedMemory(REG_SYS_INFO, buffer, systemInfo.dataLength);
+    if (status == cmd_okay) systemInfo.decodeFrom(buffer, bigEndian);
+    return status;
+}
+
+I2cHidApi::commandErrors CirqueHid::readXYConfig(XYConfig & xyConfig)
+{
+    uint8_t buffer[xyConfig.dataLength];
+    bool bigEndian = (endianState() != 0);
+    commandErrors status = readExtendedMemory(xyConfig.baseAddress, buffer, xyConfig.dataLength);
+    if (status == cmd_okay) xyConfig.decodeFrom(buffer, bigEndian);
+    return status;
+}
+
+I2cHidApi::commandErrors CirqueHid::readPowerConfig(PowerConfig & powerConfig)
+{
+    uint8_t buffer[powerConfig.dataLength];
+    bool bigEndian = (endianState() != 0);
+    commandErrors status = readExtendedMemory(powerConfig.baseAddress, buffer, powerConfig.dataLength);
+    if (status == cmd_okay) powerConfig.decodeFrom(buffer, bigEndian);
+    return status;
+}
+
+I2cHidApi::commandErrors CirqueHid::readFeedConfig(FeedConfig & feedConfig)
+{
+    uint8_t buffer[feedConfig.dataLength];
+    bool bigEndian = (endianState() != 0);
+    commandErrors status = readExtendedMemory(feedConfig.baseAddress, buffer, feedConfig.dataLength);
+    if (status == cmd_okay) feedConfig.decodeFrom(buffer, bigEndian);
+    return status;
+}
+
+void CirqueHid::writeCirqueRegister(uint32_t address, uint8_t value)
+{
+    writeExtendedMemory(address, &value, 1);
+}
+
+void CirqueHid::sensorSize(uint8_t &sizeX, uint8_t &sizeY)
+{
+    uint8_t counts[2];
+    readExtendedMemory(REG_SENSOR_X_COUNT, counts, 2);
+    sizeX = counts[0];
+    sizeY = counts[1];
+}
+
+bool CirqueHid::setQMVStream(QMVChannelNumbers channelNumber, QMVChannelState state)
+{
+    uint32_t address = REG_QMV_CONTROL + channelNumber;
+    uint8_t registerValue = (state != QMVCHANNEL_OFF) ? (state | 0x80) : 0;
+    writeCirqueRegister(address, registerValue);
+    return readCirqueRegister(address) == registerValue;
+}
+
+reportIds_t CirqueHid::getQMVReport(QmvImageStore & imageStore, uint32_t timestamp_us, HidReport & otherReport)
+{
+    reportIds_t result = id_unknown;
+    uint16_t readCount = m_host_bus->read(m_i2cAddress, m_maxBufferLength);
+    retrieveReadData(m_commandBuffer, readCount, m_maxBufferLength);
+    if (readCount < QMV_HEADER_LENGTH) return result;
+
+    if (m_commandBuffer[2] == QMV_REPORT_ID)
+    {
+        imageStore.consume(m_commandBuffer, readCount, timestamp_us);
+        result = (reportIds_t)QMV_REPORT_ID;
+    }
+    else if (otherReport.decodeReport(m_commandBuffer))
+    {
+        result = otherReport.reportId;
+    }
+    return result;
+}
+
+uint8_t CirqueHid::endianState(void)
+{
+    if (!m_endianStateKnown)
+    {
+        // read this once and save the value for future use
+        m_endianState = readCirqueRegister(REG_IS_BIG_ENDIAN) & IS_BIG_ENDIAN_CONFIG_MASK;
+        m_endianStateKnown = true;
+    }
+    return m_endianState;
+}
+
+uint16_t CirqueHid::compByteLength(void)
+{
+    uint8_t lengthBytes[2];
+    readExtendedMemory(EXTREG_COMP_MATRIX_LENGTH, lengthBytes, 2);
+    return lengthBytes[0] | (lengthBytes[1] << 8);
+}
+
+I2cHidApi::commandErrors CirqueHid::readComp(int16_t * compMatrix, uint16_t compByteLength)
+{
+    // extended reads carry 3 bytes of overhead (length, checksum), keep chunks an even number of bytes
+    uint16_t chunkSize = (m_host_bus->i2cMinBufferLength - 3) & ~1;
+    uint8_t * rawData = (uint8_t *)compMatrix;
+    bool bigEndian = (endianState() != 0); // before comp is disabled, this may need a read
+
+    uint8_t enableFlags;
+    commandErrors status = readExtendedMemory(REG_ENABLE_FLAGS, &enableFlags, 1);
+    if (status != cmd_okay) return status;
+    writeCirqueRegister(REG_ENABLE_FLAGS, enableFlags & ~COMPFLAG_ALL_COMPS_ENABLE);
+
+    for (uint16_t offset = 0; (offset < compByteLength) && (status == cmd_okay); offset += chunkSize)
+    {
+        uint16_t length = (compByteLength - offset < chunkSize) ? compByteLength - offset : chunkSize;
+        status = readExtendedMemory(EXTREG_COMP_MATRIX_DATA + offset, &rawData[offset], length);
+    }
+
+    writeCirqueRegister(REG_ENABLE_FLAGS, enableFlags);
+
+    // the bytes landed in compMatrix as they were sent, the host is little endian
+    if (bigEndian)
+    {
+        swapBytes16((uint16_t *)compMatrix, compByteLength / 2);
+    }
+    return status;
+}
+
+const PowerSettings_t & CirqueHid::powerProfileSettings(PowerProfiles profile)
+{
+    static const PowerSettings_t profiles[] =
+    {
+        // lowest latency: always scanning at the active rate
+        {  50,  100,  600, 1000, POWER_SETTING_DISABLE_IDLE_SLEEP | POWER_SETTING_DISABLE_DEEP_SLEEP },
+        // balanced: idle after 5 s (10 ms scans), sleep after 60 s (100 ms scans)
+        {  50,  100,  600, 1000, 0 },
+        // battery: idle after 1 s (25 ms scans), sleep after 10 s (200 ms scans)
+        {  10,  250,  100, 2000, 0 },
+    };
+    return profiles[(profile <= POWER_BATTERY) ? profile : POWER_BALANCED];
+}
+
+bool CirqueHid::writePowerSettings(const PowerSettings_t & powerSettings)
+{
+    uint16_t times[4] = { powerSettings.timeBeforeIdle_100ms, powerSettings.timeInIdle_100us,
+        powerSettings.timeBeforeSleep_100ms, powerSettings.timeInSleep_100us };
+    bool bigEndian = (endianState() != 0);
+    uint8_t registers[POWER_REGISTERS_LENGTH];
+    uint8_t readBack[POWER_REGISTERS_LENGTH];
+
+    for (uint8_t x = 0; x < 4; x++)
+    {
+        registers[(2 * x) + (bigEndian ? 1 : 0)] = times[x] & 0xFF;
+        registers[(2 * x) + (bigEndian ? 0 : 1)] = (times[x] >> 8) & 0xFF;
+    }
+    registers[8] = powerSettings.settings;
+
+    writeExtendedMemory(REG_POWER_REGISTERS, registers, POWER_REGISTERS_LENGTH);
+    if (readExtendedMemory(REG_POWER_REGISTERS, readBack, POWER_REGISTERS_LENGTH) != cmd_okay) return false;
+    return memcmp(registers, readBack, POWER_REGISTERS_LENGTH) == 0;
+}
+
+bool CirqueHid::setPowerProfile(PowerProfiles profile)
+{
+    return writePowerSettings(powerProfileSettings(profile));
+}
+
+void CirqueHid::forceSleep(bool sleep)
+{
+    writeCirqueRegister(REG_POWER_CMD, sleep ? POWER_CMD_FORCE_SLEEP : POWER_CMD_CANCEL_FORCE_SLEEP);
+}
@@ -4,6 +4,20 @@
 // Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
 
 #include "I2cHidApi.h"
+#include "CustomMeasSystemInfo.h"
+#include "CirqueHidConfig.h"
+#include "QuickMeasView.h"
+#include "CompDrift.h"
+
+#define REG_SYS_INFO (0x20000808)  // hardwareId, firmwareId, vendor/product/version IDs, firmware revision...
+#define REG_SENSOR_X_COUNT (0x2001080C)  // followed by REG_SENSOR_Y_COUNT
+#define REG_QMV_CONTROL (0x20160408)  // one byte per QMV channel
+#define REG_IS_BIG_ENDIAN (0x20000824)
+#define IS_BIG_ENDIAN_CONFIG_MASK (0x01)
+#define REG_ENABLE_FLAGS (0x20020008)
+#define COMPFLAG_ALL_COMPS_ENABLE (0x7E)
+#define EXTREG_COMP_MATRIX_LENGTH (0x30010000)
+#define EXTREG_COMP_MATRIX_DATA (0x30010002)
 
 class CirqueHid : public I2cHidApi
 {
@@ -18,6 +32,29 @@ public:
         PTP_DiscretePad = 2,    // Non-Clickable
     };
 
+    enum QMVChannelState
+    {
+        QMVCHANNEL_UART = 0,
+        QMVCHANNEL_I2C = 1,
+        QMVCHANNEL_OFF = 0xFF
+    };
+
+    enum QMVChannelNumbers  // From: CoreFW/Includes/QuickMeasViewDataControl.h
+    {
+        QMV_PREDEMUX = 0,
+        QMV_POSTDEMUX = 1,
+        QMV_POSTCOMP = 2,
+        QMV_COMP = 3,
+        QMV_FACTORYCOMP = 4,
+    };
+
+    enum PowerProfiles
+    {
+        POWER_LOWEST_LATENCY = 0,  // never idles or sleeps
+        POWER_BALANCED = 1,
+        POWER_BATTERY = 2,
+    };
+
     // Cirque-specific HID stuff
     void getDeviceCapabilities(uint8_t &NumberContacts, PTP_ButtonImplementation &ButtonImplementation);
     void getCertificationStatus(uint8_t * blob, uint16_t blobLength);
@@ -26,14 +63,40 @@ public:
     uint8_t readCirqueRegister(uint32_t address);   // replaces API_C3_readRegister
     uint8_t isDR_AssertedViaI2C(void);              // replaces API_C3_DR_Asserted_ViaI2C
 
+    // each block is read in a single extended memory transaction, and only decoded if the read worked
+    commandErrors readSystemInfo(SystemInfo & systemInfo);  // replaces API_C3_readSystemInfo
+    commandErrors readXYConfig(XYConfig & xyConfig);
+    commandErrors readPowerConfig(PowerConfig & powerConfig);
+    commandErrors readFeedConfig(FeedConfig & feedConfig);
+
+    // Power management - all the power registers are written in one transaction, then read back in one
+    bool writePowerSettings(const PowerSettings_t & powerSettings);  // replaces API_C3_setTimeBeforeIdle, ...
+    bool setPowerProfile(PowerProfiles profile);
+    static const PowerSettings_t & powerProfileSettings(PowerProfiles profile);
+    void forceSleep(bool sleep);
+
+    void writeCirqueRegister(uint32_t address, uint8_t value);
+    uint8_t endianState(void);  // 1 = device config registers are big endian, read once and remembered
+    void sensorSize(uint8_t &sizeX, uint8_t &sizeY);
+
+    // Compensation matrix
+    uint16_t compByteLength(void);
+    // Reads the whole matrix (compByteLength bytes) into compMatrix, in the largest chunks the host bus 
+    // buffer holds. Comp is only disabled while the matrix is being read, and the enable flags 
+    // are put back the way they were. The byte order is fixed up after comp is running again.
+    commandErrors readComp(int16_t * compMatrix, uint16_t compByteLength);  // replaces API_C3_readComp
+
+    // QuickMeasView - stream sensor images, one per frame, onto I2C
+    bool setQMVStream(QMVChannelNumbers channelNumber, QMVChannelState state);  // replaces API_C3_SetQMVStream
+    // Reads the next report. QMV reports go into the image store, anything else is decoded into otherReport.
+    // The whole report is read in one transaction (up to maxBufferLength bytes).
+    reportIds_t getQMVReport(QmvImageStore & imageStore, uint32_t timestamp_us, HidReport & otherReport);
+
 	// suggested functions, that need to be pulled over from the prior code
-	//uint8_t endianState(void);
 	//uint16_t readCirqueRegister16(uint32_t address);
 	//uint32_t readCirqueRegister32(uint32_t address);
-	//void writeCirqueRegister(uint32_t address, uint8_t value);
 	//void writeCirqueRegister16(uint32_t address, uint16_t contents);
 	//void writeCirqueRegister32(uint32_t address, uint32_t contents);
-	//void readSystemInfo(systemInfo_t* result);
 	//uint8_t getMemoryContents(uint32_t address, uint8_t * buffer, uint16_t bufferLength, uint16_t chunkSize);
 
     // what about doing fw update?
@@ -41,14 +104,11 @@ public:
 
     // Cirque C3 Api - these functions can be renamed and pulled over from the prior code
 
-    // uint8_t API_C3_endianState(void);
     // uint16_t API_C3_readRegister16(uint32_t address);
     // uint32_t API_C3_readRegister32(uint32_t address);
-    // void API_C3_writeRegister(uint32_t address, uint8_t value);
     // void API_C3_writeRegister16(uint32_t address, uint16_t contents);
     // void API_C3_writeRegister32(uint32_t address, uint32_t contents);
 
-    // void API_C3_readSystemInfo(systemInfo_t* result);
     // uint8_t API_C3_getMemoryContents(uint32_t address, uint8_t * buffer, uint16_t bufferLength, uint16_t chunkSize);
     // void API_C3_setPtpMode();
     // void API_C3_setCRQ_AbsoluteMode(void);
@@ -63,19 +123,6 @@ public:
     // void API_C3_disableScaling(void);
     // void API_C3_enableLinearCorrection(void);
     // void API_C3_disableLinearCorrection(void);
-    // // Common channel numbers in QMVChannelNumbers enum
-    // void API_C3_SetQMVStream(uint8_t channelNumber, QMVChannelState state);
-    // // From: CoreFW/Includes/QuickMeasViewDataControl.h
-    // //QmvId_Image_PreDemux, // 0
-    // //QmvId_Image_PostDemux, // 1
-    // //QmvId_Image_PostComp, //2
-    // //QmvId_Image_Comp,  //3
-    // // ...
-    // 	//QmvId_IdleDetect,  // 16
-    // //QmvId_IdleDetect_Accumulation,  // 17
-    // //QmvId_IdleDetect_MeasData, // 18
-
-    // bool API_C3_XYConfig_isImplemented();
     // void API_C3_setInvertX(void);
     // void API_C3_clearInvertX(void);
     // void API_C3_setInvertY(void);
@@ -86,29 +133,20 @@ public:
     // void API_C3_disableLogicalScaling(void);
     // void API_C3_enableComp(void);
     // void API_C3_disableComp(void);
-    // bool API_C3_PowerManagement_isImplemented(void);
-    // void API_C3_setPowerSetting(uint8_t registerValue);
-    // void API_C3_setPowerCommand(uint8_t registerValue);
-    // void API_C3_setTimeBeforeIdle(uint16_t timeBeforeIdle_100ms); //given in 100 ms
-    // void API_C3_setTimeInIdle(uint16_t idleTime);
-    // void API_C3_setTimeBeforeSleep(uint16_t timeBeforeSleep_100ms); //given in 100 ms
-    // void API_C3_setTimeInSleep(uint16_t sleepTime); //given in 100us increments
-    // void API_C3_setIdleDisable(bool idleDisable);
-    // bool API_C3_readIdleDisable();
-    // void API_C3_setSleepDisable(bool sleepDisable);
-    // bool API_C3_readSleepDisable();
     // bool API_C3_ProjectSpecific_isImplemented(void);
     // bool API_C3_saveConfig(void);
     // bool API_C3_restoreSavedConfig(void);
     // bool API_C3_restoreFactoryConfig(void);
-    // void API_C3_sensorSize(uint8_t * sizeX, uint8_t * sizeY, uint16_t * compByteLength);
-    // void API_C3_readComp(int16_t * compMatrix, uint16_t compByteLength, uint16_t chunkSize);
 
     // // for now these are a pass-through to the HID_reports code, they only work for CRQ_Absolute mode 
     // bool API_C3_isFingerValid(HID_report_t* report, uint8_t finger_num);
     // bool API_C3_isFingerContacted(HID_report_t* report, uint8_t finger_num);
     // uint8_t API_C3_numberFingers(HID_report_t* report);
     // bool API_C3_isButtonPressed(HID_report_t* report, uint8_t buttonMask);
+
+private:
+    bool m_endianStateKnown;
+    uint8_t m_endianState;
 };
 
 //  Hid.c
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "CirqueHidConfig.h"
+
+void ConfigBlock::decodeHeader(uint8_t * packet, uint16_t &packetIndex, uint32_t baseAddress)
+{
+	// base address is stored at the base address if implemented, and the header data must be non-zero
+	uint32_t address = next32bits(packet, packetIndex);
+	uint32_t headerData = next32bits(packet, packetIndex);
+	m_isImplemented = (address == baseAddress) && (headerData != 0);
+}
+
+void XYConfig::decodeFrom(uint8_t * packet, bool bigEndian)
+{
+	uint16_t index = 0;
+
+	decodeHeader(packet, index, baseAddress);
+	index = 0x18;
+	m_flags = next8bits(packet, index);
+}
+
+void PowerConfig::decodeFrom(uint8_t * packet, bool bigEndian)
+{
+	uint16_t index = 0;
+
+	decodeHeader(packet, index, baseAddress);
+	m_timeBeforeIdle = next16bits(packet, index, bigEndian);
+	m_timeInIdle = next16bits(packet, index, bigEndian);
+	m_timeBeforeSleep = next16bits(packet, index, bigEndian);
+	m_timeInSleep = next16bits(packet, index, bigEndian);
+	m_settings = next8bits(packet, index);
+}
+
+void FeedConfig::decodeFrom(uint8_t * packet, bool bigEndian)
+{
+	uint16_t index = 0;
+
+	decodeHeader(packet, index, baseAddress);
+	m_config1 = next8bits(packet, index);
+	m_config2 = next8bits(packet, index);
+	m_config3 = next8bits(packet, index);
+	m_config4 = next8bits(packet, index);
+}
@@ -0,0 +1,120 @@
+#ifndef CIRQUE_HID_CONFIG_H
+#define CIRQUE_HID_CONFIG_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "ResponseReader.h"
+
+// Gen6 configuration blocks start with an 8 byte header: the block's own base address,
+// then 4 bytes that are non-zero when the block is implemented. The registers follow
+// the header, so the header and the registers can be read in a single burst.
+
+// XY Config
+#define REG_XY_CONFIG_HEADER          (0x20080000)
+#define XY_CONFIG_INVERT_X            (0x01)
+#define XY_CONFIG_INVERT_Y            (0x02)
+#define XY_CONFIG_SWAP_XY             (0x04)
+#define XY_CONFIG_DISABLE_SCALING     (0x08)
+#define XY_CONFIG_LIFTOFF_OOB         (0x10)
+
+// Power Management
+#define REG_POWER_HEADER                    (0x200A0000)
+#define POWER_SETTING_DISABLE_DEEP_SLEEP    (0x01)
+#define POWER_SETTING_DISABLE_IDLE_SLEEP    (0x02)
+#define POWER_SETTING_DONT_WAKE_FROM_TOUCH  (0x04)
+#define POWER_SETTING_DONT_WAKE_FROM_BUTTON (0x08)
+#define REG_POWER_REGISTERS                 (0x200A0008)  // idle wait, idle time, sleep wait, sleep time, settings
+#define POWER_REGISTERS_LENGTH              (9)
+#define REG_POWER_CMD                       (0x200A0408)
+#define POWER_CMD_FORCE_SLEEP               (0x01)
+#define POWER_CMD_CANCEL_FORCE_SLEEP        (0x02)
+
+// Feed Config
+#define REG_FEED_CONFIG_HEADER        (0x200E0000)
+#define FC1_LINEAR_CORRECTION_ENABLED (0x04)
+#define FC3_PS2_FEED_ENABLE           (0x01)
+#define FC3_I2C_FEED_ENABLE           (0x02)
+#define FC3_USB_FEED_ENABLE           (0x04)
+
+// the header part of each block. The registers are in the device's byte order, bigEndian is
+// CirqueHid::endianState. The header's base address is little endian on every part, as
+// API_C3 isValidHeader compares it. A block that hasn't been read isn't implemented.
+class ConfigBlock : public ResponseReader
+{
+public:
+	const bool &IsImplemented{ m_isImplemented };
+
+protected:
+	bool m_isImplemented = false;
+
+	void decodeHeader(uint8_t * packet, uint16_t &packetIndex, uint32_t baseAddress);
+};
+
+// 0x20080000 - 0x20080018
+class XYConfig : public ConfigBlock
+{
+public:
+	const uint8_t &Flags{ m_flags };
+
+	static const uint32_t baseAddress = REG_XY_CONFIG_HEADER;
+	static const uint16_t dataLength = 0x19;
+	void decodeFrom(uint8_t * packet, bool bigEndian);
+
+protected:
+	uint8_t m_flags; // XY_CONFIG_* bits
+};
+
+// 0x200A0000 - 0x200A0010
+class PowerConfig : public ConfigBlock
+{
+public:
+	const uint16_t &TimeBeforeIdle{ m_timeBeforeIdle };
+	const uint16_t &TimeInIdle{ m_timeInIdle };
+	const uint16_t &TimeBeforeSleep{ m_timeBeforeSleep };
+	const uint16_t &TimeInSleep{ m_timeInSleep };
+	const uint8_t &Settings{ m_settings };
+
+	static const uint32_t baseAddress = REG_POWER_HEADER;
+	static const uint16_t dataLength = 0x11;
+	void decodeFrom(uint8_t * packet, bool bigEndian);
+
+protected:
+	uint16_t m_timeBeforeIdle;  // 100 ms units
+	uint16_t m_timeInIdle;      // 100 us units
+	uint16_t m_timeBeforeSleep; // 100 ms units
+	uint16_t m_timeInSleep;     // 100 us units
+	uint8_t m_settings;         // POWER_SETTING_* bits
+};
+
+// the writable part of the power block, in the register order
+typedef struct
+{
+	uint16_t timeBeforeIdle_100ms;
+	uint16_t timeInIdle_100us;   // how often the sensor scans while idle
+	uint16_t timeBeforeSleep_100ms;
+	uint16_t timeInSleep_100us;  // how often the sensor scans while in deep sleep
+	uint8_t settings;            // POWER_SETTING_* bits
+} PowerSettings_t;
+
+// 0x200E0000 - 0x200E000B
+class FeedConfig : public ConfigBlock
+{
+public:
+	const uint8_t &Config1{ m_config1 };
+	const uint8_t &Config2{ m_config2 };
+	const uint8_t &Config3{ m_config3 };
+	const uint8_t &Config4{ m_config4 };
+
+	static const uint32_t baseAddress = REG_FEED_CONFIG_HEADER;
+	static const uint16_t dataLength = 0x0C;
+	void decodeFrom(uint8_t * packet, bool bigEndian);
+
+protected:
+	uint8_t m_config1;
+	uint8_t m_config2;
+	uint8_t m_config3;
+	uint8_t m_config4;
+};
+
+#endif // CIRQUE_HID_CONFIG_H
@@ -0,0 +1,42 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "CompDrift.h"
+
+void CompDrift::analyze(const int16_t * comp, const int16_t * baseline, uint16_t pixelCount, uint16_t outlierThreshold)
+{
+    int32_t minDrift = INT16_MAX;
+    int32_t maxDrift = INT16_MIN;
+    int32_t sum = 0;
+    uint32_t worstMagnitude = 0;
+    uint16_t outliers = 0;
+    uint16_t worstPixel = 0;
+
+    for (uint16_t x = 0; x < pixelCount; x++)
+    {
+        int32_t drift = (int32_t)comp[x] - baseline[x];
+        uint32_t magnitude = (drift < 0) ? -drift : drift;
+
+        minDrift = (drift < minDrift) ? drift : minDrift;
+        maxDrift = (drift > maxDrift) ? drift : maxDrift;
+        sum += drift;
+        outliers += (magnitude > outlierThreshold) ? 1 : 0;
+        if (magnitude > worstMagnitude)
+        {
+            worstMagnitude = magnitude;
+            worstPixel = x;
+        }
+    }
+
+    if (pixelCount == 0)
+    {
+        minDrift = 0;
+        maxDrift = 0;
+    }
+    // drift of two int16_t values can exceed int16_t, clamp the summary
+    m_minDrift = (minDrift < INT16_MIN) ? INT16_MIN : (int16_t)minDrift;
+    m_maxDrift = (maxDrift > INT16_MAX) ? INT16_MAX : (int16_t)maxDrift;
+    m_meanDrift = (pixelCount > 0) ? (int16_t)(sum / pixelCount) : 0;
+    m_outliers = outliers;
+    m_worstPixel = worstPixel;
+    m_pixelCount = pixelCount;
+}
@@ -0,0 +1,31 @@
+#ifndef COMP_DRIFT_H
+#define COMP_DRIFT_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+
+// Compares a compensation matrix against a stored baseline (drift = comp - baseline, per pixel)
+// and keeps a summary, so the health of a part can be checked without dumping the images.
+class CompDrift
+{
+public:
+    const int16_t &MinDrift {m_minDrift};
+    const int16_t &MaxDrift {m_maxDrift};
+    const int16_t &MeanDrift {m_meanDrift};
+    const uint16_t &Outliers {m_outliers};      // pixels with |drift| > outlierThreshold
+    const uint16_t &WorstPixel {m_worstPixel};  // index (row major) of the largest |drift|
+    const uint16_t &PixelCount {m_pixelCount};
+
+    void analyze(const int16_t * comp, const int16_t * baseline, uint16_t pixelCount, uint16_t outlierThreshold);
+
+protected:
+    int16_t m_minDrift;
+    int16_t m_maxDrift;
+    int16_t m_meanDrift;
+    uint16_t m_outliers;
+    uint16_t m_worstPixel;
+    uint16_t m_pixelCount;
+};
+
+#endif // COMP_DRIFT_H
@@ -1,4 +1,9 @@
 #include "CustomMeas.h"
+#include "MeasFrameQueue.h"
+#include "NoiseScan.h"
+#include "DataUtils.h"
+#include <string.h>
+#include <stddef.h>
 
 // Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
 
@@ -19,8 +24,15 @@
 
 #define GLOBAL_INFO_ADDR (0x51000000)
 
+#define CALIBRATION_CALIBRATE_NOW (0x40)  // GroupInfo_t.Calibration bit 6, cleared by the device when done
+#define CALIBRATION_ENABLE (0x80)         // GroupInfo_t.Calibration bit 7
+#define NO_IGNORE_INDEX (0xFF)
+
 CustomMeas::CustomMeas(uint16_t maxBufferLength) : I2cHidApi(CUSTOMMEAS_I2CADDRESS, maxBufferLength)
 {
+	m_measFrameLength = 0;
+	m_configBlocksWritten = 0;
+	invalidateConfigCache();
 
 }
 
@@ -34,7 +46,7 @@ CustomMeas::commandErrors CustomMeas::ReadSystemInfo(SystemInfo &systemInfo)
 	uint8_t buffer[systemInfo.dataLength];
 
 	commandErrors status = readExtendedMemory(POST_HEADER_ADDR, buffer, systemInfo.dataLength);
-	systemInfo.decodeFrom(buffer);
+	systemInfo.decodeFrom(buffer, false);  // no endianState here, little endian as it always was
 	return status;
 }
 
@@ -98,6 +110,7 @@ CustomMeas::commandErrors CustomMeas::WriteGroupInfo(uint8_t groupIndex, GroupIn
 {
 	uint32_t address = (uint32_t)(GROUP_INFO_ADDR + (groupIndex * GROUP_INFO_INC));
 	writeExtendedMemory(address, (uint8_t *)groupInfo, (uint8_t)sizeof(GroupInfo_t));
+	m_groupCached &= ~(1 << groupIndex);
 	return commandErrors::cmd_okay;
 }
 
@@ -121,14 +134,7 @@ CustomMeas::commandErrors CustomMeas::Calibrate(uint8_t groupIndex)
 
 CustomMeas::commandErrors CustomMeas::CalibrateAll(void)
 {
-	commandErrors status;
-
-	for (uint8_t i = 0; i < MAX_NUMBER_GROUPS; i++)
-	{
-		status = Calibrate(i);
-		if (status != cmd_okay) { break; }
-	}
-	return status;
+	return CalibrateGroups(ALL_GROUPS_MASK);
 }
 
 CustomMeas::commandErrors CustomMeas::EnableCalibration(uint8_t groupIndex)
@@ -151,14 +157,7 @@ CustomMeas::commandErrors CustomMeas::EnableCalibration(uint8_t groupIndex)
 
 CustomMeas::commandErrors CustomMeas::EnableAllCalibration(void)
 {
-	commandErrors status;
-
-	for (uint8_t i = 0; i < MAX_NUMBER_GROUPS; i++)
-	{
-		status = EnableCalibration(i);
-		if (status != cmd_okay) { break; }
-	}
-	return status;
+	return EnableCalibrationGroups(ALL_GROUPS_MASK);
 }
 
 CustomMeas::commandErrors CustomMeas::DisableCalibration(uint8_t groupIndex)
@@ -181,12 +180,58 @@ CustomMeas::commandErrors CustomMeas::DisableCalibration(uint8_t groupIndex)
 
 CustomMeas::commandErrors CustomMeas::DisableAllCalibration(void)
 {
-	commandErrors status;
+	return DisableCalibrationGroups(ALL_GROUPS_MASK);
+}
 
+CustomMeas::commandErrors CustomMeas::CalibrateGroups(uint8_t groupMask)
+{
+	return editGroupCalibration(groupMask, CALIBRATION_CALIBRATE_NOW, 0);
+}
+
+CustomMeas::commandErrors CustomMeas::EnableCalibrationGroups(uint8_t groupMask)
+{
+	return editGroupCalibration(groupMask, CALIBRATION_ENABLE, 0);
+}
+
+CustomMeas::commandErrors CustomMeas::DisableCalibrationGroups(uint8_t groupMask)
+{
+	return editGroupCalibration(groupMask, 0, CALIBRATION_ENABLE);
+}
+
+CustomMeas::commandErrors CustomMeas::editGroupCalibration(uint8_t groupMask, uint8_t setBits, uint8_t clearBits)
+{
+	if (groupMask & ~ALL_GROUPS_MASK)
+		return commandErrors::cmd_parameterBad;
+
+	commandErrors status = cmd_okay;
+	m_configBlocksWritten = 0;
+
+	// read every group that isn't cached first, so the writes go out back to back
+	for (uint8_t i = 0; (i < MAX_NUMBER_GROUPS) && (status == cmd_okay); i++)
+	{
+		if (!((groupMask >> i) & 1) || ((m_groupCached >> i) & 1)) continue;
+
+		status = ReadGroupInfo(i, &m_deviceConfig.groups[i]);
+		m_deviceConfig.groups[i].Calibration &= ~CALIBRATION_CALIBRATE_NOW;
+		if (status == cmd_okay) m_groupCached |= (1 << i);
+	}
+	if (status != cmd_okay) return status;
+
+	// only groups that change are written. "Calibrate now" always changes, the device clears it.
 	for (uint8_t i = 0; i < MAX_NUMBER_GROUPS; i++)
 	{
-		status = DisableCalibration(i);
-		if (status != cmd_okay) { break; }
+		if (!((groupMask >> i) & 1)) continue;
+
+		GroupInfo_t & cached = m_deviceConfig.groups[i];
+		uint8_t calibration = (cached.Calibration & ~clearBits) | setBits;
+		if (calibration == cached.Calibration) continue;
+
+		GroupInfo_t wanted = cached;
+		wanted.Calibration = calibration;
+		uint32_t address = (uint32_t)(GROUP_INFO_ADDR + (i * GROUP_INFO_INC));
+		writeExtendedMemory(address, (uint8_t *)&wanted, (uint8_t)sizeof(GroupInfo_t));
+		m_configBlocksWritten++;
+		cached.Calibration = calibration & ~CALIBRATION_CALIBRATE_NOW;
 	}
 	return status;
 }
@@ -224,6 +269,7 @@ CustomMeas::commandErrors CustomMeas::Restore(void)
 	{
 		globalInfo.Restore = 1;
 		WriteGlobalInfo(&globalInfo);
+		invalidateConfigCache();
 	}
 	return status;
 }
@@ -297,6 +343,7 @@ CustomMeas::commandErrors CustomMeas::WriteMeasInfo(uint8_t index, const MeasInf
 
 	uint32_t address = (uint32_t)(MEAS_INFO_ADDR + (index * MEAS_INFO_INC));
 	writeExtendedMemory(address, (uint8_t *)measInfo, sizeof(MeasInfo_t));
+	m_measCached &= ~(1UL << index);
 	return cmd_okay;
 }
 
@@ -314,9 +361,82 @@ CustomMeas::commandErrors CustomMeas::WriteNoiseConfig(uint8_t index, const Nois
 
 	uint32_t address = (uint32_t)(NOISE_CONFIG_ADDR + (index * NOISE_CONFIG_INC));
 	writeExtendedMemory(address, (uint8_t *)config, sizeof(NoiseConfig_t));
+	m_noiseCached &= (index < 8) ? ~(1 << index) : 0;
 	return cmd_okay;
 }
 
+void CustomMeas::invalidateConfigCache(void)
+{
+	m_groupCached = 0;
+	m_measCached = 0;
+	m_noiseCached = 0;
+}
+
+CustomMeas::commandErrors CustomMeas::syncBlock(uint32_t address, const uint8_t * wanted, uint8_t * cached, uint16_t length, 
+	bool isCached, uint8_t ignoreIndex, uint8_t ignoreMask)
+{
+	commandErrors status = cmd_okay;
+
+	if (!isCached)
+	{
+		status = readExtendedMemory(address, cached, length);
+		if (status != cmd_okay) return status;
+		if (ignoreIndex < length) cached[ignoreIndex] &= ~ignoreMask;
+	}
+	if (memcmp(wanted, cached, length) == 0) return cmd_okay;
+
+	writeExtendedMemory(address, (uint8_t *)wanted, length);
+	m_configBlocksWritten++;
+
+	// verify
+	status = readExtendedMemory(address, cached, length);
+	if (ignoreIndex < length) cached[ignoreIndex] &= ~ignoreMask;
+	if ((status == cmd_okay) && (memcmp(wanted, cached, length) != 0))
+	{
+		status = commandErrors::cmd_parameterBad;
+	}
+	return status;
+}
+
+CustomMeas::commandErrors CustomMeas::applyConfig(const Config_t & config)
+{
+	if ((config.groupCount > MAX_NUMBER_GROUPS) || (config.measCount > MAX_NUMBER_MEASUREMENTS) || 
+		(config.noiseCount > MAX_NUMBER_GROUPS))
+		return commandErrors::cmd_parameterBad;
+
+	commandErrors status = cmd_okay;
+	m_configBlocksWritten = 0;
+
+	for (uint8_t i = 0; (i < config.groupCount) && (status == cmd_okay); i++)
+	{
+		// "calibrate now" is an action, not configuration. Use Calibrate() for that.
+		GroupInfo_t wanted = config.groups[i];
+		wanted.Calibration &= ~CALIBRATION_CALIBRATE_NOW;
+		uint32_t address = (uint32_t)(GROUP_INFO_ADDR + (i * GROUP_INFO_INC));
+		status = syncBlock(address, (uint8_t *)&wanted, (uint8_t *)&m_deviceConfig.groups[i], sizeof(GroupInfo_t), 
+			(m_groupCached >> i) & 1, offsetof(GroupInfo_t, Calibration), CALIBRATION_CALIBRATE_NOW);
+		m_groupCached = (status == cmd_okay) ? (m_groupCached | (1 << i)) : (m_groupCached & ~(1 << i));
+	}
+
+	for (uint8_t i = 0; (i < config.measCount) && (status == cmd_okay); i++)
+	{
+		uint32_t address = (uint32_t)(MEAS_INFO_ADDR + (i * MEAS_INFO_INC));
+		status = syncBlock(address, (uint8_t *)&config.meas[i], (uint8_t *)&m_deviceConfig.meas[i], sizeof(MeasInfo_t), 
+			(m_measCached >> i) & 1, NO_IGNORE_INDEX, 0);
+		m_measCached = (status == cmd_okay) ? (m_measCached | (1UL << i)) : (m_measCached & ~(1UL << i));
+	}
+
+	for (uint8_t i = 0; (i < config.noiseCount) && (status == cmd_okay); i++)
+	{
+		uint32_t address = (uint32_t)(NOISE_CONFIG_ADDR + (i * NOISE_CONFIG_INC));
+		status = syncBlock(address, (uint8_t *)&config.noise[i], (uint8_t *)&m_deviceConfig.noise[i], sizeof(NoiseConfig_t), 
+			(m_noiseCached >> i) & 1, NO_IGNORE_INDEX, 0);
+		m_noiseCached = (status == cmd_okay) ? (m_noiseCached | (1 << i)) : (m_noiseCached & ~(1 << i));
+	}
+
+	return status;
+}
+
 reportIds_t CustomMeas::getMeasReport(int16_t * measArray, uint16_t &measCount)
 {
 	int16_t measReportBuffer[20 * 16];
@@ -365,3 +485,113 @@ reportIds_t CustomMeas::getMeasReport(int16_t * measArray, uint16_t &measCount)
 	return result;
 }
 
+
+void CustomMeas::beginMeasStream(uint16_t measByteCount)
+{
+	m_measFrameLength = (measByteCount > 0) ? MEAS_REPORT_HEADER_LENGTH + measByteCount : 0;
+}
+
+uint16_t CustomMeas::fetchMeasFrame(uint8_t * report, uint16_t reportLength)
+{
+	uint16_t readCount = m_host_bus->read(m_i2cAddress, reportLength);
+	uint16_t fetchLimit = (readCount >= reportLength) ? reportLength : readCount;
+	for (uint16_t x = 0; x < fetchLimit; x++)
+	{
+		report[x] = m_host_bus->fetch();
+	}
+	return fetchLimit;
+}
+
+reportIds_t CustomMeas::getMeasFrame(uint16_t * frameBuffer, int16_t * &measArray, uint16_t &measCount)
+{
+	// the report starts at byte 1, so the readings (byte 5 of the report) land on a 2 byte boundary
+	uint8_t * report = (uint8_t *)frameBuffer + 1;
+	uint16_t maxReportLength = (MEAS_FRAME_BUFFER_WORDS * 2) - 1;
+	if (maxReportLength > m_host_bus->i2cMinBufferLength) maxReportLength = m_host_bus->i2cMinBufferLength;
+
+	measArray = (int16_t *)&frameBuffer[3];
+	measCount = 0;
+
+	// until the frame length is known, read just the header to learn it
+	uint16_t reportLength = (m_measFrameLength > 0) ? m_measFrameLength : MEAS_REPORT_HEADER_LENGTH;
+	if (reportLength > maxReportLength) reportLength = maxReportLength;
+	uint16_t fetchCount = fetchMeasFrame(report, reportLength);
+	if (fetchCount < MEAS_REPORT_HEADER_LENGTH) return id_unknown;
+
+	reportIds_t result = (reportIds_t)report[2];
+	if (result != id_customMeas) return result;
+
+	uint16_t measByteCount = report[3] + (report[4] << 8);
+	uint16_t frameLength = MEAS_REPORT_HEADER_LENGTH + measByteCount;
+	if (frameLength > maxReportLength) return id_unknown;
+
+	if (frameLength > fetchCount)
+	{
+		// first frame, or the measurements were reconfigured. A short read leaves the report
+		// in place (like getMeasReport's header read), so read it again at the new length
+		fetchCount = fetchMeasFrame(report, frameLength);
+		if (fetchCount < frameLength) return id_unknown;
+	}
+	m_measFrameLength = frameLength;
+
+	measCount = measByteCount / 2;
+	littleEndianToHost16(&frameBuffer[3], measCount);
+	return result;
+}
+
+reportIds_t CustomMeas::queueMeasFrame(MeasFrameQueue & queue, uint32_t timestamp_us)
+{
+	MeasFrame_t * frame = queue.writeSlot();
+	reportIds_t result = getMeasFrame(frame->frameBuffer, frame->meas, frame->measCount);
+	if (result == id_customMeas)
+	{
+		queue.commit(timestamp_us);
+	}
+	return result;
+}
+
+CustomMeas::commandErrors CustomMeas::applyToggleFrequency(Config_t & config, uint8_t toggleFrequency)
+{
+	for (uint8_t i = 0; (i < config.measCount) && (i < MAX_NUMBER_MEASUREMENTS); i++)
+	{
+		config.meas[i].ToggleFrequency = toggleFrequency;
+	}
+
+	// only the measurement blocks differ, so only they are written. Measurements are stopped
+	// while they are, and started again only if they were running.
+	GlobalInfo_t globalInfo;
+	commandErrors status = ReadGlobalInfo(&globalInfo);
+	if (status != cmd_okay) return status;
+
+	if (globalInfo.Enable) StopMeas();
+	status = applyConfig(config);
+	if (globalInfo.Enable) StartMeas();
+	return status;
+}
+
+CustomMeas::commandErrors CustomMeas::beginNoiseScan(NoiseScan & scan, Config_t & config)
+{
+	if (!scan.Running) return commandErrors::cmd_parameterBad;
+
+	commandErrors status = applyToggleFrequency(config, scan.ToggleFrequency);
+	if (status != cmd_okay) scan.stop();
+	return status;
+}
+
+CustomMeas::commandErrors CustomMeas::addNoiseScanFrame(NoiseScan & scan, Config_t & config, const int16_t * meas, 
+	uint16_t measCount)
+{
+	if (!scan.add(meas, measCount)) return cmd_okay;
+
+	commandErrors status = cmd_okay;
+	if (scan.Running)
+	{
+		status = applyToggleFrequency(config, scan.ToggleFrequency);
+		if (status != cmd_okay) scan.stop();
+	}
+	else if (scan.ApplyRecommended && (scan.recommended() != NOISE_SCAN_NONE))
+	{
+		status = applyToggleFrequency(config, scan.result(scan.recommended()).toggleFrequency);
+	}
+	return status;
+}
@@ -10,6 +10,15 @@
 #define MAX_NUMBER_GROUPS (5)  // 0..3 are measurement groups, 4 is for noise measurements
 #define MAX_NUMBER_MEASUREMENTS (20)
 #define MAX_READINGS_PER_MEASUREMENT (16)
+#define ALL_GROUPS_MASK ((1 << MAX_NUMBER_GROUPS) - 1)
+
+// CustomMeas report: 2 byte length, report ID, 2 byte measurement byte count, then int16_t readings
+#define MEAS_REPORT_HEADER_LENGTH (5)
+// frame buffer for getMeasFrame, one pad byte keeps the readings 2 byte aligned
+#define MEAS_FRAME_BUFFER_WORDS ((1 + MEAS_REPORT_HEADER_LENGTH + (2 * MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT)) / 2)
+
+class MeasFrameQueue;
+class NoiseScan;
 
 class CustomMeas : public I2cHidApi
 {
@@ -66,6 +75,16 @@ public:
 	} NoiseConfig_t;
 #pragma pack(pop)
 
+	// everything applyConfig writes, slots 0..count-1 of each table
+	typedef struct {
+		uint8_t groupCount;
+		uint8_t measCount;
+		uint8_t noiseCount;
+		GroupInfo_t groups[MAX_NUMBER_GROUPS];
+		MeasInfo_t meas[MAX_NUMBER_MEASUREMENTS];
+		NoiseConfig_t noise[MAX_NUMBER_GROUPS];
+	} Config_t;
+
 	CustomMeas::commandErrors ReadSystemInfo(SystemInfo & systemInfo);
 
 	CustomMeas::commandErrors ReadGlobalInfo(GlobalInfo_t * globalInfo);
@@ -84,6 +103,11 @@ public:
 	CustomMeas::commandErrors EnableAllCalibration(void);
 	CustomMeas::commandErrors DisableCalibration(uint8_t groupIndex);
 	CustomMeas::commandErrors DisableAllCalibration(void);
+	// Bit n of groupMask is group n. The groups are read (unless cached, see applyConfig) and
+	// edited together, and only the groups whose Calibration byte changes are written.
+	CustomMeas::commandErrors CalibrateGroups(uint8_t groupMask);
+	CustomMeas::commandErrors EnableCalibrationGroups(uint8_t groupMask);
+	CustomMeas::commandErrors DisableCalibrationGroups(uint8_t groupMask);
 
 	CustomMeas::commandErrors Persist(void);
 	CustomMeas::commandErrors Restore(void);
@@ -98,8 +122,50 @@ public:
 	CustomMeas::commandErrors ReadNoiseConfig(uint8_t index, NoiseConfig_t *config);
 	CustomMeas::commandErrors WriteNoiseConfig(uint8_t index, const NoiseConfig_t *config);
 
+	// Writes only the group, measurement and noise blocks that differ from the device, then
+	// reads back just those blocks to verify. The device state is cached, so after the first
+	// call (which reads every slot in the config) unchanged blocks cost no bus traffic.
+	CustomMeas::commandErrors applyConfig(const Config_t & config);
+	void invalidateConfigCache(void);
+	const uint8_t &ConfigBlocksWritten{ m_configBlocksWritten };  // by the last applyConfig or *Groups call
+
 	reportIds_t getMeasReport(int16_t * measArray, uint16_t &measCount);
 
+	// Streaming acquisition. Once the frame length is known every frame is read in a single
+	// transaction, straight into frameBuffer, and the readings are converted in place.
+	// measByteCount = 0 learns the length from the first frame (that frame takes two reads).
+	void beginMeasStream(uint16_t measByteCount = 0);
+	// measArray points into frameBuffer. If another report arrives it is left, raw, in frameBuffer.
+	reportIds_t getMeasFrame(uint16_t * frameBuffer, int16_t * &measArray, uint16_t &measCount);
+	const uint16_t &MeasFrameLength{ m_measFrameLength };  // whole report, 0 until known
+	// reads the next frame into the queue (see MeasFrameQueue.h), measurement reports are queued
+	reportIds_t queueMeasFrame(MeasFrameQueue & queue, uint32_t timestamp_us);
+
+	// ToggleFrequency scan (see NoiseScan.h). config is the caller's working copy, each
+	// measurement's ToggleFrequency in it is changed and applied (applyConfig) as the scan moves on.
+	// Sets every measurement in config to toggleFrequency and applies it, measurements are left
+	// running or not as they were
+	CustomMeas::commandErrors applyToggleFrequency(Config_t & config, uint8_t toggleFrequency);
+	CustomMeas::commandErrors beginNoiseScan(NoiseScan & scan, Config_t & config);
+	// Feed each measurement frame to the scan. When a setting is finished the next ToggleFrequency
+	// is applied. At the end the recommended one is applied, if scan.ApplyRecommended,
+	// otherwise config (and the device) is left at the last setting for the caller to restore.
+	CustomMeas::commandErrors addNoiseScanFrame(NoiseScan & scan, Config_t & config, const int16_t * meas, uint16_t measCount);
+
+protected:
+	uint16_t m_measFrameLength;
+
+	// device configuration cache, a bit per slot is set when the cached copy matches the device
+	Config_t m_deviceConfig;
+	uint8_t m_groupCached;
+	uint32_t m_measCached;
+	uint8_t m_noiseCached;
+	uint8_t m_configBlocksWritten;
+	CustomMeas::commandErrors syncBlock(uint32_t address, const uint8_t * wanted, uint8_t * cached, uint16_t length, 
+		bool isCached, uint8_t ignoreIndex, uint8_t ignoreMask);
+	uint16_t fetchMeasFrame(uint8_t * report, uint16_t reportLength);
+	CustomMeas::commandErrors editGroupCalibration(uint8_t groupMask, uint8_t setBits, uint8_t clearBits);
+
 };
 
 #endif // CUSTOM_MEAS_H
\ No newline at end of file
@@ -0,0 +1,151 @@
+#ifndef CUSTOM_MEAS_CONFIG_H
+#define CUSTOM_MEAS_CONFIG_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+// Compile time CustomMeas configuration.
+// The builders take natural units (milliseconds, signed thresholds, electrode lists) and pack
+// them into the device layouts (GlobalInfo_t, GroupInfo_t, MeasInfo_t). Used with constexpr,
+// the packed blocks are built by the compiler, so nothing is encoded at run time.
+//
+//   constexpr CustomMeasConfig<1, 2> demoConfig =
+//   {
+//       CustomMeasConfigBuilder::global(10, true),
+//       { CustomMeasConfigBuilder::group(CustomMeasConfigBuilder::MODE_SELF_V2V, ...) },
+//       { CustomMeasConfigBuilder::measurement(0x00FFFF, ...), ... },
+//   };
+//   constexpr CustomMeas::Config_t measConfig = demoConfig.toConfig();  // for applyConfig
+
+#define CUSTOM_MEAS_ELECTRODES (48)  // two per ElectrodeStates byte
+
+class CustomMeasConfigBuilder
+{
+public:
+	enum GroupModes : uint8_t
+	{
+		MODE_SELF_V2V = 1,
+	};
+
+	enum CalibrationModes : uint8_t  // GroupInfo_t.Calibration
+	{
+		CALIBRATION_OFF = 0x00,
+		CALIBRATION_SNAPSHOT = 0x80,    // calibrate when asked
+		CALIBRATION_BACKGROUND = 0x81,  // snapshot, plus tracking while there is no activity
+	};
+
+	enum ElectrodeStates : uint8_t  // one nibble per electrode
+	{
+		ELECTRODE_IDLE = 0x4,   // not part of the measurement
+		ELECTRODE_SENSE = 0x7,  // measured
+	};
+
+	static constexpr CustomMeas::GlobalInfo_t global(uint16_t frameMillis, bool measureAtPowerOn, bool lowPowerMode = false)
+	{
+		return CustomMeas::GlobalInfo_t
+		{
+			0,  // Enable, use StartMeas()
+			lo(frameMillis), hi(frameMillis),
+			0,  // Persist
+			0,  // Restore
+			(uint8_t)(measureAtPowerOn ? 1 : 0),
+			(uint8_t)(lowPowerMode ? 1 : 0),
+		};
+	}
+
+	static constexpr CustomMeas::GroupInfo_t group(GroupModes mode, CalibrationModes calibration,
+		uint16_t framesBetweenComps, int16_t negativeThreshold, uint16_t speedThreshold,
+		uint16_t activityThreshold, uint16_t activityTimeout)
+	{
+		return CustomMeas::GroupInfo_t
+		{
+			mode,
+			calibration,
+			lo(framesBetweenComps), hi(framesBetweenComps),
+			lo((uint16_t)negativeThreshold), hi((uint16_t)negativeThreshold),
+			lo(speedThreshold), hi(speedThreshold),
+			lo(activityThreshold), hi(activityThreshold),
+			lo(activityTimeout), hi(activityTimeout),
+		};
+	}
+
+	// senseElectrodes has a bit per electrode (bit 0 = electrode 0), those are ELECTRODE_SENSE,
+	// the rest are ELECTRODE_IDLE. Even electrodes go in the low nibble.
+	// adcChannelMask has a bit per reading in the report (MAX_READINGS_PER_MEASUREMENT)
+	static constexpr CustomMeas::MeasInfo_t measurement(uint64_t senseElectrodes, uint8_t gain, uint8_t globalOffset,
+		uint8_t toggleFrequency, uint8_t apertureLength, uint16_t adcChannelMask = 0xFFFF)
+	{
+		CustomMeas::MeasInfo_t meas{};
+		meas.Control = 0x80;  // enabled
+		for (uint8_t x = 0; x < CUSTOM_MEAS_ELECTRODES; x++)
+		{
+			uint8_t state = ((senseElectrodes >> x) & 1) ? ELECTRODE_SENSE : ELECTRODE_IDLE;
+			meas.ElectrodeStates[x / 2] |= (uint8_t)((x & 1) ? (state << 4) : state);
+		}
+		meas.Gain = gain;
+		meas.GlobalOffset = globalOffset;
+		meas.ChannelOffsetMultiplier = 0;
+		meas.ToggleFrequency = toggleFrequency;
+		meas.ApertureLength = apertureLength;
+		meas.Waveform = 0;
+		meas.ADCChannelMaskLSB = lo(adcChannelMask);
+		meas.ADCChannelMaskMSB = hi(adcChannelMask);
+		return meas;
+	}
+
+	// readings in the report for one measurement
+	static constexpr uint8_t readingCount(const CustomMeas::MeasInfo_t & meas)
+	{
+		uint8_t count = 0;
+		uint16_t mask = meas.ADCChannelMaskLSB | (meas.ADCChannelMaskMSB << 8);
+		for (; mask != 0; mask >>= 1) count += (mask & 1);
+		return (meas.Control & 0x80) ? count : 0;
+	}
+
+private:
+	static constexpr uint8_t lo(uint16_t value) { return (uint8_t)value; }
+	static constexpr uint8_t hi(uint16_t value) { return (uint8_t)(value >> 8); }
+};
+
+// All the blocks for one measurement setup. The counts are checked when the type is used.
+template <uint8_t GroupCount, uint8_t MeasCount>
+struct CustomMeasConfig
+{
+	static_assert((GroupCount > 0) && (GroupCount <= MAX_NUMBER_GROUPS), "CustomMeasConfig: 1 to MAX_NUMBER_GROUPS groups");
+	static_assert((MeasCount > 0) && (MeasCount <= MAX_NUMBER_MEASUREMENTS), "CustomMeasConfig: 1 to MAX_NUMBER_MEASUREMENTS measurements");
+	static_assert(sizeof(CustomMeas::GroupInfo_t) == 12, "GroupInfo_t must match the device layout");
+	static_assert(sizeof(CustomMeas::MeasInfo_t) == 41, "MeasInfo_t must match the device layout");
+	static_assert(sizeof(CustomMeas::GlobalInfo_t) == 7, "GlobalInfo_t must match the device layout");
+
+	CustomMeas::GlobalInfo_t global;
+	CustomMeas::GroupInfo_t groups[GroupCount];
+	CustomMeas::MeasInfo_t meas[MeasCount];
+
+	// bytes of readings in each CustomMeas report, for CustomMeas::beginMeasStream()
+	constexpr uint16_t measByteCount(void) const
+	{
+		uint16_t count = 0;
+		for (uint8_t x = 0; x < MeasCount; x++) count += 2 * CustomMeasConfigBuilder::readingCount(meas[x]);
+		return count;
+	}
+
+	constexpr uint16_t frameMillis(void) const
+	{
+		return global.FrameMillisLSB | (global.FrameMillisMSB << 8);
+	}
+
+	constexpr CustomMeas::Config_t toConfig(void) const
+	{
+		CustomMeas::Config_t config{};
+		config.groupCount = GroupCount;
+		config.measCount = MeasCount;
+		config.noiseCount = 0;
+		for (uint8_t x = 0; x < GroupCount; x++) config.groups[x] = groups[x];
+		for (uint8_t x = 0; x < MeasCount; x++) config.meas[x] = meas[x];
+		return config;
+	}
+};
+
+#endif // CUSTOM_MEAS_CONFIG_H
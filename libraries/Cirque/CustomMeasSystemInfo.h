@@ -23,7 +23,8 @@ public:
 	const uint8_t &IsBigEndian{ m_isBigEndian };
 
 	static const uint16_t dataLength = 29;
-	void decodeFrom(uint8_t * packet);
+	// the 16 and 32 bit values are in the device's order, bigEndian is CirqueHid::endianState
+	void decodeFrom(uint8_t * packet, bool bigEndian);
 
 protected:
 	uint8_t m_hardwareID;
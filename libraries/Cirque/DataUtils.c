@@ -1,6 +1,7 @@
 // Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
 
 #include "DataUtils.h"
+#include <string.h>
 
 uint8_t calculateChecksum(uint8_t * data, uint16_t length)
 {
@@ -11,3 +12,30 @@ uint8_t calculateChecksum(uint8_t * data, uint16_t length)
 	}
 	return checksum;
 }
+
+void swapBytes16(uint16_t * data, uint16_t count)
+{
+	// two values per 32 bit word, the masks/shifts vectorize (and become REV16 on Cortex-M)
+	uint16_t pairs = count / 2;
+	for (uint16_t x = 0; x < pairs; x++)
+	{
+		uint32_t w;
+		memcpy(&w, &data[x * 2], sizeof(w));
+		w = ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+		memcpy(&data[x * 2], &w, sizeof(w));
+	}
+	if (count & 1)
+	{
+		data[count - 1] = (uint16_t)((data[count - 1] << 8) | (data[count - 1] >> 8));
+	}
+}
+
+void littleEndianToHost16(uint16_t * data, uint16_t count)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	(void)data;
+	(void)count;
+#else
+	swapBytes16(data, count);
+#endif
+}
@@ -11,6 +11,12 @@ extern "C" {
 
 uint8_t calculateChecksum(uint8_t * data, uint16_t length);
 
+// swap the two bytes of every 16 bit value in place (big endian <--> little endian)
+void swapBytes16(uint16_t * data, uint16_t count);
+
+// convert little endian byte pairs to host order in place (nothing to do on a little endian host)
+void littleEndianToHost16(uint16_t * data, uint16_t count);
+
 #ifdef __cplusplus
 }
 #endif
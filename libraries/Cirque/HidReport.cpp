@@ -44,8 +44,13 @@ bool HidReport::decodeReport(uint8_t* packet)
         case id_keyReport :
             decoded_okay &= decodeKeyboardReport(packet);
             break;
-        // case crqAlpsReport:
-        // case stickReport:
+        case id_crqAlpsReport:
+            decoded_okay &= (m_length == alpsAbsoluteLength) ? 
+                decodeAlpsAbsoluteReport(packet) : decodeCirqueAbsoluteReport(packet);
+            break;
+        case id_alpsStickReport: // same id as SpiderMeas, only the stick length is decoded here
+            decoded_okay &= decodeStickReport(packet);
+            break;
         default:
             decoded_okay = false;
             [[fallthrough]];
@@ -122,9 +127,21 @@ bool HidReport::decodeMouseReport(uint8_t* packet)
 // +2   -- total contacts
 // +3   -- button mask 
 
+// PTP Input Report -Pressure- is always a single finger per report, with the 
+// pressure area between the finger and the time stamp:
+// 0, 1 = length, 2 = id
+// 3, 4,5, 6,7 = confidence, x, y
+// 8,9 = pressure area
+// 10,11 = time stamp
+// 12 = total contacts
+// 13 = button mask
+// A frame with several contacts arrives as several reports. Total contacts is only
+// filled in on the first report of the frame (it is 0 on the rest).
+
 bool HidReport::decodePTPReport(uint8_t* packet)
 {
     bool length_okay = false;
+    report.ptp.hasPressure = 0;
     switch (m_length)
     {
         case 3 + (5 * 1) + 4 : // one finger
@@ -132,6 +149,12 @@ bool HidReport::decodePTPReport(uint8_t* packet)
         case 3 + (5 * 3) + 4 : // three fingers
             report.ptp.numberFingers = (m_length - (3 + 4) ) / 5;
             length_okay = true;
+            break;
+        case ptpPressureLength : // one finger, with pressure
+            report.ptp.numberFingers = 1;
+            report.ptp.hasPressure = 1;
+            length_okay = true;
+            break;
     }
     if ((m_report_id != id_ptpReport) || (!length_okay))
     {
@@ -154,6 +177,18 @@ bool HidReport::decodePTPReport(uint8_t* packet)
 
         report.ptp.fingers[x].y = (uint16_t) packet[index++];   // low byte
         report.ptp.fingers[x].y |= (uint16_t) packet[index++] << 8;  // high byte
+
+        report.ptp.fingers[x].pressure = 0;
+        if (report.ptp.hasPressure)
+        {
+            report.ptp.fingers[x].pressure = (uint16_t) packet[index++];   // low byte
+            report.ptp.fingers[x].pressure |= (uint16_t) packet[index++] << 8;  // high byte
+        }
+    }
+    // fingers that weren't in this report don't carry stale data
+    for (int x = report.ptp.numberFingers; x < MAX_PTP_FINGER_COUNT; x++)
+    {
+        memset(&report.ptp.fingers[x], 0, sizeof(PtpFingerData_t));
     }
 
     report.ptp.timeStamp = (uint16_t) packet[index++];  // low byte
@@ -163,16 +198,6 @@ bool HidReport::decodePTPReport(uint8_t* packet)
     report.ptp.buttons = packet[index++]; 
 
 	return true;
-
-    // ToDo: make this work with PTP Input Report -Pressure-
-
-    // pressure makes this be single finger per report:
-    // 0, 1 = length, 2 = id
-    // 3, 4,5, 6,7 = confidence, x, y
-    // 8,9 = pressure area
-    // 10,11 = time stamp
-    // 12 = total contacts
-    // 13 = button mask
 }
 
 bool HidReport::decodeKeyboardReport(uint8_t* packet)
@@ -195,3 +220,102 @@ bool HidReport::decodeKeyboardReport(uint8_t* packet)
     return true;
 }
 
+
+// Cirque Absolute and Alps Absolute reports share report id 9, the length tells them apart.
+// All values are little endian.
+
+// Cirque Absolute layout (30 bytes):
+// 0, 1 -- report size
+// 2    -- report ID
+// 3,4  -- Y
+// 5,6  -- X
+// 7    -- palm
+//  -- repeat for remaining fingers; Y, X, palm (5 bytes per finger, 5 fingers)
+// 28   -- contact flags
+// 29   -- button mask
+
+bool HidReport::decodeCirqueAbsoluteReport(uint8_t* packet)
+{
+    if ((m_report_id != id_crqAlpsReport) || (m_length != crqAbsoluteLength))
+    {
+        clearReport();
+        return false;
+    }
+
+    int index = 3;
+    for (int x = 0; x < MAX_CRQ_ALPS_FINGER_COUNT; x++)
+    {
+        report.abs.fingers[x].y = (uint16_t) packet[index++];   // low byte
+        report.abs.fingers[x].y |= (uint16_t) packet[index++] << 8;  // high byte
+
+        report.abs.fingers[x].x = (uint16_t) packet[index++];   // low byte
+        report.abs.fingers[x].x |= (uint16_t) packet[index++] << 8;  // high byte
+
+        report.abs.fingers[x].palm = packet[index++];
+    }
+    report.abs.contactFlags = packet[index++];
+    report.abs.buttons = packet[index++];
+
+    return true;
+}
+
+// Alps Absolute layout (35 bytes):
+// 0, 1 -- report size
+// 2    -- report ID
+// 3,4  -- X
+// 5,6  -- Y
+// 7    -- palm
+// 8    -- Z
+//  -- repeat for remaining fingers; X, Y, palm, Z (6 bytes per finger, 5 fingers)
+// 33   -- contact flags
+// 34   -- button mask
+
+bool HidReport::decodeAlpsAbsoluteReport(uint8_t* packet)
+{
+    if ((m_report_id != id_crqAlpsReport) || (m_length != alpsAbsoluteLength))
+    {
+        clearReport();
+        return false;
+    }
+
+    int index = 3;
+    for (int x = 0; x < MAX_CRQ_ALPS_FINGER_COUNT; x++)
+    {
+        report.alpsAbs.fingers[x].x = (uint16_t) packet[index++];   // low byte
+        report.alpsAbs.fingers[x].x |= (uint16_t) packet[index++] << 8;  // high byte
+
+        report.alpsAbs.fingers[x].y = (uint16_t) packet[index++];   // low byte
+        report.alpsAbs.fingers[x].y |= (uint16_t) packet[index++] << 8;  // high byte
+
+        report.alpsAbs.fingers[x].palm = packet[index++];
+        report.alpsAbs.fingers[x].z = packet[index++];
+    }
+    report.alpsAbs.contactFlags = packet[index++];
+    report.alpsAbs.buttons = packet[index++];
+
+    return true;
+}
+
+// Stick layout (10 bytes), report id 15 (other lengths are SpiderMeas reports):
+// 0, 1 -- report size
+// 2    -- report ID
+// 3    -- button mask
+// 4,5  -- X
+// 6,7  -- Y
+// 8,9  -- Z
+
+bool HidReport::decodeStickReport(uint8_t* packet)
+{
+    if ((m_report_id != id_alpsStickReport) || (m_length != stickLength))
+    {
+        clearReport();
+        return false;
+    }
+
+    report.stick.buttons = packet[3];
+    report.stick.X = (uint16_t) packet[4] | ((uint16_t) packet[5] << 8);
+    report.stick.Y = (uint16_t) packet[6] | ((uint16_t) packet[7] << 8);
+    report.stick.Z = (uint16_t) packet[8] | ((uint16_t) packet[9] << 8);
+
+    return true;
+}
@@ -17,6 +17,13 @@ public:
 
     bool decodeReport(uint8_t* packet);
 
+    // packet lengths (including the 3 byte HID header) of the fixed size reports
+    static const uint16_t ptpPressureLength = 3 + 7 + 4;
+    static const uint16_t crqAbsoluteLength = 3 + (5 * MAX_CRQ_ALPS_FINGER_COUNT) + 2;
+    static const uint16_t alpsAbsoluteLength = 3 + (6 * MAX_CRQ_ALPS_FINGER_COUNT) + 2;
+    static const uint16_t stickLength = 3 + 7;
+    static const uint16_t maxReportLength = alpsAbsoluteLength;  // the longest of them
+
     // bool isFingerValid(uint8_t finger_num);
     // bool isFingerTouching(uint8_t finger_num);
     // uint8_t numberFingers(void);
@@ -33,9 +40,9 @@ protected:
     bool decodeMouseReport(uint8_t* packet);
     bool decodePTPReport(uint8_t* packet);
     bool decodeKeyboardReport(uint8_t* packet);
-    // bool decodeAlpsAbsoluteReport(uint8_t* packet);
-    // bool decodeCirqueAbsoluteReport(uint8_t* packet);
-    // bool decodeStickReport(uint8_t* packet);
+    bool decodeAlpsAbsoluteReport(uint8_t* packet);
+    bool decodeCirqueAbsoluteReport(uint8_t* packet);
+    bool decodeStickReport(uint8_t* packet);
 
 };
 
@@ -24,12 +24,12 @@ typedef enum reportIds_t : uint8_t
     id_mouseReport = 6,
     id_fwUpdate = 7,
     id_keyReport = 8,
-    // id_crqAlpsReport = 9, // uses data length to figure out which it is
+    id_crqAlpsReport = 9, // uses data length to figure out which it is
     // id_serial = 13,
     // id_AlpsFeatureReport = 14,
     id_customMeas = 14,
     id_spiderMeas = 15,
-    // id_AlpsStickAbsoluteReport = 15,
+    id_alpsStickReport = 15, // shares the id with SpiderMeas, uses data length to figure out which it is
     // HID_Rep_ID_SerialPassthrough  = 18, 
 	id_adaptiveTouch = 25, 
     // id_GuisePipe = 240,
@@ -57,6 +57,7 @@ typedef struct
 	uint8_t  contactID;    //Uniquely identifies the contact within a given frame
 	uint8_t  confidence;   //Microsoft ways "Set when a contact is too large to be a finger" but that is backwards. It's clear if the object is too big.
 	uint8_t  tip;          // Set if the contact is on the surface of the digitizer, once this clears you know you have lift-off
+	uint16_t pressure;     // contact area, only PTP Pressure reports fill this in (0 otherwise)
 } PtpFingerData_t;
 
 typedef struct
@@ -66,6 +67,7 @@ typedef struct
 	uint8_t  buttons;
 	PtpFingerData_t fingers[MAX_PTP_FINGER_COUNT];
     uint8_t numberFingers;
+    uint8_t hasPressure;   // set if this was a PTP Pressure report (always one finger per report)
 } PtpReport_t;
 
 // Keyboard report packet
@@ -81,46 +83,46 @@ typedef struct
 	uint16_t NumberValidBytes; // measurements results, number of bytes
 } customMeasHeader_t;
 
-// // Cirque Absolute data of a single finger - this is a sub-part of a report
-// typedef struct
-// {
-//     uint16_t y;     // Absolute Y position of finger 
-//     uint16_t x;     //  Absolute X position of finger 
-//     uint8_t  palm;  //  Bitfield with Palm-reject, confidence and single sample information Note: a finger may have old or inaccurate x,y data when the confidence is low
-// } CRQFingerData_t;
-
-// // Cirque Absolute report
-// typedef struct
-// {
-//     CRQFingerData_t fingers[MAX_CRQ_ALPS_FINGER_COUNT];  // Array of 5 Fingers 
-//     uint8_t contactFlags;        // bitmap of contacted fingers ie. 0x3 means fingers 0 and 1 are down
-//     uint8_t buttons;             // Bitmap of the button states 
-// } CRQabsoluteReport_t;
-
-// // Alps Absolute data of a single finger - this is a sub-part of a report
-// typedef struct
-// {
-//     uint16_t x;     // Absolute X position of finger
-//     uint16_t y;     // Absolute Y position of finger
-//     uint8_t  palm;  // Bitfield with Palm-reject, confidence and single sample information Note: a finger may have old or inaccurate x,y data when the confidence is lo
-//     uint8_t z; 	    // Z value of the finger
-// } AlpsFingerData_t;
-
-// // Alps report packet
-// typedef struct
-// {
-//     AlpsFingerData_t    fingers[MAX_CRQ_ALPS_FINGER_COUNT];     // Array of 5 Fingersn
-//     uint8_t         	contactFlags;   // bitmap of contacted fingers ie. 0x3 means fingers 0 and 1 are down
-//     uint8_t         	buttons;        // Bitmap of the button statesn
-// } AlpsAbsoluteReport_t;
-
-// typedef struct
-// {
-// 	uint8_t buttons; // b0 = left, b1 = right, b2 = middle 
-//     uint16_t X;
-//     uint16_t Y;
-//     uint16_t Z;
-// } StickReport_t;
+// Cirque Absolute data of a single finger - this is a sub-part of a report
+typedef struct
+{
+    uint16_t y;     // Absolute Y position of finger 
+    uint16_t x;     //  Absolute X position of finger 
+    uint8_t  palm;  //  Bitfield with Palm-reject, confidence and single sample information Note: a finger may have old or inaccurate x,y data when the confidence is low
+} CRQFingerData_t;
+
+// Cirque Absolute report
+typedef struct
+{
+    CRQFingerData_t fingers[MAX_CRQ_ALPS_FINGER_COUNT];  // Array of 5 Fingers 
+    uint8_t contactFlags;        // bitmap of contacted fingers ie. 0x3 means fingers 0 and 1 are down
+    uint8_t buttons;             // Bitmap of the button states 
+} CRQabsoluteReport_t;
+
+// Alps Absolute data of a single finger - this is a sub-part of a report
+typedef struct
+{
+    uint16_t x;     // Absolute X position of finger
+    uint16_t y;     // Absolute Y position of finger
+    uint8_t  palm;  // Bitfield with Palm-reject, confidence and single sample information Note: a finger may have old or inaccurate x,y data when the confidence is lo
+    uint8_t z; 	    // Z value of the finger
+} AlpsFingerData_t;
+
+// Alps report packet
+typedef struct
+{
+    AlpsFingerData_t    fingers[MAX_CRQ_ALPS_FINGER_COUNT];     // Array of 5 Fingersn
+    uint8_t         	contactFlags;   // bitmap of contacted fingers ie. 0x3 means fingers 0 and 1 are down
+    uint8_t         	buttons;        // Bitmap of the button statesn
+} AlpsAbsoluteReport_t;
+
+typedef struct
+{
+	uint8_t buttons; // b0 = left, b1 = right, b2 = middle 
+    uint16_t X;
+    uint16_t Y;
+    uint16_t Z;
+} StickReport_t;
 
 typedef union  // This union allows the report to be generic, use reportType to decide which report it is
 {
@@ -129,9 +131,9 @@ typedef union  // This union allows the report to be generic, use reportType to
     keyReport_t keyboard;  	       
 	customMeasHeader_t customMeasHeader;
 
-    // CRQabsoluteReport_t abs;    	
-    // AlpsAbsoluteReport_t alpsAbs;	
-    // StickReport_t stick;
+    CRQabsoluteReport_t abs;
+    AlpsAbsoluteReport_t alpsAbs;
+    StickReport_t stick;
 
 } AnyHIDReport_t;
 
@@ -71,7 +71,8 @@ protected:
     
     uint16_t m_descriptorAddress = CIRQUE_HID_DESCRIPTOR_ADDRESS;
     uint16_t m_commandRegister = CIRQUE_HID_COMMAND_REGISTER;
-    uint8_t hidReportBuffer[sizeof(AnyHIDReport_t)];
+    uint16_t m_reportReadLength = HidReport::crqAbsoluteLength;  // see getReport
+    uint8_t hidReportBuffer[HidReport::maxReportLength];
 
     enum hidReportTypes : uint8_t
     {
@@ -0,0 +1,202 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "MeasEvents.h"
+
+#define BASELINE_FRACTION_BITS (8)
+
+static uint32_t noClock(void)
+{
+	return 0;
+}
+
+static inline int16_t saturate16(int32_t value)
+{
+	return (value > INT16_MAX) ? INT16_MAX : (value < INT16_MIN) ? INT16_MIN : (int16_t)value;
+}
+
+MeasEventDetector::MeasEventDetector()
+{
+	// no events until thresholds are set
+	MeasEventThresholds_t off = { INT16_MAX, INT16_MAX, INT16_MIN, 0, 1, 1, 0 };
+	begin(noClock);
+	setThresholds(off);
+}
+
+MeasEventThresholds_t MeasEventDetector::thresholdsFromGroup(const CustomMeas::GroupInfo_t & group, uint8_t touchDebounce,
+	uint8_t releaseDebounce)
+{
+	MeasEventThresholds_t thresholds;
+	uint16_t activity = group.ActivityThresholdLSB | (group.ActivityThresholdMSB << 8);
+	thresholds.activityThreshold = saturate16(activity);
+	thresholds.releaseThreshold = thresholds.activityThreshold - (thresholds.activityThreshold / 4);
+	thresholds.negativeThreshold = (int16_t)(group.NegativeThresholdLSB | (group.NegativeThresholdMSB << 8));
+	if (thresholds.negativeThreshold >= 0) thresholds.negativeThreshold = INT16_MIN;  // off
+	thresholds.speedThreshold = group.SpeedThresholdLSB | (group.SpeedThresholdMSB << 8);
+	thresholds.touchDebounce = touchDebounce;
+	thresholds.releaseDebounce = releaseDebounce;
+	thresholds.activityTimeout = group.ActivityTimeoutLSB | (group.ActivityTimeoutMSB << 8);
+	return thresholds;
+}
+
+void MeasEventDetector::begin(uint32_t (*clock_us)(void), uint8_t baselineShift)
+{
+	m_clock_us = clock_us ? clock_us : noClock;
+	m_baselineShift = (baselineShift > 15) ? 15 : baselineShift;
+	m_count = 0;
+	m_head = 0;
+	m_tail = 0;
+	m_eventsDropped = 0;
+	reset();
+	resetLatency();
+}
+
+void MeasEventDetector::setThresholds(const MeasEventThresholds_t & thresholds)
+{
+	for (uint16_t x = 0; x < MEAS_EVENT_CHANNELS; x++) m_thresholds[x] = thresholds;
+}
+
+bool MeasEventDetector::setThresholds(uint16_t channel, const MeasEventThresholds_t & thresholds)
+{
+	if (channel >= MEAS_EVENT_CHANNELS) return false;
+	m_thresholds[channel] = thresholds;
+	return true;
+}
+
+void MeasEventDetector::reset(void)
+{
+	m_primed = false;
+}
+
+void MeasEventDetector::resetLatency(void)
+{
+	m_frames = 0;
+	m_latencyMin_us = UINT32_MAX;
+	m_latencyMax_us = 0;
+	m_latencySum_us = 0;
+}
+
+void MeasEventDetector::queueEvent(uint32_t sequence, uint16_t channel, MeasEventTypes type, int16_t signal,
+	uint32_t timestamp_us)
+{
+	if (next(m_head) == m_tail)
+	{
+		m_eventsDropped++;
+		return;
+	}
+
+	uint32_t latency_us = m_clock_us() - timestamp_us;
+	MeasEvent_t & event = m_events[m_head];
+	event.sequence = sequence;
+	event.channel = channel;
+	event.type = type;
+	event.signal = signal;
+	event.latency_us = (latency_us > UINT16_MAX) ? UINT16_MAX : (uint16_t)latency_us;
+	m_head = next(m_head);
+}
+
+uint8_t MeasEventDetector::process(const int16_t * samples, uint16_t sampleCount, uint32_t sequence, uint32_t timestamp_us)
+{
+	if (sampleCount > MEAS_EVENT_CHANNELS) sampleCount = MEAS_EVENT_CHANNELS;
+	if (!m_primed || (sampleCount != m_count))
+	{
+		m_count = sampleCount;
+		for (uint16_t x = 0; x < sampleCount; x++)
+		{
+			m_baseline[x] = (int32_t)samples[x] << BASELINE_FRACTION_BITS;
+			m_previousSignal[x] = 0;
+			m_debounce[x] = 0;
+			m_touched[x] = false;
+			m_touchFrames[x] = 0;
+		}
+		m_primed = true;
+		return 0;
+	}
+
+	uint8_t queued = eventCount();
+	for (uint16_t x = 0; x < sampleCount; x++)
+	{
+		const MeasEventThresholds_t & t = m_thresholds[x];
+		int32_t reading = (int32_t)samples[x] << BASELINE_FRACTION_BITS;
+		int16_t signal = saturate16((reading - m_baseline[x] + (1 << (BASELINE_FRACTION_BITS - 1))) >> BASELINE_FRACTION_BITS);
+
+		if (signal <= t.negativeThreshold)
+		{
+			// the baseline was taken while touched (or the sensor has changed), start again from here
+			m_baseline[x] = reading;
+			m_touched[x] = false;
+			m_debounce[x] = 0;
+			queueEvent(sequence, x, MEAS_EVENT_NEGATIVE, signal, timestamp_us);
+			signal = 0;
+		}
+		else if (!m_touched[x])
+		{
+			if (signal >= t.activityThreshold)
+			{
+				// a fast rise is a touch, not drift, so it skips the debounce
+				bool fast = (t.speedThreshold > 0) && ((int32_t)signal - m_previousSignal[x] >= t.speedThreshold);
+				if (m_debounce[x] < UINT8_MAX) m_debounce[x]++;
+				if (fast || (m_debounce[x] >= t.touchDebounce))
+				{
+					m_touched[x] = true;
+					m_touchFrames[x] = 0;
+					m_debounce[x] = 0;
+					queueEvent(sequence, x, MEAS_EVENT_TOUCH, signal, timestamp_us);
+				}
+			}
+			else
+			{
+				// only an idle channel moves its baseline
+				m_debounce[x] = 0;
+				m_baseline[x] += (reading - m_baseline[x]) >> m_baselineShift;
+			}
+		}
+		else
+		{
+			if (m_touchFrames[x] < UINT16_MAX) m_touchFrames[x]++;
+			if ((t.activityTimeout > 0) && (m_touchFrames[x] >= t.activityTimeout))
+			{
+				m_baseline[x] = reading;
+				m_touched[x] = false;
+				m_debounce[x] = 0;
+				queueEvent(sequence, x, MEAS_EVENT_TIMEOUT, signal, timestamp_us);
+				signal = 0;
+			}
+			else if (signal < t.releaseThreshold)
+			{
+				if (m_debounce[x] < UINT8_MAX) m_debounce[x]++;
+				if (m_debounce[x] >= t.releaseDebounce)
+				{
+					m_touched[x] = false;
+					m_debounce[x] = 0;
+					queueEvent(sequence, x, MEAS_EVENT_RELEASE, signal, timestamp_us);
+				}
+			}
+			else
+			{
+				m_debounce[x] = 0;
+			}
+		}
+		m_previousSignal[x] = signal;
+	}
+
+	uint32_t latency_us = m_clock_us() - timestamp_us;
+	m_frames++;
+	m_latencySum_us += latency_us;
+	if (latency_us < m_latencyMin_us) m_latencyMin_us = latency_us;
+	if (latency_us > m_latencyMax_us) m_latencyMax_us = latency_us;
+
+	return (uint8_t)(eventCount() - queued);
+}
+
+uint8_t MeasEventDetector::eventCount(void) const
+{
+	return (m_head + MEAS_EVENT_QUEUE_DEPTH + 1 - m_tail) % (MEAS_EVENT_QUEUE_DEPTH + 1);
+}
+
+bool MeasEventDetector::getEvent(MeasEvent_t & event)
+{
+	if (m_head == m_tail) return false;
+	event = m_events[m_tail];
+	m_tail = next(m_tail);
+	return true;
+}
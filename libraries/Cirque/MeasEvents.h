@@ -0,0 +1,104 @@
+#ifndef MEAS_EVENTS_H
+#define MEAS_EVENTS_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+#define MEAS_EVENT_CHANNELS (MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT)
+#ifndef MEAS_EVENT_QUEUE_DEPTH
+#define MEAS_EVENT_QUEUE_DEPTH (16)
+#endif
+
+enum MeasEventTypes : uint8_t
+{
+	MEAS_EVENT_TOUCH = 0,
+	MEAS_EVENT_RELEASE = 1,
+	MEAS_EVENT_TIMEOUT = 2,   // released because it was touched for longer than activityTimeout
+	MEAS_EVENT_NEGATIVE = 3,  // the signal went below negativeThreshold, the baseline was reset (and a touch released)
+};
+
+typedef struct {
+	uint32_t sequence;    // of the frame that caused it
+	uint16_t channel;
+	MeasEventTypes type;
+	int16_t signal;       // reading - baseline
+	uint16_t latency_us;  // from the frame timestamp to the event being queued, 65535 at most
+} MeasEvent_t;
+
+// Signal levels are counts above the channel's baseline, times are in frames.
+typedef struct {
+	int16_t activityThreshold;  // touch at or above this
+	int16_t releaseThreshold;   // release below this, the hysteresis is activityThreshold - releaseThreshold
+	int16_t negativeThreshold;  // at or below this the baseline is reset (a negative number)
+	uint16_t speedThreshold;    // touch with no debounce if the signal rises this much in one frame, 0 = off
+	uint8_t touchDebounce;      // frames at or above activityThreshold before a touch
+	uint8_t releaseDebounce;    // frames below releaseThreshold before a release
+	uint16_t activityTimeout;   // frames touched before the touch is released and the baseline reset, 0 = never
+} MeasEventThresholds_t;
+
+// Turns CustomMeas frames into touch and release events per channel, like buttons.
+// Each channel keeps a baseline that follows the reading while it's idle and holds while it's
+// touched (or about to be). The thresholds mirror the device's GroupInfo_t ones, see
+// thresholdsFromGroup(). Events are queued as the frame is processed, so the latency from
+// the frame being read to its events is just the processing, which is measured every frame.
+//
+// clock_us is the time base of the frame timestamps, micros() on the Arduino.
+class MeasEventDetector
+{
+public:
+	MeasEventDetector();
+
+	const uint32_t &EventsDropped{ m_eventsDropped };  // the queue was full
+	const uint32_t &Frames{ m_frames };                // frames in the latency figures
+	const uint32_t &LatencyMin_us{ m_latencyMin_us };
+	const uint32_t &LatencyMax_us{ m_latencyMax_us };
+	uint32_t latencyMean_us(void) const { return m_frames ? (uint32_t)(m_latencySum_us / m_frames) : 0; }
+
+	// The device's activity, negative and speed thresholds, and activity timeout (taken as frames).
+	// GroupInfo_t has no hysteresis, the release threshold is 3/4 of the activity threshold.
+	static MeasEventThresholds_t thresholdsFromGroup(const CustomMeas::GroupInfo_t & group, uint8_t touchDebounce = 2,
+		uint8_t releaseDebounce = 2);
+
+	// baselineShift sets how fast the baseline follows, 1/2^shift of the difference per frame
+	void begin(uint32_t (*clock_us)(void), uint8_t baselineShift = 6);
+	void setThresholds(const MeasEventThresholds_t & thresholds);  // every channel
+	bool setThresholds(uint16_t channel, const MeasEventThresholds_t & thresholds);
+	void reset(void);  // forget the baselines and touches, the next frame sets the baselines
+	void resetLatency(void);
+
+	// returns the number of events this frame queued. A change in sampleCount resets.
+	uint8_t process(const int16_t * samples, uint16_t sampleCount, uint32_t sequence, uint32_t timestamp_us);
+	bool getEvent(MeasEvent_t & event);
+	uint8_t eventCount(void) const;
+	bool isTouched(uint16_t channel) const { return (channel < m_count) && m_touched[channel]; }
+
+protected:
+	uint32_t (*m_clock_us)(void);
+	uint8_t m_baselineShift;
+	uint16_t m_count;
+	bool m_primed;
+
+	MeasEventThresholds_t m_thresholds[MEAS_EVENT_CHANNELS];
+	int32_t m_baseline[MEAS_EVENT_CHANNELS];  // 8 fraction bits
+	int16_t m_previousSignal[MEAS_EVENT_CHANNELS];
+	uint8_t m_debounce[MEAS_EVENT_CHANNELS];
+	bool m_touched[MEAS_EVENT_CHANNELS];
+	uint16_t m_touchFrames[MEAS_EVENT_CHANNELS];
+
+	MeasEvent_t m_events[MEAS_EVENT_QUEUE_DEPTH + 1];
+	uint8_t m_head;
+	uint8_t m_tail;
+	uint32_t m_eventsDropped;
+
+	uint32_t m_frames;
+	uint32_t m_latencyMin_us;
+	uint32_t m_latencyMax_us;
+	uint64_t m_latencySum_us;
+
+	void queueEvent(uint32_t sequence, uint16_t channel, MeasEventTypes type, int16_t signal, uint32_t timestamp_us);
+	static uint8_t next(uint8_t index) { return (index + 1) % (MEAS_EVENT_QUEUE_DEPTH + 1); }
+};
+
+#endif // MEAS_EVENTS_H
@@ -0,0 +1,229 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "MeasFilter.h"
+#include <string.h>
+
+#define LOW_PASS_FRACTION_BITS (8)
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+// two int16_t per word, SSUB16 sets a GE flag per half, SEL picks each half by it
+static inline uint32_t max16x2(uint32_t a, uint32_t b)
+{
+	uint32_t result;
+	__asm__ ("ssub16 %0, %1, %2\n\tsel %0, %1, %2" : "=&r" (result) : "r" (a), "r" (b) : "cc");
+	return result;
+}
+
+static inline uint32_t min16x2(uint32_t a, uint32_t b)
+{
+	uint32_t result;
+	__asm__ ("ssub16 %0, %1, %2\n\tsel %0, %2, %1" : "=&r" (result) : "r" (a), "r" (b) : "cc");
+	return result;
+}
+#endif
+
+static inline int16_t min16(int16_t a, int16_t b) { return (a < b) ? a : b; }
+static inline int16_t max16(int16_t a, int16_t b) { return (a > b) ? a : b; }
+
+static inline int16_t median3(int16_t a, int16_t b, int16_t c)
+{
+	return max16(min16(a, b), min16(max16(a, b), c));
+}
+
+static inline int16_t median5(int16_t a, int16_t b, int16_t c, int16_t d, int16_t e)
+{
+	// drop the smaller of two minimums and the larger of two maximums, then it's a median of 3
+	int16_t f = max16(min16(a, b), min16(c, d));
+	int16_t g = min16(max16(a, b), max16(c, d));
+	return median3(e, f, g);
+}
+
+static inline int16_t saturate16(int32_t value)
+{
+	return (value > INT16_MAX) ? INT16_MAX : (value < INT16_MIN) ? INT16_MIN : (int16_t)value;
+}
+
+MeasFilterChain::MeasFilterChain()
+{
+	clear();
+}
+
+void MeasFilterChain::clear(void)
+{
+	m_stageCount = 0;
+	m_count = 0;
+}
+
+bool MeasFilterChain::addStage(FilterTypes type, uint8_t shift, uint8_t length, uint16_t threshold)
+{
+	if (m_stageCount >= MEAS_FILTER_MAX_STAGES) return false;
+
+	Stage_t & stage = m_stages[m_stageCount++];
+	stage.type = type;
+	stage.shift = shift;
+	stage.length = length;
+	stage.threshold = threshold;
+	stage.primed = false;
+	stage.historyIndex = 0;
+	stage.historyFill = 0;
+	return true;
+}
+
+bool MeasFilterChain::addLowPass(uint8_t shift)
+{
+	if (shift > 15) return false;
+	return addStage(FILTER_LOW_PASS, shift, 0, 0);
+}
+
+bool MeasFilterChain::addBaseline(uint8_t shift, uint16_t freezeThreshold)
+{
+	if (shift > 15) return false;
+	return addStage(FILTER_BASELINE, shift, 0, freezeThreshold);
+}
+
+bool MeasFilterChain::addMedian(uint8_t length)
+{
+	if ((length != 3) && (length != 5)) return false;
+	return addStage(FILTER_MEDIAN, 0, length, 0);
+}
+
+void MeasFilterChain::reset(void)
+{
+	for (uint8_t x = 0; x < m_stageCount; x++)
+	{
+		m_stages[x].primed = false;
+		m_stages[x].historyIndex = 0;
+		m_stages[x].historyFill = 0;
+	}
+}
+
+void MeasFilterChain::process(const int16_t * in, int16_t * out, uint16_t count)
+{
+	if (count > MEAS_FILTER_CHANNELS) count = MEAS_FILTER_CHANNELS;
+	if (count != m_count)
+	{
+		m_count = count;
+		reset();
+	}
+	if (in != out) memcpy(out, in, count * sizeof(int16_t));
+
+	for (uint8_t x = 0; x < m_stageCount; x++)
+	{
+		processStage(x, out, count);
+	}
+}
+
+void MeasFilterChain::processStage(uint8_t stage, int16_t * data, uint16_t count)
+{
+	if (stage >= m_stageCount) return;
+	if (count > MEAS_FILTER_CHANNELS) count = MEAS_FILTER_CHANNELS;
+
+	switch (m_stages[stage].type)
+	{
+		case FILTER_LOW_PASS:
+			lowPass(m_stages[stage], m_state[stage], data, count);
+			break;
+		case FILTER_BASELINE:
+			baseline(m_stages[stage], m_state[stage], data, count);
+			break;
+		case FILTER_MEDIAN:
+			median(m_stages[stage], m_history[stage], data, count);
+			break;
+	}
+}
+
+void MeasFilterChain::lowPass(Stage_t & stage, int32_t * state, int16_t * data, uint16_t count)
+{
+	if (!stage.primed)
+	{
+		for (uint16_t x = 0; x < count; x++) state[x] = (int32_t)data[x] << LOW_PASS_FRACTION_BITS;
+		stage.primed = true;
+		return;
+	}
+
+	uint8_t shift = stage.shift;
+	for (uint16_t x = 0; x < count; x++)
+	{
+		int32_t s = state[x];
+		s += (((int32_t)data[x] << LOW_PASS_FRACTION_BITS) - s) >> shift;
+		state[x] = s;
+		data[x] = (int16_t)((s + (1 << (LOW_PASS_FRACTION_BITS - 1))) >> LOW_PASS_FRACTION_BITS);
+	}
+}
+
+void MeasFilterChain::baseline(Stage_t & stage, int32_t * state, int16_t * data, uint16_t count)
+{
+	if (!stage.primed)
+	{
+		for (uint16_t x = 0; x < count; x++) state[x] = (int32_t)data[x] << LOW_PASS_FRACTION_BITS;
+		stage.primed = true;
+	}
+
+	uint8_t shift = stage.shift;
+	int32_t threshold = (int32_t)stage.threshold << LOW_PASS_FRACTION_BITS;
+	for (uint16_t x = 0; x < count; x++)
+	{
+		int32_t s = state[x];
+		int32_t difference = ((int32_t)data[x] << LOW_PASS_FRACTION_BITS) - s;
+		// no branch: the update is masked off while the signal is far from the baseline
+		int32_t track = ((difference <= threshold) && (difference >= -threshold)) ? -1 : 0;
+		s += (difference >> shift) & track;
+		state[x] = s;
+		data[x] = saturate16((difference + (1 << (LOW_PASS_FRACTION_BITS - 1))) >> LOW_PASS_FRACTION_BITS);
+	}
+}
+
+void MeasFilterChain::median(Stage_t & stage, int16_t (*history)[MEAS_FILTER_CHANNELS], int16_t * data, uint16_t count)
+{
+	memcpy(history[stage.historyIndex], data, count * sizeof(int16_t));
+	stage.historyIndex = (stage.historyIndex + 1) % stage.length;
+	if (stage.historyFill < stage.length)
+	{
+		// pass through until there are enough frames
+		stage.historyFill++;
+		if (stage.historyFill < stage.length) return;
+	}
+
+	uint16_t x = 0;
+	if (stage.length == 3)
+	{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+		for (; x + 1 < count; x += 2)
+		{
+			uint32_t a, b, c;
+			memcpy(&a, &history[0][x], sizeof(a));
+			memcpy(&b, &history[1][x], sizeof(b));
+			memcpy(&c, &history[2][x], sizeof(c));
+			uint32_t m = max16x2(min16x2(a, b), min16x2(max16x2(a, b), c));
+			memcpy(&data[x], &m, sizeof(m));
+		}
+#endif
+		for (; x < count; x++)
+		{
+			data[x] = median3(history[0][x], history[1][x], history[2][x]);
+		}
+	}
+	else
+	{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+		for (; x + 1 < count; x += 2)
+		{
+			uint32_t a, b, c, d, e;
+			memcpy(&a, &history[0][x], sizeof(a));
+			memcpy(&b, &history[1][x], sizeof(b));
+			memcpy(&c, &history[2][x], sizeof(c));
+			memcpy(&d, &history[3][x], sizeof(d));
+			memcpy(&e, &history[4][x], sizeof(e));
+			// the same network as median5()
+			uint32_t f = max16x2(min16x2(a, b), min16x2(c, d));
+			uint32_t g = min16x2(max16x2(a, b), max16x2(c, d));
+			uint32_t m = max16x2(min16x2(e, f), min16x2(max16x2(e, f), g));
+			memcpy(&data[x], &m, sizeof(m));
+		}
+#endif
+		for (; x < count; x++)
+		{
+			data[x] = median5(history[0][x], history[1][x], history[2][x], history[3][x], history[4][x]);
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef MEAS_FILTER_H
+#define MEAS_FILTER_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+#define MEAS_FILTER_CHANNELS (MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT)
+#ifndef MEAS_FILTER_MAX_STAGES
+#define MEAS_FILTER_MAX_STAGES (3)  // each stage keeps ~4.5k of state for the full 320 channels
+#endif
+#define MEAS_FILTER_MAX_MEDIAN (5)
+
+// A chain of filters that runs on whole CustomMeas frames, every channel at once.
+// Everything is integer (fixed point) and allocated up front, so it runs between
+// getMeasFrame/getMeasReport and the consumer with no heap use. The first frame after
+// reset() primes each stage's state.
+//
+// Stages, applied in the order they were added:
+//   low pass  - first order IIR, y += (x - y) / 2^shift, state kept with 8 fraction bits
+//   baseline  - tracks the slow level, b += (x - b) / 2^shift, and outputs x - b. The baseline
+//               holds while |x - b| > freezeThreshold, so a touch isn't absorbed into it.
+//   median    - median of the last 3 or 5 frames per channel, removes single frame spikes
+//
+// On a Cortex-M7 (or any core with the DSP extension) the medians do two channels per
+// instruction with SSUB16/SEL. The low pass and baseline stay scalar: their state is 32 bits
+// per channel (16 bits of signal and 8 of fraction, plus headroom for the difference), so
+// there are no 16 bit lanes to pair, and the M7 has no 32 bit SIMD.
+class MeasFilterChain
+{
+public:
+	MeasFilterChain();
+
+	enum FilterTypes : uint8_t
+	{
+		FILTER_LOW_PASS = 0,
+		FILTER_BASELINE = 1,
+		FILTER_MEDIAN = 2,
+	};
+
+	const uint8_t &Stages{ m_stageCount };
+
+	void clear(void);  // removes every stage
+	bool addLowPass(uint8_t shift);
+	bool addBaseline(uint8_t shift, uint16_t freezeThreshold);
+	bool addMedian(uint8_t length);  // 3 or 5
+	void reset(void);  // forget the filter state, the next frame primes it
+
+	// in and out may be the same buffer. A change in count resets the chain.
+	void process(const int16_t * in, int16_t * out, uint16_t count);
+	// one stage in place, process() runs each stage with this
+	void processStage(uint8_t stage, int16_t * data, uint16_t count);
+
+protected:
+	typedef struct {
+		FilterTypes type;
+		uint8_t shift;
+		uint8_t length;
+		uint16_t threshold;
+		bool primed;
+		uint8_t historyIndex;  // median: next slot to write
+		uint8_t historyFill;   // median: frames in the history so far
+	} Stage_t;
+
+	Stage_t m_stages[MEAS_FILTER_MAX_STAGES];
+	uint8_t m_stageCount;
+	uint16_t m_count;
+
+	int32_t m_state[MEAS_FILTER_MAX_STAGES][MEAS_FILTER_CHANNELS];
+	int16_t m_history[MEAS_FILTER_MAX_STAGES][MEAS_FILTER_MAX_MEDIAN][MEAS_FILTER_CHANNELS];
+
+	bool addStage(FilterTypes type, uint8_t shift, uint8_t length, uint16_t threshold);
+	void lowPass(Stage_t & stage, int32_t * state, int16_t * data, uint16_t count);
+	void baseline(Stage_t & stage, int32_t * state, int16_t * data, uint16_t count);
+	void median(Stage_t & stage, int16_t (*history)[MEAS_FILTER_CHANNELS], int16_t * data, uint16_t count);
+};
+
+#endif // MEAS_FILTER_H
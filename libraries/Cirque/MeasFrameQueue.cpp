@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "MeasFrameQueue.h"
+
+MeasFrameQueue::MeasFrameQueue()
+{
+	begin(0);
+}
+
+void MeasFrameQueue::begin(uint16_t frameMillis)
+{
+	m_head = 0;
+	m_tail = 0;
+	m_frameMillis = frameMillis;
+	m_haveTimestamp = false;
+	m_lastTimestamp_us = 0;
+	m_sequence = 0;
+	m_framesQueued = 0;
+	m_overruns = 0;
+	m_missedFrames = 0;
+}
+
+uint8_t MeasFrameQueue::count(void) const
+{
+	return (m_head + MEAS_FRAME_QUEUE_DEPTH + 1 - m_tail) % (MEAS_FRAME_QUEUE_DEPTH + 1);
+}
+
+const MeasFrame_t * MeasFrameQueue::front(void) const
+{
+	return (m_head == m_tail) ? 0 : &m_frames[m_tail];
+}
+
+void MeasFrameQueue::pop(void)
+{
+	if (m_head != m_tail) m_tail = next(m_tail);
+}
+
+void MeasFrameQueue::commit(uint32_t timestamp_us)
+{
+	// frames the device made between this one and the last one read
+	uint32_t missed = 0;
+	if (m_haveTimestamp && (m_frameMillis > 0))
+	{
+		uint32_t period_us = (uint32_t)m_frameMillis * 1000;
+		uint32_t interval_us = timestamp_us - m_lastTimestamp_us;
+		uint32_t frames = (interval_us + (period_us / 2)) / period_us;  // nearest, host timestamps jitter
+		missed = (frames > 1) ? frames - 1 : 0;
+	}
+	m_haveTimestamp = true;
+	m_lastTimestamp_us = timestamp_us;
+	m_missedFrames += missed;
+	m_sequence += missed;
+
+	MeasFrame_t * frame = &m_frames[m_head];
+	frame->sequence = m_sequence++;
+	frame->timestamp_us = timestamp_us;
+
+	if (next(m_head) == m_tail)
+	{
+		// full, the reader keeps the frames it has, this one is lost
+		m_overruns++;
+		return;
+	}
+	m_head = next(m_head);
+	m_framesQueued++;
+}
@@ -0,0 +1,65 @@
+#ifndef MEAS_FRAME_QUEUE_H
+#define MEAS_FRAME_QUEUE_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+#ifndef MEAS_FRAME_QUEUE_DEPTH
+#define MEAS_FRAME_QUEUE_DEPTH (8)  // frames the reader can fall behind, ~6k RAM with the default sizes
+#endif
+
+typedef struct {
+	uint32_t sequence;       // device frame number, counted from begin(). Gaps are missed frames.
+	uint32_t timestamp_us;   // host time the frame was read
+	uint16_t measCount;
+	int16_t * meas;          // points into frameBuffer
+	uint16_t frameBuffer[MEAS_FRAME_BUFFER_WORDS];  // the report, as read by CustomMeas::getMeasFrame
+} MeasFrame_t;
+
+// Queue of CustomMeas frames, so reading the device (on DR) is decoupled from slow consumers
+// like printing. CustomMeas::queueMeasFrame reads the report straight into the next free slot.
+//
+// Two kinds of loss are counted:
+//   Overruns     - frames read from the device, but dropped because the queue was full
+//   MissedFrames - frames the device produced that were never read, found by comparing the
+//                  time between frames with FrameMillis
+class MeasFrameQueue
+{
+public:
+	MeasFrameQueue();
+
+	const uint32_t &FramesQueued{ m_framesQueued };
+	const uint32_t &Overruns{ m_overruns };
+	const uint32_t &MissedFrames{ m_missedFrames };
+	const uint16_t &FrameMillis{ m_frameMillis };
+
+	void begin(uint16_t frameMillis);  // empties the queue and clears the counters
+	uint8_t count(void) const;
+
+	// reader side
+	const MeasFrame_t * front(void) const;  // 0 when empty
+	void pop(void);
+
+	// writer side (CustomMeas::queueMeasFrame)
+	MeasFrame_t * writeSlot(void) { return &m_frames[m_head]; }
+	void commit(uint32_t timestamp_us);
+
+protected:
+	MeasFrame_t m_frames[MEAS_FRAME_QUEUE_DEPTH + 1];  // one spare, the writer always has a slot to read into
+	volatile uint8_t m_head;
+	volatile uint8_t m_tail;
+
+	uint16_t m_frameMillis;
+	bool m_haveTimestamp;
+	uint32_t m_lastTimestamp_us;
+	uint32_t m_sequence;
+	uint32_t m_framesQueued;
+	uint32_t m_overruns;
+	uint32_t m_missedFrames;
+
+	static uint8_t next(uint8_t index) { return (index + 1) % (MEAS_FRAME_QUEUE_DEPTH + 1); }
+};
+
+#endif // MEAS_FRAME_QUEUE_H
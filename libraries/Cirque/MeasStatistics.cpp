@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "MeasStatistics.h"
+#include <math.h>
+
+MeasStatistics::MeasStatistics()
+{
+	begin(MAX_READINGS_PER_MEASUREMENT);
+}
+
+void MeasStatistics::begin(uint8_t readingsPerMeasurement)
+{
+	m_readingsPerMeasurement = (readingsPerMeasurement > 0) ? readingsPerMeasurement : 1;
+	m_channels = 0;
+	m_measurements = 0;
+	m_haveReference = false;
+	reset();
+}
+
+void MeasStatistics::reset(void)
+{
+	m_count = 0;
+	for (uint16_t x = 0; x < MEAS_STATISTICS_CHANNELS; x++)
+	{
+		m_mean[x] = 0;
+		m_m2[x] = 0;
+		m_min[x] = INT16_MAX;
+		m_max[x] = INT16_MIN;
+	}
+	for (uint8_t x = 0; x < MAX_NUMBER_MEASUREMENTS; x++)
+	{
+		m_measMean[x] = 0;
+		m_measM2[x] = 0;
+		m_measMin[x] = INT32_MAX;
+		m_measMax[x] = INT32_MIN;
+	}
+}
+
+void MeasStatistics::add(const int16_t * samples, uint16_t sampleCount)
+{
+	if (sampleCount > MEAS_STATISTICS_CHANNELS) sampleCount = MEAS_STATISTICS_CHANNELS;
+	if (sampleCount != m_channels)
+	{
+		// the measurement setup changed, nothing so far applies
+		m_channels = sampleCount;
+		m_measurements = (sampleCount + m_readingsPerMeasurement - 1) / m_readingsPerMeasurement;
+		m_haveReference = false;
+		reset();
+	}
+
+	if (m_count == UINT32_MAX) return;  // Frames would wrap
+	m_count++;
+	double weight = 1.0 / m_count;
+
+	// Welford: mean += (x - mean) / n, m2 += (x - old mean) * (x - new mean)
+	for (uint16_t x = 0; x < sampleCount; x++)
+	{
+		double value = samples[x];
+		double delta = value - m_mean[x];
+		m_mean[x] += delta * weight;
+		m_m2[x] += delta * (value - m_mean[x]);
+	}
+	for (uint16_t x = 0; x < sampleCount; x++)
+	{
+		m_min[x] = (samples[x] < m_min[x]) ? samples[x] : m_min[x];
+		m_max[x] = (samples[x] > m_max[x]) ? samples[x] : m_max[x];
+	}
+
+	for (uint8_t m = 0; m < m_measurements; m++)
+	{
+		uint16_t first = m * m_readingsPerMeasurement;
+		uint16_t last = first + m_readingsPerMeasurement;
+		if (last > sampleCount) last = sampleCount;
+
+		int32_t sum = 0;
+		for (uint16_t x = first; x < last; x++) sum += samples[x];
+
+		double value = sum;
+		double delta = value - m_measMean[m];
+		m_measMean[m] += delta * weight;
+		m_measM2[m] += delta * (value - m_measMean[m]);
+		m_measMin[m] = (sum < m_measMin[m]) ? sum : m_measMin[m];
+		m_measMax[m] = (sum > m_measMax[m]) ? sum : m_measMax[m];
+	}
+}
+
+void MeasStatistics::captureReference(void)
+{
+	for (uint16_t x = 0; x < m_channels; x++)
+	{
+		m_referenceMean[x] = (float)m_mean[x];
+		m_referenceDeviation[x] = (m_count > 1) ? (float)sqrt(m_m2[x] / (m_count - 1)) : 0;
+	}
+	for (uint8_t m = 0; m < m_measurements; m++)
+	{
+		m_measReferenceMean[m] = (float)m_measMean[m];
+		m_measReferenceDeviation[m] = (m_count > 1) ? (float)sqrt(m_measM2[m] / (m_count - 1)) : 0;
+	}
+	m_haveReference = (m_count > 1);
+}
+
+void MeasStatistics::snapshot(uint32_t count, double mean, double m2, int32_t min, int32_t max, float referenceMean,
+	float referenceDeviation, MeasChannelStats_t & stats) const
+{
+	stats.count = count;
+	stats.mean = (float)mean;
+	double variance = (count > 1) ? m2 / (count - 1) : 0;  // sample variance
+	stats.variance = (float)variance;
+	stats.standardDeviation = (float)sqrt(variance);
+	stats.min = (count > 0) ? min : 0;
+	stats.max = (count > 0) ? max : 0;
+	stats.peakToPeak = (uint32_t)(stats.max - stats.min);
+	stats.snr = (m_haveReference && (referenceDeviation > 0)) ? (float)(fabs(mean - referenceMean) / referenceDeviation) : 0;
+}
+
+void MeasStatistics::channelSnapshot(uint16_t channel, MeasChannelStats_t & stats) const
+{
+	if (channel >= m_channels)
+	{
+		snapshot(0, 0, 0, 0, 0, 0, 0, stats);
+		return;
+	}
+	snapshot(m_count, m_mean[channel], m_m2[channel], m_min[channel], m_max[channel], 
+		m_referenceMean[channel], m_referenceDeviation[channel], stats);
+}
+
+void MeasStatistics::measurementSnapshot(uint8_t measurement, MeasChannelStats_t & stats) const
+{
+	if (measurement >= m_measurements)
+	{
+		snapshot(0, 0, 0, 0, 0, 0, 0, stats);
+		return;
+	}
+	snapshot(m_count, m_measMean[measurement], m_measM2[measurement], m_measMin[measurement], m_measMax[measurement],
+		m_measReferenceMean[measurement], m_measReferenceDeviation[measurement], stats);
+}
@@ -0,0 +1,76 @@
+#ifndef MEAS_STATISTICS_H
+#define MEAS_STATISTICS_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+#define MEAS_STATISTICS_CHANNELS (MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT)
+
+typedef struct {
+	uint32_t count;
+	float mean;
+	float variance;
+	float standardDeviation;
+	int32_t min;
+	int32_t max;
+	uint32_t peakToPeak;
+	float snr;  // |mean - reference mean| / reference standard deviation, 0 without a reference
+} MeasChannelStats_t;
+
+// Running statistics of CustomMeas frames, without keeping the frames.
+// Every reading is a channel. Each measurement (the sum of its readings) is tracked as well.
+// Mean and variance use Welford's update with double accumulators (the Teensy 4 FPU does
+// double in hardware). A float mean stops following the data after a few million frames,
+// once (x - mean) / n is below its resolution. With doubles the results are good for 1 to
+// 4294967295 frames, the range of Frames, and add() ignores frames past that. The accumulators are kept as separate
+// arrays (mean[], m2[], min[], max[]) so the per frame update is a few straight loops.
+//
+// For production SNR: run with no touch and call captureReference(), then reset() and run
+// with the touch, the snapshots then report SNR against the untouched noise.
+class MeasStatistics
+{
+public:
+	MeasStatistics();
+
+	const uint32_t &Frames{ m_count };
+	const uint16_t &Channels{ m_channels };
+	const uint8_t &Measurements{ m_measurements };
+
+	void begin(uint8_t readingsPerMeasurement);  // clears everything, the reference too
+	void reset(void);                            // clears the accumulators, keeps the reference
+	void add(const int16_t * samples, uint16_t sampleCount);  // a different sampleCount starts again
+	void captureReference(void);
+
+	void channelSnapshot(uint16_t channel, MeasChannelStats_t & stats) const;
+	void measurementSnapshot(uint8_t measurement, MeasChannelStats_t & stats) const;
+
+protected:
+	uint8_t m_readingsPerMeasurement;
+	uint16_t m_channels;
+	uint8_t m_measurements;
+	uint32_t m_count;
+	bool m_haveReference;
+
+	// per reading
+	double m_mean[MEAS_STATISTICS_CHANNELS];
+	double m_m2[MEAS_STATISTICS_CHANNELS];
+	int16_t m_min[MEAS_STATISTICS_CHANNELS];
+	int16_t m_max[MEAS_STATISTICS_CHANNELS];
+	float m_referenceMean[MEAS_STATISTICS_CHANNELS];
+	float m_referenceDeviation[MEAS_STATISTICS_CHANNELS];
+
+	// per measurement, the sum of its readings
+	double m_measMean[MAX_NUMBER_MEASUREMENTS];
+	double m_measM2[MAX_NUMBER_MEASUREMENTS];
+	int32_t m_measMin[MAX_NUMBER_MEASUREMENTS];
+	int32_t m_measMax[MAX_NUMBER_MEASUREMENTS];
+	float m_measReferenceMean[MAX_NUMBER_MEASUREMENTS];
+	float m_measReferenceDeviation[MAX_NUMBER_MEASUREMENTS];
+
+	void snapshot(uint32_t count, double mean, double m2, int32_t min, int32_t max, float referenceMean,
+		float referenceDeviation, MeasChannelStats_t & stats) const;
+};
+
+#endif // MEAS_STATISTICS_H
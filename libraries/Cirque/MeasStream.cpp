@@ -0,0 +1,257 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "MeasStream.h"
+
+static const uint16_t crcNibbleTable[16] =
+{
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+uint16_t measStreamCrc(const uint8_t * data, uint16_t length)
+{
+	// a nibble at a time, small table, fast enough for the packet rates here
+	uint16_t crc = 0xFFFF;
+	for (uint16_t x = 0; x < length; x++)
+	{
+		crc = (crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (data[x] >> 4)];
+		crc = (crc << 4) ^ crcNibbleTable[(crc >> 12) ^ (data[x] & 0x0F)];
+	}
+	return crc;
+}
+
+static uint16_t putVarint(uint8_t * buffer, uint16_t index, int32_t value)
+{
+	uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+	while (zigzag >= 0x80)
+	{
+		buffer[index++] = (uint8_t)(zigzag | 0x80);
+		zigzag >>= 7;
+	}
+	buffer[index++] = (uint8_t)zigzag;
+	return index;
+}
+
+// returns false if the varint runs past end
+static bool getVarint(const uint8_t * buffer, uint16_t &index, uint16_t end, int32_t &value)
+{
+	uint32_t zigzag = 0;
+	for (uint8_t shift = 0; shift < 21; shift += 7)
+	{
+		if (index >= end) return false;
+		uint8_t b = buffer[index++];
+		zigzag |= (uint32_t)(b & 0x7F) << shift;
+		if ((b & 0x80) == 0)
+		{
+			value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+			return true;
+		}
+	}
+	return false;
+}
+
+static void put16(uint8_t * buffer, uint16_t index, uint16_t value)
+{
+	buffer[index] = (uint8_t)value;
+	buffer[index + 1] = (uint8_t)(value >> 8);
+}
+
+static void put32(uint8_t * buffer, uint16_t index, uint32_t value)
+{
+	put16(buffer, index, (uint16_t)value);
+	put16(buffer, index + 2, (uint16_t)(value >> 16));
+}
+
+static uint16_t get16(const uint8_t * buffer, uint16_t index)
+{
+	return buffer[index] | (buffer[index + 1] << 8);
+}
+
+static uint32_t get32(const uint8_t * buffer, uint16_t index)
+{
+	return get16(buffer, index) | ((uint32_t)get16(buffer, index + 2) << 16);
+}
+
+MeasStreamEncoder::MeasStreamEncoder()
+{
+	m_packetNumber = 0;  // not restarted by begin(), so a receiver doesn't see a switch as lost packets
+	begin(false);
+}
+
+void MeasStreamEncoder::begin(bool compress)
+{
+	m_compress = compress;
+	m_packetsSinceKey = MEAS_STREAM_KEY_INTERVAL;
+	m_previousCount = 0;
+}
+
+uint16_t MeasStreamEncoder::encode(uint8_t * packet, uint32_t sequence, uint32_t timestamp_us, const int16_t * samples,
+	uint16_t sampleCount)
+{
+	if (sampleCount > MEAS_STREAM_MAX_SAMPLES) sampleCount = MEAS_STREAM_MAX_SAMPLES;
+
+	MeasStreamFormats format = MEAS_STREAM_RAW;
+	if (m_compress)
+	{
+		// key frames are sent regularly so a receiver that lost a packet can start again
+		bool key = (m_packetsSinceKey >= MEAS_STREAM_KEY_INTERVAL) || (sampleCount != m_previousCount);
+		format = key ? MEAS_STREAM_KEY : MEAS_STREAM_DELTA;
+		m_packetsSinceKey = key ? 1 : m_packetsSinceKey + 1;
+	}
+
+	uint16_t index = MEAS_STREAM_HEADER_LENGTH;
+	if (format == MEAS_STREAM_RAW)
+	{
+		for (uint16_t x = 0; x < sampleCount; x++)
+		{
+			put16(packet, index, (uint16_t)samples[x]);
+			index += 2;
+		}
+	}
+	else
+	{
+		int32_t reference = 0;
+		for (uint16_t x = 0; x < sampleCount; x++)
+		{
+			if (format == MEAS_STREAM_DELTA) reference = m_previous[x];
+			index = putVarint(packet, index, (int32_t)samples[x] - reference);
+			if (format == MEAS_STREAM_KEY) reference = samples[x];
+			m_previous[x] = samples[x];
+		}
+		m_previousCount = sampleCount;
+	}
+
+	packet[0] = MEAS_STREAM_SYNC0;
+	packet[1] = MEAS_STREAM_SYNC1;
+	packet[2] = format;
+	put16(packet, 3, m_packetNumber++);
+	put32(packet, 5, sequence);
+	put32(packet, 9, timestamp_us);
+	put16(packet, 13, sampleCount);
+	put16(packet, 15, index - MEAS_STREAM_HEADER_LENGTH);
+	put16(packet, index, measStreamCrc(&packet[2], index - 2));
+	return index + MEAS_STREAM_CRC_LENGTH;
+}
+
+MeasStreamDecoder::MeasStreamDecoder()
+{
+	reset();
+}
+
+void MeasStreamDecoder::reset(void)
+{
+	m_received = 0;
+	m_expected = MEAS_STREAM_HEADER_LENGTH;
+	m_haveSequence = false;
+	m_haveSamples = false;
+	m_packetNumber = 0;
+	m_sequence = 0;
+	m_timestamp_us = 0;
+	m_sampleCount = 0;
+	m_crcErrors = 0;
+	m_lostPackets = 0;
+	m_undecodable = 0;
+	m_skippedFrames = 0;
+}
+
+bool MeasStreamDecoder::push(uint8_t byte)
+{
+	// hunt for the sync word
+	if ((m_received == 0) && (byte != MEAS_STREAM_SYNC0)) return false;
+	if ((m_received == 1) && (byte != MEAS_STREAM_SYNC1))
+	{
+		m_received = (byte == MEAS_STREAM_SYNC0) ? 1 : 0;
+		return false;
+	}
+
+	m_packet[m_received++] = byte;
+	if (m_received == MEAS_STREAM_HEADER_LENGTH)
+	{
+		uint16_t payloadLength = get16(m_packet, 15);
+		if ((payloadLength > MEAS_STREAM_MAX_PAYLOAD) || (get16(m_packet, 13) > MEAS_STREAM_MAX_SAMPLES))
+		{
+			// not a real header, look for the next sync word
+			m_received = 0;
+			return false;
+		}
+		m_expected = MEAS_STREAM_HEADER_LENGTH + payloadLength + MEAS_STREAM_CRC_LENGTH;
+	}
+	if ((m_received < MEAS_STREAM_HEADER_LENGTH) || (m_received < m_expected)) return false;
+
+	m_received = 0;
+	m_expected = MEAS_STREAM_HEADER_LENGTH;
+	return decodePacket();
+}
+
+bool MeasStreamDecoder::decodePacket(void)
+{
+	uint16_t payloadLength = get16(m_packet, 15);
+	uint16_t end = MEAS_STREAM_HEADER_LENGTH + payloadLength;
+	if (get16(m_packet, end) != measStreamCrc(&m_packet[2], end - 2))
+	{
+		m_crcErrors++;
+		return false;
+	}
+
+	uint8_t format = m_packet[2];
+	uint16_t packetNumber = get16(m_packet, 3);
+	uint32_t sequence = get32(m_packet, 5);
+	uint16_t sampleCount = get16(m_packet, 13);
+	uint16_t missing = (uint16_t)(packetNumber - m_packetNumber - 1);
+	bool follows = m_haveSequence && (missing == 0);
+
+	if (m_haveSequence && (missing > 0) && (missing < 0x8000))
+	{
+		m_lostPackets += missing;
+	}
+	if (follows && (sequence - m_sequence > 1) && (sequence - m_sequence < 0x80000000UL))
+	{
+		// nothing was lost on the way, the device didn't measure those frames
+		m_skippedFrames += sequence - m_sequence - 1;
+	}
+	m_haveSequence = true;
+	m_packetNumber = packetNumber;
+	m_sequence = sequence;
+	m_timestamp_us = get32(m_packet, 9);
+
+	if ((format == MEAS_STREAM_DELTA) && !(follows && m_haveSamples && (sampleCount == m_sampleCount)))
+	{
+		// the reference packet is missing, wait for the next key frame
+		m_haveSamples = false;
+		m_undecodable++;
+		return false;
+	}
+
+	bool okay = true;
+	uint16_t index = MEAS_STREAM_HEADER_LENGTH;
+	if (format == MEAS_STREAM_RAW)
+	{
+		okay = (payloadLength == 2 * sampleCount);
+		for (uint16_t x = 0; okay && (x < sampleCount); x++)
+		{
+			m_samples[x] = (int16_t)get16(m_packet, index);
+			index += 2;
+		}
+	}
+	else if ((format == MEAS_STREAM_KEY) || (format == MEAS_STREAM_DELTA))
+	{
+		int32_t reference = 0;
+		for (uint16_t x = 0; okay && (x < sampleCount); x++)
+		{
+			int32_t delta = 0;
+			if (format == MEAS_STREAM_DELTA) reference = m_samples[x];
+			okay = getVarint(m_packet, index, end, delta);
+			m_samples[x] = (int16_t)(reference + delta);
+			if (format == MEAS_STREAM_KEY) reference = m_samples[x];
+		}
+	}
+	else
+	{
+		okay = false;
+	}
+
+	m_sampleCount = okay ? sampleCount : 0;
+	m_haveSamples = okay;
+	if (!okay) m_undecodable++;
+	return okay;
+}
@@ -0,0 +1,108 @@
+#ifndef MEAS_STREAM_H
+#define MEAS_STREAM_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+// Binary packets for streaming CustomMeas frames to a PC. Far smaller and cheaper than printing
+// the readings as text. Both ends are in this file, it has no Arduino dependencies, so a host
+// program can compile MeasStream.cpp as is.
+//
+// Packet, multi-byte values are little endian
+//  0, 1    -- sync, 0xA5 0x5A
+//  2       -- format (MeasStreamFormats)
+//  3, 4    -- packet number, counts every packet the encoder writes (wraps)
+//  5..8    -- sequence number (MeasFrame_t.sequence), jumps when the device missed frames
+//  9..12   -- timestamp, host microseconds
+//  13, 14  -- sample count
+//  15, 16  -- payload length
+//  17..    -- payload
+//  last 2  -- CRC-16/CCITT (poly 0x1021, init 0xFFFF) of bytes 2 through the end of the payload
+//
+// Payloads
+//  MEAS_STREAM_RAW       -- int16_t samples
+//  MEAS_STREAM_KEY       -- each sample minus the sample before it (the first minus 0),
+//                           zigzag encoded, then varint (7 bits per byte, LSB first)
+//  MEAS_STREAM_DELTA     -- each sample minus the same sample in the previous packet, zigzag varint.
+//                           Only valid if the previous packet (packet number - 1) was decoded.
+//                           A gap in the sequence number doesn't matter, the previous packet is
+//                           the previous frame that was sent.
+
+#define MEAS_STREAM_SYNC0 (0xA5)
+#define MEAS_STREAM_SYNC1 (0x5A)
+#define MEAS_STREAM_HEADER_LENGTH (17)
+#define MEAS_STREAM_CRC_LENGTH (2)
+#define MEAS_STREAM_MAX_SAMPLES (MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT)
+#define MEAS_STREAM_MAX_PAYLOAD (3 * MEAS_STREAM_MAX_SAMPLES)  // a zigzag varint of an int16_t is 3 bytes at most
+#define MEAS_STREAM_MAX_PACKET (MEAS_STREAM_HEADER_LENGTH + MEAS_STREAM_MAX_PAYLOAD + MEAS_STREAM_CRC_LENGTH)
+#define MEAS_STREAM_KEY_INTERVAL (32)  // packets between key frames when compressing
+
+enum MeasStreamFormats : uint8_t
+{
+	MEAS_STREAM_RAW = 0,
+	MEAS_STREAM_KEY = 1,
+	MEAS_STREAM_DELTA = 2,
+};
+
+uint16_t measStreamCrc(const uint8_t * data, uint16_t length);
+
+class MeasStreamEncoder
+{
+public:
+	MeasStreamEncoder();
+
+	void begin(bool compress);  // the next compressed packet will be a key frame
+	// writes one packet into packet (MEAS_STREAM_MAX_PACKET bytes), returns its length
+	uint16_t encode(uint8_t * packet, uint32_t sequence, uint32_t timestamp_us, const int16_t * samples, uint16_t sampleCount);
+
+protected:
+	bool m_compress;
+	uint16_t m_packetNumber;
+	uint8_t m_packetsSinceKey;
+	uint16_t m_previousCount;
+	int16_t m_previous[MEAS_STREAM_MAX_SAMPLES];
+};
+
+class MeasStreamDecoder
+{
+public:
+	MeasStreamDecoder();
+
+	const uint32_t &Sequence{ m_sequence };
+	const uint32_t &Timestamp_us{ m_timestamp_us };
+	const uint16_t &SampleCount{ m_sampleCount };
+	const int16_t * const Samples{ m_samples };
+
+	const uint32_t &CrcErrors{ m_crcErrors };
+	const uint32_t &LostPackets{ m_lostPackets };       // gaps in the packet numbers
+	const uint32_t &UndecodablePackets{ m_undecodable }; // delta packets that arrived without their previous packet
+	const uint32_t &SkippedFrames{ m_skippedFrames };   // frames the device missed, sequence gaps between packets that follow
+
+	void reset(void);
+	// feed the received bytes one at a time, true when a packet has been decoded into Samples
+	bool push(uint8_t byte);
+
+protected:
+	uint8_t m_packet[MEAS_STREAM_MAX_PACKET];
+	uint16_t m_received;
+	uint16_t m_expected;
+
+	bool m_haveSequence;
+	bool m_haveSamples;  // m_samples holds the packet before this one, deltas can be decoded
+	uint16_t m_packetNumber;
+	uint32_t m_sequence;
+	uint32_t m_timestamp_us;
+	uint16_t m_sampleCount;
+	int16_t m_samples[MEAS_STREAM_MAX_SAMPLES];
+
+	uint32_t m_crcErrors;
+	uint32_t m_lostPackets;
+	uint32_t m_undecodable;
+	uint32_t m_skippedFrames;
+
+	bool decodePacket(void);
+};
+
+#endif // MEAS_STREAM_H
@@ -0,0 +1,240 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "NoiseScan.h"
+#include <string.h>
+
+#define FFT_HEADROOM (16383)  // the largest input that can't overflow the first pass
+#define SPECTRUM_FRACTION_BITS (8)
+
+// sin(2 pi k / 64) for k = 0..16, Q15
+static const int16_t fftSine[NOISE_SCAN_FFT_LENGTH / 4 + 1] =
+{
+	0, 3212, 6393, 9512, 12539, 15446, 18204, 20787, 23170,
+	25329, 27245, 28898, 30273, 31356, 32137, 32609, 32767,
+};
+
+static inline int16_t multiplyQ15(int16_t a, int16_t b)
+{
+	return (int16_t)(((int32_t)a * b) >> 15);
+}
+
+void noiseScanFft(int16_t * re, int16_t * im)
+{
+	const uint16_t n = NOISE_SCAN_FFT_LENGTH;
+
+	// bit reversed order
+	for (uint16_t x = 1, y = 0; x < n; x++)
+	{
+		uint16_t bit = n >> 1;
+		for (; y & bit; bit >>= 1) y ^= bit;
+		y |= bit;
+		if (x < y)
+		{
+			int16_t t = re[x]; re[x] = re[y]; re[y] = t;
+			t = im[x]; im[x] = im[y]; im[y] = t;
+		}
+	}
+
+	for (uint16_t length = 2; length <= n; length <<= 1)
+	{
+		uint16_t half = length / 2;
+		uint16_t twiddleStep = n / length;
+		for (uint16_t j = 0; j < half; j++)
+		{
+			// w = exp(-2 pi i k / n), from the quarter wave table
+			uint16_t k = j * twiddleStep;
+			int16_t cosine = (k <= n / 4) ? fftSine[n / 4 - k] : -fftSine[k - n / 4];
+			int16_t sine = (k <= n / 4) ? fftSine[k] : fftSine[n / 2 - k];
+			for (uint16_t i = j; i < n; i += length)
+			{
+				uint16_t m = i + half;
+				int16_t tRe = multiplyQ15(re[m], cosine) + multiplyQ15(im[m], sine);
+				int16_t tIm = multiplyQ15(im[m], cosine) - multiplyQ15(re[m], sine);
+				int16_t uRe = re[i];
+				int16_t uIm = im[i];
+				re[i] = (int16_t)((uRe + tRe) >> 1);
+				im[i] = (int16_t)((uIm + tIm) >> 1);
+				re[m] = (int16_t)((uRe - tRe) >> 1);
+				im[m] = (int16_t)((uIm - tIm) >> 1);
+			}
+		}
+	}
+}
+
+NoiseScan::NoiseScan()
+{
+	m_running = false;
+	m_applyRecommended = false;
+	m_toggleFrequency = 0;
+	m_settingCount = 0;
+	m_haveSpectrum = 0;
+	m_spectrumChannel = NOISE_SCAN_NO_SPECTRUM;
+}
+
+bool NoiseScan::begin(uint8_t firstFrequency, uint8_t lastFrequency, uint8_t step, uint16_t framesPerSetting,
+	uint8_t settleFrames, bool applyRecommended)
+{
+	m_running = false;
+	if ((step == 0) || (lastFrequency < firstFrequency)) return false;
+	if (((lastFrequency - firstFrequency) / step) >= NOISE_SCAN_MAX_SETTINGS) return false;
+	if ((framesPerSetting < 2) || (framesPerSetting > NOISE_SCAN_MAX_FRAMES)) return false;
+
+	m_toggleFrequency = firstFrequency;
+	m_lastFrequency = lastFrequency;
+	m_step = step;
+	m_framesPerSetting = framesPerSetting;
+	m_settleFrames = settleFrames;
+	m_applyRecommended = applyRecommended;
+	m_settingCount = 0;
+	m_haveSpectrum = 0;
+	m_running = true;
+	startSetting();
+	return true;
+}
+
+void NoiseScan::setSpectrumChannel(uint16_t channel)
+{
+	m_spectrumChannel = channel;
+}
+
+void NoiseScan::stop(void)
+{
+	m_running = false;
+}
+
+void NoiseScan::startSetting(void)
+{
+	m_frames = 0;
+	m_count = 0;
+	m_settle = m_settleFrames;
+}
+
+bool NoiseScan::add(const int16_t * samples, uint16_t sampleCount)
+{
+	if (!m_running) return false;
+	if (m_settle > 0)
+	{
+		m_settle--;
+		return false;
+	}
+
+	if (sampleCount > NOISE_SCAN_CHANNELS) sampleCount = NOISE_SCAN_CHANNELS;
+	if ((m_frames == 0) || (sampleCount != m_count))
+	{
+		// first frame of the setting, or the frame size changed and the setting starts again
+		m_frames = 0;
+		m_count = sampleCount;
+		memcpy(m_origin, samples, sampleCount * sizeof(int16_t));
+		memset(m_sum, 0, sampleCount * sizeof(int32_t));
+		memset(m_sumSquares, 0, sampleCount * sizeof(int64_t));
+	}
+
+	for (uint16_t x = 0; x < sampleCount; x++)
+	{
+		int32_t difference = (int32_t)samples[x] - m_origin[x];
+		m_sum[x] += difference;
+		m_sumSquares[x] += (int64_t)difference * difference;
+	}
+	if ((m_spectrumChannel < sampleCount) && (m_frames < NOISE_SCAN_FFT_LENGTH))
+	{
+		m_spectrumSamples[m_frames] = samples[m_spectrumChannel];
+	}
+
+	if (++m_frames < m_framesPerSetting) return false;
+
+	finishSetting();
+	if ((uint16_t)m_toggleFrequency + m_step > m_lastFrequency)
+	{
+		m_running = false;
+	}
+	else
+	{
+		m_toggleFrequency += m_step;
+		startSetting();
+	}
+	return true;
+}
+
+void NoiseScan::finishSetting(void)
+{
+	NoiseScanResult_t & result = m_results[m_settingCount];
+	result.toggleFrequency = m_toggleFrequency;
+	result.frames = m_frames;
+	result.worstChannel = 0;
+	result.meanPower = 0;
+	result.maxPower = 0;
+
+	// variance = (n * sum(d^2) - sum(d)^2) / (n * (n - 1)), the numerator is exact in 64 bits
+	float divisor = (float)m_frames * (m_frames - 1);
+	float total = 0;
+	for (uint16_t x = 0; x < m_count; x++)
+	{
+		int64_t numerator = (int64_t)m_frames * m_sumSquares[x] - (int64_t)m_sum[x] * m_sum[x];
+		float power = (float)numerator / divisor;
+		total += power;
+		if (power > result.maxPower)
+		{
+			result.maxPower = power;
+			result.worstChannel = x;
+		}
+	}
+	if (m_count > 0) result.meanPower = total / m_count;
+
+	if ((m_spectrumChannel < m_count) && (m_frames >= NOISE_SCAN_FFT_LENGTH))
+	{
+		computeSpectrum(m_spectra[m_settingCount]);
+		m_haveSpectrum |= 1UL << m_settingCount;
+	}
+	m_settingCount++;
+}
+
+// power[k] = |DFT(k) / N|^2 in 1/256 counts^2, k = 0..N/2. With the DC removed, the bins
+// (1..N/2-1 counted twice) add up to the channel's variance.
+void NoiseScan::computeSpectrum(uint32_t * power)
+{
+	int32_t sum = 0;
+	for (uint16_t x = 0; x < NOISE_SCAN_FFT_LENGTH; x++) sum += m_spectrumSamples[x];
+	int32_t mean = sum / NOISE_SCAN_FFT_LENGTH;
+
+	// scale the input up as far as it goes, so small noise isn't lost to rounding in the passes
+	int16_t re[NOISE_SCAN_FFT_LENGTH];
+	int16_t im[NOISE_SCAN_FFT_LENGTH];
+	int32_t largest = 0;
+	for (uint16_t x = 0; x < NOISE_SCAN_FFT_LENGTH; x++)
+	{
+		int32_t difference = m_spectrumSamples[x] - mean;
+		if (difference > FFT_HEADROOM) difference = FFT_HEADROOM;
+		if (difference < -FFT_HEADROOM) difference = -FFT_HEADROOM;
+		re[x] = (int16_t)difference;
+		im[x] = 0;
+		if (difference < 0) difference = -difference;
+		if (difference > largest) largest = difference;
+	}
+	uint8_t shift = 0;
+	while ((shift < 14) && ((largest << (shift + 1)) <= FFT_HEADROOM)) shift++;
+	for (uint16_t x = 0; x < NOISE_SCAN_FFT_LENGTH; x++) re[x] = (int16_t)(re[x] << shift);
+
+	noiseScanFft(re, im);
+
+	for (uint16_t k = 0; k < NOISE_SCAN_SPECTRUM_BINS; k++)
+	{
+		uint64_t magnitude = (uint64_t)((int32_t)re[k] * re[k]) + (uint64_t)((int32_t)im[k] * im[k]);
+		power[k] = (uint32_t)((magnitude << SPECTRUM_FRACTION_BITS) >> (2 * shift));
+	}
+}
+
+uint8_t NoiseScan::recommended(void) const
+{
+	uint8_t best = NOISE_SCAN_NONE;
+	for (uint8_t x = 0; x < m_settingCount; x++)
+	{
+		if ((best == NOISE_SCAN_NONE) || (m_results[x].meanPower < m_results[best].meanPower)) best = x;
+	}
+	return best;
+}
+
+const uint32_t * NoiseScan::spectrum(uint8_t setting) const
+{
+	if ((setting >= m_settingCount) || !(m_haveSpectrum & (1UL << setting))) return 0;
+	return m_spectra[setting];
+}
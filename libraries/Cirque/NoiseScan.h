@@ -0,0 +1,93 @@
+#ifndef NOISE_SCAN_H
+#define NOISE_SCAN_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CustomMeas.h"
+
+#define NOISE_SCAN_CHANNELS (MAX_NUMBER_MEASUREMENTS * MAX_READINGS_PER_MEASUREMENT)
+#define NOISE_SCAN_MAX_SETTINGS (32)
+#define NOISE_SCAN_MAX_FRAMES (4096)  // per setting, keeps the sums in range
+#define NOISE_SCAN_FFT_LENGTH (64)    // frames in the spectrum, the first 64 of each setting
+#define NOISE_SCAN_SPECTRUM_BINS (NOISE_SCAN_FFT_LENGTH / 2 + 1)
+#define NOISE_SCAN_NO_SPECTRUM (0xFFFF)
+#define NOISE_SCAN_NONE (0xFF)
+
+typedef struct {
+	uint8_t toggleFrequency;
+	uint16_t frames;
+	uint16_t worstChannel;
+	float meanPower;  // noise power (variance, counts^2) averaged over the channels
+	float maxPower;   // noise power of worstChannel
+} NoiseScanResult_t;
+
+// In place fixed point FFT of NOISE_SCAN_FFT_LENGTH points. Each pass halves the values so
+// nothing overflows, the result is the DFT / NOISE_SCAN_FFT_LENGTH.
+void noiseScanFft(int16_t * re, int16_t * im);
+
+// Picks the quietest ToggleFrequency. A range of ToggleFrequency settings is measured one
+// after the other, framesPerSetting frames each, and the noise power (variance over the frames)
+// of every channel is worked out for each setting. The setting with the lowest mean power is
+// recommended. A spectrum of one channel can be kept for each setting as well, its bins run
+// from DC to half the frame rate.
+//
+// This is the analysis only, it has no Arduino or bus dependencies so it can be run on a PC
+// with synthetic frames. CustomMeas::beginNoiseScan and addNoiseScanFrame drive it from the
+// device: they write each ToggleFrequency and feed the frames in.
+// Take the frames with nothing touching the sensor, a touch looks like a lot of noise.
+class NoiseScan
+{
+public:
+	NoiseScan();
+
+	const bool &Running{ m_running };
+	const uint8_t &ToggleFrequency{ m_toggleFrequency };  // the setting being measured
+	const uint8_t &Settings{ m_settingCount };            // settings finished so far
+	const bool &ApplyRecommended{ m_applyRecommended };
+
+	// settleFrames are dropped after each change, while the device settles at the new frequency
+	bool begin(uint8_t firstFrequency, uint8_t lastFrequency, uint8_t step, uint16_t framesPerSetting,
+		uint8_t settleFrames = 2, bool applyRecommended = true);
+	void setSpectrumChannel(uint16_t channel);  // NOISE_SCAN_NO_SPECTRUM (default) for none
+	void stop(void);
+
+	// true when this frame finished a setting: measure the next ToggleFrequency, or, if
+	// Running is now false, the scan is done
+	bool add(const int16_t * samples, uint16_t sampleCount);
+
+	const NoiseScanResult_t & result(uint8_t setting) const { return m_results[setting]; }
+	uint8_t recommended(void) const;  // index into the results, NOISE_SCAN_NONE if there are none
+	const uint32_t * spectrum(uint8_t setting) const;  // NOISE_SCAN_SPECTRUM_BINS powers, 0 if not kept
+
+protected:
+	bool m_running;
+	bool m_applyRecommended;
+	uint8_t m_toggleFrequency;
+	uint8_t m_lastFrequency;
+	uint8_t m_step;
+	uint16_t m_framesPerSetting;
+	uint8_t m_settleFrames;
+	uint8_t m_settle;
+	uint16_t m_frames;
+	uint16_t m_count;
+	uint8_t m_settingCount;
+
+	// the sums are of the difference from the first frame, so they stay small
+	int16_t m_origin[NOISE_SCAN_CHANNELS];
+	int32_t m_sum[NOISE_SCAN_CHANNELS];
+	int64_t m_sumSquares[NOISE_SCAN_CHANNELS];
+
+	uint16_t m_spectrumChannel;
+	int16_t m_spectrumSamples[NOISE_SCAN_FFT_LENGTH];
+
+	NoiseScanResult_t m_results[NOISE_SCAN_MAX_SETTINGS];
+	uint32_t m_spectra[NOISE_SCAN_MAX_SETTINGS][NOISE_SCAN_SPECTRUM_BINS];
+	uint32_t m_haveSpectrum;  // a bit per setting
+
+	void startSetting(void);
+	void finishSetting(void);
+	void computeSpectrum(uint32_t * power);
+};
+
+#endif // NOISE_SCAN_H
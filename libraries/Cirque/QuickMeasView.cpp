@@ -0,0 +1,167 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "QuickMeasView.h"
+#include <cstring>
+
+#define QMV_RATE_WINDOW_US (1000000)
+
+QmvImageStore::QmvImageStore()
+{
+    begin(0, 0, 0, false);
+}
+
+bool QmvImageStore::begin(uint8_t sizeX, uint8_t sizeY, uint8_t channel, bool bigEndian)
+{
+    bool fits = ((uint16_t)sizeX * sizeY) <= QMV_MAX_IMAGE_PIXELS;
+    if (!fits)
+    {
+        sizeX = 0;
+        sizeY = 0;
+    }
+    m_sizeX = sizeX;
+    m_sizeY = sizeY;
+    m_imageByteLength = (uint16_t)sizeX * sizeY * 2;
+    m_channel = channel;
+    m_bigEndian = bigEndian;
+    memset(m_images, 0, sizeof(m_images));
+    m_front = 0;
+    m_frontFrameNumber = 0;
+    m_frontUnread = false;
+    resetCounters();
+    return fits;
+}
+
+void QmvImageStore::resetCounters(void)
+{
+    m_assembling = false;
+    m_haveFrameNumber = false;
+    m_backFrameNumber = 0;
+    m_backPixelsReceived = 0;
+    memset(m_backReceived, 0, sizeof(m_backReceived));
+    m_framesReceived = 0;
+    m_droppedFrames = 0;
+    m_unreadFrames = 0;
+    m_rateWindowStart_us = 0;
+    m_rateWindowFrames = 0;
+    m_frameRate_x10 = 0;
+}
+
+bool QmvImageStore::consume(const uint8_t * packet, uint16_t packetLength, uint32_t timestamp_us)
+{
+    if ((packetLength < QMV_HEADER_LENGTH) || (m_imageByteLength == 0)) return false;
+
+    uint16_t reportLength = packet[0] | (packet[1] << 8);
+    if ((packet[2] != QMV_REPORT_ID) || (reportLength < QMV_HEADER_LENGTH)) return false;
+    // chunks still in flight from a channel that was streamed before don't belong in this image
+    if (packet[3] != m_channel) return false;
+    // a report can't be longer than what was read
+    if (reportLength > packetLength) reportLength = packetLength;
+
+    uint16_t frameNumber = packet[4] | (packet[5] << 8);
+    uint16_t byteOffset = packet[6] | (packet[7] << 8);
+    uint16_t chunkLength = reportLength - QMV_HEADER_LENGTH;
+
+    if (!m_assembling || (frameNumber != m_backFrameNumber))
+    {
+        // new frame, whatever was being assembled is lost
+        if (m_assembling)
+        {
+            m_droppedFrames++;
+        }
+        startFrame(frameNumber);
+    }
+
+    // pixels must land on pixel boundaries inside the image
+    if ((byteOffset & 1) || (byteOffset >= m_imageByteLength)) return false;
+    if (chunkLength > (m_imageByteLength - byteOffset))
+    {
+        chunkLength = m_imageByteLength - byteOffset;
+    }
+
+    int16_t * image = m_images[m_front ^ 1];
+    const uint8_t * data = &packet[QMV_HEADER_LENGTH];
+    for (uint16_t x = byteOffset / 2; x < (byteOffset + chunkLength) / 2; x++)
+    {
+        image[x] = m_bigEndian ? (int16_t)((data[0] << 8) | data[1]) : (int16_t)(data[0] | (data[1] << 8));
+        data += 2;
+
+        // only pixels that haven't arrived yet count towards the image
+        uint32_t bit = 1UL << (x & 31);
+        if ((m_backReceived[x / 32] & bit) == 0)
+        {
+            m_backReceived[x / 32] |= bit;
+            m_backPixelsReceived++;
+        }
+    }
+
+    if (m_backPixelsReceived >= m_imageByteLength / 2)
+    {
+        finishFrame(timestamp_us);
+        return true;
+    }
+    return false;
+}
+
+void QmvImageStore::startFrame(uint16_t frameNumber)
+{
+    if (m_haveFrameNumber)
+    {
+        // frames the device made that never showed up at all
+        uint16_t expected = m_backFrameNumber + 1;
+        uint16_t missing = frameNumber - expected;
+        if (missing < 0x8000)  // otherwise the frame number went backwards (device reset), just resync
+        {
+            m_droppedFrames += missing;
+        }
+    }
+    m_haveFrameNumber = true;
+    m_assembling = true;
+    m_backFrameNumber = frameNumber;
+    m_backPixelsReceived = 0;
+    memset(m_backReceived, 0, sizeof(m_backReceived));
+}
+
+void QmvImageStore::finishFrame(uint32_t timestamp_us)
+{
+    m_assembling = false;
+    if (m_frontUnread)
+    {
+        m_unreadFrames++;
+    }
+    m_front ^= 1;
+    m_frontFrameNumber = m_backFrameNumber;
+    m_frontUnread = true;
+    m_framesReceived++;
+
+    // frame rate over (roughly) one second windows
+    if (m_rateWindowFrames == 0)
+    {
+        m_rateWindowStart_us = timestamp_us;
+    }
+    m_rateWindowFrames++;
+    uint32_t elapsed_us = timestamp_us - m_rateWindowStart_us;
+    if (elapsed_us >= QMV_RATE_WINDOW_US)
+    {
+        // frames counted from the first frame of the window, so there are (frames - 1) intervals
+        m_frameRate_x10 = (uint16_t)(((uint64_t)(m_rateWindowFrames - 1) * 10 * 1000000) / elapsed_us);
+        m_rateWindowStart_us = timestamp_us;
+        m_rateWindowFrames = 1;
+    }
+}
+
+bool QmvImageStore::imageAvailable(void) const
+{
+    return m_frontUnread;
+}
+
+const int16_t * QmvImageStore::image(void)
+{
+    m_frontUnread = false;
+    return m_images[m_front];
+}
+
+int16_t QmvImageStore::pixel(uint8_t x, uint8_t y) const
+{
+    if ((x >= m_sizeX) || (y >= m_sizeY)) return 0;
+    return m_images[m_front][(uint16_t)y * m_sizeX + x];
+}
@@ -0,0 +1,89 @@
+#ifndef QUICK_MEAS_VIEW_H
+#define QUICK_MEAS_VIEW_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+
+#define QMV_MAX_IMAGE_PIXELS (30 * 16)  // largest Gen6 sensor
+
+// QMV image reports
+// The image of one frame is larger than a HID report, so it arrives in chunks.
+// Every chunk says which frame it belongs to and where its pixels go in the image.
+// UNVERIFIED: this layout is a placeholder, nothing in this tree documents it (API_C3 only has
+// SetQMVStream, which turns the stream on). Confirm bytes 3..7 and the report ID against the
+// firmware before relying on the images.
+// 0, 1 -- report size
+// 2    -- report ID (QMV_REPORT_ID)
+// 3    -- QMV channel number (QMVChannelNumbers)
+// 4, 5 -- frame number, increments once per sensor frame
+// 6, 7 -- byte offset of this chunk in the image
+// 8..  -- pixels, int16_t in the device's byte order (CirqueHid::endianState), row major (x changes fastest)
+#ifndef QMV_REPORT_ID
+#define QMV_REPORT_ID (240)  // assumed to be the GuisePipe report id (commented out in HidStructs.h), projects may redefine this
+#endif
+#define QMV_HEADER_LENGTH (8)
+
+// Double buffered store for the sensor images streamed by QuickMeasView.
+// Chunks are assembled into the back buffer, when every pixel of a frame has arrived the
+// buffers swap and the finished image can be read from the front buffer while the
+// next frame is assembled. A chunk that arrives twice (or overlaps another) only counts once.
+class QmvImageStore
+{
+public:
+    QmvImageStore();
+
+    const uint8_t &SizeX {m_sizeX};
+    const uint8_t &SizeY {m_sizeY};
+    const uint16_t &FrameNumber {m_frontFrameNumber};   // frame number of the front image
+    const uint32_t &FramesReceived {m_framesReceived};  // complete images
+    const uint32_t &DroppedFrames {m_droppedFrames};    // frames the device sent that never completed here
+    const uint32_t &UnreadFrames {m_unreadFrames};      // complete images replaced before the app read them
+    const uint16_t &FrameRate_x10 {m_frameRate_x10};    // frames per second, times 10
+
+    // sizeX * sizeY must be <= QMV_MAX_IMAGE_PIXELS, returns false if it doesn't fit
+    // channel is the one setQMVStream turned on, chunks of any other channel are dropped
+    // bigEndian is CirqueHid::endianState
+    bool begin(uint8_t sizeX, uint8_t sizeY, uint8_t channel, bool bigEndian);
+
+    // consume one QMV report, returns true if it completed an image
+    // timestamp_us is the host time the report was read, it is only used for the frame rate
+    bool consume(const uint8_t * packet, uint16_t packetLength, uint32_t timestamp_us);
+
+    bool imageAvailable(void) const;
+    // the most recent complete image, row major, SizeX * SizeY pixels. Marks the image as read.
+    const int16_t * image(void);
+    int16_t pixel(uint8_t x, uint8_t y) const;
+
+    void resetCounters(void);
+
+protected:
+    int16_t m_images[2][QMV_MAX_IMAGE_PIXELS];
+    uint8_t m_front;  // index of the complete image in m_images, the other one is being assembled
+    uint8_t m_sizeX;
+    uint8_t m_sizeY;
+    uint16_t m_imageByteLength;
+    uint8_t m_channel;
+    bool m_bigEndian;
+
+    bool m_assembling;
+    uint16_t m_backFrameNumber;
+    uint16_t m_backPixelsReceived;
+    uint32_t m_backReceived[(QMV_MAX_IMAGE_PIXELS + 31) / 32];  // a bit per pixel that has arrived
+    uint16_t m_frontFrameNumber;
+    bool m_frontUnread;
+    bool m_haveFrameNumber;
+
+    uint32_t m_framesReceived;
+    uint32_t m_droppedFrames;
+    uint32_t m_unreadFrames;
+
+    uint32_t m_rateWindowStart_us;
+    uint16_t m_rateWindowFrames;
+    uint16_t m_frameRate_x10;
+
+    void startFrame(uint16_t frameNumber);
+    void finishFrame(uint32_t timestamp_us);
+};
+
+#endif // QUICK_MEAS_VIEW_H
@@ -26,3 +26,26 @@ uint32_t ResponseReader::next32bits(uint8_t * packet, uint16_t &packetIndex)
 	return result;
 }
 
+uint16_t ResponseReader::next16bits(uint8_t * packet, uint16_t &packetIndex, bool bigEndian)
+{
+	if (!bigEndian) return next16bits(packet, packetIndex);
+
+	// high byte at low address
+	uint16_t result = packet[packetIndex++] << 8;
+	result |= packet[packetIndex++];
+
+	return result;
+}
+
+uint32_t ResponseReader::next32bits(uint8_t * packet, uint16_t &packetIndex, bool bigEndian)
+{
+	if (!bigEndian) return next32bits(packet, packetIndex);
+
+	// high byte at low address
+	uint32_t result = (uint32_t)packet[packetIndex++] << 24;
+	result |= packet[packetIndex++] << 16;
+	result |= packet[packetIndex++] << 8;
+	result |= packet[packetIndex++];
+
+	return result;
+}
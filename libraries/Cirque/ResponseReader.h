@@ -14,6 +14,9 @@ protected:
 	uint8_t next8bits(uint8_t * packet, uint16_t &packetIndex);
 	uint16_t next16bits(uint8_t * packet, uint16_t &packetIndex);
 	uint32_t next32bits(uint8_t * packet, uint16_t &packetIndex);
+	// the same, in the device's order (its config registers can be big endian, see CirqueHid::endianState)
+	uint16_t next16bits(uint8_t * packet, uint16_t &packetIndex, bool bigEndian);
+	uint32_t next32bits(uint8_t * packet, uint16_t &packetIndex, bool bigEndian);
 };
 
 #endif  // RESPONSE_READER_H
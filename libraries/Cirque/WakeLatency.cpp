@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include "WakeLatency.h"
+
+WakeLatency::WakeLatency()
+{
+    reset();
+}
+
+void WakeLatency::reset(void)
+{
+    m_waitingForDr = false;
+    m_touchState = STATE_ACTIVE;
+    m_touchTimestamp_us = 0;
+    for (uint8_t x = 0; x < STATE_COUNT; x++)
+    {
+        m_samples[x] = 0;
+        m_min_us[x] = 0;
+        m_max_us[x] = 0;
+        m_total_us[x] = 0;
+    }
+}
+
+WakeLatency::PowerStates WakeLatency::stateAfterQuiet(uint32_t quiet_ms, const PowerSettings_t & powerSettings, 
+    bool forcedSleep)
+{
+    if (forcedSleep) return STATE_SLEEP;
+
+    uint32_t beforeIdle_ms = (uint32_t)powerSettings.timeBeforeIdle_100ms * 100;
+    uint32_t beforeSleep_ms = (uint32_t)powerSettings.timeBeforeSleep_100ms * 100;
+    bool idleEnabled = !(powerSettings.settings & POWER_SETTING_DISABLE_IDLE_SLEEP);
+    bool sleepEnabled = !(powerSettings.settings & POWER_SETTING_DISABLE_DEEP_SLEEP);
+
+    // deep sleep follows idle, timeBeforeSleep counts from the last touch like timeBeforeIdle
+    if (sleepEnabled && (quiet_ms >= beforeSleep_ms)) return STATE_SLEEP;
+    if (idleEnabled && (quiet_ms >= beforeIdle_ms)) return STATE_IDLE;
+    return STATE_ACTIVE;
+}
+
+void WakeLatency::touch(uint32_t timestamp_us, PowerStates state)
+{
+    if (m_waitingForDr) return;  // bounce, or a second touch before DR
+    m_touchTimestamp_us = timestamp_us;
+    m_touchState = state;
+    m_waitingForDr = true;
+}
+
+bool WakeLatency::dataReady(uint32_t timestamp_us)
+{
+    if (!m_waitingForDr) return false;
+    uint32_t latency_us = timestamp_us - m_touchTimestamp_us;  // wraps correctly
+    if ((int32_t)latency_us < 0) return false;  // the edge of a report that was pending before the touch
+    m_waitingForDr = false;
+
+    uint8_t x = m_touchState;
+    if ((m_samples[x] == 0) || (latency_us < m_min_us[x])) m_min_us[x] = latency_us;
+    if ((m_samples[x] == 0) || (latency_us > m_max_us[x])) m_max_us[x] = latency_us;
+    m_total_us[x] += latency_us;
+    m_samples[x]++;
+    return true;
+}
+
+uint32_t WakeLatency::mean_us(PowerStates state) const
+{
+    return (m_samples[state] > 0) ? m_total_us[state] / m_samples[state] : 0;
+}
@@ -0,0 +1,54 @@
+#ifndef WAKE_LATENCY_H
+#define WAKE_LATENCY_H
+
+// Copyright (c) 2025 Cirque Corp. Restrictions apply. See: www.cirque.com/sw-license
+
+#include <stdint.h>
+#include "CirqueHidConfig.h"
+
+// Measures the time from a touch to the first data ready (DR) edge, sorted by the power
+// state the device was in when the touch happened. The state is worked out from how long
+// the device has been quiet and the power settings, so the idle and sleep timings can be
+// picked from data.
+//
+// The caller supplies the timestamps, both taken in interrupts: touch() with the time of
+// the touch (an external stimulus, see TOUCH_TRIGGER_PIN in the Gen6 demo), and
+// dataReady() with the time of the DR edge. Only the first DR edge after each touch is
+// measured, so the host's I2C read of the report isn't part of the latency.
+class WakeLatency
+{
+public:
+    enum PowerStates
+    {
+        STATE_ACTIVE = 0,
+        STATE_IDLE = 1,
+        STATE_SLEEP = 2,
+        STATE_COUNT = 3
+    };
+
+    WakeLatency();
+
+    void reset(void);
+    // quiet_ms is the time since the previous report, forcedSleep is set when the host put the device to sleep
+    static PowerStates stateAfterQuiet(uint32_t quiet_ms, const PowerSettings_t & powerSettings, bool forcedSleep);
+
+    void touch(uint32_t timestamp_us, PowerStates state);
+    bool dataReady(uint32_t timestamp_us);  // true when a sample was recorded
+
+    uint16_t samples(PowerStates state) const { return m_samples[state]; }
+    uint32_t min_us(PowerStates state) const { return m_min_us[state]; }
+    uint32_t max_us(PowerStates state) const { return m_max_us[state]; }
+    uint32_t mean_us(PowerStates state) const;
+
+protected:
+    bool m_waitingForDr;
+    PowerStates m_touchState;
+    uint32_t m_touchTimestamp_us;
+
+    uint16_t m_samples[STATE_COUNT];
+    uint32_t m_min_us[STATE_COUNT];
+    uint32_t m_max_us[STATE_COUNT];
+    uint32_t m_total_us[STATE_COUNT];
+};
+
+#endif // WAKE_LATENCY_H